@@ -31,26 +31,60 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "EPICSCAInput.h"
-#include "MemoryMapInputBroker.h"
+#include "EPICSCAInputBroker.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe {
+/**
+ * Number of times that Synchronise tries to copy a PV before locking its writer.
+ */
+static const uint32 EPICSCA_INPUT_SNAPSHOT_RETRIES = 8u;
+
+/**
+ * @brief Full memory barrier between the buffer and the sequence accesses.
+ */
+/*lint -estring(526,__sync_synchronize) -estring(628,__sync_synchronize) -estring(746,__sync_synchronize) -estring(1055,__sync_synchronize) The __sync_synchronize function is a GCC built-in function, so it does not have declaration.*/
+static inline void EPICSCAInputBarrier() {
+    __sync_synchronize();
+}
+
 /**
  * @brief Callback function for the ca_create_subscription. Single point of access which
- * delegates the events to the corresponding EPICSPV instance.
+ * delegates the events to the corresponding EPICSCAInputPV double buffer.
  */
-static FastPollingMutexSem eventCallbackFastMux;
 /*lint -e{1746} function must match required prototype and thus cannot be changed to constant reference.*/
 void EPICSCAInputEventCallback(struct event_handler_args const args) {
-    (void) eventCallbackFastMux.FastLock();
-    PVWrapper *pv = static_cast<PVWrapper *>(args.usr);
-    if (pv != NULL_PTR(PVWrapper *)) {
-        (void) MemoryOperationsHelper::Copy(pv->memory, args.dbr, pv->memorySize);
+    EPICSCAInputPV *inputPV = static_cast<EPICSCAInputPV *>(args.usr);
+    bool ok = (inputPV != NULL_PTR(EPICSCAInputPV *));
+    if (ok) {
+        ok = ((args.status == ECA_NORMAL) && (args.dbr != NULL_PTR(const void *)));
+    }
+    if (ok) {
+        (void) inputPV->writeMux.FastLock();
+        uint32 writeIdx = (1u - inputPV->published);
+        if (inputPV->buffer[writeIdx] != NULL_PTR(void *)) {
+            inputPV->sequence++;
+            EPICSCAInputBarrier();
+            /*lint -e{9005} -e{9079} -e{929} -e{826} all the dbr_time_ structures start with the status, the severity and the stamp.*/
+            const epicsTimeStamp &stamp = static_cast<const struct dbr_time_double *>(args.dbr)->stamp;
+            uint64 timestamp = static_cast<uint64>(stamp.secPastEpoch) + static_cast<uint64>(POSIX_TIME_AT_EPICS_EPOCH);
+            timestamp *= 1000000000ULL;
+            timestamp += static_cast<uint64>(stamp.nsec);
+            /*lint -e{9005} -e{9079} -e{929} dbr_value_ptr is provided by the EPICS API*/
+            (void) MemoryOperationsHelper::Copy(inputPV->buffer[writeIdx], dbr_value_ptr(args.dbr, args.type), inputPV->pv->memorySize);
+            inputPV->bufferTimestamp[writeIdx] = timestamp;
+            EPICSCAInputBarrier();
+            inputPV->published = writeIdx;
+            inputPV->updates++;
+            EPICSCAInputBarrier();
+            inputPV->sequence++;
+        }
+        inputPV->writeMux.FastUnLock();
     }
-    eventCallbackFastMux.FastUnLock();
 }
 }
 /*---------------------------------------------------------------------------*/
@@ -60,9 +94,11 @@ namespace MARTe {
 EPICSCAInput::EPICSCAInput() :
         DataSourceI(), EmbeddedServiceMethodBinderI(), executor(*this) {
     pvs = NULL_PTR(PVWrapper *);
+    inputPVs = NULL_PTR(EPICSCAInputPV *);
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
-    eventCallbackFastMux.Create();
+    snapshotNumber = 0u;
+    (void) snapshotMux.Create();
 }
 
 /*lint -e{1551} must stop the SingleThreadService in the destructor.*/
@@ -72,8 +108,21 @@ EPICSCAInput::~EPICSCAInput() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
-    (void) eventCallbackFastMux.FastLock();
     uint32 nOfSignals = GetNumberOfSignals();
+    if (inputPVs != NULL_PTR(EPICSCAInputPV *)) {
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            (void) inputPVs[n].writeMux.FastLock();
+            uint32 b;
+            for (b = 0u; b < 2u; b++) {
+                if (inputPVs[n].buffer[b] != NULL_PTR(void *)) {
+                    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(inputPVs[n].buffer[b]);
+                }
+            }
+            inputPVs[n].writeMux.FastUnLock();
+        }
+        delete[] inputPVs;
+    }
     if (pvs != NULL_PTR(PVWrapper *)) {
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
@@ -83,7 +132,6 @@ EPICSCAInput::~EPICSCAInput() {
         }
         delete[] pvs;
     }
-    eventCallbackFastMux.FastUnLock();
 }
 
 bool EPICSCAInput::Initialise(StructuredDataI & data) {
@@ -155,9 +203,26 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
     }
     if (ok) {
         pvs = new PVWrapper[nOfSignals];
+        inputPVs = new EPICSCAInputPV[nOfSignals];
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
             pvs[n].memory = NULL_PTR(void *);
+            pvs[n].pvChid = NULL_PTR(chid);
+            pvs[n].pvEvid = NULL_PTR(evid);
+            inputPVs[n].pv = &pvs[n];
+            inputPVs[n].field = EPICSCA_INPUT_FIELD_VALUE;
+            inputPVs[n].valueIdx = n;
+            inputPVs[n].buffer[0u] = NULL_PTR(void *);
+            inputPVs[n].buffer[1u] = NULL_PTR(void *);
+            inputPVs[n].bufferTimestamp[0u] = 0u;
+            inputPVs[n].bufferTimestamp[1u] = 0u;
+            inputPVs[n].published = 0u;
+            inputPVs[n].sequence = 0u;
+            inputPVs[n].updates = 0u;
+            inputPVs[n].timestamp = 0u;
+            inputPVs[n].snapshotUpdates = 0u;
+            inputPVs[n].previousSnapshotUpdates = 0u;
+            (void) inputPVs[n].writeMux.Create();
         }
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
             //Note that the RealTimeApplicationConfigurationBuilder is allowed to change the order of the signals w.r.t. to the originalSignalInformation
@@ -176,11 +241,40 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
                     REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
                 }
             }
+            StreamString field;
+            if (ok) {
+                if (originalSignalInformation.Read("Field", field)) {
+                    if (field == "Timestamp") {
+                        inputPVs[n].field = EPICSCA_INPUT_FIELD_TIMESTAMP;
+                    }
+                    else if (field == "Updated") {
+                        inputPVs[n].field = EPICSCA_INPUT_FIELD_UPDATED;
+                    }
+                    else {
+                        ok = (field == "Value");
+                        if (!ok) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "Field %s is not supported. Use Value, Timestamp or Updated", field.Buffer());
+                        }
+                    }
+                }
+            }
             TypeDescriptor td = GetSignalType(n);
             if (ok) {
                 pvs[n].td = td;
                 (void) StringHelper::CopyN(&pvs[n].pvName[0], pvName.Buffer(), PV_NAME_MAX_SIZE);
-                if (td == CharString) {
+                if (inputPVs[n].field == EPICSCA_INPUT_FIELD_TIMESTAMP) {
+                    ok = (td == UnsignedInteger64Bit);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The Timestamp signal of PV %s shall be uint64", pvName.Buffer());
+                    }
+                }
+                else if (inputPVs[n].field == EPICSCA_INPUT_FIELD_UPDATED) {
+                    ok = (td == UnsignedInteger32Bit);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The Updated signal of PV %s shall be uint32", pvName.Buffer());
+                    }
+                }
+                else if (td == CharString) {
                     pvs[n].pvType = DBR_STRING;
                 }
                 else if (td == Character8Bit) {
@@ -220,7 +314,13 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
                 ok = GetSignalNumberOfElements(n, numberOfElements);
             }
             if (ok) {
-                if (pvs[n].pvType == DBR_STRING) {
+                if (inputPVs[n].field != EPICSCA_INPUT_FIELD_VALUE) {
+                    ok = (numberOfElements == 1u);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The %s signal of PV %s shall have one element", field.Buffer(), pvName.Buffer());
+                    }
+                }
+                else if (pvs[n].pvType == DBR_STRING) {
                     ok = (numberOfElements == 40u);
                 }
                 if (!ok) {
@@ -236,9 +336,36 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
                 pvs[n].memorySize /= 8u;
                 pvs[n].memorySize *= numberOfElements;
                 pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                (void) MemoryOperationsHelper::Set(pvs[n].memory, '\0', pvs[n].memorySize);
+                if (inputPVs[n].field == EPICSCA_INPUT_FIELD_VALUE) {
+                    uint32 b;
+                    for (b = 0u; b < 2u; b++) {
+                        inputPVs[n].buffer[b] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                        (void) MemoryOperationsHelper::Set(inputPVs[n].buffer[b], '\0', pvs[n].memorySize);
+                    }
+                }
                 ok = originalSignalInformation.MoveToAncestor(1u);
             }
         }
+        //The Timestamp and Updated signals are read from a value signal of the same PV
+        for (n = 0u; (n < nOfSignals) && (ok); n++) {
+            if (inputPVs[n].field != EPICSCA_INPUT_FIELD_VALUE) {
+                bool found = false;
+                uint32 v;
+                for (v = 0u; (v < nOfSignals) && (!found); v++) {
+                    if (inputPVs[v].field == EPICSCA_INPUT_FIELD_VALUE) {
+                        found = (StringHelper::Compare(&pvs[v].pvName[0], &pvs[n].pvName[0]) == 0);
+                        if (found) {
+                            inputPVs[n].valueIdx = v;
+                        }
+                    }
+                }
+                ok = found;
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "No value signal defined for PV %s", pvs[n].pvName);
+                }
+            }
+        }
     }
 
     if (ok) {
@@ -273,13 +400,13 @@ bool EPICSCAInput::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bu
 const char8* EPICSCAInput::GetBrokerName(StructuredDataI& data, const SignalDirection direction) {
     const char8* brokerName = "";
     if (direction == InputSignals) {
-        brokerName = "MemoryMapInputBroker";
+        brokerName = "EPICSCAInputBroker";
     }
     return brokerName;
 }
 
 bool EPICSCAInput::GetInputBrokers(ReferenceContainer& inputBrokers, const char8* const functionName, void* const gamMemPtr) {
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+    ReferenceT<EPICSCAInputBroker> broker("EPICSCAInputBroker");
     bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
     if (ok) {
         ok = inputBrokers.Insert(broker);
@@ -301,7 +428,6 @@ bool EPICSCAInput::PrepareNextState(const char8* const currentStateName, const c
 ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (info.GetStage() == ExecutionInfo::StartupStage) {
-        (void) eventCallbackFastMux.FastLock();
         /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
         if (ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL) {
             err = ErrorManagement::FatalError;
@@ -310,42 +436,44 @@ ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
 
         uint32 n;
         uint32 nOfSignals = GetNumberOfSignals();
-        if (pvs != NULL_PTR(PVWrapper *)) {
+        if ((pvs != NULL_PTR(PVWrapper *)) && (inputPVs != NULL_PTR(EPICSCAInputPV *))) {
             for (n = 0u; (n < nOfSignals); n++) {
-                /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                if (ca_create_channel(&pvs[n].pvName[0], NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvs[n].pvChid) != ECA_NORMAL) {
-                    err = ErrorManagement::FatalError;
-                    REPORT_ERROR(err, "ca_create_channel failed for PV with name %s", pvs[n].pvName);
-                }
-                if (err.ErrorsCleared()) {
+                //Only the value signals subscribe to the PV. The DBR_TIME_ types also carry the EPICS timestamp.
+                if (inputPVs[n].field == EPICSCA_INPUT_FIELD_VALUE) {
                     /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                    if (ca_create_subscription(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, DBE_VALUE, &EPICSCAInputEventCallback, &pvs[n],
-                                               &pvs[n].pvEvid) != ECA_NORMAL) {
+                    if (ca_create_channel(&pvs[n].pvName[0], NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvs[n].pvChid) != ECA_NORMAL) {
                         err = ErrorManagement::FatalError;
-                        REPORT_ERROR(err, "ca_create_subscription failed for PV %s", pvs[n].pvName);
+                        REPORT_ERROR(err, "ca_create_channel failed for PV with name %s", pvs[n].pvName);
+                    }
+                    if (err.ErrorsCleared()) {
+                        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+                        if (ca_create_subscription(dbf_type_to_DBR_TIME(pvs[n].pvType), pvs[n].numberOfElements, pvs[n].pvChid, DBE_VALUE,
+                                                   &EPICSCAInputEventCallback, &inputPVs[n], &pvs[n].pvEvid) != ECA_NORMAL) {
+                            err = ErrorManagement::FatalError;
+                            REPORT_ERROR(err, "ca_create_subscription failed for PV %s", pvs[n].pvName);
+                        }
                     }
                 }
             }
         }
-        eventCallbackFastMux.FastUnLock();
     }
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
         Sleep::Sec(1.0F);
     }
     else {
-        (void) eventCallbackFastMux.FastLock();
         uint32 n;
         uint32 nOfSignals = GetNumberOfSignals();
         if (pvs != NULL_PTR(PVWrapper *)) {
             for (n = 0u; (n < nOfSignals); n++) {
-                (void) ca_clear_subscription(pvs[n].pvEvid);
-                (void) ca_clear_event(pvs[n].pvEvid);
-                (void) ca_clear_channel(pvs[n].pvChid);
+                if (pvs[n].pvChid != NULL_PTR(chid)) {
+                    (void) ca_clear_subscription(pvs[n].pvEvid);
+                    (void) ca_clear_event(pvs[n].pvEvid);
+                    (void) ca_clear_channel(pvs[n].pvChid);
+                }
             }
         }
         ca_detach_context();
         ca_context_destroy();
-        eventCallbackFastMux.FastUnLock();
     }
 
     return err;
@@ -360,7 +488,93 @@ uint32 EPICSCAInput::GetCPUMask() const {
 }
 
 bool EPICSCAInput::Synchronise() {
-    return false;
+    bool ok = (snapshotMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        ok = TakeSnapshot();
+        snapshotNumber++;
+        snapshotMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool EPICSCAInput::LockSnapshot(uint32 &readSnapshot) {
+    bool ok = (snapshotMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        //The caller already copied the current snapshot: this is a new cycle.
+        if (readSnapshot == snapshotNumber) {
+            ok = TakeSnapshot();
+            snapshotNumber++;
+        }
+        readSnapshot = snapshotNumber;
+        if (!ok) {
+            snapshotMux.FastUnLock();
+        }
+    }
+    return ok;
+}
+
+void EPICSCAInput::UnlockSnapshot() {
+    snapshotMux.FastUnLock();
+}
+
+bool EPICSCAInput::TakeSnapshot() {
+    bool ok = ((pvs != NULL_PTR(PVWrapper *)) && (inputPVs != NULL_PTR(EPICSCAInputPV *)));
+    if (ok) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            if (inputPVs[n].field == EPICSCA_INPUT_FIELD_VALUE) {
+                Snapshot(n);
+            }
+        }
+        for (n = 0u; (n < nOfSignals); n++) {
+            const EPICSCAInputPV &valuePV = inputPVs[inputPVs[n].valueIdx];
+            if (inputPVs[n].field == EPICSCA_INPUT_FIELD_TIMESTAMP) {
+                *static_cast<uint64 *>(pvs[n].memory) = valuePV.timestamp;
+            }
+            else if (inputPVs[n].field == EPICSCA_INPUT_FIELD_UPDATED) {
+                *static_cast<uint32 *>(pvs[n].memory) = (valuePV.snapshotUpdates - valuePV.previousSnapshotUpdates);
+            }
+            else {
+                //The value was already copied by Snapshot.
+            }
+        }
+    }
+    return ok;
+}
+
+void EPICSCAInput::Snapshot(const uint32 n) {
+    EPICSCAInputPV &inputPV = inputPVs[n];
+    uint32 updates = 0u;
+    bool done = false;
+    uint32 retry;
+    for (retry = 0u; (retry < EPICSCA_INPUT_SNAPSHOT_RETRIES) && (!done); retry++) {
+        uint32 sequenceBefore = inputPV.sequence;
+        EPICSCAInputBarrier();
+        uint32 readIdx = inputPV.published;
+        updates = inputPV.updates;
+        (void) MemoryOperationsHelper::Copy(pvs[n].memory, inputPV.buffer[readIdx], pvs[n].memorySize);
+        uint64 timestamp = inputPV.bufferTimestamp[readIdx];
+        EPICSCAInputBarrier();
+        uint32 sequenceAfter = inputPV.sequence;
+        //The published buffer is only rewritten by the second write that starts after sequenceBefore.
+        //A write which was ongoing (odd sequence) when the copy started wrote the other buffer.
+        done = ((sequenceAfter - (sequenceBefore & ~1u)) <= 2u);
+        if (done) {
+            inputPV.timestamp = timestamp;
+        }
+    }
+    if (!done) {
+        //The PV is being updated faster than it can be copied. Hold its writer for one copy.
+        (void) inputPV.writeMux.FastLock();
+        uint32 readIdx = inputPV.published;
+        updates = inputPV.updates;
+        (void) MemoryOperationsHelper::Copy(pvs[n].memory, inputPV.buffer[readIdx], pvs[n].memorySize);
+        inputPV.timestamp = inputPV.bufferTimestamp[readIdx];
+        inputPV.writeMux.FastUnLock();
+    }
+    inputPV.previousSnapshotUpdates = inputPV.snapshotUpdates;
+    inputPV.snapshotUpdates = updates;
 }
 
 CLASS_REGISTER(EPICSCAInput, "1.0")
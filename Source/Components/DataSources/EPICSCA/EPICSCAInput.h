@@ -36,6 +36,7 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -94,10 +95,103 @@ struct PVWrapper {
     TypeDescriptor td;
 };
 
+/**
+ * The signal reads the value of the PV.
+ */
+const uint32 EPICSCA_INPUT_FIELD_VALUE = 0u;
+
+/**
+ * The signal reads the EPICS timestamp of the PV value.
+ */
+const uint32 EPICSCA_INPUT_FIELD_TIMESTAMP = 1u;
+
+/**
+ * The signal reads the number of PV updates since the previous cycle.
+ */
+const uint32 EPICSCA_INPUT_FIELD_UPDATED = 2u;
+
+/**
+ * Input specific information of a PV.
+ * @details The monitor callback writes the values in the buffer which is not published (serialised only with the other callbacks of the same PV)
+ * and then publishes it, incrementing the sequence before and after writing (seqlock). The real-time thread copies the published buffer and
+ * repeats the copy if the sequence shows that the buffer might have been overwritten in the meanwhile.
+ */
+struct EPICSCAInputPV {
+    /**
+     * The PV whose monitor is received.
+     */
+    PVWrapper *pv;
+
+    /**
+     * What is read from the PV (one of the EPICSCA_INPUT_FIELD_ values).
+     */
+    uint32 field;
+
+    /**
+     * For the Timestamp and Updated fields, the index of the signal with the value of the same PV.
+     */
+    uint32 valueIdx;
+
+    /**
+     * Double buffer written by the monitor callback.
+     */
+    void *buffer[2u];
+
+    /**
+     * EPICS timestamp (nanoseconds since the UNIX epoch) of the values in each buffer.
+     */
+    uint64 bufferTimestamp[2u];
+
+    /**
+     * The index of the buffer with the newest values.
+     */
+    volatile uint32 published;
+
+    /**
+     * Incremented before and after writing a buffer (odd while writing).
+     */
+    volatile uint32 sequence;
+
+    /**
+     * Number of values received.
+     */
+    volatile uint32 updates;
+
+    /**
+     * Serialises the monitor callbacks of this PV.
+     */
+    FastPollingMutexSem writeMux;
+
+    /**
+     * The timestamp of the values copied in the last Synchronise.
+     */
+    uint64 timestamp;
+
+    /**
+     * The number of values received in the last Synchronise.
+     */
+    uint32 snapshotUpdates;
+
+    /**
+     * The number of values received until the previous Synchronise.
+     */
+    uint32 previousSnapshotUpdates;
+};
+
 /**
  * @brief A DataSource which allows to retrieved data from any number of PVs using the EPICS channel access client protocol.
  * Data is asynchronously retrieved using ca_create_subscriptions in the context of a different thread (w.r.t. to the real-time thread).
  *
+ * Each PV is received in its own double buffer (see EPICSCAInputPV), so that the monitor callbacks of different PVs never contend and
+ * the real-time thread never blocks the callbacks. A consistent copy (snapshot) of all the PVs is taken by the EPICSCAInputBroker before copying
+ * the signals to a GAM. The snapshot is only taken once per cycle: a new one is taken when a GAM has already copied the current one, so that
+ * all the GAMs that read the DataSource in the same cycle get the same values. The snapshot is locked while it is taken and while it is copied,
+ * so that GAMs in different threads can read the DataSource. A GAM in a slower thread gets the last snapshot taken by the faster thread.
+ *
+ * Besides the value of the PV (Field = Value), a signal can read the EPICS timestamp of the value (Field = Timestamp, Type = uint64,
+ * nanoseconds since the UNIX epoch) or the number of values received since the previous snapshot (Field = Updated, Type = uint32, 0 if the
+ * PV was not updated). These signals shall have the same PVName as a value signal.
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -111,6 +205,16 @@ struct PVWrapper {
  *             Type = uint32 //Compulsory. Supported types are char8[40], string[40], uint8, int8, uint16, int16, int32, uint32, uint64, int64, float32 and float64
  *             NumberOfElements = 1 //Arrays also supported
  *          }
+ *          PV1Time = {
+ *             PVName = My::PV1
+ *             Field = Timestamp //Optional. Value (default), Timestamp or Updated.
+ *             Type = uint64
+ *          }
+ *          PV1Updated = {
+ *             PVName = My::PV1
+ *             Field = Updated
+ *             Type = uint32
+ *          }
  *          ...
  *     }
  * }
@@ -156,14 +260,14 @@ public:
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
      * @details Only InputSignals are supported.
-     * @return MemoryMapInputBroker.
+     * @return EPICSCAInputBroker.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
 
     /**
      * @brief See DataSourceI::GetInputBrokers.
-     * @details adds a memory MemoryMapInputBroker instance to the inputBrokers
+     * @details adds an EPICSCAInputBroker instance to the inputBrokers
      * @return true.
      */
     virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
@@ -197,6 +301,7 @@ public:
      *  are valid and consistent with the parameters set during the initialisation phase.
      * In particular the following conditions shall be met:
      * - All the signals have the PVName defined
+     * - The Timestamp signals are uint64, the Updated signals are uint32 and both have the PVName of a value signal
      * - All the signals have one of the following types: uint32, int32, float32 or float64.
      * @return true if all the parameters are valid and the conditions above are met.
      */
@@ -225,10 +330,24 @@ public:
 
     /**
      * @brief See DataSourceI::Synchronise.
-     * @return false.
+     * @details Takes a new snapshot: copies the newest values (and timestamps) of all the PVs into the signal memory, without blocking the monitor callbacks.
+     * @return true.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Locks the snapshot and takes a new one if the caller already copied the current one.
+     * @details Called by the EPICSCAInputBroker before copying the signals. Shall be followed by UnlockSnapshot().
+     * @param[in,out] readSnapshot the number of the last snapshot copied by the caller. Updated with the number of the snapshot to be copied.
+     * @return true if the snapshot could be locked and taken.
+     */
+    bool LockSnapshot(uint32 &readSnapshot);
+
+    /**
+     * @brief Unlocks the snapshot locked by LockSnapshot().
+     */
+    void UnlockSnapshot();
+
     /**
      * @brief Registered as the ca_create_subscription callback function.
      * It calls updates the memory of the corresponding PV variable.
@@ -237,6 +356,33 @@ public:
 
 private:
 
+    /**
+     * @brief Copies the published buffer of a value signal into the signal memory.
+     * @param[in] n the signal index.
+     */
+    void Snapshot(const uint32 n);
+
+    /**
+     * @brief Copies all the PVs into the signal memory and computes the Timestamp and Updated signals. Shall be called with snapshotMux locked.
+     * @return true if the DataSource was configured.
+     */
+    bool TakeSnapshot();
+
+    /**
+     * Protects the signal memory while a snapshot is taken or copied to a GAM.
+     */
+    FastPollingMutexSem snapshotMux;
+
+    /**
+     * The number of the last snapshot taken.
+     */
+    uint32 snapshotNumber;
+
+    /**
+     * Input specific information of each PV.
+     */
+    EPICSCAInputPV *inputPVs;
+
     /**
      * List of PVs.
      */
@@ -0,0 +1,80 @@
+/**
+ * @file EPICSCAInputBroker.h
+ * @brief Header file for class EPICSCAInputBroker
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This header file contains the declaration of the class EPICSCAInputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EPICSCAINPUTBROKER_H_
+#define EPICSCAINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapInputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief The input broker of the EPICSCAInput.
+ * @details Copies the signals of the last snapshot of the EPICSCAInput to the GAM, holding the snapshot lock of the
+ * DataSource during the copy, so that GAMs in different threads never see a snapshot being written.
+ * A new snapshot is taken when a GAM has already copied the current one, i.e. once per cycle of the first GAM that reads
+ * the DataSource; the other GAMs of the same cycle copy the same snapshot.
+ */
+class EPICSCAInputBroker: public MemoryMapInputBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    EPICSCAInputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~EPICSCAInputBroker();
+
+    /**
+     * @brief Takes a new snapshot if this GAM already copied the current one and copies the signals to the GAM memory.
+     * @return true if the DataSource is an EPICSCAInput and the copy succeeds.
+     */
+    virtual bool Execute();
+
+private:
+
+    /**
+     * The number of the last snapshot copied by this broker (see EPICSCAInput::LockSnapshot).
+     */
+    uint32 snapshotNumber;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EPICSCAINPUTBROKER_H_ */
@@ -32,11 +32,45 @@
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
 #include "EPICSCAOutput.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Timeout in seconds of the ca_pend_io calls.
+ */
+static const float64 EPICSCA_OUTPUT_PEND_IO_TIMEOUT = 0.5;
+
+/**
+ * @brief Checks if any of the new values differs more than deadband from the last values.
+ * @param[in] newValues the new values.
+ * @param[in] lastValues the last values that were put.
+ * @param[in] numberOfElements the number of elements to compare.
+ * @param[in] deadband the deadband.
+ * @return true if any of the new values differs more than deadband from the last values.
+ */
+template<typename T>
+static bool EPICSCAOutputExceedsDeadband(const void * const newValues,
+                                         const void * const lastValues,
+                                         const uint32 numberOfElements,
+                                         const float64 deadband) {
+    const T *newV = static_cast<const T *>(newValues);
+    const T *lastV = static_cast<const T *>(lastValues);
+    bool exceeds = false;
+    uint32 k;
+    for (k = 0u; (k < numberOfElements) && (!exceeds); k++) {
+        float64 delta = static_cast<float64>(newV[k]) - static_cast<float64>(lastV[k]);
+        if (delta < 0.0) {
+            delta = -delta;
+        }
+        exceeds = (delta > deadband);
+    }
+    return exceeds;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,7 +85,10 @@ EPICSCAOutput::EPICSCAOutput() :
     ignoreBufferOverrun = 1u;
     threadContextSet = false;
     dbr64CastDouble = true;
+    batchPuts = false;
+    numberOfFilteredPuts = 0u;
     signalFlag = NULL_PTR(uint8*);
+    outputPVs = NULL_PTR(EPICSCAOutputPV *);
     ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -75,6 +112,18 @@ EPICSCAOutput::~EPICSCAOutput() {
         }
         delete[] pvs;
     }
+    if (outputPVs != NULL_PTR(EPICSCAOutputPV *)) {
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            if (outputPVs[n].putMemory != NULL_PTR(void *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(outputPVs[n].putMemory);
+            }
+            if (outputPVs[n].lastPutMemory != NULL_PTR(void *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(outputPVs[n].lastPutMemory);
+            }
+        }
+        delete[] outputPVs;
+    }
     if (signalFlag != NULL_PTR(uint8*)) {
         delete[] signalFlag;
     }
@@ -124,6 +173,23 @@ bool EPICSCAOutput::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported DBR64CastDouble = %s", dbr64CastDoubleStr.Buffer());
         }
     }
+    if (ok) {
+        StreamString batchPutsStr;
+        if (!data.Read("BatchPuts", batchPutsStr)) {
+            batchPutsStr = "no";
+            REPORT_ERROR(ErrorManagement::Information, "No BatchPuts defined. Using default = %s", batchPutsStr.Buffer());
+        }
+        if (batchPutsStr == "yes") {
+            batchPuts = true;
+        }
+        else if (batchPutsStr == "no") {
+            batchPuts = false;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported BatchPuts = %s", batchPutsStr.Buffer());
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -189,11 +255,18 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
 
     if (ok) {
         pvs = new PVWrapper[nOfSignals];
+        outputPVs = new EPICSCAOutputPV[nOfSignals];
         signalFlag = new uint8[nOfSignals];
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
             pvs[n].memory = NULL_PTR(void *);
             pvs[n].pvChid = NULL_PTR(chid);
+            outputPVs[n].putMemory = NULL_PTR(void *);
+            outputPVs[n].putMemorySize = 0u;
+            outputPVs[n].lastPutMemory = NULL_PTR(void *);
+            outputPVs[n].lastPutValid = false;
+            outputPVs[n].hasDeadband = false;
+            outputPVs[n].deadband = 0.0;
             signalFlag[n] = 0u;
         }
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
@@ -213,6 +286,15 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
                     REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
                 }
             }
+            if (ok) {
+                outputPVs[n].hasDeadband = originalSignalInformation.Read("Deadband", outputPVs[n].deadband);
+                if (outputPVs[n].hasDeadband) {
+                    ok = (outputPVs[n].deadband >= 0.0);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The Deadband of PV %s shall be >= 0", pvName.Buffer());
+                    }
+                }
+            }
             TypeDescriptor td = GetSignalType(n);
             if (ok) {
                 pvs[n].td = td;
@@ -288,6 +370,19 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
                 pvs[n].memorySize /= 8u;
                 pvs[n].memorySize *= numberOfElements;
                 pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                //The uint64/int64 signals are converted into a float64 staging buffer, so that the signal memory is never modified.
+                if (pvs[n].pvType == DBR_DOUBLE) {
+                    outputPVs[n].putMemorySize = static_cast<uint32>(sizeof(float64)) * numberOfElements;
+                }
+                else {
+                    outputPVs[n].putMemorySize = pvs[n].memorySize;
+                }
+                if ((td == UnsignedInteger64Bit) || (td == SignedInteger64Bit)) {
+                    outputPVs[n].putMemory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(outputPVs[n].putMemorySize);
+                }
+                if (outputPVs[n].hasDeadband) {
+                    outputPVs[n].lastPutMemory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(outputPVs[n].putMemorySize);
+                }
                 ok = originalSignalInformation.MoveToAncestor(1u);
             }
         }
@@ -389,6 +484,10 @@ bool EPICSCAOutput::Synchronise() {
                     }
                 }
             }
+            if (batchPuts) {
+                //The puts are no longer followed by a ca_pend_io, so wait here for the channels to connect.
+                (void) ca_pend_io(EPICSCA_OUTPUT_PEND_IO_TIMEOUT);
+            }
         }
     }
 
@@ -397,44 +496,122 @@ bool EPICSCAOutput::Synchronise() {
         if ((pvs != NULL_PTR(PVWrapper *)) && (signalFlag != NULL_PTR(uint8*))) {
             for (n = 0u; (n < nOfSignals); n++) {
                 if (signalFlag[n] > 0u) {
-
-                    uint32 nRetries = 5u;
-                    ok = false;
-                    while ((nRetries > 0u) && (!ok)) {
-                        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                        if (pvs[n].pvType == DBR_STRING) {
-                            ok = (ca_put(pvs[n].pvType, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                    if (StagePut(n)) {
+                        bool putOk = false;
+                        if (batchPuts) {
+                            //Queued. Flushed once for all the signals.
+                            putOk = CaPut(n);
                         }
                         else {
-                            //Handle 64 bit case with a cast to float64
-                            //lint -e{9013} else not meaningful, since this check only applies to uint64 and int64
-                            if (pvs[n].td == UnsignedInteger64Bit) {
-                                float64 *pvMemF64 = static_cast<float64 *>(pvs[n].memory);
-                                uint64 *pvMemU64 = static_cast<uint64 *>(pvs[n].memory);
-                                for (uint32 k=0u; k<pvs[n].numberOfElements; k++) {
-                                    pvMemF64[k] = static_cast<float64>(pvMemU64[k]);
-                                }
-                            }
-                            else if (pvs[n].td == SignedInteger64Bit) {
-                                float64 *pvMemF64 = static_cast<float64 *>(pvs[n].memory);
-                                int64 *pvMemI64 = static_cast<int64 *>(pvs[n].memory);
-                                for (uint32 k=0u; k<pvs[n].numberOfElements; k++) {
-                                    pvMemF64[k] = static_cast<float64>(pvMemI64[k]);
-                                }
+                            uint32 nRetries = 5u;
+                            while ((nRetries > 0u) && (!putOk)) {
+                                putOk = CaPut(n);
+                                nRetries--;
+                                (void) ca_pend_io(EPICSCA_OUTPUT_PEND_IO_TIMEOUT);
                             }
-                            ok = (ca_array_put(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
                         }
-                        nRetries--;
-                        (void) ca_pend_io(0.5);
-                    }
-                    if (!ok) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "ca_put failed for PV: %s", pvs[n].pvName);
+                        if (!putOk) {
+                            //Make sure that the value is put again in the next cycle.
+                            /*lint -e{613} outputPVs is allocated together with pvs*/
+                            outputPVs[n].lastPutValid = false;
+                            REPORT_ERROR(ErrorManagement::FatalError, "ca_put failed for PV: %s", pvs[n].pvName);
+                            ok = false;
+                        }
                     }
                 }
             }
+            if (batchPuts) {
+                ok = (ca_flush_io() == ECA_NORMAL) && (ok);
+            }
+        }
+    }
+
+    return ok;
+}
+
+bool EPICSCAOutput::StagePut(const uint32 n) {
+    /*lint -e{613} pvs and outputPVs are allocated together and checked by the caller*/
+    void *putMemory = pvs[n].memory;
+    TypeDescriptor putTd = pvs[n].td;
+    if (outputPVs[n].putMemory != NULL_PTR(void *)) {
+        //Handle 64 bit case with a cast to float64
+        putMemory = outputPVs[n].putMemory;
+        putTd = Float64Bit;
+        float64 *pvMemF64 = static_cast<float64 *>(putMemory);
+        uint32 k;
+        if (pvs[n].td == UnsignedInteger64Bit) {
+            const uint64 *pvMemU64 = static_cast<const uint64 *>(pvs[n].memory);
+            for (k = 0u; k < pvs[n].numberOfElements; k++) {
+                pvMemF64[k] = static_cast<float64>(pvMemU64[k]);
+            }
+        }
+        else {
+            const int64 *pvMemI64 = static_cast<const int64 *>(pvs[n].memory);
+            for (k = 0u; k < pvs[n].numberOfElements; k++) {
+                pvMemF64[k] = static_cast<float64>(pvMemI64[k]);
+            }
+        }
+    }
+    bool doPut = true;
+    if (outputPVs[n].hasDeadband) {
+        if (outputPVs[n].lastPutValid) {
+            const void *lastPutMemory = outputPVs[n].lastPutMemory;
+            uint32 nElements = pvs[n].numberOfElements;
+            float64 deadband = outputPVs[n].deadband;
+            if ((deadband > 0.0) && (pvs[n].pvType != DBR_STRING)) {
+                if (putTd == UnsignedInteger8Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<uint8>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else if (putTd == SignedInteger8Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<int8>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else if (putTd == UnsignedInteger16Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<uint16>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else if (putTd == SignedInteger16Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<int16>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else if (putTd == UnsignedInteger32Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<uint32>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else if (putTd == SignedInteger32Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<int32>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else if (putTd == Float32Bit) {
+                    doPut = EPICSCAOutputExceedsDeadband<float32>(putMemory, lastPutMemory, nElements, deadband);
+                }
+                else {
+                    doPut = EPICSCAOutputExceedsDeadband<float64>(putMemory, lastPutMemory, nElements, deadband);
+                }
+            }
+            else {
+                doPut = (MemoryOperationsHelper::Compare(putMemory, lastPutMemory, outputPVs[n].putMemorySize) != 0);
+            }
+        }
+        if (doPut) {
+            outputPVs[n].lastPutValid = MemoryOperationsHelper::Copy(outputPVs[n].lastPutMemory, putMemory, outputPVs[n].putMemorySize);
+        }
+        else {
+            numberOfFilteredPuts++;
         }
     }
+    return doPut;
+}
 
+bool EPICSCAOutput::CaPut(const uint32 n) const {
+    bool ok;
+    /*lint -e{613} pvs and outputPVs are allocated together and checked by the caller*/
+    const void *putMemory = pvs[n].memory;
+    if (outputPVs[n].putMemory != NULL_PTR(void *)) {
+        putMemory = outputPVs[n].putMemory;
+    }
+    /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+    if (pvs[n].pvType == DBR_STRING) {
+        ok = (ca_put(pvs[n].pvType, pvs[n].pvChid, putMemory) == ECA_NORMAL);
+    }
+    else {
+        ok = (ca_array_put(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, putMemory) == ECA_NORMAL);
+    }
     return ok;
 }
 
@@ -442,6 +619,14 @@ bool EPICSCAOutput::IsIgnoringBufferOverrun() const {
     return (ignoreBufferOverrun == 1u);
 }
 
+bool EPICSCAOutput::IsBatchingPuts() const {
+    return batchPuts;
+}
+
+uint32 EPICSCAOutput::GetNumberOfFilteredPuts() const {
+    return numberOfFilteredPuts;
+}
+
 ErrorManagement::ErrorType EPICSCAOutput::AsyncCaPut(StreamString pvName, StreamString pvVal) {
     ErrorManagement::ErrorType err;
     TypeDescriptor td;
@@ -48,10 +48,50 @@
 namespace MARTe {
 //Maximum size that a PV name may have
 
+/**
+ * Output specific information of a PV.
+ */
+struct EPICSCAOutputPV {
+    /**
+     * The memory which is ca_put. It is the signal memory, with the exception of the uint64/int64 signals
+     * which are converted to float64 into a staging buffer.
+     */
+    void *putMemory;
+
+    /**
+     * The size of the putMemory.
+     */
+    uint32 putMemorySize;
+
+    /**
+     * A copy of the last values that were put (only allocated if hasDeadband).
+     */
+    void *lastPutMemory;
+
+    /**
+     * True if the lastPutMemory holds the last values that were put.
+     */
+    bool lastPutValid;
+
+    /**
+     * True if a Deadband was defined for the signal.
+     */
+    bool hasDeadband;
+
+    /**
+     * The values are only put if any element changed more than deadband w.r.t. to the last values that were put.
+     */
+    float64 deadband;
+};
+
 /**
  * @brief A DataSource which allows to output data into any number of PVs using the EPICS channel access client protocol.
  * Data is asynchronously ca_put in the context of a different thread (w.r.t. to the real-time thread).
  *
+ * If BatchPuts = "yes" the puts of all the signals are queued and flushed once per cycle with ca_flush_io, instead of waiting
+ * (and retrying) for each put with ca_pend_io. If a signal defines a Deadband, its values are only put if any element changed more than
+ * Deadband (or, for Deadband = 0 and for strings, if any element changed) w.r.t. to the last values that were put.
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -62,10 +102,12 @@ namespace MARTe {
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the PV values. Each buffer is capable of holding a copy of all the DataSourceI signals.
  *     DBR64CastDouble = "yes" //Optional, default=yes. DBR does not support 64 bit integers. If a 64 bit signal is added and DBR64CastDouble is set to "yes", the uint64/int64 signals will be cast to DBR_DOUBLE.
+ *     BatchPuts = "yes" //Optional, default=no. If "yes" all the puts of a cycle are queued and flushed once with ca_flush_io.
  *     Signals = {
  *          PV1 = { //At least one shall be defined
  *             PVName = My::PV1 //Compulsory. Name of the PV.
  *             Type = uint32 //Compulsory. Supported types are char8[40], string[40], uint8, int8, uint16, int16, int32, uint32, float32 and float64. See note on DBR64CastDouble for uint64/int64.
+ *             Deadband = 0.5 //Optional. If set the values are only put when any element changed more than Deadband. Deadband = 0 puts on any change.
  *          }
  *          ...
  *     }
@@ -191,6 +233,18 @@ public:
      */
     bool IsIgnoringBufferOverrun() const;
 
+    /**
+     * @brief Gets if the puts of each cycle are queued and flushed once.
+     * @return true if BatchPuts = "yes".
+     */
+    bool IsBatchingPuts() const;
+
+    /**
+     * @brief Gets the number of puts that were not issued because the values did not exceed the signal Deadband.
+     * @return the number of filtered puts.
+     */
+    uint32 GetNumberOfFilteredPuts() const;
+
     /**
      * @brief Asynchronous Channel Access Put.
      * @details Performs the following EPICS calls: ca_create_channel and then, depending on pvType, 
@@ -205,6 +259,35 @@ public:
     virtual void Purge(ReferenceContainer &purgeList);
 
 private:
+    /**
+     * @brief Copies (converting the uint64/int64 signals to float64) the signal memory into the putMemory.
+     * @param[in] n the signal index.
+     * @return true if the values are to be put, i.e. if the signal has no Deadband or if the values exceeded the Deadband.
+     */
+    bool StagePut(const uint32 n);
+
+    /**
+     * @brief Calls ca_put or ca_array_put for the putMemory of the signal.
+     * @param[in] n the signal index.
+     * @return true if ca_put or ca_array_put returned ECA_NORMAL.
+     */
+    bool CaPut(const uint32 n) const;
+
+    /**
+     * Output specific information of each PV.
+     */
+    EPICSCAOutputPV *outputPVs;
+
+    /**
+     * Queue the puts and flush once per cycle.
+     */
+    bool batchPuts;
+
+    /**
+     * Number of puts that were filtered by the Deadband.
+     */
+    uint32 numberOfFilteredPuts;
+
     /**
      * List of PVs.
      */
@@ -32,10 +32,18 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "EPICSPVAChannelWrapper.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum time in seconds that a put is allowed to be in flight.
+ */
+static const float64 EPICSPVA_PUT_TIMEOUT = 1.0;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -46,10 +54,28 @@ EPICSPVAChannelWrapper::EPICSPVAChannelWrapper() {
     resolvedStructIndexMap = NULL_PTR(uint32 *);
     cachedSignals = NULL_PTR(EPICSPVAFieldWrapperI **);
     structureResolved = false;
-    putFinished = false;
+    putInFlight = false;
+    putCancelled = false;
+    putPending = false;
+    putEvent = NULL_PTR(EventSem *);
+    putStartCounter = 0u;
+    numberOfPuts = 0u;
+    numberOfFailedPuts = 0u;
+    numberOfDroppedValues = 0u;
+    lastPutLatency = 0u;
+    maxPutLatency = 0u;
+    stagingMemory = NULL_PTR(char8 *);
+    signalMemory = NULL_PTR(void **);
+    stagingOffset = NULL_PTR(uint32 *);
+    signalByteSize = NULL_PTR(uint32 *);
+    if (!putMux.Create()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not create FastPollingMutexSem.");
+    }
 }
 
 EPICSPVAChannelWrapper::~EPICSPVAChannelWrapper() {
+    //Cancel any put in flight before releasing the memory that it uses.
+    putOperation = pvac::Operation();
     if (cachedSignals != NULL_PTR(EPICSPVAFieldWrapperI **)) {
         for (uint32 n = 0u; (n < numberOfSignals); n++) {
             if (cachedSignals[n] != NULL_PTR(EPICSPVAFieldWrapperI *)) {
@@ -61,6 +87,18 @@ EPICSPVAChannelWrapper::~EPICSPVAChannelWrapper() {
     if (resolvedStructIndexMap != NULL_PTR(uint32 *)) {
         delete [] resolvedStructIndexMap;
     }
+    if (stagingMemory != NULL_PTR(char8 *)) {
+        delete[] stagingMemory;
+    }
+    if (signalMemory != NULL_PTR(void **)) {
+        delete[] signalMemory;
+    }
+    if (stagingOffset != NULL_PTR(uint32 *)) {
+        delete[] stagingOffset;
+    }
+    if (signalByteSize != NULL_PTR(uint32 *)) {
+        delete[] signalByteSize;
+    }
     channel = pvac::ClientChannel();
     monitor = pvac::MonitorSync();
 }
@@ -84,10 +122,12 @@ bool EPICSPVAChannelWrapper::SetAliasAndField(StructuredDataI &data) {
     return ok;
 }
 
-bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource) {
+bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource, const bool stagePuts) {
     bool ok = true;
     uint32 maxNumberOfSignals = dataSource.GetNumberOfSignals();
     EPICSPVAFieldWrapperI **tempCachedSignals = new EPICSPVAFieldWrapperI*[maxNumberOfSignals];
+    void **tempSignalMemory = new void*[maxNumberOfSignals];
+    uint32 *tempSignalByteSize = new uint32[maxNumberOfSignals];
     uint32 n;
     numberOfSignals = 0u;
     for (n = 0u; (n < maxNumberOfSignals) && (ok); n++) {
@@ -143,6 +183,9 @@ bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource) {
             if (ok) {
                 ok = dataSource.GetSignalMemoryBuffer(n, 0u, memory);
             }
+            if (ok) {
+                ok = dataSource.GetSignalByteSize(n, tempSignalByteSize[numberOfSignals]);
+            }
             if (ok) {
                 if (typeDescriptor == UnsignedInteger8Bit) {
                     tempCachedSignals[numberOfSignals] = new EPICSPVAFieldWrapper<uint8>();
@@ -183,6 +226,7 @@ bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource) {
                 }
             }
             if (ok) {
+                tempSignalMemory[numberOfSignals] = memory;
                 tempCachedSignals[numberOfSignals]->SetMemory(numberOfElements, qualifiedName.Buffer(), memory);
             }
             REPORT_ERROR_STATIC(ErrorManagement::Information, "Registering signal %s [%s]", qualifiedName.Buffer(), channelName.Buffer());
@@ -206,67 +250,208 @@ bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource) {
     if (ok) {
         resolvedStructIndexMap = new uint32[numberOfSignals];
     }
+    if ((ok) && (stagePuts) && (numberOfSignals > 0u)) {
+        signalMemory = new void*[numberOfSignals];
+        stagingOffset = new uint32[numberOfSignals];
+        signalByteSize = new uint32[numberOfSignals];
+        uint32 stagingSize = 0u;
+        for (n = 0u; (n < numberOfSignals); n++) {
+            signalMemory[n] = tempSignalMemory[n];
+            signalByteSize[n] = tempSignalByteSize[n];
+            stagingOffset[n] = stagingSize;
+            stagingSize += signalByteSize[n];
+        }
+        stagingMemory = new char8[stagingSize];
+        for (n = 0u; (n < numberOfSignals) && (ok); n++) {
+            //Put from the staging memory
+            cachedSignals[n]->SetMemory(&stagingMemory[stagingOffset[n]]);
+            ok = MemoryOperationsHelper::Copy(&stagingMemory[stagingOffset[n]], signalMemory[n], signalByteSize[n]);
+        }
+    }
+    delete[] tempSignalMemory;
+    delete[] tempSignalByteSize;
     return ok;
 }
 
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the structure to be put is already known.*/
 void EPICSPVAChannelWrapper::putBuild(const epics::pvData::StructureConstPtr& build, pvac::ClientChannel::PutCallback::Args& args) {
     args.root = putPVStruct;
     args.tosend.set(0);
-    putFinished = true;
 }
 
 void EPICSPVAChannelWrapper::putDone(const pvac::PutEvent& evt) {
-    if (evt.event == 0) {
-        std::cout << evt.event << std::endl;
+    uint64 elapsed = HighResolutionTimer::Counter() - putStartCounter;
+    float64 latency = (static_cast<float64>(elapsed) * HighResolutionTimer::Period()) * 1e6;
+    putMux.FastLock();
+    if (putCancelled) {
+        //The put timed out and was already counted as failed in Flush. Ignore the Cancel event (or a late completion racing with the cancel).
+    }
+    else if (evt.event == pvac::PutEvent::Success) {
+        numberOfPuts++;
+        lastPutLatency = static_cast<uint32>(latency);
+        if (lastPutLatency > maxPutLatency) {
+            maxPutLatency = lastPutLatency;
+        }
+    }
+    else {
+        numberOfFailedPuts++;
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Put on channel %s failed [%s]", channelName.Buffer(), evt.message.c_str());
+    }
+    putInFlight = false;
+    putMux.FastUnLock();
+    if (putEvent != NULL_PTR(EventSem *)) {
+        (void) putEvent->Post();
     }
 }
 
-bool EPICSPVAChannelWrapper::Put() {
-    bool ok = false;
-    try {
-        if (!channel.valid()) {
-            provider = pvac::ClientProvider("pva");
-            REPORT_ERROR_STATIC(ErrorManagement::Information, "Connected to channel %s", channelName.Buffer());
-            channel = pvac::ClientChannel(provider.connect(channelName.Buffer()));
-        }
-        ok = channel.valid();
+bool EPICSPVAChannelWrapper::ConnectPut() {
+    if (!channel.valid()) {
+        provider = pvac::ClientProvider("pva");
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Connected to channel %s", channelName.Buffer());
+        channel = pvac::ClientChannel(provider.connect(channelName.Buffer()));
+    }
+    bool ok = channel.valid();
 
-        if (ok) {
-            if (!structureResolved) {
-                uint32 absIndex = 0u;
-                epics::pvData::PVStructurePtr getPVStruct = std::const_pointer_cast<epics::pvData::PVStructure>(channel.get());
-                ok = (getPVStruct) ? true : false;
+    if (ok) {
+        if (!structureResolved) {
+            uint32 absIndex = 0u;
+            epics::pvData::PVStructurePtr getPVStruct = std::const_pointer_cast<epics::pvData::PVStructure>(channel.get());
+            ok = (getPVStruct) ? true : false;
+            if (ok) {
+                ok = ResolveStructure(getPVStruct, "", absIndex);
                 if (ok) {
-                    ok = ResolveStructure(getPVStruct, "", absIndex);
-                    if (ok) {
-                        putPVStruct = getPVStruct;
-                    }
-                    structureResolved = ok;
+                    putPVStruct = getPVStruct;
                 }
+                structureResolved = ok;
             }
         }
-        if (ok) {
+    }
+    return ok;
+}
+
+bool EPICSPVAChannelWrapper::Stage() {
+    bool ok = false;
+    try {
+        ok = ConnectPut();
+    }
+    catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Failed to connect to channel %s [%s]", channelName.Buffer(), ignored.what());
+        ok = false;
+    }
+    if (ok) {
+        putMux.FastLock();
+        if (stagingMemory != NULL_PTR(char8 *)) {
             uint32 n;
-            for (n = 0u; n < numberOfSignals; n++) {
-                cachedSignals[n]->Put();
+            for (n = 0u; (n < numberOfSignals) && (ok); n++) {
+                ok = MemoryOperationsHelper::Copy(&stagingMemory[stagingOffset[n]], signalMemory[n], signalByteSize[n]);
             }
         }
-        putFinished = false;
-        pvac::Operation op(channel.put(this));
-        uint32 timeout = 10u;
-        while (ok && (!putFinished)) {
-            Sleep::Sec(0.1);
+        if (putPending) {
+            numberOfDroppedValues++;
+        }
+        putPending = true;
+        putMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool EPICSPVAChannelWrapper::Flush() {
+    bool ok = true;
+    bool startPut = false;
+    putMux.FastLock();
+    if (putInFlight) {
+        uint64 elapsed = HighResolutionTimer::Counter() - putStartCounter;
+        if ((static_cast<float64>(elapsed) * HighResolutionTimer::Period()) > EPICSPVA_PUT_TIMEOUT) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Put on channel %s timed out", channelName.Buffer());
+            numberOfFailedPuts++;
+            putInFlight = false;
+            putCancelled = true;
+            putMux.FastUnLock();
+            //Cancel outside of the lock as the callback may be running. The callback is not called after the cancel returns.
+            putOperation = pvac::Operation();
+            putMux.FastLock();
+            putCancelled = false;
+        }
+    }
+    if ((!putInFlight) && (putPending) && (structureResolved)) {
+        uint32 n;
+        for (n = 0u; n < numberOfSignals; n++) {
+            cachedSignals[n]->Put();
+        }
+        putPending = false;
+        putInFlight = true;
+        putStartCounter = HighResolutionTimer::Counter();
+        startPut = true;
+    }
+    putMux.FastUnLock();
+    if (startPut) {
+        try {
+            putOperation = channel.put(this);
+        }
+        catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Failed to put on channel %s [%s]", channelName.Buffer(), ignored.what());
+            putMux.FastLock();
+            numberOfFailedPuts++;
+            putInFlight = false;
+            putMux.FastUnLock();
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool EPICSPVAChannelWrapper::Put() {
+    uint32 failedPutsBefore = numberOfFailedPuts;
+    bool ok = Stage();
+    if (ok) {
+        ok = Flush();
+    }
+    uint32 timeout = 1000u;
+    bool done = false;
+    while ((ok) && (!done)) {
+        putMux.FastLock();
+        done = ((!putInFlight) && (!putPending));
+        if (done) {
+            ok = (numberOfFailedPuts == failedPutsBefore);
+        }
+        putMux.FastUnLock();
+        if (!done) {
+            Sleep::MSec(1u);
             timeout--;
             ok = (timeout > 0u);
+            if (ok) {
+                //Send the staged values if the previous put has meanwhile completed.
+                ok = Flush();
+            }
         }
     }
-    catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
-        REPORT_ERROR_STATIC(ErrorManagement::Information, "Failed to connect to channel %s [s]", channelName.Buffer(), ignored.what());
-        ok = false;
-    }
     return ok;
 }
 
+void EPICSPVAChannelWrapper::SetPutEvent(EventSem * const putEventIn) {
+    putEvent = putEventIn;
+}
+
+uint32 EPICSPVAChannelWrapper::GetNumberOfPuts() const {
+    return numberOfPuts;
+}
+
+uint32 EPICSPVAChannelWrapper::GetNumberOfFailedPuts() const {
+    return numberOfFailedPuts;
+}
+
+uint32 EPICSPVAChannelWrapper::GetNumberOfDroppedValues() const {
+    return numberOfDroppedValues;
+}
+
+uint32 EPICSPVAChannelWrapper::GetLastPutLatency() const {
+    return lastPutLatency;
+}
+
+uint32 EPICSPVAChannelWrapper::GetMaxPutLatency() const {
+    return maxPutLatency;
+}
+
 bool EPICSPVAChannelWrapper::RefreshStructure(epics::pvData::PVFieldPtr pvField, uint32 &absIndex) {
     epics::pvData::PVStructurePtr pvStruct = std::dynamic_pointer_cast<epics::pvData::PVStructure>(pvField);
     bool ok = (pvStruct ? true : false);
@@ -415,11 +600,11 @@ bool EPICSPVAChannelWrapper::Monitor() {
     return ok;
 }
 
-const char8 * const EPICSPVAChannelWrapper::GetChannelName() {
+const char8 * const EPICSPVAChannelWrapper::GetChannelName() const {
     return channelName.Buffer();
 }
 
-const char8 * const EPICSPVAChannelWrapper::GetFieldName() {
+const char8 * const EPICSPVAChannelWrapper::GetFieldName() const {
     return fieldName.Buffer();
 }
 
@@ -38,6 +38,8 @@
 #include "DataSourceI.h"
 #include "DjbHashFunction.h"
 #include "EPICSPVAFieldWrapper.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "StreamString.h"
 #include "StructuredDataI.h"
 
@@ -75,6 +77,10 @@ struct EPICSPVAChannelWrapperCachedSignal {
 #endif
 /**
  * @brief Helper class which encapsulates a PVA signal (record) and allows to put/monitor.
+ * @details Puts can be issued asynchronously: Stage() copies the signal values into a staging memory (see Setup),
+ * Flush() commits the staged values and starts the channel put without waiting for its completion. While a put is in flight
+ * the staged values are overwritten by the newest ones (i.e. only the newest value is sent when the put completes) and
+ * the overwritten values are counted (see GetNumberOfDroppedValues()).
  */
 class EPICSPVAChannelWrapper: public pvac::ClientChannel::PutCallback {
 public:
@@ -99,16 +105,70 @@ public:
     /**
      * @brief Setup all the signal memory information.
      * @param[in] dataSource the data source holding the signals.
+     * @param[in] stagePuts if true the values are put from a staging memory which is only updated by Stage(), so that
+     * the data source memory can be modified while a put is in flight.
      * @return true if the memory setup was successfully set.
      */
-    bool Setup(DataSourceI &dataSource);
+    bool Setup(DataSourceI &dataSource, const bool stagePuts = false);
 
     /**
      * @brief Copies from each signal memory (see GetSignalMemory) into the relevant PVA structure fields and commit the changes.
+     * @details Calls Stage() and Flush() and waits (at most one second) for the put to complete.
      * @return true if all the signals have been successfully committed into the network.
      */
     bool Put();
 
+    /**
+     * @brief Copies the signal values into the staging memory and marks them as pending.
+     * @details The first call connects to the channel and resolves the structure. If the previously staged values were not
+     * yet flushed they are overwritten and the number of dropped values is incremented.
+     * @return true if the channel is valid and the structure can be resolved.
+     */
+    bool Stage();
+
+    /**
+     * @brief Starts the put of the staged values, if any are pending and no put is in flight.
+     * @details Does not wait for the put to complete. A put that does not complete in one second is cancelled and counted as failed.
+     * @return true if no error occurred while starting the put.
+     */
+    bool Flush();
+
+    /**
+     * @brief Sets a semaphore to be posted every time that a put completes.
+     * @param[in] putEventIn the semaphore to be posted.
+     */
+    void SetPutEvent(EventSem * const putEventIn);
+
+    /**
+     * @brief Gets the number of puts that were successfully completed.
+     * @return the number of puts that were successfully completed.
+     */
+    uint32 GetNumberOfPuts() const;
+
+    /**
+     * @brief Gets the number of puts that failed or were cancelled after the timeout.
+     * @return the number of puts that failed.
+     */
+    uint32 GetNumberOfFailedPuts() const;
+
+    /**
+     * @brief Gets the number of staged values that were overwritten before being sent.
+     * @return the number of staged values that were overwritten before being sent.
+     */
+    uint32 GetNumberOfDroppedValues() const;
+
+    /**
+     * @brief Gets the time elapsed between the start and the completion of the last put.
+     * @return the latency of the last put in microseconds.
+     */
+    uint32 GetLastPutLatency() const;
+
+    /**
+     * @brief Gets the maximum time elapsed between the start and the completion of a put.
+     * @return the maximum latency of a put in microseconds.
+     */
+    uint32 GetMaxPutLatency() const;
+
     /**
      * @brief Copies from relevant PVA structure fields into each signal memory.
      * @details This method has a fixed timeout of 0.2 second.
@@ -120,13 +180,13 @@ public:
      * @brief Gets this channel name (see SetAliasAndField).
      * @return this channel name .
      */
-    const char8 * const GetChannelName();
+    const char8 * const GetChannelName() const;
 
     /**
      * @brief Gets the field name (see SetAliasAndField).
      * @return the field name.
      */
-    const char8 * const GetFieldName();
+    const char8 * const GetFieldName() const;
 
     /**
      * @brief The callback function that is called when the channel.put method is called. Sets the args.root to pvStruct.
@@ -137,12 +197,19 @@ public:
 
     /**
      * @brief The callback function that is called when the put operation concludes.
+     * @details Updates the put statistics and posts the event set with SetPutEvent().
      * @param[in] evt see pvac::ClientChannel::PutCallback
      */
     virtual void putDone(const pvac::PutEvent& evt);
 
 private:
 
+    /**
+     * @brief Connects to the channel (if not yet connected) and resolves the structure to be put (if not yet resolved).
+     * @return true if the channel is valid and the structure is resolved.
+     */
+    bool ConnectPut();
+
     /**
      * @brief Recursively populates the cachedSignals (flat list of the structure identified with the qualifiedName) array from the input structure.
      * @param[in] pvField the structure to be resolved.
@@ -215,9 +282,84 @@ private:
     epics::pvData::PVStructure::const_shared_pointer monitorRoot;
 
     /**
-     * Set to true when the put has finished.
+     * Set to true while a put is in flight.
+     */
+    bool putInFlight;
+
+    /**
+     * Set to true while a put which timed out (and was already counted as failed) is being cancelled.
+     */
+    bool putCancelled;
+
+    /**
+     * Set to true when there are staged values waiting to be put.
+     */
+    bool putPending;
+
+    /**
+     * The put operation in flight.
+     */
+    pvac::Operation putOperation;
+
+    /**
+     * Protects the staging memory and the put state between the staging, the flushing and the PVA callback threads.
+     */
+    FastPollingMutexSem putMux;
+
+    /**
+     * Posted when a put completes (may be NULL).
+     */
+    EventSem *putEvent;
+
+    /**
+     * HighResolutionTimer counter when the put in flight was started.
+     */
+    uint64 putStartCounter;
+
+    /**
+     * Number of puts successfully completed.
+     */
+    uint32 numberOfPuts;
+
+    /**
+     * Number of puts that failed.
+     */
+    uint32 numberOfFailedPuts;
+
+    /**
+     * Number of staged values overwritten before being sent.
+     */
+    uint32 numberOfDroppedValues;
+
+    /**
+     * Latency of the last put in microseconds.
+     */
+    uint32 lastPutLatency;
+
+    /**
+     * Maximum latency of a put in microseconds.
+     */
+    uint32 maxPutLatency;
+
+    /**
+     * Staging memory of all the signals (NULL if the puts are not staged).
+     */
+    char8 *stagingMemory;
+
+    /**
+     * The data source memory of each signal (only used if the puts are staged).
+     */
+    void **signalMemory;
+
+    /**
+     * The offset of each signal in the stagingMemory.
+     */
+    uint32 *stagingOffset;
+
+    /**
+     * The size in bytes of each signal.
      */
-    bool putFinished;
+    uint32 *signalByteSize;
 
     /**
      * Cache the index of the signals.
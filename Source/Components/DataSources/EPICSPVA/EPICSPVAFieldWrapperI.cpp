@@ -48,6 +48,10 @@ void EPICSPVAFieldWrapperI::SetMemory(uint32 numberOfElementsIn, const char8 *qu
     memory = memoryIn;
 }
 
+void EPICSPVAFieldWrapperI::SetMemory(void *memoryIn) {
+    memory = memoryIn;
+}
+
 void EPICSPVAFieldWrapperI::SetPVAField(epics::pvData::PVFieldPtr pvFieldIn) {
     pvField = pvFieldIn;
 }
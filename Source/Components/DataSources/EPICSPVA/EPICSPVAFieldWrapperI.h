@@ -63,6 +63,12 @@ public:
      */
     void SetMemory(uint32 numberOfElementsIn, const char8 *qualifiedNameIn, void *memoryIn);
 
+    /**
+     * @brief Changes the memory where to copy/read the values from.
+     * @param[in] memoryIn the new memory, which shall have the same size as the one set with SetMemory.
+     */
+    void SetMemory(void *memoryIn);
+
     /**
      * @brief Sets the PVA field.
      * @param[in] pvFieldIn the pvField to set.
@@ -31,24 +31,46 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum time in milliseconds that the put thread waits for staged values (so that timed out puts are detected).
+ */
+static const uint32 EPICSPVA_OUTPUT_PUT_WAIT_MSEC = 100u;
+}
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 EPICSPVAOutput::EPICSPVAOutput() :
-        MemoryDataSourceI() {
+        MemoryDataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        putExecutor(*this) {
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
     numberOfBrokerBuffers = 0u;
     numberOfChannels = 0u;
     ignoreBufferOverrun = 1u;
     channelList = NULL_PTR(EPICSPVAChannelWrapper *);
+    if (!putEvent.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
 }
 
+/*lint -e{1551} must stop the SingleThreadService in the destructor.*/
 EPICSPVAOutput::~EPICSPVAOutput() {
+    if (!putEvent.Post()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not post EventSem.");
+    }
+    if (!putExecutor.Stop()) {
+        if (!putExecutor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    //The channels cancel their puts in flight, which may still post the putEvent.
     if (channelList != NULL_PTR(EPICSPVAChannelWrapper *)) {
         delete[] channelList;
     }
+    (void) putEvent.Close();
 }
 
 bool EPICSPVAOutput::Initialise(StructuredDataI & data) {
@@ -69,6 +91,8 @@ bool EPICSPVAOutput::Initialise(StructuredDataI & data) {
         if (!data.Read("IgnoreBufferOverrun", ignoreBufferOverrun)) {
             REPORT_ERROR(ErrorManagement::Information, "No IgnoreBufferOverrun defined. Using default = %d", ignoreBufferOverrun);
         }
+        putExecutor.SetStackSize(stackSize);
+        putExecutor.SetCPUMask(cpuMask);
 
     }
     if (ok) {
@@ -153,7 +177,12 @@ bool EPICSPVAOutput::AllocateMemory() {
     bool ok = MemoryDataSourceI::AllocateMemory();
     uint32 n;
     for (n = 0u; (n < numberOfChannels) && (ok); n++) {
-        ok = channelList[n].Setup(*this);
+        ok = channelList[n].Setup(*this, true);
+        channelList[n].SetPutEvent(&putEvent);
+    }
+    if (ok) {
+        putExecutor.SetName(GetName());
+        ok = (putExecutor.Start() == ErrorManagement::NoError);
     }
 
     return ok;
@@ -200,11 +229,40 @@ bool EPICSPVAOutput::Synchronise() {
     bool ok = true;
     uint32 n;
     for (n = 0u; (n < numberOfChannels) && (ok); n++) {
-        ok = channelList[n].Put();
+        ok = channelList[n].Stage();
+    }
+    if (!putEvent.Post()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not post EventSem.");
     }
     return ok;
 }
 
+ErrorManagement::ErrorType EPICSPVAOutput::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) putEvent.Wait(EPICSPVA_OUTPUT_PUT_WAIT_MSEC);
+        //Reset before flushing: the values staged before this point are sent by the Flush below, while a Post from Synchronise
+        //(or from a completed put) during the Flush keeps the event set, so that the next Wait returns immediately.
+        (void) putEvent.Reset();
+        uint32 n;
+        for (n = 0u; n < numberOfChannels; n++) {
+            (void) channelList[n].Flush();
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 EPICSPVAOutput::GetNumberOfChannels() const {
+    return numberOfChannels;
+}
+
+const EPICSPVAChannelWrapper *EPICSPVAOutput::GetChannel(const uint32 idx) const {
+    const EPICSPVAChannelWrapper *channel = NULL_PTR(const EPICSPVAChannelWrapper *);
+    if (idx < numberOfChannels) {
+        channel = &channelList[idx];
+    }
+    return channel;
+}
+
 bool EPICSPVAOutput::IsIgnoringBufferOverrun() const {
     return (ignoreBufferOverrun == 1u);
 }
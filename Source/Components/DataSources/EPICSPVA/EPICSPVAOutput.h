@@ -46,6 +46,11 @@ namespace MARTe {
  * @brief A DataSource which allows to output data into any number of records using the EPICS PVA client protocol.
  * Data is asynchronously written in the PVA in the context of a different thread (w.r.t. to the real-time thread).
  *
+ * The MemoryMapAsyncOutputBroker thread stages the newest values of all the channels (see EPICSPVAChannelWrapper::Stage) and
+ * a put thread starts the puts of all the channels at once, without waiting for the completion of each put. If a put of a channel is
+ * still in flight when new values are staged, only the newest values are sent after the put completes. The number of puts, of dropped
+ * (i.e. overwritten) values and the put latency of each channel are available through GetChannel().
+ *
  * Each signal root name defines the name of the record (signal).
  * The configuration syntax is (names are only given as an example):
  *
@@ -55,7 +60,7 @@ namespace MARTe {
  * +EPICSPVAOutput_1 = {
  *     Class = EPICSPVADataSource::EPICSPVAOutput
  *     StackSize = 1048576 //Optional the EmbeddedThread stack size. Default value is THREADS_DEFAULT_STACKSIZE * 4u
- *     CPUs = 0xff //Optional the affinity of the EmbeddedThread which actually performs the PVA puts.
+ *     CPUs = 0xff //Optional the affinity of the EmbeddedThreads which stage and actually perform the PVA puts.
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the values. Each buffer is capable of holding a copy of all the DataSourceI signals.
  *     Signals = {
@@ -79,7 +84,7 @@ namespace MARTe {
  *
  * </pre>
  */
-class EPICSPVAOutput: public MemoryDataSourceI {
+class EPICSPVAOutput: public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -152,11 +157,31 @@ EPICSPVAOutput    ();
     virtual bool AllocateMemory();
 
     /**
-     * @brief Provides the context to execute all the EPICS calls.
-     * @return true if all the all the variables can be successfully set and exec.
+     * @brief Stages the signal values of all the channels and wakes the put thread.
+     * @details Does not wait for the puts to complete.
+     * @return true if all the channels are connected and the values can be staged.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Put thread callback. Starts the put of the staged values of all the channels without a put in flight.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
+    /**
+     * @brief Gets the number of channels.
+     * @return the number of channels.
+     */
+    uint32 GetNumberOfChannels() const;
+
+    /**
+     * @brief Gets a channel, e.g. to query its put statistics.
+     * @param[in] idx the index of the channel.
+     * @return the channel or NULL if idx is not valid.
+     */
+    const EPICSPVAChannelWrapper *GetChannel(const uint32 idx) const;
+
     /**
      * @brief See DataSourceI::GetOutputBrokers.
      * @details adds a memory MemoryMapOutputBroker instance to the outputBrokers
@@ -213,6 +238,16 @@ private:
      * The broker.
      */
     ReferenceT<MemoryMapAsyncOutputBroker> broker;
+
+    /**
+     * The thread which starts the puts.
+     */
+    SingleThreadService putExecutor;
+
+    /**
+     * Posted when values are staged or when a put completes.
+     */
+    EventSem putEvent;
 };
 }
 
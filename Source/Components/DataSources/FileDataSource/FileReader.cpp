@@ -24,6 +24,10 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -45,6 +49,7 @@
 namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
+static const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
 
 FileReader::FileReader() :
         DataSourceI(),
@@ -74,6 +79,9 @@ FileReader::FileReader() :
     allData.interalBufferIdx = 0u;
     allData.internalBuffer = NULL_PTR(char8*);
     allData.maxDataFileByteSize = 0u;
+    memoryMapped = false;
+    mappedMemory = NULL_PTR(void*);
+    mappedSize = 0u;
 }
 
 /*lint -e{1551} -e{1579} the destructor must guarantee that the memory is freed and the file is flushed and closed.. The brokerAsyncTrigger is freed by the ReferenceT */
@@ -87,6 +95,11 @@ FileReader::~FileReader() {
     if (signalsAnyType != NULL_PTR(AnyType*)) {
         delete[] signalsAnyType;
     }
+    if (mappedMemory != NULL_PTR(void*)) {
+        (void) munmap(mappedMemory, static_cast<size_t>(mappedSize));
+        //The internalBuffer points into the mapping
+        allData.internalBuffer = NULL_PTR(char8*);
+    }
     if (allData.internalBuffer != NULL_PTR(char8*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(allData.internalBuffer));
     }
@@ -250,7 +263,6 @@ bool FileReader::Synchronise() {
             if (inputFile.Position() == inputFile.Size()) {
                 if (eofBehaviour == EOFRewind) {
                     if (fileFormat == FILE_FORMAT_BINARY) {
-                        const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
                         uint32 headerSize = static_cast<uint32>(sizeof(uint16));
                         headerSize += SIGNAL_NAME_MAX_SIZE;
                         headerSize += static_cast<uint32>(sizeof(uint32));
@@ -359,7 +371,17 @@ bool FileReader::Initialise(StructuredDataI &data) {
             preload = false;
         }
         else {
-            if (preloadStr == "yes") {
+            if (preloadStr == "mmap") {
+                preload = true;
+                memoryMapped = true;
+                if (fileFormat == FILE_FORMAT_CSV) {
+                    if (!data.Read("IndexFilename", indexFilename)) {
+                        indexFilename.Printf("%s.idx", filename.Buffer());
+                    }
+                    REPORT_ERROR(ErrorManagement::Information, "IndexFilename set to %s", indexFilename.Buffer());
+                }
+            }
+            else if (preloadStr == "yes") {
                 const uint32 maxAllowedSizeFile = 4000000000u;
                 preload = true;
                 if (!data.Read("MaxFileByteSize", allData.maxDataFileByteSize)) {
@@ -585,9 +607,8 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
     //Allocate memory
     if (ok) {
         dataSourceMemory = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
-        if (preload) { //Get the size of the file and allocate memory
+        if ((preload) && (!memoryMapped)) { //Get the size of the file and allocate memory
             if (fileFormat == FILE_FORMAT_BINARY) {
-                const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
                 uint32 headerSize = static_cast<uint32>(sizeof(uint16));
                 headerSize += SIGNAL_NAME_MAX_SIZE;
                 headerSize += static_cast<uint32>(sizeof(uint32));
@@ -665,7 +686,24 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
-    if (ok && preload) { //Read all the file
+    if (ok && memoryMapped) {
+        if (fileFormat == FILE_FORMAT_BINARY) {
+            ok = MapFile(filename.Buffer());
+        }
+        else {
+            if (!IsCSVIndexValid()) {
+                REPORT_ERROR(ErrorManagement::Information, "Converting %s into the index file %s", filename.Buffer(), indexFilename.Buffer());
+                ok = BuildCSVIndex();
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to write the index file %s", indexFilename.Buffer());
+                }
+            }
+            if (ok) {
+                ok = MapFile(indexFilename.Buffer());
+            }
+        }
+    }
+    if (ok && preload && (!memoryMapped)) { //Read all the file
         if (fileFormat == FILE_FORMAT_BINARY) {
             ok = inputFile.Seek(inputFile.Size() - allData.dataFileByteSize);
             uint64 remainingDataToRead = allData.dataFileByteSize;
@@ -828,7 +866,6 @@ ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
                 /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
                 fatalFileError = !inputFile.Read(reinterpret_cast<char8*>(&signalType.all), readSize);
 
-                const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
                 char8 signalNameMemory[SIGNAL_NAME_MAX_SIZE + 1u];
                 if (!fatalFileError) {
                     fatalFileError = !MemoryOperationsHelper::Set(&signalNameMemory[0], '\0', SIGNAL_NAME_MAX_SIZE + 1u);
@@ -874,6 +911,204 @@ ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
     ErrorManagement::ErrorType ret(!fatalFileError);
     return ret;
 }
+uint32 FileReader::GetBinaryHeaderSize() {
+    uint32 headerSize = static_cast<uint32>(sizeof(uint16));
+    headerSize += SIGNAL_NAME_MAX_SIZE;
+    headerSize += static_cast<uint32>(sizeof(uint32));
+    headerSize *= GetNumberOfSignals();
+    headerSize += static_cast<uint32>(sizeof(uint32));
+    return headerSize;
+}
+
+bool FileReader::BuildBinaryHeader(char8 * const header) {
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint32 idx = 0u;
+    /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Copy function.*/
+    bool ok = MemoryOperationsHelper::Copy(&header[idx], reinterpret_cast<const char8*>(&nOfSignals), static_cast<uint32>(sizeof(uint32)));
+    idx += static_cast<uint32>(sizeof(uint32));
+    uint32 n;
+    for (n = 0u; (n < nOfSignals) && (ok); n++) {
+        uint16 signalType = GetSignalType(n).all;
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Copy function.*/
+        ok = MemoryOperationsHelper::Copy(&header[idx], reinterpret_cast<const char8*>(&signalType), static_cast<uint32>(sizeof(uint16)));
+        idx += static_cast<uint32>(sizeof(uint16));
+        StreamString signalName;
+        if (ok) {
+            ok = GetSignalName(n, signalName);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&header[idx], '\0', SIGNAL_NAME_MAX_SIZE);
+        }
+        if (ok) {
+            uint32 copySize = static_cast<uint32>(signalName.Size());
+            if (copySize > SIGNAL_NAME_MAX_SIZE) {
+                copySize = SIGNAL_NAME_MAX_SIZE;
+            }
+            ok = MemoryOperationsHelper::Copy(&header[idx], signalName.Buffer(), copySize);
+        }
+        idx += SIGNAL_NAME_MAX_SIZE;
+        uint32 nOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(n, nOfElements);
+        }
+        if (ok) {
+            /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Copy function.*/
+            ok = MemoryOperationsHelper::Copy(&header[idx], reinterpret_cast<const char8*>(&nOfElements), static_cast<uint32>(sizeof(uint32)));
+        }
+        idx += static_cast<uint32>(sizeof(uint32));
+    }
+    return ok;
+}
+
+bool FileReader::IsCSVIndexValid() {
+    struct stat csvStat;
+    struct stat indexStat;
+    bool valid = (stat(filename.Buffer(), &csvStat) == 0);
+    if (valid) {
+        valid = (stat(indexFilename.Buffer(), &indexStat) == 0);
+    }
+    if (valid) {
+        //Must have been written after the last change of the csv file
+        if (indexStat.st_mtim.tv_sec == csvStat.st_mtim.tv_sec) {
+            valid = (indexStat.st_mtim.tv_nsec > csvStat.st_mtim.tv_nsec);
+        }
+        else {
+            valid = (indexStat.st_mtim.tv_sec > csvStat.st_mtim.tv_sec);
+        }
+    }
+    uint32 headerSize = GetBinaryHeaderSize();
+    if (valid) {
+        uint64 indexSize = static_cast<uint64>(indexStat.st_size);
+        valid = (indexSize > headerSize);
+        if (valid) {
+            valid = (((indexSize - headerSize) % numberOfBinaryBytes) == 0u);
+        }
+    }
+    if (valid) {
+        char8 *expectedHeader = new char8[headerSize];
+        char8 *indexHeader = new char8[headerSize];
+        valid = BuildBinaryHeader(expectedHeader);
+        File indexFile;
+        if (valid) {
+            valid = indexFile.Open(indexFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+        }
+        if (valid) {
+            uint32 readSize = headerSize;
+            valid = indexFile.Read(indexHeader, readSize);
+            if (valid) {
+                valid = (readSize == headerSize);
+            }
+            (void) indexFile.Close();
+        }
+        if (valid) {
+            valid = (MemoryOperationsHelper::Compare(expectedHeader, indexHeader, headerSize) == 0);
+        }
+        delete[] expectedHeader;
+        delete[] indexHeader;
+    }
+    return valid;
+}
+
+bool FileReader::BuildCSVIndex() {
+    Directory toDelete(indexFilename.Buffer());
+    (void) toDelete.Delete();
+    File indexFile;
+    bool ok = indexFile.Open(indexFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+    if (ok) {
+        uint32 headerSize = GetBinaryHeaderSize();
+        char8 *header = new char8[headerSize];
+        ok = BuildBinaryHeader(header);
+        if (ok) {
+            uint32 writeSize = headerSize;
+            ok = indexFile.Write(header, writeSize);
+            if (ok) {
+                ok = (writeSize == headerSize);
+            }
+        }
+        delete[] header;
+    }
+    if (ok) {
+        ok = inputFile.Seek(0LLU);
+    }
+    if (ok) {
+        StreamString headerline;
+        ok = inputFile.GetLine(headerline); //Skip header
+    }
+    bool endFile = false;
+    if (ok) {
+        endFile = (inputFile.Position() == inputFile.Size());
+    }
+    while ((ok) && (!endFile)) {
+        ok = ReadLineCSVFormat();
+        if (ok) {
+            uint32 writeSize = numberOfBinaryBytes;
+            ok = indexFile.Write(dataSourceMemory, writeSize);
+            if (ok) {
+                ok = (writeSize == numberOfBinaryBytes);
+            }
+        }
+        endFile = (inputFile.Position() == inputFile.Size());
+    }
+    if (indexFile.IsOpen()) {
+        if (!indexFile.Close()) {
+            ok = false;
+        }
+    }
+    if (!ok) {
+        //Do not leave a partial index behind
+        (void) toDelete.Delete();
+    }
+    return ok;
+}
+
+bool FileReader::MapFile(const char8 * const mapFilename) {
+    uint64 headerSize = static_cast<uint64>(GetBinaryHeaderSize());
+    int32 fd = open(mapFilename, O_RDONLY);
+    bool ok = (fd >= 0);
+    struct stat fileStat;
+    if (ok) {
+        ok = (fstat(fd, &fileStat) == 0);
+    }
+    uint64 fileSize = 0u;
+    if (ok) {
+        fileSize = static_cast<uint64>(fileStat.st_size);
+        ok = (fileSize > headerSize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The file %s has no data to be mapped", mapFilename);
+        }
+    }
+    if (ok) {
+        allData.dataFileByteSize = fileSize - headerSize;
+        //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 as otherwise SetConfiguredDatabase would have failed.
+        ok = ((allData.dataFileByteSize % numberOfBinaryBytes) == 0u);
+        if (!ok) {
+            REPORT_ERROR(
+                    ErrorManagement::InitialisationError,
+                    "The total data file size is not a multiple of the data to read each cycle. allData.dataFileByteSize = %u, data to read for each cycle = %u ",
+                    allData.dataFileByteSize, numberOfBinaryBytes);
+        }
+    }
+    if (ok) {
+        void *mapping = mmap(NULL_PTR(void*), static_cast<size_t>(fileSize), PROT_READ, MAP_PRIVATE, fd, 0);
+        ok = (mapping != MAP_FAILED);
+        if (ok) {
+            mappedMemory = mapping;
+            mappedSize = fileSize;
+            //Replay is sequential: let the kernel read ahead
+            (void) madvise(mapping, static_cast<size_t>(fileSize), MADV_SEQUENTIAL);
+            allData.internalBuffer = &(reinterpret_cast<char8*>(mapping)[headerSize]);
+            allData.interalBufferIdx = 0u;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to memory map the file %s", mapFilename);
+        }
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    return ok;
+}
+
 bool FileReader::ReadLineCSVFormat() {
     StreamString token;
     char8 saveTerminator;
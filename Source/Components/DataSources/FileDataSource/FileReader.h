@@ -62,6 +62,10 @@ namespace MARTe {
  *  by exactly 32 bytes to encode the signal name, followed by 4 bytes which store the number of elements of a given signal.
  *  Following the header, the signal samples are consecutively stored in binary format.
  *
+ * If Preload = "mmap" the data is not copied into memory. Binary files are memory mapped and each cycle is copied straight from the mapping.
+ *  Csv files are converted once, when configuring, into a binary index file (with the binary format described above) which is then memory mapped.
+ *  The index is reused, without being converted again, as long as it is more recent than the csv file and its header matches the csv signals.
+ *
  * This DataSourceI has the function CloseFile registered as an RPCs.
  *
  * Only one and one GAM is allowed to read from this DataSourceI.
@@ -80,7 +84,8 @@ namespace MARTe {
  *     XAxisSignal = "Time" //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. Name of the signal containing the independent variable to generate the interpolation samples.
  *     InterpolationPeriod = 1000 //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. InterpolatedXAxisSignal += InterpolationPeriod. It will be read as an uint64.
  *     EOF = "Rewind" //Optional behaviour to have when reaching the end of the file. If not set EOF = "Rewind". Possible options are: "Error", "Rewind" and "Last". If "Rewind" the file will be read from the start; if "Error" an error will be issues when EOF is reached; if "Last" the last read values are sent.
- *     Preload = "yes" //Optional. Default no. If set the file is load in memory when configuring.
+ *     Preload = "yes" //Optional. Default no. If "yes" the file is load in memory when configuring. If "mmap" the file is memory mapped (see below).
+ *     IndexFilename = "test.csv.idx" //Optional. Only meaningful if FileFormat = csv and Preload = mmap. Default is the Filename followed by .idx.
  *     MaxFileByteSize = 1000000 //Optional. Default 4 GB. The maximum data file size to be loaded in Bytes.
  *     //All the signals are automatically added against the information stored in the header of the input file (format described above).
  *     +Messages = { //Optional. If set a message will be fired every time one of the events below occur
@@ -247,6 +252,39 @@ private:
      */
     ErrorManagement::ErrorType OpenFile(StructuredDataI &cdb);
 
+    /**
+     * @brief Computes the size of the header of a binary file with the signals of this DataSourceI.
+     * @return the size of the binary header.
+     */
+    uint32 GetBinaryHeaderSize();
+
+    /**
+     * @brief Writes into \a header the binary file header with the signals of this DataSourceI.
+     * @param[out] header memory with at least GetBinaryHeaderSize() bytes.
+     * @return true if the header could be written.
+     */
+    bool BuildBinaryHeader(char8 * const header);
+
+    /**
+     * @brief Checks if the csv index file can be reused, i.e. if it is more recent than the csv file and
+     * if its header matches the signals of this DataSourceI.
+     * @return true if the index file can be reused.
+     */
+    bool IsCSVIndexValid();
+
+    /**
+     * @brief Converts all the lines of the csv file into the binary index file.
+     * @return true if the index file was successfully written.
+     */
+    bool BuildCSVIndex();
+
+    /**
+     * @brief Memory maps a binary file and sets the allData.internalBuffer to point at the first sample after the header.
+     * @param[in] mapFilename the name of the binary file to map.
+     * @return true if the file was successfully mapped and its data size is a multiple of the signals size.
+     */
+    bool MapFile(const char8 * const mapFilename);
+
     /**
      * Offset of each signal in the dataSourceMemory
      */
@@ -372,6 +410,26 @@ private:
 
     bool preload;
 
+    /**
+     * True if the data is memory mapped (Preload = mmap).
+     */
+    bool memoryMapped;
+
+    /**
+     * The name of the binary index file to be generated from a csv file when memoryMapped.
+     */
+    StreamString indexFilename;
+
+    /**
+     * Start of the memory mapped file (including the header).
+     */
+    void *mappedMemory;
+
+    /**
+     * Size of the memory mapped file.
+     */
+    uint64 mappedSize;
+
     struct preLoadedData {
         /**
          * maximum (configurable) data file size excluding the header!
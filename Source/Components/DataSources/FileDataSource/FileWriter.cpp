@@ -32,6 +32,7 @@
 #include "CLASSMETHODREGISTER.h"
 #include "Directory.h"
 #include "FileWriter.h"
+#include "StreamMemoryReference.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,6 +44,21 @@
 namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
+static const uint8 CSV_EMITTER_GENERIC = 0u;
+static const uint8 CSV_EMITTER_UINT8 = 1u;
+static const uint8 CSV_EMITTER_UINT16 = 2u;
+static const uint8 CSV_EMITTER_UINT32 = 3u;
+static const uint8 CSV_EMITTER_UINT64 = 4u;
+static const uint8 CSV_EMITTER_INT8 = 5u;
+static const uint8 CSV_EMITTER_INT16 = 6u;
+static const uint8 CSV_EMITTER_INT32 = 7u;
+static const uint8 CSV_EMITTER_INT64 = 8u;
+/**
+ * Maximum number of characters of a 64 bit integer printed in decimal (20 digits and the sign).
+ */
+static const uint32 CSV_MAX_INTEGER_CHARS = 21u;
+static const uint32 CSV_DEFAULT_BLOCK_SIZE = 65536u;
+static const uint32 CSV_MIN_BLOCK_SIZE = 64u;
 
 FileWriter::FileWriter() :
         DataSourceI(),
@@ -63,6 +79,14 @@ FileWriter::FileWriter() :
     refreshContent = 0u;
     fullNotation =0u;
     signalsAnyType = NULL_PTR(AnyType *);
+    csvEmitters = NULL_PTR(uint8 *);
+    csvPrefixes = NULL_PTR(StreamString *);
+    csvSuffixes = NULL_PTR(StreamString *);
+    csvSignalFormats = NULL_PTR(StreamString *);
+    csvBlock = NULL_PTR(char8 *);
+    csvBlockSize = CSV_DEFAULT_BLOCK_SIZE;
+    csvBlockUsed = 0u;
+    csvBlockSem.Create();
     filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -86,6 +110,21 @@ FileWriter::~FileWriter() {
         delete[] signalsAnyType;
     }
     (void) CloseFile();
+    if (csvEmitters != NULL_PTR(uint8 *)) {
+        delete[] csvEmitters;
+    }
+    if (csvPrefixes != NULL_PTR(StreamString *)) {
+        delete[] csvPrefixes;
+    }
+    if (csvSuffixes != NULL_PTR(StreamString *)) {
+        delete[] csvSuffixes;
+    }
+    if (csvSignalFormats != NULL_PTR(StreamString *)) {
+        delete[] csvSignalFormats;
+    }
+    if (csvBlock != NULL_PTR(char8 *)) {
+        delete[] csvBlock;
+    }
 }
 
 bool FileWriter::AllocateMemory() {
@@ -171,17 +210,19 @@ bool FileWriter::Synchronise() {
             }
         }
         else {
-            if ((signalsAnyType != NULL) && (fullNotation > 0u)) {
-                for(uint32 i=0u; i<numberOfSignals; i++){
-                    StreamString signalName;
-                    (void)GetSignalName(i, signalName);
-                    ok = outputFile.Printf("%s = %! %s", signalName.Buffer(), signalsAnyType[i], csvSeparator.Buffer());
-                }
+            ok = (csvBlock != NULL_PTR(char8 *));
+            if (ok) {
+                ok = (csvBlockSem.FastLock() == ErrorManagement::NoError);
             }
-            else {
-                ok = outputFile.PrintFormatted(csvPrintfFormat.Buffer(), signalsAnyType);
+            if (ok) {
+                ok = WriteCSVLine();
+                //The line must be in the file before it is overwritten in the next cycle
+                if ((ok) && (refreshContent > 0u)) {
+                    ok = DrainCSVBlock();
+                }
+                csvBlockSem.FastUnLock();
             }
-            if (refreshContent > 0u) {
+            if ((ok) && (refreshContent > 0u)) {
                 ok = outputFile.Flush();
             }
         }
@@ -208,6 +249,168 @@ bool FileWriter::PrepareNextState(const char8* const currentStateName,
     return true;
 }
 
+bool FileWriter::WriteCSVLine() {
+    bool ok = true;
+    uint32 n;
+    /*lint -e{613} csvEmitters, csvPrefixes, csvSuffixes, dataSourceMemory and offsets cannot be NULL as otherwise csvBlock would also be NULL*/
+    for (n = 0u; (n < numberOfSignals) && (ok); n++) {
+        ok = AppendCSVBlock(csvPrefixes[n].Buffer(), static_cast<uint32>(csvPrefixes[n].Size()));
+        uint8 emitter = csvEmitters[n];
+        if ((ok) && (emitter != CSV_EMITTER_GENERIC)) {
+            ok = ReserveCSVBlock(CSV_MAX_INTEGER_CHARS);
+        }
+        if (ok) {
+            const char8 * const memPtr = &dataSourceMemory[offsets[n]];
+            /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the emitter was compiled from the signal type, which is the type stored at this address.*/
+            switch (emitter) {
+            case CSV_EMITTER_UINT8:
+                EmitCSVUnsigned(static_cast<uint64>(*reinterpret_cast<const uint8 *>(memPtr)));
+                break;
+            case CSV_EMITTER_UINT16:
+                EmitCSVUnsigned(static_cast<uint64>(*reinterpret_cast<const uint16 *>(memPtr)));
+                break;
+            case CSV_EMITTER_UINT32:
+                EmitCSVUnsigned(static_cast<uint64>(*reinterpret_cast<const uint32 *>(memPtr)));
+                break;
+            case CSV_EMITTER_UINT64:
+                EmitCSVUnsigned(*reinterpret_cast<const uint64 *>(memPtr));
+                break;
+            case CSV_EMITTER_INT8:
+                EmitCSVSigned(static_cast<int64>(*reinterpret_cast<const int8 *>(memPtr)));
+                break;
+            case CSV_EMITTER_INT16:
+                EmitCSVSigned(static_cast<int64>(*reinterpret_cast<const int16 *>(memPtr)));
+                break;
+            case CSV_EMITTER_INT32:
+                EmitCSVSigned(static_cast<int64>(*reinterpret_cast<const int32 *>(memPtr)));
+                break;
+            case CSV_EMITTER_INT64:
+                EmitCSVSigned(*reinterpret_cast<const int64 *>(memPtr));
+                break;
+            default:
+                ok = EmitCSVGeneric(n);
+                break;
+            }
+        }
+        if (ok) {
+            ok = AppendCSVBlock(csvSuffixes[n].Buffer(), static_cast<uint32>(csvSuffixes[n].Size()));
+        }
+    }
+    return ok;
+}
+
+bool FileWriter::ReserveCSVBlock(const uint32 nBytes) {
+    bool ok = true;
+    if ((csvBlockSize - csvBlockUsed) < nBytes) {
+        ok = DrainCSVBlock();
+    }
+    return ok;
+}
+
+bool FileWriter::AppendCSVBlock(const char8 * const text,
+                                const uint32 nBytes) {
+    bool ok = true;
+    if (nBytes > 0u) {
+        if (nBytes > csvBlockSize) {
+            //Does not fit in the block at all. Preserve the order of the data and write directly.
+            ok = DrainCSVBlock();
+            if (ok) {
+                uint32 writeSize = nBytes;
+                ok = outputFile.Write(text, writeSize);
+                if (ok) {
+                    ok = (writeSize == nBytes);
+                }
+            }
+        }
+        else {
+            ok = ReserveCSVBlock(nBytes);
+            if (ok) {
+                /*lint -e{613} csvBlock cannot be NULL as otherwise Synchronise would not call WriteCSVLine*/
+                ok = MemoryOperationsHelper::Copy(&csvBlock[csvBlockUsed], text, nBytes);
+            }
+            if (ok) {
+                csvBlockUsed += nBytes;
+            }
+        }
+    }
+    return ok;
+}
+
+bool FileWriter::DrainCSVBlock() {
+    bool ok = true;
+    if (csvBlockUsed > 0u) {
+        uint32 writeSize = csvBlockUsed;
+        ok = outputFile.Write(csvBlock, writeSize);
+        if (ok) {
+            ok = (writeSize == csvBlockUsed);
+        }
+        csvBlockUsed = 0u;
+    }
+    return ok;
+}
+
+void FileWriter::EmitCSVUnsigned(uint64 value) {
+    char8 digits[CSV_MAX_INTEGER_CHARS];
+    uint32 first = CSV_MAX_INTEGER_CHARS;
+    do {
+        first--;
+        digits[first] = static_cast<char8>('0' + static_cast<char8>(value % 10u));
+        value /= 10u;
+    }
+    while (value > 0u);
+    while (first < CSV_MAX_INTEGER_CHARS) {
+        /*lint -e{613} csvBlock cannot be NULL as otherwise Synchronise would not call WriteCSVLine*/
+        csvBlock[csvBlockUsed] = digits[first];
+        csvBlockUsed++;
+        first++;
+    }
+}
+
+void FileWriter::EmitCSVSigned(const int64 value) {
+    uint64 magnitude = static_cast<uint64>(value);
+    if (value < 0) {
+        /*lint -e{613} csvBlock cannot be NULL as otherwise Synchronise would not call WriteCSVLine*/
+        csvBlock[csvBlockUsed] = '-';
+        csvBlockUsed++;
+        //Two's complement negation also holds for the most negative value
+        magnitude = (~magnitude) + 1u;
+    }
+    EmitCSVUnsigned(magnitude);
+}
+
+bool FileWriter::PrintCSVBlock(const uint32 n) {
+    uint32 freeSize = csvBlockSize - csvBlockUsed;
+    /*lint -e{613} csvBlock and signalsAnyType cannot be NULL as otherwise Synchronise would not call WriteCSVLine*/
+    StreamMemoryReference valueStream(&csvBlock[csvBlockUsed], freeSize);
+    bool printed = valueStream.PrintFormatted(csvSignalFormats[n].Buffer(), &signalsAnyType[n]);
+    uint32 printedSize = static_cast<uint32>(valueStream.Size());
+    //If all the free space was used the value might have been truncated
+    if (printed) {
+        printed = (printedSize < freeSize);
+    }
+    if (printed) {
+        csvBlockUsed += printedSize;
+    }
+    return printed;
+}
+
+bool FileWriter::EmitCSVGeneric(const uint32 n) {
+    bool ok = true;
+    bool printed = PrintCSVBlock(n);
+    if ((!printed) && (csvBlockUsed > 0u)) {
+        ok = DrainCSVBlock();
+        if (ok) {
+            printed = PrintCSVBlock(n);
+        }
+    }
+    if ((ok) && (!printed)) {
+        //Larger than the whole block (which is empty at this point): print directly into the file
+        /*lint -e{613} signalsAnyType cannot be NULL as otherwise Synchronise would not call WriteCSVLine*/
+        ok = outputFile.PrintFormatted(csvSignalFormats[n].Buffer(), &signalsAnyType[n]);
+    }
+    return ok;
+}
+
 bool FileWriter::Initialise(StructuredDataI& data) {
     bool ok = DataSourceI::Initialise(data);
     if (ok) {
@@ -269,6 +472,15 @@ bool FileWriter::Initialise(StructuredDataI& data) {
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "FileFormat=csv and CSVSeparator was not specified");
             }
+            if (ok) {
+                if (!data.Read("CSVBlockSize", csvBlockSize)) {
+                    csvBlockSize = CSV_DEFAULT_BLOCK_SIZE;
+                }
+                ok = (csvBlockSize >= CSV_MIN_BLOCK_SIZE);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "CSVBlockSize shall be >= %u", CSV_MIN_BLOCK_SIZE);
+                }
+            }
         }
     }
     if (ok) {
@@ -451,6 +663,10 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
         uint32 n;
         if (ok) {
             signalsAnyType = new AnyType[nOfSignals];
+            csvEmitters = new uint8[nOfSignals];
+            csvPrefixes = new StreamString[nOfSignals];
+            csvSuffixes = new StreamString[nOfSignals];
+            csvSignalFormats = new StreamString[nOfSignals];
         }
 
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
@@ -487,13 +703,14 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
             }
 
             TypeDescriptor signalType = GetSignalType(n);
+            StreamString signalFormat;
             if (customFormat) {
                 // Initialize a FormatDescriptor object to check that the parameter is a legal type descriptor
                 FormatDescriptor fd;
                 const char8* format_str = format.Buffer();
                 ok = fd.InitialiseFromString(format_str);
                 if (ok) {
-                    ok = csvPrintfFormat.Printf("%s%s", "%", format.Buffer());
+                    ok = signalFormat.Printf("%s%s", "%", format.Buffer());
                 }
                 else {
                     ok = false;
@@ -508,13 +725,13 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
                 bool isFloat = (signalType.type == Float);
                 if (ok) {
                     if (isUnsignedInteger) {
-                        ok = csvPrintfFormat.Printf("%s", "%u");
+                        ok = signalFormat.Printf("%s", "%u");
                     }
                     else if (isSignedInteger) {
-                        ok = csvPrintfFormat.Printf("%s", "%d");
+                        ok = signalFormat.Printf("%s", "%d");
                     }
                     else if (isFloat) {
-                        ok = csvPrintfFormat.Printf("%s", "%f");
+                        ok = signalFormat.Printf("%s", "%f");
                     }
                     else {
                         ok = false;
@@ -522,11 +739,78 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
                     }
                 }
             }
+            if (ok) {
+                ok = csvPrintfFormat.Printf("%s", signalFormat.Buffer());
+            }
+
+            //Compile the emitter. Full notation always prints the values with %!, ignoring the Format.
+            /*lint -e{613} csvEmitters, csvPrefixes, csvSuffixes and csvSignalFormats cannot be null as otherwise ok would be false*/
+            if (ok) {
+                bool defaultFormat = ((!customFormat) || (fullNotation > 0u));
+                bool isScalar = ((nElements == 1u) && (nDimensions == 0u));
+                csvEmitters[n] = CSV_EMITTER_GENERIC;
+                if ((defaultFormat) && (isScalar)) {
+                    if (signalType == UnsignedInteger8Bit) {
+                        csvEmitters[n] = CSV_EMITTER_UINT8;
+                    }
+                    else if (signalType == UnsignedInteger16Bit) {
+                        csvEmitters[n] = CSV_EMITTER_UINT16;
+                    }
+                    else if (signalType == UnsignedInteger32Bit) {
+                        csvEmitters[n] = CSV_EMITTER_UINT32;
+                    }
+                    else if (signalType == UnsignedInteger64Bit) {
+                        csvEmitters[n] = CSV_EMITTER_UINT64;
+                    }
+                    else if (signalType == SignedInteger8Bit) {
+                        csvEmitters[n] = CSV_EMITTER_INT8;
+                    }
+                    else if (signalType == SignedInteger16Bit) {
+                        csvEmitters[n] = CSV_EMITTER_INT16;
+                    }
+                    else if (signalType == SignedInteger32Bit) {
+                        csvEmitters[n] = CSV_EMITTER_INT32;
+                    }
+                    else if (signalType == SignedInteger64Bit) {
+                        csvEmitters[n] = CSV_EMITTER_INT64;
+                    }
+                    else {
+                        //Floats and other types keep being printed by the generic emitter
+                    }
+                }
+                if (fullNotation > 0u) {
+                    StreamString signalName;
+                    ok = GetSignalName(n, signalName);
+                    if (ok) {
+                        ok = csvPrefixes[n].Printf("%s = ", signalName.Buffer());
+                    }
+                    if (ok) {
+                        ok = csvSuffixes[n].Printf(" %s", csvSeparator.Buffer());
+                    }
+                    if (ok) {
+                        csvSignalFormats[n] = "%!";
+                    }
+                }
+                else {
+                    if (n != 0u) {
+                        csvPrefixes[n] = csvSeparator;
+                    }
+                    csvSignalFormats[n] = signalFormat;
+                }
+            }
         }
         if (ok) {
             ok = csvPrintfFormat.Printf("%s", "\n");
             REPORT_ERROR(ErrorManagement::Information, "CSV format is %s", csvPrintfFormat.Buffer());
         }
+        if (ok) {
+            if (fullNotation == 0u) {
+                /*lint -e{613} csvSuffixes cannot be null as otherwise ok would be false*/
+                csvSuffixes[nOfSignals - 1u] = "\n";
+            }
+            csvBlock = new char8[csvBlockSize];
+            csvBlockUsed = 0u;
+        }
     }
 
     if (ok){
@@ -539,6 +823,14 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
 }
 
 ErrorManagement::ErrorType FileWriter::OpenFile(StreamString filenameIn) {
+    //Lines still pending belong to the previously opened file
+    if (csvBlockSem.FastLock() == ErrorManagement::NoError) {
+        if ((outputFile.IsOpen()) && (!fatalFileError)) {
+            (void) DrainCSVBlock();
+        }
+        csvBlockUsed = 0u;
+        csvBlockSem.FastUnLock();
+    }
     filename = filenameIn;
     REPORT_ERROR(ErrorManagement::Information, "Going to open file with name %s", filename.Buffer());
     if (!overwrite) {
@@ -699,6 +991,15 @@ ErrorManagement::ErrorType FileWriter::FlushFile() {
             ok = brokerAsyncNoTrigger->Flush();
         }
     }
+    if (ok) {
+        if ((outputFile.IsOpen()) && (!fatalFileError)) {
+            ok = (csvBlockSem.FastLock() == ErrorManagement::NoError);
+            if (ok) {
+                ok = DrainCSVBlock();
+                csvBlockSem.FastUnLock();
+            }
+        }
+    }
     if (ok) {
         if (outputFile.IsOpen()) {
             ok = outputFile.Flush();
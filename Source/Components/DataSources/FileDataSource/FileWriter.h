@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "FastPollingMutexSem.h"
 #include "File.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
@@ -56,6 +57,9 @@ namespace MARTe {
  * A new line will be added every time all the signal samples are written.
  * The default number formats for a csv file are "%u" for unsigned integers, "%d" for signed integers and "%f" for floats.
  * A custom format can be chosen for each signal via the parameter "Format" (see signal SignalUInt16F in the example below) 
+ * The csv format is compiled once in SetConfiguredDatabase into a list of per-signal emitters: scalar integers with the default format are
+ * converted to text by specialised routines and all the other signals are printed with their pre-built format.
+ * Each line is formatted into a memory block (see CSVBlockSize below) which is written into the file only when full (or when the file is flushed).
  *
  * If the format is binary an header with the following information is created: the first 4 bytes
  * contain the number of signals. Then, for each signal, the signal type will be encoded in two bytes, followed
@@ -78,6 +82,7 @@ namespace MARTe {
  *     Overwrite = "yes" //Compulsory. If "yes" the file will be overwritten, otherwise new data will be added to the end of the existent file.
  *     FileFormat = "binary" //Compulsory. Possible values are: binary and csv.
  *     CSVSeparator = "," //Compulsory if Format=csv. Sets the file separator type.
+ *     CSVBlockSize = 65536 //Optional. Only meaningful if Format=csv. Size in bytes of the memory block where the csv lines are formatted before being written into the file. Default = 65536.
  *     StoreOnTrigger = 1 //Compulsory. If 0 all the data in the circular buffer is continuously stored. If 1 data is stored when the Trigger signal is 1 (see below).
  *     RefreshContent = 0 //Optional. If set, new data will always overwrite old data, keeping always the last snapshot. Also enables header pretty-printing, which is referred as "Full Notation".
  *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store before the trigger.
@@ -306,6 +311,65 @@ public:
 
 private:
 
+    /**
+     * @brief Formats the current value of all the signals, as a csv line, into the csvBlock.
+     * @return true if all the signals could be formatted and, if the csvBlock had to be drained, written into the file.
+     */
+    bool WriteCSVLine();
+
+    /**
+     * @brief Writes the csvBlock into the output file, if the csvBlock does not have at least \a nBytes free.
+     * @param[in] nBytes the number of bytes that are going to be appended to the csvBlock.
+     * @return true if the csvBlock did not need to be drained or if it was successfully written into the file.
+     */
+    bool ReserveCSVBlock(const uint32 nBytes);
+
+    /**
+     * @brief Appends \a nBytes of \a text to the csvBlock.
+     * @param[in] text the text to append.
+     * @param[in] nBytes the number of bytes to append.
+     * @return true if the text could be appended.
+     */
+    bool AppendCSVBlock(const char8 * const text,
+                        const uint32 nBytes);
+
+    /**
+     * @brief Writes all the bytes of the csvBlock into the output file and empties the csvBlock.
+     * @return true if the csvBlock was successfully written into the file.
+     */
+    bool DrainCSVBlock();
+
+    /**
+     * @brief Appends the decimal representation of \a value to the csvBlock.
+     * @param[in] value the value to append.
+     * @pre
+     *   ReserveCSVBlock(CSV_MAX_INTEGER_CHARS)
+     */
+    void EmitCSVUnsigned(uint64 value);
+
+    /**
+     * @brief Appends the decimal representation (with the minus sign if negative) of \a value to the csvBlock.
+     * @param[in] value the value to append.
+     * @pre
+     *   ReserveCSVBlock(CSV_MAX_INTEGER_CHARS)
+     */
+    void EmitCSVSigned(const int64 value);
+
+    /**
+     * @brief Prints the signal with index \a n into the free space of the csvBlock using its pre-built printf format.
+     * @param[in] n the signal index.
+     * @return true if the signal fitted in the free space of the csvBlock.
+     */
+    bool PrintCSVBlock(const uint32 n);
+
+    /**
+     * @brief Prints the signal with index \a n into the csvBlock (draining it first if required) using its pre-built printf format.
+     * @details Values which do not fit in an empty csvBlock are printed directly into the output file.
+     * @param[in] n the signal index.
+     * @return true if the signal could be printed.
+     */
+    bool EmitCSVGeneric(const uint32 n);
+
     /**
      * Copy of the original signal information. 
      * Needed to retrieve the "Format" parameter of the signals, not copied in configuredDatabase
@@ -392,6 +456,46 @@ private:
      */
     AnyType *signalsAnyType;
 
+    /**
+     * The emitter (one of the CSV_EMITTER_* values) that converts each signal into text.
+     */
+    uint8 *csvEmitters;
+
+    /**
+     * Text to be written before each signal value (i.e. the separator or, in full notation, the signal name).
+     */
+    StreamString *csvPrefixes;
+
+    /**
+     * Text to be written after each signal value (i.e. the new line or, in full notation, the separator).
+     */
+    StreamString *csvSuffixes;
+
+    /**
+     * The printf format of each signal, used by the signals that do not have a specialised emitter.
+     */
+    StreamString *csvSignalFormats;
+
+    /**
+     * Memory block where the csv lines are formatted before being written into the output file.
+     */
+    char8 *csvBlock;
+
+    /**
+     * Size of the csvBlock.
+     */
+    uint32 csvBlockSize;
+
+    /**
+     * Number of bytes of the csvBlock which are yet to be written into the output file.
+     */
+    uint32 csvBlockUsed;
+
+    /**
+     * Protects the csvBlock against concurrent accesses from the broker thread and from the RPC functions.
+     */
+    FastPollingMutexSem csvBlockSem;
+
     /**
      * If a fatal file error occurred do not try to flush segments nor do further writes.
      */
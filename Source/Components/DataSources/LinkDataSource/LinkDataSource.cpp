@@ -46,10 +46,19 @@ namespace MARTe {
 LinkDataSource::LinkDataSource() :
         MemoryDataSourceI() {
     isWriter = 0u;
+    zeroCopy = 0u;
+    gateMemory = NULL_PTR(const uint8 *);
+    borrowedBuffer = 0u;
+    borrowed = false;
+    borrowFailed = false;
 }
 
 LinkDataSource::~LinkDataSource() {
-
+    if (borrowed) {
+        if (link.IsValid()) {
+            (void) link->MemoryRelease(borrowedBuffer);
+        }
+    }
 }
 
 bool LinkDataSource::Initialise(StructuredDataI &data) {
@@ -66,6 +75,15 @@ bool LinkDataSource::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify IsWriter");
         }
     }
+    if (ret) {
+        if (!data.Read("ZeroCopy", zeroCopy)) {
+            zeroCopy = 0u;
+        }
+        ret = ((zeroCopy == 0u) || (isWriter == 0u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "ZeroCopy is only allowed for readers");
+        }
+    }
     if (ret) {
 
         link = ObjectRegistryDatabase::Instance()->Find(linkPath.Buffer());
@@ -83,7 +101,12 @@ const char8 *LinkDataSource::GetBrokerName(StructuredDataI &data, const SignalDi
     const char8* brokerName = NULL_PTR(const char8 *);
 
     if (direction == InputSignals) {
-        brokerName = "MemoryMapSynchronisedInputBroker";
+        if (zeroCopy > 0u) {
+            brokerName = "MemoryMapMultiBufferInputBroker";
+        }
+        else {
+            brokerName = "MemoryMapSynchronisedInputBroker";
+        }
     }
 
     if (direction == OutputSignals) {
@@ -98,24 +121,104 @@ bool LinkDataSource::AllocateMemory() {
     if (ret) {
         ret = link->SetMemorySize(totalMemorySize);
     }
+    if ((ret) && (zeroCopy > 0u)) {
+        gateMemory = link->GetBuffersMemory();
+        ret = (gateMemory != NULL_PTR(const uint8 *));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The link %s does not allow ZeroCopy", linkPath.Buffer());
+        }
+    }
+    return ret;
+}
+
+uint32 LinkDataSource::GetNumberOfMemoryBuffers() {
+    uint32 ret;
+    if (gateMemory != NULL_PTR(const uint8 *)) {
+        ret = link->GetNumberOfBuffers();
+    }
+    else {
+        ret = MemoryDataSourceI::GetNumberOfMemoryBuffers();
+    }
+    return ret;
+}
+
+bool LinkDataSource::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                           const uint32 bufferIdx,
+                                           void *&signalAddress) {
+    bool ret;
+    if (gateMemory != NULL_PTR(const uint8 *)) {
+        ret = ((signalIdx < numberOfSignals) && (bufferIdx < link->GetNumberOfBuffers()));
+        if (ret) {
+            //The broker adds the offset of the borrowed buffer (see GetInputOffset) to the address in the first buffer.
+            //The broker only reads from it.
+            /*lint -e{613} signalOffsets cannot be NULL after AllocateMemory*/
+            uint8 *memPtr = const_cast<uint8 *>(&gateMemory[(bufferIdx * totalMemorySize) + signalOffsets[signalIdx]]);
+            signalAddress = reinterpret_cast<void *&>(memPtr);
+        }
+    }
+    else {
+        ret = MemoryDataSourceI::GetSignalMemoryBuffer(signalIdx, bufferIdx, signalAddress);
+    }
+    return ret;
+}
+
+void LinkDataSource::PrepareInputOffsets() {
+    if (gateMemory != NULL_PTR(const uint8 *)) {
+        const uint8 *buffer = NULL_PTR(const uint8 *);
+        uint32 bufferIdx = 0u;
+        if (link->MemoryBorrow(buffer, bufferIdx)) {
+            if (borrowed) {
+                (void) link->MemoryRelease(borrowedBuffer);
+            }
+            borrowedBuffer = bufferIdx;
+            borrowed = true;
+            borrowFailed = false;
+        }
+        else {
+            //Keep on reading the previous buffer. Only the first failure of a sequence is reported.
+            if (!borrowFailed) {
+                REPORT_ERROR(ErrorManagement::Warning, "Failed MemoryBorrow(*): probably all the buffers are busy. Keeping the previous buffer");
+            }
+            borrowFailed = true;
+        }
+    }
+}
+
+/*lint -e{715} numberOfSamples not required for this implementation.*/
+bool LinkDataSource::GetInputOffset(const uint32 signalIdx,
+                                    const uint32 numberOfSamples,
+                                    uint32 &offset) {
+    bool ret = (signalIdx < numberOfSignals);
+    if (ret) {
+        if (gateMemory != NULL_PTR(const uint8 *)) {
+            offset = (borrowedBuffer * totalMemorySize);
+            ret = borrowed;
+        }
+        else {
+            offset = 0u;
+        }
+    }
     return ret;
 }
 
 bool LinkDataSource::Synchronise() {
     bool ret = true;
     if (isWriter > 0u) {
-        ret = link->MemoryWrite(memory);
-        if (!ret) {
+        //As before, a busy MemoryGate is reported but is not an error
+        if (!link->MemoryWrite(memory)) {
             REPORT_ERROR(ErrorManagement::Warning, "Failed MemoryWrite(*): probably all the buffers are busy");
         }
     }
-    else {
-        ret = link->MemoryRead(memory);
-        if (!ret) {
+    else if (zeroCopy == 0u) {
+        if (!link->MemoryRead(memory)) {
             REPORT_ERROR(ErrorManagement::Warning, "Failed MemoryRead(*): probably all the buffers are busy");
         }
     }
-    return true;
+    else {
+        //Nothing to copy, but there shall be a borrowed buffer to read from
+        ret = borrowed;
+    }
+    return ret;
 }
 
 /*lint -e{715} currentStateName and nextStateName are not referenced*/
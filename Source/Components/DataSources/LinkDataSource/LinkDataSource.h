@@ -49,12 +49,22 @@ namespace MARTe {
  * "IsWriter" that defines if this data source has to write or reads its signals memory from/to the linked
  * MemoryGate within the Synchronise() function.
  *
+ * @details The Link can also be a SharedMemoryGate, in which case the data is exchanged with the LinkDataSource
+ * instances of other MARTe processes linked to a SharedMemoryGate with the same SharedMemoryName.
+ *
+ * @details A reader can optionally set "ZeroCopy" to 1. In this case no copy is made in the Synchronise() function:
+ * at each cycle the last written buffer of the MemoryGate is borrowed (see MemoryGate::MemoryBorrow) and the broker
+ * copies the signals directly from it to the GAM memory. The buffer is given back at the next cycle, so that the MemoryGate
+ * should have at least two buffers to allow the writers to progress. Not all the MemoryGate implementations allow
+ * borrowing their buffers (e.g. the SharedMemoryGate does not).
+ *
  * @details Follows an example of configuration.
  * <pre>
  *  +InputDataSource1 = {
  *      Class = LinkDataSource
  *      Link = ExternalComponent1
  *      IsWriter = 0
+ *      ZeroCopy = 0 //Optional. Only for readers. Default = 0
  *  }
  *  </pre>
  */
@@ -69,7 +79,7 @@ public:
 LinkDataSource    ();
 
     /**
-     * @brief Destructor
+     * @brief Destructor. Gives back the borrowed buffer (if any).
      */
     virtual ~LinkDataSource();
 
@@ -77,23 +87,58 @@ LinkDataSource    ();
      * @see MemoryDataSourceI::AllocateMemory
      * @details calls MemoryGate::SetMemorySize to check if all the components
      * linked to the MemoryGate declare the same memory size.
-     * @return true if if all the components linked to the MemoryGate declare the same memory size.
+     * @return true if if all the components linked to the MemoryGate declare the same memory size and, if
+     * ZeroCopy = 1, if the MemoryGate allows borrowing its buffers.
      */
     virtual bool AllocateMemory();
 
+    /**
+     * @see MemoryDataSourceI::GetNumberOfMemoryBuffers
+     * @return the number of buffers of the MemoryGate if ZeroCopy = 1, MemoryDataSourceI::GetNumberOfMemoryBuffers() otherwise.
+     */
+    virtual uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @see MemoryDataSourceI::GetSignalMemoryBuffer
+     * @details If ZeroCopy = 1 the address is inside the buffer \a bufferIdx of the MemoryGate. The broker uses the address
+     * in the first buffer and adds the offset of the borrowed buffer (see GetInputOffset).
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+            const uint32 bufferIdx,
+            void *&signalAddress);
+
+    /**
+     * @see DataSourceI::PrepareInputOffsets
+     * @details If ZeroCopy = 1 borrows the last written buffer of the MemoryGate and gives back the previous one.
+     * If no buffer is available the previous one is kept (a warning is only reported for the first failure after a success).
+     */
+    virtual void PrepareInputOffsets();
+
+    /**
+     * @see DataSourceI::GetInputOffset
+     * @details If ZeroCopy = 1 returns the offset of the borrowed buffer, otherwise 0.
+     * @return false if ZeroCopy = 1 and no buffer could be borrowed yet.
+     */
+    virtual bool GetInputOffset(const uint32 signalIdx,
+            const uint32 numberOfSamples,
+            uint32 &offset);
+
     /**
      * @see ReferenceContainer::Initialise
      * @details The following configuration variables shall be defined:
      *   Link = "the link of the MemoryGate component"
      *   IsWriter = [0-1] specifies if the signals memory must be written or read in the Synchronise() function.
+     *   ZeroCopy = [0-1] (optional, only if IsWriter = 0) the broker reads directly from a borrowed MemoryGate buffer.
      * @return true if all the configuration parameters are correctly defined.
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @see DataSourceI::Synchronise.
-     * @details If IsWriter==1 calls MemoryGate::MwmoryWrite() otherwise it calls MemoryGate::MemoryRead.
-     * @return true.
+     * @details If IsWriter==1 calls MemoryGate::MwmoryWrite() otherwise it calls MemoryGate::MemoryRead (nothing is done
+     * if ZeroCopy = 1).
+     * @return false if ZeroCopy = 1 and no buffer could be borrowed yet, true otherwise (a failed MemoryWrite or MemoryRead
+     * is only reported as a warning).
      */
     virtual bool Synchronise();
 
@@ -105,7 +150,8 @@ LinkDataSource    ();
 
     /**
      * @brief Returns the broker name.
-     * @return If direction == InputSignals, returns MemoryMapSynchronisedMultiBufferInputBroker, otherwise returns MemoryMapSynchronisedMultiBufferOutputBroker.
+     * @return If direction == InputSignals, returns MemoryMapSynchronisedMultiBufferInputBroker (MemoryMapMultiBufferInputBroker if ZeroCopy = 1),
+     * otherwise returns MemoryMapSynchronisedMultiBufferOutputBroker.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
@@ -127,6 +173,31 @@ protected:
      */
     uint8 isWriter;
 
+    /**
+     * Denotes if the broker reads directly from the borrowed MemoryGate buffer.
+     */
+    uint8 zeroCopy;
+
+    /**
+     * The memory of the MemoryGate buffers (if zeroCopy).
+     */
+    const uint8 *gateMemory;
+
+    /**
+     * The index of the borrowed MemoryGate buffer.
+     */
+    uint32 borrowedBuffer;
+
+    /**
+     * True if a MemoryGate buffer is borrowed.
+     */
+    bool borrowed;
+
+    /**
+     * True if the last MemoryBorrow failed (to report only once a sequence of failures).
+     */
+    bool borrowFailed;
+
 };
 }
 
@@ -0,0 +1,318 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Source file for class LatencyHistogram
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LatencyHistogram (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LatencyHistogram.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief The tracked percentiles, in parts per 10000.
+ */
+static const uint64 LATENCY_HISTOGRAM_PERCENTILES[2] = { 9900u, 9990u };
+
+/**
+ * @brief Denominator of LATENCY_HISTOGRAM_PERCENTILES.
+ */
+static const uint64 LATENCY_HISTOGRAM_PERCENTILES_DEN = 10000u;
+
+/**
+ * @brief log2 of the number of bins (or of occupancy words) summarised by one occupancy word.
+ */
+static const uint32 LATENCY_HISTOGRAM_WORD_SHIFT = 5u;
+
+/**
+ * @brief Mask of the bit index inside an occupancy word.
+ */
+static const uint32 LATENCY_HISTOGRAM_WORD_MASK = 31u;
+
+/**
+ * @brief Index of the lowest set bit of a non-zero word.
+ */
+static inline uint32 LatencyHistogramLowestBit(const uint32 word) {
+    /*lint -e{9119} -e{970} GCC builtin, word is never zero.*/
+    return static_cast<uint32>(__builtin_ctz(word));
+}
+
+/**
+ * @brief Index of the highest set bit of a non-zero word.
+ */
+static inline uint32 LatencyHistogramHighestBit(const uint32 word) {
+    /*lint -e{9119} -e{970} GCC builtin, word is never zero.*/
+    return (LATENCY_HISTOGRAM_WORD_MASK - static_cast<uint32>(__builtin_clz(word)));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LatencyHistogram::LatencyHistogram() {
+    bins = NULL_PTR(uint32 *);
+    occupiedBins = NULL_PTR(uint32 *);
+    occupiedWords = NULL_PTR(uint32 *);
+    numberOfBins = 0u;
+    numberOfOccupiedBinsWords = 0u;
+    numberOfOccupiedWordsWords = 0u;
+    binWidth = 0u;
+    numberOfSamples = 0u;
+    minValue = 0xFFFFFFFFu;
+    maxValue = 0u;
+    lostCycles = 0u;
+    percentileBin[0] = 0u;
+    percentileBin[1] = 0u;
+    percentileCumulative[0] = 0u;
+    percentileCumulative[1] = 0u;
+}
+
+LatencyHistogram::~LatencyHistogram() {
+    if (bins != NULL_PTR(uint32 *)) {
+        delete[] bins;
+    }
+    if (occupiedBins != NULL_PTR(uint32 *)) {
+        delete[] occupiedBins;
+    }
+    if (occupiedWords != NULL_PTR(uint32 *)) {
+        delete[] occupiedWords;
+    }
+}
+
+bool LatencyHistogram::Create(const uint32 numberOfBinsIn,
+                              const uint32 binWidthIn) {
+    bool ok = (bins == NULL_PTR(uint32 *));
+    if (ok) {
+        ok = ((numberOfBinsIn > 0u) && (binWidthIn > 0u));
+    }
+    if (ok) {
+        numberOfBins = numberOfBinsIn;
+        binWidth = binWidthIn;
+        bins = new uint32[numberOfBins];
+        numberOfOccupiedBinsWords = ((numberOfBins - 1u) >> LATENCY_HISTOGRAM_WORD_SHIFT) + 1u;
+        numberOfOccupiedWordsWords = ((numberOfOccupiedBinsWords - 1u) >> LATENCY_HISTOGRAM_WORD_SHIFT) + 1u;
+        occupiedBins = new uint32[numberOfOccupiedBinsWords];
+        occupiedWords = new uint32[numberOfOccupiedWordsWords];
+        Reset();
+    }
+    return ok;
+}
+
+void LatencyHistogram::Reset() {
+    for (uint32 i = 0u; i < numberOfBins; i++) {
+        bins[i] = 0u;
+    }
+    for (uint32 i = 0u; i < numberOfOccupiedBinsWords; i++) {
+        occupiedBins[i] = 0u;
+    }
+    for (uint32 i = 0u; i < numberOfOccupiedWordsWords; i++) {
+        occupiedWords[i] = 0u;
+    }
+    numberOfSamples = 0u;
+    minValue = 0xFFFFFFFFu;
+    maxValue = 0u;
+    lostCycles = 0u;
+    percentileBin[0] = 0u;
+    percentileBin[1] = 0u;
+    percentileCumulative[0] = 0u;
+    percentileCumulative[1] = 0u;
+}
+
+void LatencyHistogram::Add(const uint32 value,
+                           const uint32 lostCyclesIn) {
+    uint32 binIdx = (value / binWidth);
+    if (binIdx >= numberOfBins) {
+        binIdx = (numberOfBins - 1u);
+    }
+    if (bins[binIdx] == 0u) {
+        uint32 wordIdx = (binIdx >> LATENCY_HISTOGRAM_WORD_SHIFT);
+        occupiedBins[wordIdx] |= (1u << (binIdx & LATENCY_HISTOGRAM_WORD_MASK));
+        occupiedWords[wordIdx >> LATENCY_HISTOGRAM_WORD_SHIFT] |= (1u << (wordIdx & LATENCY_HISTOGRAM_WORD_MASK));
+    }
+    bins[binIdx]++;
+    numberOfSamples++;
+    if (value < minValue) {
+        minValue = value;
+    }
+    if (value > maxValue) {
+        maxValue = value;
+    }
+    lostCycles += lostCyclesIn;
+    UpdatePercentile(0u, binIdx);
+    UpdatePercentile(1u, binIdx);
+}
+
+void LatencyHistogram::UpdatePercentile(const uint32 percentileIdx,
+                                        const uint32 binIdx) {
+    uint32 idx = percentileBin[percentileIdx];
+    uint64 cumulative = percentileCumulative[percentileIdx];
+    if (binIdx <= idx) {
+        cumulative++;
+    }
+    //1-based rank of the percentile
+    uint64 rank = ((numberOfSamples * LATENCY_HISTOGRAM_PERCENTILES[percentileIdx]) + (LATENCY_HISTOGRAM_PERCENTILES_DEN - 1u))
+            / LATENCY_HISTOGRAM_PERCENTILES_DEN;
+    //Empty bins are skipped through the occupancy words, so that both loops run at most once per sample
+    while ((cumulative < rank) && ((idx + 1u) < numberOfBins)) {
+        idx = NextOccupiedBin(idx);
+        cumulative += bins[idx];
+    }
+    while ((idx > 0u) && ((cumulative - bins[idx]) >= rank)) {
+        cumulative -= bins[idx];
+        idx = PreviousOccupiedBin(idx);
+    }
+    percentileBin[percentileIdx] = idx;
+    percentileCumulative[percentileIdx] = cumulative;
+}
+
+uint32 LatencyHistogram::NextOccupiedBin(const uint32 binIdx) const {
+    uint32 ret = (numberOfBins - 1u);
+    uint32 first = (binIdx + 1u);
+    uint32 wordIdx = (first >> LATENCY_HISTOGRAM_WORD_SHIFT);
+    uint32 word = (occupiedBins[wordIdx] & (0xFFFFFFFFu << (first & LATENCY_HISTOGRAM_WORD_MASK)));
+    bool found = (word != 0u);
+    if (found) {
+        ret = ((wordIdx << LATENCY_HISTOGRAM_WORD_SHIFT) + LatencyHistogramLowestBit(word));
+    }
+    else {
+        uint32 firstWord = (wordIdx + 1u);
+        uint32 i = (firstWord >> LATENCY_HISTOGRAM_WORD_SHIFT);
+        if (i < numberOfOccupiedWordsWords) {
+            word = (occupiedWords[i] & (0xFFFFFFFFu << (firstWord & LATENCY_HISTOGRAM_WORD_MASK)));
+        }
+        while ((!found) && (i < numberOfOccupiedWordsWords)) {
+            found = (word != 0u);
+            if (found) {
+                wordIdx = ((i << LATENCY_HISTOGRAM_WORD_SHIFT) + LatencyHistogramLowestBit(word));
+                ret = ((wordIdx << LATENCY_HISTOGRAM_WORD_SHIFT) + LatencyHistogramLowestBit(occupiedBins[wordIdx]));
+            }
+            else {
+                i++;
+                if (i < numberOfOccupiedWordsWords) {
+                    word = occupiedWords[i];
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+uint32 LatencyHistogram::PreviousOccupiedBin(const uint32 binIdx) const {
+    uint32 ret = 0u;
+    uint32 last = (binIdx - 1u);
+    uint32 wordIdx = (last >> LATENCY_HISTOGRAM_WORD_SHIFT);
+    uint32 word = (occupiedBins[wordIdx] & (0xFFFFFFFFu >> (LATENCY_HISTOGRAM_WORD_MASK - (last & LATENCY_HISTOGRAM_WORD_MASK))));
+    bool found = (word != 0u);
+    if (found) {
+        ret = ((wordIdx << LATENCY_HISTOGRAM_WORD_SHIFT) + LatencyHistogramHighestBit(word));
+    }
+    else if (wordIdx > 0u) {
+        uint32 lastWord = (wordIdx - 1u);
+        uint32 i = (lastWord >> LATENCY_HISTOGRAM_WORD_SHIFT);
+        word = (occupiedWords[i] & (0xFFFFFFFFu >> (LATENCY_HISTOGRAM_WORD_MASK - (lastWord & LATENCY_HISTOGRAM_WORD_MASK))));
+        bool end = false;
+        while ((!found) && (!end)) {
+            found = (word != 0u);
+            if (found) {
+                wordIdx = ((i << LATENCY_HISTOGRAM_WORD_SHIFT) + LatencyHistogramHighestBit(word));
+                ret = ((wordIdx << LATENCY_HISTOGRAM_WORD_SHIFT) + LatencyHistogramHighestBit(occupiedBins[wordIdx]));
+            }
+            else if (i > 0u) {
+                i--;
+                word = occupiedWords[i];
+            }
+            else {
+                end = true;
+            }
+        }
+    }
+    else {
+        //No occupied bin below binIdx
+    }
+    return ret;
+}
+
+uint32 LatencyHistogram::GetPercentile(const uint32 percentileIdx) const {
+    uint32 ret = 0u;
+    if (numberOfSamples > 0u) {
+        uint64 upperEdge = (static_cast<uint64>(percentileBin[percentileIdx]) + 1ull) * static_cast<uint64>(binWidth);
+        ret = maxValue;
+        //The last bin has no upper edge
+        if ((percentileBin[percentileIdx] + 1u) < numberOfBins) {
+            if (upperEdge < static_cast<uint64>(maxValue)) {
+                ret = static_cast<uint32>(upperEdge);
+            }
+        }
+    }
+    return ret;
+}
+
+uint32 LatencyHistogram::GetMin() const {
+    return (numberOfSamples > 0u) ? (minValue) : (0u);
+}
+
+uint32 LatencyHistogram::GetMax() const {
+    return maxValue;
+}
+
+uint32 LatencyHistogram::GetPercentile99() const {
+    return GetPercentile(0u);
+}
+
+uint32 LatencyHistogram::GetPercentile999() const {
+    return GetPercentile(1u);
+}
+
+uint32 LatencyHistogram::GetLostCycles() const {
+    return lostCycles;
+}
+
+uint64 LatencyHistogram::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+uint32 LatencyHistogram::GetNumberOfBins() const {
+    return numberOfBins;
+}
+
+uint32 LatencyHistogram::GetBinWidth() const {
+    return binWidth;
+}
+
+uint32 LatencyHistogram::GetBinCount(const uint32 binIdx) const {
+    uint32 ret = 0u;
+    if (binIdx < numberOfBins) {
+        ret = bins[binIdx];
+    }
+    return ret;
+}
+
+}
@@ -0,0 +1,236 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Header file for class LatencyHistogram
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LatencyHistogram
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_LATENCYHISTOGRAM_H_
+#define SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_LATENCYHISTOGRAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Fixed-bin histogram of the LinuxTimer wake-up lateness.
+ * @details The bins are allocated once (Create) and Add never allocates memory.
+ * Besides the bin counts, the minimum, the maximum, the 99% and the 99.9% percentiles and the number of lost cycles
+ * are available after every Add. The percentiles are tracked incrementally: each one keeps the bin where the percentile falls
+ * and the number of samples up to that bin, which moves at most to the next or to the previous non-empty bin per sample.
+ * The non-empty bins are found through a two-level occupancy bitmap (one bit per bin and one bit per 32 bins), so that Add
+ * costs at most numberOfBins / 1024 word tests (a single one for up to 1024 bins) whatever the number of empty bins skipped.
+ * The last bin also accumulates all the values which do not fit in the others.
+ */
+class LatencyHistogram {
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfBins() == 0
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Destructor. Frees the bins.
+     */
+    ~LatencyHistogram();
+
+    /**
+     * @brief Allocates the bins and resets the histogram.
+     * @param[in] numberOfBinsIn number of bins (the last bin also counts all the values >= numberOfBinsIn * binWidthIn).
+     * @param[in] binWidthIn width of each bin.
+     * @return true if numberOfBinsIn > 0, binWidthIn > 0 and the histogram was not already created.
+     */
+    bool Create(const uint32 numberOfBinsIn,
+                const uint32 binWidthIn);
+
+    /**
+     * @brief Clears the bins and all the statistics.
+     */
+    void Reset();
+
+    /**
+     * @brief Adds one sample to the histogram.
+     * @param[in] value the sample value.
+     * @param[in] lostCyclesIn number of cycles lost before this sample.
+     * @pre
+     *   Create()
+     */
+    void Add(const uint32 value,
+             const uint32 lostCyclesIn);
+
+    /**
+     * @brief Gets the minimum value added since the last Reset (0 if there are no samples).
+     */
+    uint32 GetMin() const;
+
+    /**
+     * @brief Gets the maximum value added since the last Reset.
+     */
+    uint32 GetMax() const;
+
+    /**
+     * @brief Gets the 99% percentile, given as the upper edge of its bin (GetMax() if lower or if it falls in the last bin).
+     */
+    uint32 GetPercentile99() const;
+
+    /**
+     * @brief Gets the 99.9% percentile, given as the upper edge of its bin (GetMax() if lower or if it falls in the last bin).
+     */
+    uint32 GetPercentile999() const;
+
+    /**
+     * @brief Gets the sum of the lost cycles added since the last Reset.
+     */
+    uint32 GetLostCycles() const;
+
+    /**
+     * @brief Gets the number of samples added since the last Reset.
+     */
+    uint64 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets the number of bins.
+     */
+    uint32 GetNumberOfBins() const;
+
+    /**
+     * @brief Gets the width of each bin.
+     */
+    uint32 GetBinWidth() const;
+
+    /**
+     * @brief Gets the number of samples in the bin \a binIdx (0 if binIdx >= GetNumberOfBins()).
+     */
+    uint32 GetBinCount(const uint32 binIdx) const;
+
+private:
+
+    /**
+     * @brief Moves the percentile \a percentileIdx to the bin which holds its rank after a sample was added to \a binIdx.
+     */
+    void UpdatePercentile(const uint32 percentileIdx,
+                          const uint32 binIdx);
+
+    /**
+     * @brief Gets the first non-empty bin after \a binIdx (the last bin if there is none).
+     * @pre
+     *   binIdx + 1 < numberOfBins
+     */
+    uint32 NextOccupiedBin(const uint32 binIdx) const;
+
+    /**
+     * @brief Gets the last non-empty bin before \a binIdx (0 if there is none).
+     * @pre
+     *   binIdx > 0
+     */
+    uint32 PreviousOccupiedBin(const uint32 binIdx) const;
+
+    /**
+     * @brief Converts the bin of the percentile \a percentileIdx into a value.
+     */
+    uint32 GetPercentile(const uint32 percentileIdx) const;
+
+    /**
+     * @brief The bin counts.
+     */
+    uint32 *bins;
+
+    /**
+     * @brief One bit per bin, set if the bin is not empty.
+     */
+    uint32 *occupiedBins;
+
+    /**
+     * @brief One bit per occupiedBins word, set if the word is not zero.
+     */
+    uint32 *occupiedWords;
+
+    /**
+     * @brief Number of words of occupiedBins.
+     */
+    uint32 numberOfOccupiedBinsWords;
+
+    /**
+     * @brief Number of words of occupiedWords.
+     */
+    uint32 numberOfOccupiedWordsWords;
+
+    /**
+     * @brief Number of bins.
+     */
+    uint32 numberOfBins;
+
+    /**
+     * @brief Width of each bin.
+     */
+    uint32 binWidth;
+
+    /**
+     * @brief Number of samples since the last Reset.
+     */
+    uint64 numberOfSamples;
+
+    /**
+     * @brief Minimum value since the last Reset.
+     */
+    uint32 minValue;
+
+    /**
+     * @brief Maximum value since the last Reset.
+     */
+    uint32 maxValue;
+
+    /**
+     * @brief Lost cycles since the last Reset.
+     */
+    uint32 lostCycles;
+
+    /**
+     * @brief Bin where each percentile falls.
+     */
+    uint32 percentileBin[2];
+
+    /**
+     * @brief Number of samples in the bins [0, percentileBin].
+     */
+    uint64 percentileCumulative[2];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_LATENCYHISTOGRAM_H_ */
+
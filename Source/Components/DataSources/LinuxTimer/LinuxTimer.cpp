@@ -36,6 +36,7 @@
 #include "MemoryMapSynchronisedInputBroker.h"
 #include "ObjectRegistryDatabase.h"
 #include "ReferenceContainerFilterReferences.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -55,6 +56,29 @@ const uint32 LINUX_TIMER_EXEC_MODE_SPAWNED = 2u;
  * @brief Maximum phase of the signal (default)
  */
 const uint32 USEC_IN_SEC = 1000000u;
+
+/**
+ * @brief Full memory barrier between the lateness histogram banks and the bank switch handshake.
+ */
+/*lint -estring(526,__sync_synchronize) -estring(628,__sync_synchronize) -estring(746,__sync_synchronize) -estring(1055,__sync_synchronize) The __sync_synchronize function is a GCC built-in function, so it does not have declaration.*/
+static inline void LinuxTimerBarrier() {
+    __sync_synchronize();
+}
+
+/**
+ * @brief Saturation value of the Lateness signal
+ */
+const uint32 LINUX_TIMER_MAX_LATENESS = 0xFFFFFFFFu;
+
+/**
+ * @brief Default number of bins of the lateness histogram.
+ */
+const uint32 LINUX_TIMER_HISTOGRAM_DEFAULT_BINS = 1000u;
+
+/**
+ * @brief Default width (ns) of the bins of the lateness histogram.
+ */
+const uint32 LINUX_TIMER_HISTOGRAM_DEFAULT_BIN_WIDTH = 1000u;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -64,6 +88,7 @@ namespace MARTe {
 LinuxTimer::LinuxTimer() :
         DataSourceI(),
         EmbeddedServiceMethodBinderI(),
+        MessageI(),
         executor(*this) {
     startTimeTicks = 0u;
     sleepTimeTicks[0] = 0u;
@@ -84,6 +109,22 @@ LinuxTimer::LinuxTimer() :
     phase = 0u;
     phaseBackup = phase;
     trigRephase = 0u;
+    lateness = 0u;
+    overruns = 0u;
+    for (uint32 i = 0u; i < 5u; i++) {
+        latencyStatistics[i] = 0u;
+    }
+    activeHistogram = 0u;
+    histogramDumpRequest = 0u;
+    histogramDumpAck = 0u;
+    histogramDumpPending = false;
+    histogramDumpSem.Create();
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 
     if (!synchSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
@@ -270,6 +311,27 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
         if (ok) {
             ticksPerUs = (static_cast<float64>(timeProvider->Frequency()) / 1.0e6);
         }
+
+        if (ok) {
+            uint32 histogramBins;
+            uint32 histogramBinWidth;
+            if (!data.Read("LatencyHistogramBins", histogramBins)) {
+                histogramBins = LINUX_TIMER_HISTOGRAM_DEFAULT_BINS;
+            }
+            if (!data.Read("LatencyHistogramBinWidth", histogramBinWidth)) {
+                histogramBinWidth = LINUX_TIMER_HISTOGRAM_DEFAULT_BIN_WIDTH;
+            }
+            ok = latencyHistogram[0].Create(histogramBins, histogramBinWidth);
+            if (ok) {
+                ok = latencyHistogram[1].Create(histogramBins, histogramBinWidth);
+            }
+            if (ok) {
+                REPORT_ERROR(ErrorManagement::Information, "Lateness histogram with %d bins of %d ns", histogramBins, histogramBinWidth);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "LatencyHistogramBins and LatencyHistogramBinWidth shall be > 0");
+            }
+        }
     }
     else {
         REPORT_ERROR(ErrorManagement::FatalError, "Failure in inner initialize function");
@@ -283,10 +345,10 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
     uint32 tempNumOfSignals = GetNumberOfSignals();
 
     if (ok) {
-        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 5u);
+        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 12u);
     }
     if (!ok) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 5");
+        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 12");
     }
     if (ok) {
         ok = (GetSignalType(0u).numberOfBits == 32u);
@@ -345,6 +407,30 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
         }
     }
 
+    if ((tempNumOfSignals > 5u) && (ok)) {
+        uint16 tempNumOfBits = GetSignalType(5u).numberOfBits;
+        ok = ((GetSignalType(5u).type == UnsignedInteger) && (tempNumOfBits == 32u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The sixth signal (Lateness) must be a 32 bit unsigned integer");
+        }
+    }
+
+    if ((tempNumOfSignals > 6u) && (ok)) {
+        uint16 tempNumOfBits = GetSignalType(6u).numberOfBits;
+        ok = ((GetSignalType(6u).type == UnsignedInteger) && (tempNumOfBits == 32u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The seventh signal (Overruns) must be a 32 bit unsigned integer");
+        }
+    }
+
+    for (uint32 i = 7u; (i < tempNumOfSignals) && (ok); i++) {
+        uint16 tempNumOfBits = GetSignalType(i).numberOfBits;
+        ok = ((GetSignalType(i).type == UnsignedInteger) && (tempNumOfBits == 32u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The latency statistics signals (index %d) must be 32 bit unsigned integers", i);
+        }
+    }
+
     if (ok) {
         ReferenceContainer result;
         ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, this);
@@ -380,6 +466,15 @@ bool LinuxTimer::GetSignalMemoryBuffer(const uint32 signalIdx,
     else if (signalIdx == 4u) {
         signalAddress = &trigRephase;
     }
+    else if (signalIdx == 5u) {
+        signalAddress = &lateness;
+    }
+    else if (signalIdx == 6u) {
+        signalAddress = &overruns;
+    }
+    else if (signalIdx < 12u) {
+        signalAddress = &latencyStatistics[signalIdx - 7u];
+    }
     else {
         ok = false;
     }
@@ -608,6 +703,35 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
         uint64 microsecs = static_cast<uint64>(seconds) * static_cast<uint64>(USEC_IN_SEC);
         deltaTime = (microsecs - absoluteTime_1);
         absoluteTime_1 = microsecs;
+        //startTimeTicks is now the deadline that was given to the TimeProvider
+        uint64 latenessTicks = 0u;
+        if (newCounter > startTimeTicks) {
+            latenessTicks = (newCounter - startTimeTicks);
+        }
+        float64 latenessNs = static_cast<float64>(latenessTicks) * (timeProvider->Period()) * 1e9;
+        if (latenessNs < static_cast<float64>(LINUX_TIMER_MAX_LATENESS)) {
+            lateness = static_cast<uint32>(latenessNs);
+        }
+        else {
+            lateness = LINUX_TIMER_MAX_LATENESS;
+        }
+        overruns = (nCycles > 1u) ? (nCycles - 1u) : 0u;
+        uint32 dumpRequest = histogramDumpRequest;
+        if (dumpRequest != histogramDumpAck) {
+            //The bank cleared by DumpLatencyHistogram before its request shall be seen cleared
+            LinuxTimerBarrier();
+            activeHistogram = (1u - activeHistogram);
+            //The samples of the retired bank shall be visible before the acknowledge
+            LinuxTimerBarrier();
+            histogramDumpAck = dumpRequest;
+        }
+        LatencyHistogram &histogram = latencyHistogram[activeHistogram];
+        histogram.Add(lateness, overruns);
+        latencyStatistics[0] = histogram.GetMin();
+        latencyStatistics[1] = histogram.GetMax();
+        latencyStatistics[2] = histogram.GetPercentile99();
+        latencyStatistics[3] = histogram.GetPercentile999();
+        latencyStatistics[4] = histogram.GetLostCycles();
     }
 
     if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
@@ -629,6 +753,56 @@ uint32 LinuxTimer::GetSleepPercentage() const {
     return sleepPercentage;
 }
 
+ErrorManagement::ErrorType LinuxTimer::DumpLatencyHistogram() {
+    ErrorManagement::ErrorType err = histogramDumpSem.FastLock();
+    if (err.ErrorsCleared()) {
+        //A request left by a previous timed out call is reused (and, if it was meanwhile acknowledged, directly reported)
+        if ((histogramDumpRequest == histogramDumpAck) && (!histogramDumpPending)) {
+            //The bank cleared by the previous call shall be visible before the timer thread can switch to it
+            LinuxTimerBarrier();
+            histogramDumpRequest++;
+        }
+        uint32 maxPeriodUsec = (timerPeriodUsecTime[0] > timerPeriodUsecTime[1]) ? (timerPeriodUsecTime[0]) : (timerPeriodUsecTime[1]);
+        uint32 timeoutMSec = ((2u * maxPeriodUsec) / 1000u) + 1000u;
+        uint32 waitedMSec = 0u;
+        while ((histogramDumpRequest != histogramDumpAck) && (waitedMSec < timeoutMSec)) {
+            Sleep::MSec(1u);
+            waitedMSec++;
+        }
+        if (histogramDumpRequest == histogramDumpAck) {
+            //The timer thread has moved to the other bank. Do not read the retired bank before the acknowledge.
+            LinuxTimerBarrier();
+            LatencyHistogram &retired = latencyHistogram[1u - activeHistogram];
+            REPORT_ERROR(ErrorManagement::Information, "Lateness histogram: samples = %!, min = %! ns, max = %! ns, p99 = %! ns, p99.9 = %! ns, lost cycles = %!",
+                         retired.GetNumberOfSamples(), retired.GetMin(), retired.GetMax(), retired.GetPercentile99(), retired.GetPercentile999(),
+                         retired.GetLostCycles());
+            uint32 binWidth = retired.GetBinWidth();
+            uint32 numberOfBins = retired.GetNumberOfBins();
+            for (uint32 i = 0u; i < numberOfBins; i++) {
+                uint32 binCount = retired.GetBinCount(i);
+                if (binCount > 0u) {
+                    if ((i + 1u) < numberOfBins) {
+                        REPORT_ERROR(ErrorManagement::Information, "[%!, %![ ns = %!", (i * binWidth), ((i + 1u) * binWidth), binCount);
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::Information, "[%!, inf[ ns = %!", (i * binWidth), binCount);
+                    }
+                }
+            }
+            //Cleared here (and not by the timer thread) so that the next switch is O(1) on the real-time side
+            retired.Reset();
+            histogramDumpPending = false;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Timeout, "The timer thread did not switch the lateness histogram bank in %! ms", timeoutMSec);
+            histogramDumpPending = true;
+            err = ErrorManagement::Timeout;
+        }
+        histogramDumpSem.FastUnLock();
+    }
+    return err;
+}
+
 void LinuxTimer::Purge(ReferenceContainer &purgeList) {
     if (rtApp.IsValid()) {
         rtApp->Purge(purgeList);
@@ -637,6 +811,7 @@ void LinuxTimer::Purge(ReferenceContainer &purgeList) {
 }
 
 CLASS_REGISTER(LinuxTimer, "1.0")
+CLASS_METHOD_REGISTER(LinuxTimer, DumpLatencyHistogram)
 
 }
 
@@ -34,7 +34,11 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "LatencyHistogram.h"
+#include "MessageI.h"
 #include "RealTimeApplication.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "SingleThreadService.h"
 #include "TimeProvider.h"
 
@@ -47,7 +51,7 @@ namespace MARTe {
  * @brief A DataSource which provides a timing source for a MARTe application.
  * @details The LinuxTimer provides a timing generation facility where generators can be conveniently plugged in.
  * The LinuxTimer itself comes with a default provider which is based on internal HighResolutionTimer.
- * The Timer can be configured with two, three, four or five signals and it shall
+ * The Timer can be configured with two to twelve signals and it shall
  * always have a frequency set in one of the signals.
  *
  * @details The default time provider (if no plugin is defined) is the HighResolutionTimeProvider. It relies on the implementation
@@ -67,6 +71,8 @@ namespace MARTe {
  *     SleepPercentage = 0 //Only meaningful if SleepNature = Busy. The percentage of time to sleep using the OS sleep.
  *     Phase = 1 //Optional, sets the phase of the timing generation, defaults to 0u
  *     CPUMask = 0x8 //Optional and only relevant if ExecutionMode=IndependentThread
+ *     LatencyHistogramBins = 1000 //Optional. Number of bins of the lateness histogram. Default: 1000
+ *     LatencyHistogramBinWidth = 1000 //Optional. Width (in nanoseconds) of each bin of the lateness histogram. Default: 1000
  *     +TimeProvider = { //Optional, if omitted defaults to HighResolutionTimeProvider
  *         //Can be any of the implementing types for the TimeProvider interface
            //Please refer to the specific time provider interface for configuration details
@@ -89,7 +95,28 @@ namespace MARTe {
  *         }
  *         TrigRephase = { //Optional, can be omitted
  *             Type = uint8 //Only type supported
- *         }*
+ *         }
+ *         Lateness = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         Overruns = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         LatenessMin = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         LatenessMax = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         LatenessP99 = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         LatenessP999 = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         LostCycles = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
  *     }
  * }
  * </pre>
@@ -108,15 +135,31 @@ namespace MARTe {
  *   - AbsoluteTime: uses TimeProvider::Counter and TimeProvider::Period to get an absolute time
  *   - DeltaTime: time difference between two cycles
  *   - TrigRephase: if equal to 1 rephases the time synchronisation when the Execute method is called.
+ *   - Lateness: time (in nanoseconds, saturated at 0xFFFFFFFF) elapsed between the cycle deadline and the wake-up.
+ *   - Overruns: number of periods which were entirely missed before the current cycle.
+ *   - LatenessMin, LatenessMax, LatenessP99, LatenessP999: minimum, maximum, 99% and 99.9% percentiles (in nanoseconds) of the Lateness
+ *     since the last DumpLatencyHistogram.
+ *   - LostCycles: sum of the Overruns since the last DumpLatencyHistogram.
+ *
+ * @details The Lateness of every cycle is stored in a histogram (see LatencyHistogram) whose bins are allocated in Initialise.
+ * The histogram has two banks. The RPC DumpLatencyHistogram asks the timer thread to switch bank in its next cycle, reports
+ * the retired bank (using REPORT_ERROR), clears it and returns, so that the timer thread never waits on the caller and the switch
+ * only flips the bank index. If the timer thread does not acknowledge the switch within two periods (plus one second), the RPC
+ * returns ErrorManagement::Timeout, the switch is performed as soon as the timer thread runs again and the retired bank is
+ * reported by the next DumpLatencyHistogram.
+ *
+ * @details For deterministic wake-ups the MonotonicTimeProvider can be used, which sleeps against absolute CLOCK_MONOTONIC deadlines
+ * (see MonotonicTimeProvider.h).
  *
  * @details When TrigRephase is equal to 1, the phase changes and it is kept across a state change if the data source is consumed in both current and next state.
  * If the data source is not used in the current state the phase will be reset to the configured one before the next state execution.
  */
-class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI {
+class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
      * @brief Default constructor
+     * @details Registers the RPC DumpLatencyHistogram callback function.
      * @post
      *   Counter = 0
      *   Time = 0
@@ -202,6 +245,12 @@ public:
      *         TrigRephase = { //Optional, can be omitted
      *             Type = uint8 //Only type supported
      *         }
+     *         Lateness = { //Optional
+     *             Type = uint32 //Only uint32 supported
+     *         }
+     *         Overruns = { //Optional
+     *             Type = uint32 //Only uint32 supported
+     *         }
      *     }
      * }
      * If the SleepNature=Busy a Sleep::Busy will be used to wait for the 1/Frequency period to elapse
@@ -236,6 +285,13 @@ public:
      */
     uint32 GetSleepPercentage() const;
 
+    /**
+     * @brief Reports and resets the lateness histogram (see class description).
+     * @details Can be called from any thread but the one which calls Execute.
+     * @return ErrorManagement::NoError if the timer thread acknowledged the bank switch, ErrorManagement::Timeout otherwise.
+     */
+    ErrorManagement::ErrorType DumpLatencyHistogram();
+
     /**
     * @brief Purges the DataSource
     */
@@ -359,6 +415,56 @@ private:
      * @brief Rephase triggering signals.
      */
     uint8 trigRephase;
+
+    /**
+     * @brief Nanoseconds elapsed between the deadline and the wake-up.
+     */
+    uint32 lateness;
+
+    /**
+     * @brief Number of periods missed before the current cycle.
+     */
+    uint32 overruns;
+
+    /**
+     * @brief LatenessMin, LatenessMax, LatenessP99, LatenessP999 and LostCycles signals.
+     */
+    uint32 latencyStatistics[5];
+
+    /**
+     * @brief The two banks of the lateness histogram.
+     */
+    LatencyHistogram latencyHistogram[2];
+
+    /**
+     * @brief The bank being written by the timer thread.
+     */
+    volatile uint32 activeHistogram;
+
+    /**
+     * @brief Incremented by DumpLatencyHistogram to request a bank switch.
+     */
+    volatile uint32 histogramDumpRequest;
+
+    /**
+     * @brief Set to histogramDumpRequest by the timer thread after the bank switch.
+     */
+    volatile uint32 histogramDumpAck;
+
+    /**
+     * @brief True if the last DumpLatencyHistogram timed out before reporting (and clearing) the retired bank.
+     */
+    bool histogramDumpPending;
+
+    /**
+     * @brief Serialises the DumpLatencyHistogram callers.
+     */
+    FastPollingMutexSem histogramDumpSem;
+
+    /**
+     * @brief The filter for the registered RPC.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
 };
 }
 
@@ -0,0 +1,195 @@
+/**
+ * @file MonotonicTimeProvider.cpp
+ * @brief Source file for class MonotonicTimeProvider
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MonotonicTimeProvider (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "MonotonicTimeProvider.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Number of nanoseconds in a second (i.e. the tick rate).
+ */
+static const uint64 MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC = 1000000000ull;
+
+/**
+ * @brief Number of nanoseconds in a microsecond (SpinTime unit).
+ */
+static const uint64 MONOTONIC_TIME_PROVIDER_NSEC_IN_USEC = 1000ull;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MonotonicTimeProvider::MonotonicTimeProvider() :
+        TimeProvider() {
+    spinTime = 0u;
+    timerFd = -1;
+    SleepUntilFunction = &MonotonicTimeProvider::ClockNanosleep;
+}
+
+MonotonicTimeProvider::~MonotonicTimeProvider() {
+    if (timerFd >= 0) {
+        if (close(timerFd) != 0) {
+            REPORT_ERROR(ErrorManagement::OSError, "Could not close the timerfd");
+        }
+    }
+}
+
+bool MonotonicTimeProvider::Initialise(StructuredDataI &data) {
+    bool returnValue = Object::Initialise(data);
+    if (returnValue) {
+        StreamString sleepMode;
+        if (!data.Read("SleepMode", sleepMode)) {
+            sleepMode = "ClockNanosleep";
+            REPORT_ERROR(ErrorManagement::Information, "SleepMode was not specified, using %s", sleepMode.Buffer());
+        }
+        if (sleepMode == "ClockNanosleep") {
+            SleepUntilFunction = &MonotonicTimeProvider::ClockNanosleep;
+        }
+        else if (sleepMode == "TimerFd") {
+            timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+            returnValue = (timerFd >= 0);
+            if (returnValue) {
+                SleepUntilFunction = &MonotonicTimeProvider::TimerFdSleep;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::OSError, "Could not create the timerfd");
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Specified SleepMode [%s] is not valid. Allowed [ClockNanosleep, TimerFd]", sleepMode.Buffer());
+            returnValue = false;
+        }
+    }
+    if (returnValue) {
+        uint32 spinTimeUsec = 0u;
+        if (!data.Read("SpinTime", spinTimeUsec)) {
+            spinTimeUsec = 0u;
+        }
+        spinTime = (static_cast<uint64>(spinTimeUsec) * MONOTONIC_TIME_PROVIDER_NSEC_IN_USEC);
+        REPORT_ERROR(ErrorManagement::Information, "Busy spinning %d us before each deadline", spinTimeUsec);
+    }
+    return returnValue;
+}
+
+uint64 MonotonicTimeProvider::Counter() {
+    struct timespec now;
+    uint64 ret = 0u;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0) {
+        ret = (static_cast<uint64>(now.tv_sec) * MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC) + static_cast<uint64>(now.tv_nsec);
+    }
+    return ret;
+}
+
+float64 MonotonicTimeProvider::Period() {
+    return (1.0 / static_cast<float64>(MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC));
+}
+
+uint64 MonotonicTimeProvider::Frequency() {
+    return MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC;
+}
+
+bool MonotonicTimeProvider::Sleep(const uint64 start,
+                                  const uint64 delta) {
+    bool ok = true;
+    uint64 deadline = (start + delta);
+    //Leave the kernel SpinTime before the deadline, so that the wake-up latency is absorbed by the spin
+    if (delta > spinTime) {
+        uint64 wakeUp = (deadline - spinTime);
+        if (wakeUp > Counter()) {
+            ok = (this->*SleepUntilFunction)(wakeUp);
+        }
+    }
+    while (Counter() < deadline) {
+        ;
+    }
+    return ok;
+}
+
+/*lint -e{1762} The function is a generic delegate which needs to match other signatures No const can be added*/
+bool MonotonicTimeProvider::ClockNanosleep(const uint64 deadline) {
+    struct timespec deadlineSpec;
+    deadlineSpec.tv_sec = static_cast<time_t>(deadline / MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC);
+    deadlineSpec.tv_nsec = static_cast<long>(deadline % MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC);
+    int32 err = EINTR;
+    //Being absolute, the same deadline can be used again if a signal interrupts the sleep
+    while (err == EINTR) {
+        err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadlineSpec, NULL_PTR(struct timespec *));
+    }
+    return (err == 0);
+}
+
+bool MonotonicTimeProvider::TimerFdSleep(const uint64 deadline) {
+    struct itimerspec timerSpec;
+    timerSpec.it_interval.tv_sec = 0;
+    timerSpec.it_interval.tv_nsec = 0;
+    timerSpec.it_value.tv_sec = static_cast<time_t>(deadline / MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC);
+    timerSpec.it_value.tv_nsec = static_cast<long>(deadline % MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC);
+    bool ok = (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &timerSpec, NULL_PTR(struct itimerspec *)) == 0);
+    if (ok) {
+        uint64 expirations = 0u;
+        ssize_t readSize = -1;
+        bool interrupted = true;
+        while (interrupted) {
+            readSize = read(timerFd, &expirations, sizeof(expirations));
+            interrupted = ((readSize < 0) && (errno == EINTR));
+        }
+        ok = (readSize == static_cast<ssize_t>(sizeof(expirations)));
+    }
+    return ok;
+}
+
+/*lint -e{715} The compatibility data has no meaning for this provider*/
+bool MonotonicTimeProvider::BackwardCompatibilityInit(StructuredDataI &compatibilityData) {
+    REPORT_ERROR(ErrorManagement::Warning, "SleepNature, SleepPercentage and TcnPoll are not used by the MonotonicTimeProvider. Use SleepMode and SpinTime instead.");
+    return true;
+}
+
+uint64 MonotonicTimeProvider::GetSpinTime() const {
+    return spinTime;
+}
+
+bool MonotonicTimeProvider::IsTimerFd() const {
+    return (timerFd >= 0);
+}
+
+CLASS_REGISTER(MonotonicTimeProvider, "1.0")
+}
@@ -0,0 +1,161 @@
+/**
+ * @file MonotonicTimeProvider.h
+ * @brief Header file for class MonotonicTimeProvider
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MonotonicTimeProvider
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_MONOTONICTIMEPROVIDER_H_
+#define SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_MONOTONICTIMEPROVIDER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "TimeProvider.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief TimeProvider plugin for the LinuxTimer DataSource which sleeps against absolute CLOCK_MONOTONIC deadlines.
+ * @details The ticks are CLOCK_MONOTONIC nanoseconds, so that start + delta (see TimeProvider::Sleep) is an absolute deadline
+ * and the wake-up error of a cycle does not accumulate in the following cycles.
+ * The thread sleeps in the kernel until SpinTime before the deadline and busy spins for the remaining time,
+ * so that only a fraction of the period is spent spinning.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +TimeProvider = {
+ *     Class = MonotonicTimeProvider
+ *     SleepMode = ClockNanosleep //Optional. ClockNanosleep (clock_nanosleep with TIMER_ABSTIME) or TimerFd (timerfd with TFD_TIMER_ABSTIME). Default: ClockNanosleep
+ *     SpinTime = 20 //Optional. Time (in microseconds) to busy spin before the deadline. Default: 0
+ * }
+ * </pre>
+ */
+class MonotonicTimeProvider: public TimeProvider {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor
+     * @post
+     *   SleepMode = ClockNanosleep
+     *   SpinTime = 0
+     */
+    MonotonicTimeProvider();
+
+    /**
+     * @brief Destructor. Closes the timerfd (if any).
+     */
+    virtual ~MonotonicTimeProvider();
+
+    /**
+     * @brief MARTe2 object initialisation
+     * @return true if the SleepMode is valid and the timerfd (if SleepMode = TimerFd) can be created.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Returns the CLOCK_MONOTONIC time
+     * @return The CLOCK_MONOTONIC time in nanoseconds
+     */
+    virtual uint64 Counter();
+
+    /**
+     * @brief Returns the period between ticks
+     * @return 1e-9
+     */
+    virtual float64 Period();
+
+    /**
+     * @brief Returns the tick rate
+     * @return 1e9
+     */
+    virtual uint64 Frequency();
+
+    /**
+     * @brief Sleeps until the absolute deadline start + delta, spinning during the last SpinTime.
+     * @details Returns immediately if the deadline has already elapsed.
+     * @param[in] start Starting count
+     * @param[in] delta Number of ticks (nanoseconds) after start
+     * @return true if the OS sleep did not fail.
+     */
+    virtual bool Sleep(const uint64 start,
+                       const uint64 delta);
+
+    /**
+     * @brief See TimeProvider::BackwardCompatibilityInit.
+     * @details The SleepNature, SleepPercentage and Tcn parameters have no meaning for this provider and are ignored.
+     * @return true.
+     */
+    virtual bool BackwardCompatibilityInit(StructuredDataI &compatibilityData);
+
+    /**
+     * @brief Gets the busy spin time in nanoseconds.
+     * @return the busy spin time in nanoseconds.
+     */
+    uint64 GetSpinTime() const;
+
+    /**
+     * @brief Checks if the sleep is implemented with a timerfd.
+     * @return true if SleepMode = TimerFd.
+     */
+    bool IsTimerFd() const;
+
+private:
+
+    /**
+     * @brief Pointer to the specific OS sleep implementation
+     */
+    bool (MonotonicTimeProvider::*SleepUntilFunction)(const uint64 deadline);
+
+    /**
+     * @brief Sleeps with clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME) until \a deadline.
+     */
+    bool ClockNanosleep(const uint64 deadline);
+
+    /**
+     * @brief Arms the timerfd with TFD_TIMER_ABSTIME on \a deadline and waits for its expiration.
+     */
+    bool TimerFdSleep(const uint64 deadline);
+
+    /**
+     * @brief Busy spin time in nanoseconds.
+     */
+    uint64 spinTime;
+
+    /**
+     * @brief The timerfd file descriptor (-1 if SleepMode = ClockNanosleep).
+     */
+    int32 timerFd;
+};
+}
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_MONOTONICTIMEPROVIDER_H_ */
+
@@ -39,6 +39,21 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+/**
+ * Maximum time in milliseconds that the prefetch thread waits for a Synchronise() when there is nothing to decode.
+ */
+static const uint32 MDS_READER_PREFETCH_WAIT_MSEC = 100u;
+
+/**
+ * @brief Full memory barrier around the tree request of the real-time thread.
+ */
+/*lint -estring(526,__sync_synchronize) -estring(628,__sync_synchronize) -estring(746,__sync_synchronize) -estring(1055,__sync_synchronize) The __sync_synchronize function is a GCC built-in function, so it does not have declaration.*/
+static inline void MDSReaderBarrier() {
+    __sync_synchronize();
+}
+}
+
 /*lint -estring(1960, "*MDSplus::*") -estring(1960, "*std::*") Ignore errors that do not belong to this DataSource namespace*/
 
 /*---------------------------------------------------------------------------*/
@@ -48,7 +63,9 @@
 namespace MARTe {
 
 MDSReader::MDSReader() :
-        DataSourceI() {
+        DataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        prefetchExecutor(*this) {
     tree = NULL_PTR(MDSplus::Tree *);
     nodeName = NULL_PTR(StreamString *);
     nodes = NULL_PTR(MDSplus::TreeNode **);
@@ -78,10 +95,62 @@ MDSReader::MDSReader() :
     elementsConsumed = NULL_PTR(uint32 *);
     endNode = NULL_PTR(bool *);
     nodeSamplingTime = NULL_PTR(float64 *);
+    segmentStart = NULL_PTR(float64 **);
+    segmentEnd = NULL_PTR(float64 **);
+    prefetchSegments = 0u;
+    numberOfCachedSegments = 1u;
+    segmentCache = NULL_PTR(MDSReaderSegment *);
+    prefetchCPUMask = 0u;
+    cacheMisses = 0u;
+    prefetchedSegments = 0u;
+    realTimeTreeRequest = 0;
+    treeMux.Create(false);
+    if (!prefetchSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the prefetch EventSem");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the MDSplus are deleted and the shared memory freed*/
 MDSReader::~MDSReader() {
+    if (prefetchSegments > 0u) {
+        if (!prefetchExecutor.Stop()) {
+            if (!prefetchExecutor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the prefetch SingleThreadService.");
+            }
+        }
+    }
+    (void) prefetchSem.Close();
+    if (segmentCache != NULL_PTR(MDSReaderSegment *)) {
+        uint32 nSlots = numberOfNodeNames * numberOfCachedSegments;
+        for (uint32 i = 0u; i < nSlots; i++) {
+            if (segmentCache[i].data != NULL_PTR(char8 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(segmentCache[i].data));
+            }
+            if (segmentCache[i].time != NULL_PTR(float64 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(segmentCache[i].time));
+            }
+        }
+        delete[] segmentCache;
+        segmentCache = NULL_PTR(MDSReaderSegment *);
+    }
+    if (segmentStart != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (segmentStart[i] != NULL_PTR(float64 *)) {
+                delete[] segmentStart[i];
+            }
+        }
+        delete[] segmentStart;
+        segmentStart = NULL_PTR(float64 **);
+    }
+    if (segmentEnd != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (segmentEnd[i] != NULL_PTR(float64 *)) {
+                delete[] segmentEnd[i];
+            }
+        }
+        delete[] segmentEnd;
+        segmentEnd = NULL_PTR(float64 **);
+    }
 
     if (tree != NULL_PTR(MDSplus::Tree *)) {
         delete tree;
@@ -209,6 +278,16 @@ bool MDSReader::Initialise(StructuredDataI& data) {
             period = 1.0 / frequency;
         }
     }
+    if (ok) {
+        if (!data.Read("PrefetchSegments", prefetchSegments)) {
+            prefetchSegments = 0u;
+        }
+        //the current segment, the K next ones and the previous one (which may still be read when a cycle crosses a segment boundary)
+        numberOfCachedSegments = (prefetchSegments > 0u) ? (prefetchSegments + 2u) : 1u;
+        if (data.Read("PrefetchCPUMask", prefetchCPUMask)) {
+            prefetchExecutor.SetCPUMask(prefetchCPUMask);
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -533,6 +612,20 @@ bool MDSReader::SetConfiguredDatabase(StructuredDataI & data) {
             ok = false;
         }
     }
+    if (ok) { //read the limits of all the segments once, so that the real-time thread never has to ask the tree
+        segmentStart = new float64*[numberOfNodeNames];
+        segmentEnd = new float64*[numberOfNodeNames];
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            segmentStart[i] = NULL_PTR(float64 *);
+            segmentEnd[i] = NULL_PTR(float64 *);
+        }
+        for (uint32 i = 0u; (i < numberOfNodeNames) && ok; i++) {
+            ok = BuildSegmentIndex(i);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Error reading the segment limits of the node %s", nodeName[i].Buffer());
+            }
+        }
+    }
     if (ok) { //read DataManagement from originalSignalInformation
         dataManagement = new uint8[numberOfNodeNames];
         nodeSamplingTime = new float64[numberOfNodeNames];
@@ -630,6 +723,26 @@ bool MDSReader::SetConfiguredDatabase(StructuredDataI & data) {
             endNode[i] = false;
         }
     }
+    if (ok) { //allocate the decoded segments cache
+        uint32 nSlots = numberOfNodeNames * numberOfCachedSegments;
+        segmentCache = new MDSReaderSegment[nSlots];
+        for (uint32 i = 0u; i < nSlots; i++) {
+            segmentCache[i].segment = -1;
+            segmentCache[i].nElements = 0u;
+            segmentCache[i].data = NULL_PTR(char8 *);
+            segmentCache[i].dataCapacity = 0u;
+            segmentCache[i].time = NULL_PTR(float64 *);
+            segmentCache[i].timeCapacity = 0u;
+            segmentCache[i].mux.Create(false);
+        }
+    }
+    if ((ok) && (prefetchSegments > 0u)) {
+        prefetchExecutor.SetName(GetName());
+        ok = (prefetchExecutor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the prefetch thread");
+        }
+    }
     return ok;
 }
 
@@ -642,6 +755,10 @@ bool MDSReader::Synchronise() {
     PublishTime();
     ok = !AllNodesEnd();
     timeCycle += period;
+    if (prefetchSegments > 0u) {
+        //lastSegment may have moved: wake up the prefetch thread
+        (void) prefetchSem.Post();
+    }
     return ok;
 }
 
@@ -952,17 +1069,14 @@ int8 MDSReader::FindSegment(const float64 t,
                             uint32 &segment,
                             const uint32 nodeIdx) {
     bool find = false;
-    MDSplus::Data *tminD;
-    MDSplus::Data *tmaxD;
     int8 retVal = -1;
     float64 tmax = 0.0;
     float64 tmin = 0.0;
     for (uint32 i = lastSegment[nodeIdx]; (i < maxNumberOfSegments[nodeIdx]) && (!find); i++) {
-        nodes[nodeIdx]->getSegmentLimits(static_cast<int32>(i), &tminD, &tmaxD);
-        tmax = tmaxD->getDouble();
+        tmax = segmentEnd[nodeIdx][i];
         if (t <= tmax) {
             find = true;
-            tmin = tminD->getDouble();
+            tmin = segmentStart[nodeIdx][i];
             if (t < tmin) {
                 //look the tmax Previous segment and verify if the difference is smaller than the
                 if (i < 2u) {
@@ -973,13 +1087,7 @@ int8 MDSReader::FindSegment(const float64 t,
                     lastSegment[nodeIdx] = i;
                 }
                 else {
-                    MDSplus::Data *tminPreviousD;
-                    MDSplus::Data *tmaxPreviousD;
-                    float64 tmaxPrevious;
-//                    float64 nodeSamplingTime = 0.0;
-                    nodes[nodeIdx]->getSegmentLimits(static_cast<int32>(i) - 1, &tminPreviousD, &tmaxPreviousD);
-                    tmaxPrevious = tmaxPreviousD->getDouble();
-//                    GetNodeSamplingTime(nodeIdx, nodeSamplingTime);
+                    float64 tmaxPrevious = segmentEnd[nodeIdx][i - 1u];
                     if ((tmin - tmaxPrevious) > (nodeSamplingTime[nodeIdx] * 1.5)) { //1.5 due o numeric errors. if a samples i s not saved the difference should be nodeSamplingTime * 2
                         retVal = 0;
                         //It is very important. Even the segment does not exist the index must be updated saying the next segment to be look for is this one.
@@ -992,8 +1100,6 @@ int8 MDSReader::FindSegment(const float64 t,
                         segment = i;
                         lastSegment[nodeIdx] = i;
                     }
-                    MDSplus::deleteData(tminPreviousD);
-                    MDSplus::deleteData(tmaxPreviousD);
                 }
             }
             else {
@@ -1002,8 +1108,6 @@ int8 MDSReader::FindSegment(const float64 t,
                 lastSegment[nodeIdx] = i;
             }
         }
-        MDSplus::deleteData(tminD);
-        MDSplus::deleteData(tmaxD);
     }
     return retVal;
 }
@@ -1013,27 +1117,14 @@ uint32 MDSReader::CheckDiscontinuityOfTheSegments(const uint32 nodeNumber,
                                                   const uint32 initialSegment,
                                                   const uint32 finalSegment) const {
     uint32 counter = 0u;
-    int32 maxSegment = static_cast<int32>(finalSegment) + 1;
-    MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
-    MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
-
-    float64 tmin = 0.0;
-    float64 tmax;
-
-//    float64 nodeTimeDiff;
-//    GetNodeSamplingTime(nodeNumber, nodeTimeDiff);
-    nodes[nodeNumber]->getSegmentLimits(static_cast<int32>(initialSegment), &tminD, &tmaxD);
-    tmax = tmaxD->getDouble();
-    for (int32 currentSegment = static_cast<int32>(initialSegment) + 1; currentSegment < maxSegment; currentSegment++) {
-        nodes[nodeNumber]->getSegmentLimits(currentSegment, &tminD, &tmaxD);
-        tmin = tminD->getDouble();
+    float64 tmax = segmentEnd[nodeNumber][initialSegment];
+    for (uint32 currentSegment = initialSegment + 1u; currentSegment <= finalSegment; currentSegment++) {
+        float64 tmin = segmentStart[nodeNumber][currentSegment];
         if ((tmin - tmax) > (nodeSamplingTime[nodeNumber] * 1.5)) {
             counter++;
         }
-        tmax = tmaxD->getDouble();
+        tmax = segmentEnd[nodeNumber][currentSegment];
     }
-    MDSplus::deleteData(tminD);
-    MDSplus::deleteData(tmaxD);
     return counter;
 }
 
@@ -1404,17 +1495,7 @@ bool MDSReader::FindDiscontinuity(const uint32 nodeNumber,
                                  float64 &beginningTime,
                                  float64 &endTime) const {
     bool find = false;
-//    bool error;
-    MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
-    MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
-
-    float64 tmin;
-    float64 tmax;
-
-//    float64 nodeTimeDiff;
-//    error = !GetNodeSamplingTime(nodeNumber, nodeTimeDiff);
-    nodes[nodeNumber]->getSegmentLimits(static_cast<int32>(segment), &tminD, &tmaxD);
-    tmin = tminD->getDouble();
+    float64 tmin = segmentStart[nodeNumber][segment];
 //Playing with tolerances
     float64 auxDiff = tmin - currentTime;
     if (auxDiff > 0.00000001) {                        //tolerance is 1/100MHz
@@ -1422,24 +1503,19 @@ bool MDSReader::FindDiscontinuity(const uint32 nodeNumber,
         find = true;
     }
     else {
-        tmax = tmaxD->getDouble();
-        int32 initialSemgnet = static_cast<int32>(segment) + 1;
-        for (int32 currentSegment = initialSemgnet; (currentSegment < static_cast<int32>(maxNumberOfSegments[nodeNumber])) && (!find); currentSegment++) {
-            nodes[nodeNumber]->getSegmentLimits(currentSegment, &tminD, &tmaxD);
-            tmin = tminD->getDouble();
+        float64 tmax = segmentEnd[nodeNumber][segment];
+        for (uint32 currentSegment = segment + 1u; (currentSegment < maxNumberOfSegments[nodeNumber]) && (!find); currentSegment++) {
+            tmin = segmentStart[nodeNumber][currentSegment];
             if ((tmin - tmax) > (nodeSamplingTime[nodeNumber] * 1.5)) {
                 beginningTime = tmax;
                 endTime = tmin;
                 find = true;
             }
-            tmax = tmaxD->getDouble();
-            segment = static_cast<uint32>(currentSegment);
+            tmax = segmentEnd[nodeNumber][currentSegment];
+            segment = currentSegment;
         }
     }
-    MDSplus::deleteData(tminD);
-    MDSplus::deleteData(tmaxD);
     return find;
-//    return (find && (!error));
 }
 
 //lint -e{613} Possible use of null pointer. Not possible. If initilisation fails this function is not called.
@@ -1601,6 +1677,242 @@ bool MDSReader::CopyRemainingData(const uint32 nodeNumber,
     return ret;
 }
 
+//lint -e{613} Possible use of null pointer. Not possible. Only called when the nodes are opened.
+bool MDSReader::BuildSegmentIndex(const uint32 idx) {
+    bool ok = true;
+    segmentStart[idx] = new float64[maxNumberOfSegments[idx]];
+    segmentEnd[idx] = new float64[maxNumberOfSegments[idx]];
+    for (uint32 i = 0u; (i < maxNumberOfSegments[idx]) && (ok); i++) {
+        MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
+        MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
+        try {
+            nodes[idx]->getSegmentLimits(static_cast<int32>(i), &tminD, &tmaxD);
+            segmentStart[idx][i] = tminD->getDouble();
+            segmentEnd[idx][i] = tmaxD->getDouble();
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Fail reading the limits of the segment %u: %s", i, exc.what());
+            ok = false;
+        }
+        if (tminD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(tminD);
+        }
+        if (tmaxD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(tmaxD);
+        }
+    }
+    return ok;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. If initialisation fails this function is not called.
+bool MDSReader::DecodeSegment(const uint32 nodeNumber,
+                              const uint32 segment,
+                              MDSReaderSegment &slot) {
+    //the raw copy does not need the time base of the segment
+    bool needsTime = (dataManagement[nodeNumber] != 0u);
+    slot.segment = -1;
+    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
+    MDSplus::Data *timeD = NULL_PTR(MDSplus::Data *);
+    void *samples = NULL_PTR(void *);
+    float64 *timeNode = NULL_PTR(float64 *);
+    int32 nElements = 0;
+    int32 nTimes = 0;
+    //MDSplus is not thread safe: only the calls to MDSplus are serialised, the copy to the cache slot is done after releasing the tree.
+    bool ok = (treeMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        try {
+            dataD = nodes[nodeNumber]->getSegment(static_cast<int32>(segment));
+            if (type[nodeNumber] == UnsignedInteger8Bit) {
+                samples = dataD->getByteUnsignedArray(&nElements);
+            }
+            else if (type[nodeNumber] == SignedInteger8Bit) {
+                samples = dataD->getByteArray(&nElements);
+            }
+            else if (type[nodeNumber] == UnsignedInteger16Bit) {
+                samples = dataD->getShortUnsignedArray(&nElements);
+            }
+            else if (type[nodeNumber] == SignedInteger16Bit) {
+                samples = dataD->getShortArray(&nElements);
+            }
+            else if (type[nodeNumber] == UnsignedInteger32Bit) {
+                samples = dataD->getIntUnsignedArray(&nElements);
+            }
+            else if (type[nodeNumber] == SignedInteger32Bit) {
+                samples = dataD->getIntArray(&nElements);
+            }
+            else if (type[nodeNumber] == UnsignedInteger64Bit) {
+                samples = dataD->getLongUnsignedArray(&nElements);
+            }
+            else if (type[nodeNumber] == SignedInteger64Bit) {
+                samples = dataD->getLongArray(&nElements);
+            }
+            else if (type[nodeNumber] == Float32Bit) {
+                samples = dataD->getFloatArray(&nElements);
+            }
+            else if (type[nodeNumber] == Float64Bit) {
+                samples = dataD->getDoubleArray(&nElements);
+            }
+            else {
+                ok = false;
+            }
+            if ((ok) && (needsTime)) {
+                timeD = nodes[nodeNumber]->getSegmentDim(static_cast<int32>(segment));
+                timeNode = timeD->getDoubleArray(&nTimes);
+            }
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Fail reading the segment %u of the node %s: %s", segment, nodeName[nodeNumber].Buffer(), exc.what());
+            ok = false;
+        }
+        if (dataD != NULL_PTR(MDSplus::Array *)) {
+            MDSplus::deleteData(dataD);
+        }
+        if (timeD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(timeD);
+        }
+        treeMux.FastUnLock();
+    }
+    //StoreSegmentData also frees the samples
+    if (samples != NULL_PTR(void *)) {
+        if (type[nodeNumber] == UnsignedInteger8Bit) {
+            StoreSegmentData<uint8>(slot, static_cast<uint8 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == SignedInteger8Bit) {
+            StoreSegmentData<int8>(slot, static_cast<int8 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == UnsignedInteger16Bit) {
+            StoreSegmentData<uint16>(slot, static_cast<uint16 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == SignedInteger16Bit) {
+            StoreSegmentData<int16>(slot, static_cast<int16 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == UnsignedInteger32Bit) {
+            StoreSegmentData<uint32>(slot, static_cast<uint32 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == SignedInteger32Bit) {
+            StoreSegmentData<int32>(slot, static_cast<int32 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == UnsignedInteger64Bit) {
+            StoreSegmentData<uint64>(slot, static_cast<uint64 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == SignedInteger64Bit) {
+            StoreSegmentData<int64>(slot, static_cast<int64 *>(samples), nElements);
+        }
+        else if (type[nodeNumber] == Float32Bit) {
+            StoreSegmentData<float32>(slot, static_cast<float32 *>(samples), nElements);
+        }
+        else {
+            StoreSegmentData<float64>(slot, static_cast<float64 *>(samples), nElements);
+        }
+    }
+    else {
+        ok = false;
+    }
+    if (ok) {
+        ok = (nElements > 0) && (slot.data != NULL_PTR(char8 *));
+    }
+    if ((ok) && (needsTime)) {
+        ok = (nTimes >= nElements);
+        if (ok) {
+            uint32 nElementsU = static_cast<uint32>(nElements);
+            if (nElementsU > slot.timeCapacity) {
+                if (slot.time != NULL_PTR(float64 *)) {
+                    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(slot.time));
+                }
+                slot.time = reinterpret_cast<float64 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(
+                        nElementsU * static_cast<uint32>(sizeof(float64))));
+                slot.timeCapacity = nElementsU;
+            }
+            ok = (slot.time != NULL_PTR(float64 *));
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(reinterpret_cast<void *>(slot.time), reinterpret_cast<void *>(timeNode),
+                                              static_cast<uint32>(nElements) * static_cast<uint32>(sizeof(float64)));
+        }
+    }
+    delete[] timeNode;
+    if (ok) {
+        slot.nElements = static_cast<uint32>(nElements);
+        slot.segment = static_cast<int32>(segment);
+    }
+    return ok;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. If initialisation fails this function is not called.
+MDSReaderSegment *MDSReader::AcquireSegment(const uint32 nodeNumber,
+                                            const uint32 segment) {
+    MDSReaderSegment *slot = &segmentCache[(nodeNumber * numberOfCachedSegments) + (segment % numberOfCachedSegments)];
+    bool ok = (slot->mux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        if (slot->segment != static_cast<int32>(segment)) {
+            //not prefetched (yet): decode it in this thread. The prefetch thread does not start reading another segment while this is set.
+            realTimeTreeRequest = 1;
+            MDSReaderBarrier();
+            ok = DecodeSegment(nodeNumber, segment, *slot);
+            MDSReaderBarrier();
+            realTimeTreeRequest = 0;
+            if (ok) {
+                cacheMisses++;
+            }
+        }
+        if (!ok) {
+            slot->mux.FastUnLock();
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Error getting the segment %u of the node %s", segment, nodeName[nodeNumber].Buffer());
+        slot = NULL_PTR(MDSReaderSegment *);
+    }
+    return slot;
+}
+
+void MDSReader::ReleaseSegment(MDSReaderSegment * const slot) const {
+    slot->mux.FastUnLock();
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. The thread is only started if the initialisation succeeds.
+ErrorManagement::ErrorType MDSReader::Execute(ExecutionInfo &info) {
+    if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
+        bool decoded = false;
+        for (uint32 i = 0u; (i < numberOfNodeNames) && (realTimeTreeRequest == 0); i++) {
+            //lastSegment only moves forward (in the real-time thread)
+            uint32 firstSegment = lastSegment[i];
+            uint32 endSegment = firstSegment + prefetchSegments + 1u;
+            for (uint32 s = firstSegment; (s < endSegment) && (s < maxNumberOfSegments[i]) && (realTimeTreeRequest == 0); s++) {
+                MDSReaderSegment &slot = segmentCache[(i * numberOfCachedSegments) + (s % numberOfCachedSegments)];
+                if (slot.segment != static_cast<int32>(s)) {
+                    if (slot.mux.FastLock() == ErrorManagement::NoError) {
+                        //check again as the real-time thread might have decoded it meanwhile
+                        if (slot.segment != static_cast<int32>(s)) {
+                            if (DecodeSegment(i, s, slot)) {
+                                prefetchedSegments++;
+                                decoded = true;
+                            }
+                        }
+                        slot.mux.FastUnLock();
+                    }
+                }
+            }
+        }
+        if (!decoded) {
+            (void) prefetchSem.ResetWait(MDS_READER_PREFETCH_WAIT_MSEC);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 MDSReader::GetCacheMisses() const {
+    return cacheMisses;
+}
+
+uint32 MDSReader::GetPrefetchedSegments() const {
+    return prefetchedSegments;
+}
+
+uint32 MDSReader::GetPrefetchSegments() const {
+    return prefetchSegments;
+}
+
 CLASS_REGISTER(MDSReader, "1.0")
 }
 
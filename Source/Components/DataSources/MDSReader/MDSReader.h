@@ -36,7 +36,11 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "MessageI.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -45,6 +49,46 @@
 
 namespace MARTe {
 
+/**
+ * @brief A decoded segment of a node, as cached by the MDSReader.
+ */
+struct MDSReaderSegment {
+    /**
+     * The index of the cached segment (-1 if the slot is empty).
+     */
+    int32 segment;
+
+    /**
+     * The number of samples of the segment.
+     */
+    uint32 nElements;
+
+    /**
+     * The samples of the segment (with the node type).
+     */
+    char8 *data;
+
+    /**
+     * The size in bytes of data.
+     */
+    uint32 dataCapacity;
+
+    /**
+     * The time of each sample.
+     */
+    float64 *time;
+
+    /**
+     * The number of elements of time.
+     */
+    uint32 timeCapacity;
+
+    /**
+     * Protects the slot between the prefetch thread and the real-time thread.
+     */
+    FastPollingMutexSem mux;
+};
+
 /**
  * @brief MDSReader is a data source which allows to read data from a MDSplus tree.
  * @details MDSReader is an input data source which takes data from MDSPlus nodes (as many as desired) and publishes it on a real time application.
@@ -67,6 +111,13 @@ namespace MARTe {
  * <li>1 --> MDSReader fills the absence of data with the last value.</li>
  * </ul>
  *
+ * The time limits of all the segments are read once when the nodes are opened, so that the segments are looked up in memory.
+ * The decoded segments are kept in a per-node cache, so that each segment is only read (and decompressed) once. If PrefetchSegments = K > 0
+ * a background thread decodes the K segments following the current one of each node, so that the real-time thread only copies (or interpolates)
+ * data from memory. If a segment is not ready when needed, it is decoded in the real-time thread (see GetCacheMisses()). As MDSplus is not thread safe
+ * the real-time thread may still have to wait for the segment being read by the prefetch thread, but not for its copy into the cache and the prefetch thread
+ * does not start reading another segment until the real-time thread is done. The time base of a segment is only read if the node is interpolated or held.
+ *
  * Even if the MDSReader can deal with the absence of data, the sampling time must be constant with-in the node, however the sampling time between
  * nodes can be different.
  *
@@ -103,6 +154,8 @@ namespace MARTe {
  *     TreeName = "test_tree" //Compulsory. Name of the MDSplus tree.
  *     ShotNumber = 1 //Compulsory. 0 --> last shot number (to use 0 shotid.sys must exist)
  *     Frequency = 1000 // in Hz. Is the cycle time of the real time application.
+ *     PrefetchSegments = 2 //Optional. Number of segments per node decoded in advance by a background thread. Default = 0 (no thread).
+ *     PrefetchCPUMask = 0x1 //Optional. CPU affinity of the prefetch thread.
  *
  *     Signals = {
  *         S_uint8 = {
@@ -129,7 +182,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class MDSReader: public DataSourceI {
+class MDSReader: public DataSourceI, public EmbeddedServiceMethodBinderI {
 //TODO Add the macro DLL_API to the class declaration (i.e. class DLL_API MDSReader)
 public:
     CLASS_REGISTER_DECLARATION()
@@ -160,6 +213,7 @@ MDSReader    ();
      * <li>Reads the shot number </li>
      * <li>Opens the tree with the shot number </li>
      * <li>Reads the real-time thread Frequency parameter.</li>
+     * <li>Reads the optional PrefetchSegments and PrefetchCPUMask parameters.</li>
      * </ul>
      * @param[in] data is the configuration file.
      * @return true if all parameters can be read and the values are valid
@@ -235,6 +289,32 @@ MDSReader    ();
     virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
             const char8* const functionName,
             void * const gamMemPtr);
+
+    /**
+     * @brief Prefetch thread callback.
+     * @details Decodes the current segment and the PrefetchSegments following segments of each node which are not yet cached
+     * and waits for the next Synchronise() when there is nothing to decode.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo& info);
+
+    /**
+     * @brief Gets the number of segments decoded in the real-time thread because they were not cached.
+     * @return the number of cache misses.
+     */
+    uint32 GetCacheMisses() const;
+
+    /**
+     * @brief Gets the number of segments decoded in advance by the prefetch thread.
+     * @return the number of prefetched segments.
+     */
+    uint32 GetPrefetchedSegments() const;
+
+    /**
+     * @brief Gets the number of segments decoded in advance for each node.
+     * @return the PrefetchSegments parameter.
+     */
+    uint32 GetPrefetchSegments() const;
 private:
     /**
      * @brief Open MDS tree
@@ -490,6 +570,48 @@ private:
 
     bool AllNodesEnd() const;
 
+    /**
+     * @brief Reads the time limits of all the segments of the node idx into segmentStart and segmentEnd.
+     * @param[in] idx node index.
+     * @return true if the limits of all the segments could be read.
+     */
+    bool BuildSegmentIndex(const uint32 idx);
+
+    /**
+     * @brief Decodes the data and, if the node is interpolated or held, the time of a segment into a cache slot.
+     * @details Locks treeMux only while calling MDSplus. The copy to the slot is done after releasing it.
+     * @param[in] nodeNumber node index.
+     * @param[in] segment the segment to decode.
+     * @param[out] slot where to store the decoded segment.
+     * @return true if the segment could be read.
+     */
+    bool DecodeSegment(const uint32 nodeNumber,
+            const uint32 segment,
+            MDSReaderSegment &slot);
+
+    /**
+     * @brief Copies the decoded samples into the slot memory and frees them.
+     */
+    template<typename T>
+    void StoreSegmentData(MDSReaderSegment &slot,
+            T * const samples,
+            const int32 nSamples) const;
+
+    /**
+     * @brief Gets the decoded segment from the cache, decoding it if it is not there.
+     * @details The returned slot is locked until ReleaseSegment() is called.
+     * @param[in] nodeNumber node index.
+     * @param[in] segment the segment to get.
+     * @return the locked cache slot or NULL if the segment could not be decoded.
+     */
+    MDSReaderSegment *AcquireSegment(const uint32 nodeNumber,
+            const uint32 segment);
+
+    /**
+     * @brief Releases a slot returned by AcquireSegment().
+     */
+    void ReleaseSegment(MDSReaderSegment * const slot) const;
+
     /**
      * The name of the MDSplus tree to be opened.
      */
@@ -636,6 +758,66 @@ private:
     bool *endNode;
     float64 *nodeSamplingTime;
 
+    /**
+     * Start time of each segment of each node.
+     */
+    float64 **segmentStart;
+
+    /**
+     * End time of each segment of each node.
+     */
+    float64 **segmentEnd;
+
+    /**
+     * Number of segments decoded in advance for each node.
+     */
+    uint32 prefetchSegments;
+
+    /**
+     * Number of cached segments for each node (prefetchSegments + 2, or 1 if prefetchSegments == 0).
+     */
+    uint32 numberOfCachedSegments;
+
+    /**
+     * numberOfCachedSegments slots for each node. The segment s of the node n is stored in the slot n * numberOfCachedSegments + (s % numberOfCachedSegments).
+     */
+    MDSReaderSegment *segmentCache;
+
+    /**
+     * Serialises the accesses to the MDSplus tree after the initialisation.
+     */
+    FastPollingMutexSem treeMux;
+
+    /**
+     * Decodes the segments in advance.
+     */
+    SingleThreadService prefetchExecutor;
+
+    /**
+     * Wakes up the prefetch thread after each Synchronise().
+     */
+    EventSem prefetchSem;
+
+    /**
+     * CPU affinity of the prefetch thread.
+     */
+    uint32 prefetchCPUMask;
+
+    /**
+     * Number of segments decoded in the real-time thread.
+     */
+    uint32 cacheMisses;
+
+    /**
+     * Number of segments decoded by the prefetch thread.
+     */
+    uint32 prefetchedSegments;
+
+    /**
+     * Set by the real-time thread while it decodes a segment. The prefetch thread does not start reading a new segment while it is set.
+     */
+    volatile int32 realTimeTreeRequest;
+
 };
 
 
@@ -659,7 +841,7 @@ uint32 MDSReader::MakeRawCopyTemplate(uint32 nodeNumber,
                                       uint32 SamplesToCopy,
                                       uint32 OffsetSamples) {
 
-    MDSplus::Data *dataD = NULL_PTR(MDSplus::Data *);
+    MDSReaderSegment *cached = NULL_PTR(MDSReaderSegment *);
     int32 nElements = 0u;
     uint32 bytesToCopy = 0u;
     uint32 extraOffset = OffsetSamples * bytesType[nodeNumber];
@@ -667,68 +849,42 @@ uint32 MDSReader::MakeRawCopyTemplate(uint32 nodeNumber,
     uint32 samplesCopied = 0u;
     uint32 remainingSamplesOnTheSegment = 0u;
     T* data = NULL_PTR(T *);
-    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (SamplesToCopy != 0); currentSegment++) {
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-
-        remainingSamplesOnTheSegment = static_cast<uint32>(nElements) - elementsConsumed[nodeNumber];
-        endSegment = remainingSamplesOnTheSegment <= SamplesToCopy;
-        if (!endSegment) {        // no end of segment but no more data need to be copied
-            bytesToCopy = SamplesToCopy * bytesType[nodeNumber];
-            samplesCopied += SamplesToCopy;
-        }
-        else {        // end segment but still more data must be copied
-            bytesToCopy = remainingSamplesOnTheSegment * bytesType[nodeNumber];
-            samplesCopied += remainingSamplesOnTheSegment;
+    bool ok = true;
+    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (SamplesToCopy != 0) && (ok); currentSegment++) {
+        cached = AcquireSegment(nodeNumber, currentSegment);
+        ok = (cached != NULL_PTR(MDSReaderSegment *));
+        if (ok) {
+            data = reinterpret_cast<T *>(cached->data);
+            nElements = static_cast<int32>(cached->nElements);
+
+            remainingSamplesOnTheSegment = static_cast<uint32>(nElements) - elementsConsumed[nodeNumber];
+            endSegment = remainingSamplesOnTheSegment <= SamplesToCopy;
+            if (!endSegment) {        // no end of segment but no more data need to be copied
+                bytesToCopy = SamplesToCopy * bytesType[nodeNumber];
+                samplesCopied += SamplesToCopy;
+            }
+            else {        // end segment but still more data must be copied
+                bytesToCopy = remainingSamplesOnTheSegment * bytesType[nodeNumber];
+                samplesCopied += remainingSamplesOnTheSegment;
 
-            //
-        }
-        MemoryOperationsHelper::Copy(reinterpret_cast<void *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]),
-                                     reinterpret_cast<void *>(&data[elementsConsumed[nodeNumber]]), bytesToCopy);
-        extraOffset += bytesToCopy;
-
-//Update values
-        if (!endSegment) {        // no end of segment but no more data need to be copied
-            elementsConsumed[nodeNumber] += SamplesToCopy;
-            SamplesToCopy = 0u;
-        }
-        else {        // end segment but still more data must be copied
-            SamplesToCopy -= ((static_cast<uint32>(nElements)) - elementsConsumed[nodeNumber]);
-            elementsConsumed[nodeNumber] = 0u;
+                //
+            }
+            MemoryOperationsHelper::Copy(reinterpret_cast<void *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]),
+                                         reinterpret_cast<void *>(&data[elementsConsumed[nodeNumber]]), bytesToCopy);
+            extraOffset += bytesToCopy;
+
+            //Update values
+            if (!endSegment) {        // no end of segment but no more data need to be copied
+                elementsConsumed[nodeNumber] += SamplesToCopy;
+                SamplesToCopy = 0u;
+            }
+            else {        // end segment but still more data must be copied
+                SamplesToCopy -= ((static_cast<uint32>(nElements)) - elementsConsumed[nodeNumber]);
+                elementsConsumed[nodeNumber] = 0u;
+            }
+            *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
+            ReleaseSegment(cached);
         }
-        *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
-        MDSplus::deleteData(dataD);
-        delete data;
-
     }
     return samplesCopied;
 }
@@ -740,8 +896,7 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
                                                   uint32 samplesToCopy,
                                                   uint32 offsetSamples) {
 
-    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
-    MDSplus::Data *timeNodeD = NULL_PTR(MDSplus::Data *);
+    MDSReaderSegment *cached = NULL_PTR(MDSReaderSegment *);
     float64 *timeNode = NULL_PTR(float64 *);
     int32 nElements = 0u;
     uint32 extraOffset = offsetSamples * bytesType[nodeNumber];
@@ -751,85 +906,56 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
     uint32 remainingSamplesOnTheSegment = 0u;
 
     T* data = NULL_PTR(T *);
-    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0); currentSegment++) {
-        //nodes[nodeNumber]->getSegmentAndDimension(currentSegment, dataD, timeNodeD);
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        timeNodeD = nodes[nodeNumber]->getSegmentDim(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-        timeNode = timeNodeD->getDoubleArray(&nElements);
-        float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
-        remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
-        endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
-        if (!endSegment) {        //no end of segment but no more data need to be copied
-            samplesCopied += samplesToCopy;
-            iterations = samplesToCopy;
-        }
-        else {        // end segment but still more data must be copied
-            samplesCopied += remainingSamplesOnTheSegment;
-            iterations = remainingSamplesOnTheSegment;
-        }
-        float64 outputInterpolation = 0.0;
-        for (uint32 i = 0u; i < iterations; i++) {
-            while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
-                elementsConsumed[nodeNumber]++;
-            }
-            if (elementsConsumed[nodeNumber] == 0u) {
-                SampleInterpolation<T>(currentTime, *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]), data[elementsConsumed[nodeNumber]],
-                                       lastTime[nodeNumber], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
-
+    bool ok = true;
+    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0) && (ok); currentSegment++) {
+        cached = AcquireSegment(nodeNumber, currentSegment);
+        ok = (cached != NULL_PTR(MDSReaderSegment *));
+        if (ok) {
+            data = reinterpret_cast<T *>(cached->data);
+            nElements = static_cast<int32>(cached->nElements);
+            timeNode = cached->time;
+            float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
+            remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
+            endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
+            if (!endSegment) {        //no end of segment but no more data need to be copied
+                samplesCopied += samplesToCopy;
+                iterations = samplesToCopy;
             }
-            else {
-                SampleInterpolation<T>(currentTime, data[elementsConsumed[nodeNumber] - 1], data[elementsConsumed[nodeNumber]],
-                                       timeNode[elementsConsumed[nodeNumber] - 1], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
+            else {        // end segment but still more data must be copied
+                samplesCopied += remainingSamplesOnTheSegment;
+                iterations = remainingSamplesOnTheSegment;
             }
-            if ((type[nodeNumber] == Float32Bit) || (type[nodeNumber] == Float64Bit)) {
-                *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(outputInterpolation);
+            float64 outputInterpolation = 0.0;
+            for (uint32 i = 0u; i < iterations; i++) {
+                while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
+                    elementsConsumed[nodeNumber]++;
+                }
+                if (elementsConsumed[nodeNumber] == 0u) {
+                    SampleInterpolation<T>(currentTime, *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]), data[elementsConsumed[nodeNumber]],
+                                           lastTime[nodeNumber], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
+
+                }
+                else {
+                    SampleInterpolation<T>(currentTime, data[elementsConsumed[nodeNumber] - 1], data[elementsConsumed[nodeNumber]],
+                                           timeNode[elementsConsumed[nodeNumber] - 1], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
+                }
+                if ((type[nodeNumber] == Float32Bit) || (type[nodeNumber] == Float64Bit)) {
+                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(outputInterpolation);
+                }
+                else {
+                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(round(outputInterpolation));
+                }
+                extraOffset += bytesType[nodeNumber];
+                currentTime += samplingTime[nodeNumber];
+                samplesToCopy--;
             }
-            else {
-                *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(round(outputInterpolation));
+            if (endSegment) {
+                *reinterpret_cast<T *>(&(lastValue[offsetLastValue[nodeNumber]])) = data[nElements - 1];
+                lastTime[nodeNumber] = timeNode[nElements - 1];
+                elementsConsumed[nodeNumber] = 0u;
             }
-            extraOffset += bytesType[nodeNumber];
-            currentTime += samplingTime[nodeNumber];
-            samplesToCopy--;
+            ReleaseSegment(cached);
         }
-        if (endSegment) {
-            *reinterpret_cast<T *>(&(lastValue[offsetLastValue[nodeNumber]])) = data[nElements - 1];
-            lastTime[nodeNumber] = timeNode[nElements - 1];
-            elementsConsumed[nodeNumber] = 0u;
-        }
-        MDSplus::deleteData(dataD);
-        MDSplus::deleteData(timeNodeD);
-        delete data;
-        delete timeNode;
     }
     return samplesCopied;
 
@@ -841,8 +967,7 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
                                    uint32 samplesToCopy,
                                    uint32 samplesOffset) {
 
-    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
-    MDSplus::Data *timeNodeD = NULL_PTR(MDSplus::Data *);
+    MDSReaderSegment *cached = NULL_PTR(MDSReaderSegment *);
     float64 *timeNode = NULL_PTR(float64 *);
     int32 nElements = 0u;
     uint32 extraOffset = samplesOffset * bytesType[nodeNumber];
@@ -852,94 +977,83 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
     uint32 remainingSamplesOnTheSegment = 0u;
 
     T* data = NULL_PTR(T *);
-    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0); currentSegment++) {
-        //nodes[nodeNumber]->getSegmentAndDimension(currentSegment, dataD, timeNodeD);
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        timeNodeD = nodes[nodeNumber]->getSegmentDim(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-        timeNode = timeNodeD->getDoubleArray(&nElements);
-        float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
-        remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
-        endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
-        if (!endSegment) {        //no end of segment but no more data need to be copied
-            samplesCopied += samplesToCopy;
-            iterations = samplesToCopy;
-        }
-        else {        // end segment but still more data must be copied
-            samplesCopied += remainingSamplesOnTheSegment;
-            iterations = remainingSamplesOnTheSegment;
-        }
-        for (uint32 i = 0u; i < iterations; i++) {
-            while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
-                elementsConsumed[nodeNumber]++;
+    bool ok = true;
+    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0) && (ok); currentSegment++) {
+        cached = AcquireSegment(nodeNumber, currentSegment);
+        ok = (cached != NULL_PTR(MDSReaderSegment *));
+        if (ok) {
+            data = reinterpret_cast<T *>(cached->data);
+            nElements = static_cast<int32>(cached->nElements);
+            timeNode = cached->time;
+            float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
+            remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
+            endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
+            if (!endSegment) {        //no end of segment but no more data need to be copied
+                samplesCopied += samplesToCopy;
+                iterations = samplesToCopy;
             }
-            if (elementsConsumed[nodeNumber] == 0u) {
-                float64 diff1 = currentTime - lastTime[nodeNumber];
-                float64 diff2 = timeNode[0] - currentTime;
-                if (diff1 < diff2) {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) =
-                            *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]);
-                }
-                else {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[0];
-                }
+            else {        // end segment but still more data must be copied
+                samplesCopied += remainingSamplesOnTheSegment;
+                iterations = remainingSamplesOnTheSegment;
             }
-            else {
-                float64 diff1 = currentTime - timeNode[elementsConsumed[nodeNumber] - 1];
-                float64 diff2 = timeNode[elementsConsumed[nodeNumber]] - currentTime;
-                if (diff1 < diff2) {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber] - 1];
+            for (uint32 i = 0u; i < iterations; i++) {
+                while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
+                    elementsConsumed[nodeNumber]++;
+                }
+                if (elementsConsumed[nodeNumber] == 0u) {
+                    float64 diff1 = currentTime - lastTime[nodeNumber];
+                    float64 diff2 = timeNode[0] - currentTime;
+                    if (diff1 < diff2) {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) =
+                                *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]);
+                    }
+                    else {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[0];
+                    }
                 }
                 else {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber]];
+                    float64 diff1 = currentTime - timeNode[elementsConsumed[nodeNumber] - 1];
+                    float64 diff2 = timeNode[elementsConsumed[nodeNumber]] - currentTime;
+                    if (diff1 < diff2) {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber] - 1];
+                    }
+                    else {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber]];
+                    }
                 }
+                extraOffset += bytesType[nodeNumber];
+                currentTime += samplingTime[nodeNumber];
+                samplesToCopy--;
             }
-            extraOffset += bytesType[nodeNumber];
-            currentTime += samplingTime[nodeNumber];
-            samplesToCopy--;
-        }
-        if (endSegment) {
-            *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
-            lastTime[nodeNumber] = timeNode[nElements - 1];
-            elementsConsumed[nodeNumber] = 0u;
+            if (endSegment) {
+                *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
+                lastTime[nodeNumber] = timeNode[nElements - 1];
+                elementsConsumed[nodeNumber] = 0u;
+            }
+            ReleaseSegment(cached);
         }
-        MDSplus::deleteData(dataD);
-        MDSplus::deleteData(timeNodeD);
-        delete data;
-        delete timeNode;
     }
     return samplesCopied;
 }
 
+template<typename T>
+void MDSReader::StoreSegmentData(MDSReaderSegment &slot,
+                                 T * const samples,
+                                 const int32 nSamples) const {
+    uint32 nBytes = static_cast<uint32>(nSamples) * static_cast<uint32>(sizeof(T));
+    if (nBytes > slot.dataCapacity) {
+        if (slot.data != NULL_PTR(char8 *)) {
+            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(slot.data));
+        }
+        slot.data = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(nBytes));
+        slot.dataCapacity = nBytes;
+    }
+    if ((samples != NULL_PTR(T *)) && (slot.data != NULL_PTR(char8 *))) {
+        (void) MemoryOperationsHelper::Copy(reinterpret_cast<void *>(slot.data), reinterpret_cast<void *>(samples), nBytes);
+    }
+    delete[] samples;
+}
+
 template<typename T>
 bool MDSReader::SampleInterpolation(float64 cT,
                                     T data1,
@@ -81,7 +81,8 @@ namespace MARTe {
  *         SignalUInt16F = { //As many as required.
  *             NodeName = "SIGUINT16F" //Compulsory. MDSplus node name
  *             Period = 2 //Compulsory. Period between signal samples.
- *             AutomaticSegmentation = 1 || 0. When set to 1 MDSplus::putRow() is used instead of MDSplus::makeSegment()
+ *             AutomaticSegmentation = 1 || 0. When set to 1 MDSplus::putTimestampedSegment() is used instead of MDSplus::makeSegment()
+ *             AutomaticSegmentSize = 1024 //Optional. Only used if AutomaticSegmentation = 1. Number of time samples of each automatically created segment. Default is 1024.
  *             MakeSegmentAfterNWrites = 4 //Compulsory if AutomaticSegmentation = 0. Forces the creation of a segment after N MARTe cycles. If AutomaticSegmentation = 0 then MakeSegmentAfterNWrites = 1.
  *             DecimatedNodeName = "SIGUINT16D" //Optional. The node where MDSplus stores the automatically computed decimated signal. When AutomaticSegmentation = 1 this field is ignored.
  *             MinMaxResampleFactor = 4 //Compulsory if DecimatedNodeName is set. Decimation factor that MDSplus applies to the decimated version of the signal. AutomaticSegmentation = 1 this field is ignored.
@@ -36,6 +36,11 @@
 /*---------------------------------------------------------------------------*/
 /*lint -estring(1960, "*MDSplus::*") -estring(1960, "*std::*") Ignore errors that do not belong to this DataSource namespace*/
 
+/**
+ * Default number of rows of the segments created when AutomaticSegmentation = 1 (same as the MDSplus::TreeNode::putRow() default).
+ */
+static const MARTe::uint32 MDS_WRITER_NODE_DEFAULT_AUTOMATIC_SEGMENT_SIZE = 1024u;
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -58,6 +63,10 @@ MDSWriterNode::MDSWriterNode() {
     typeMultiplier = 0u;
 
     bufferedData = NULL_PTR(char8*);
+    timestamps = NULL_PTR(int64_t*);
+    segmentInitData = NULL_PTR(char8*);
+    automaticSegmentSize = 0u;
+    automaticSegmentFreeRows = 0u;
     currentBuffer = 0u;
     makeSegmentAfterNWrites = 0u;
     minMaxResampleFactor = 0;
@@ -93,6 +102,12 @@ MDSWriterNode::~MDSWriterNode() {
     if (bufferedData != NULL_PTR(void*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(bufferedData));
     }
+    if (timestamps != NULL_PTR(int64_t*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(timestamps));
+    }
+    if (segmentInitData != NULL_PTR(void*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(segmentInitData));
+    }
 }
 
 bool MDSWriterNode::Initialise(StructuredDataI &data) {
@@ -251,6 +266,13 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
         }
         else {
             makeSegmentAfterNWrites = 1u;
+            if (!data.Read("AutomaticSegmentSize", automaticSegmentSize)) {
+                automaticSegmentSize = MDS_WRITER_NODE_DEFAULT_AUTOMATIC_SEGMENT_SIZE;
+            }
+            ok = (automaticSegmentSize > 0u);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "AutomaticSegmentSize shall be > 0");
+            }
         }
     }
     if (ok) {
@@ -302,6 +324,22 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
 
         bufferedData = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(bufferedDataSize));
     }
+    if ((ok) && (automaticSegmentation)) {
+        //Allocated once so that AddDataToSegment does not have to allocate memory for every row.
+        uint32 timestampsSize = static_cast<uint32>(sizeof(int64_t));
+        timestampsSize *= makeSegmentAfterNWrites * numberOfSamples;
+        timestamps = reinterpret_cast<int64_t*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(timestampsSize));
+        uint32 segmentInitDataSize = static_cast<uint32>(typeMultiplier);
+        segmentInitDataSize *= numberOfElements * automaticSegmentSize;
+        segmentInitData = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(segmentInitDataSize));
+        ok = ((timestamps != NULL_PTR(int64_t*)) && (segmentInitData != NULL_PTR(void*)));
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(segmentInitData, '\0', segmentInitDataSize);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not allocate the automatic segmentation memory for node with name %s", nodeName.Buffer());
+        }
+    }
     return ok;
 }
 
@@ -339,6 +377,7 @@ bool MDSWriterNode::AllocateTreeNode(MDSplus::Tree *const tree) {
         }
     }
     start = static_cast<float64>(phaseShift) * period;
+    automaticSegmentFreeRows = 0u;
     return ok;
 }
 
@@ -495,45 +534,12 @@ bool MDSWriterNode::ForceSegment() {
 
     //lint -e{429} freed by MDSplus upon deletion of dimension
     MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(newPeriod));
-    //lint -e{429} freed by MDSplus upon deletion of array
     MDSplus::Array *array = NULL_PTR(MDSplus::Array*);
 
     if (!useTimeVector) {
         start += static_cast<float64>(numberOfSamplesPerSegment) * newPeriod;
     }
-    if (nodeType == DTYPE_B) {
-        array = new MDSplus::Int8Array(reinterpret_cast<char8*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_BU) {
-        array = new MDSplus::Uint8Array(reinterpret_cast<uint8*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_W) {
-        array = new MDSplus::Int16Array(reinterpret_cast<int16*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_WU) {
-        array = new MDSplus::Uint16Array(reinterpret_cast<uint16*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_L) {
-        array = new MDSplus::Int32Array(reinterpret_cast<int32*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_LU) {
-        array = new MDSplus::Uint32Array(reinterpret_cast<uint32*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_Q) {
-        array = new MDSplus::Int64Array(reinterpret_cast<int64_t*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_QU) {
-        array = new MDSplus::Uint64Array(reinterpret_cast<uint64_t*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_FLOAT) {
-        array = new MDSplus::Float32Array(reinterpret_cast<float32*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else if (nodeType == DTYPE_DOUBLE) {
-        array = new MDSplus::Float64Array(reinterpret_cast<float64*>(bufferedData), 2, &segmentDim[0]);
-    }
-    else {
-        //An invalid nodeType is trapped before.
-    }
+    array = CreateArray(bufferedData, 2, &segmentDim[0]);
 
     if (array != NULL_PTR(MDSplus::Array*)) {
         if (decimatedMinMax) {
@@ -562,118 +568,118 @@ bool MDSWriterNode::ForceSegment() {
     return ok;
 }
 
-/*lint -e{613} -e{429} function only called if bufferedData != NULL. Custodial pointer value freed by mds+*/
+/*lint -e{613} function only called if bufferedData != NULL and timestamps != NULL.*/
 bool MDSWriterNode::AddDataToSegment() {
     bool ok = true;
 
     //Notice that currentBuffer is not incremented if a discontinuity is found
     uint32 numberOfSamplesPerSegment = numberOfSamples * currentBuffer;
-    //MDSpluse::putRow() only save one sample at the time
-    segmentDim[0] = 1;
-    for (uint32 i = 0u; i < numberOfSamplesPerSegment; i++) {
-        int64_t auxCurrentTime = static_cast<int64>(start);
+    uint32 i;
+    for (i = 0u; i < numberOfSamplesPerSegment; i++) {
+        timestamps[i] = static_cast<int64>(start);
         if (!useTimeVector) {
             start += period;
         }
-        if (numberOfElements > 1u) {
-            int32 numberElementsInt32 = static_cast<int32>(numberOfElements);
-            MDSplus::Array *value = NULL_PTR(MDSplus::Array*);
-            if (nodeType == DTYPE_B) {
-                value = new MDSplus::Int8Array(&(reinterpret_cast<char8*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_BU) {
-                value = new MDSplus::Uint8Array(&(reinterpret_cast<uint8*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_W) {
-                value = new MDSplus::Int16Array(&(reinterpret_cast<int16*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_WU) {
-                value = new MDSplus::Uint16Array(&(reinterpret_cast<uint16*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_L) {
-                value = new MDSplus::Int32Array(&(reinterpret_cast<int32*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_LU) {
-                value = new MDSplus::Uint32Array(&(reinterpret_cast<uint32*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_Q) {
-                value = new MDSplus::Int64Array(&(reinterpret_cast<int64_t*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_QU) {
-                value = new MDSplus::Uint64Array(&(reinterpret_cast<uint64_t*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_FLOAT) {
-                value = new MDSplus::Float32Array(&(reinterpret_cast<float32*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else if (nodeType == DTYPE_DOUBLE) {
-                value = new MDSplus::Float64Array(&(reinterpret_cast<float64*>(bufferedData)[i]), numberElementsInt32);
-            }
-            else {
-                //An invalid nodeType is trapped before.
-            }
-            if (value != NULL_PTR(MDSplus::Array*)) {
-                //lint -e{613} node is checked not to be null in the beginning of the function
+    }
+    //Scalars are stored as a vector of rows, arrays as a matrix with one row per sample.
+    int32 nDims = (numberOfElements > 1u) ? (2) : (1);
+    int32 rowDims[2];
+    rowDims[1] = static_cast<int32>(numberOfElements);
+    uint32 rowSize = numberOfElements * static_cast<uint32>(typeMultiplier);
+    char8 *bufferedDataC = reinterpret_cast<char8*>(bufferedData);
+    uint32 row = 0u;
+    //The block is written with one putTimestampedSegment for each segment it spans (typically only one).
+    while ((row < numberOfSamplesPerSegment) && (ok)) {
+        if (automaticSegmentFreeRows == 0u) {
+            rowDims[0] = static_cast<int32>(automaticSegmentSize);
+            MDSplus::Array *initData = CreateArray(segmentInitData, nDims, &rowDims[0]);
+            ok = (initData != NULL_PTR(MDSplus::Array*));
+            if (ok) {
+                //lint -e{613} node is checked not to be null in the Execute
                 try {
-                    node->putRow(value, &auxCurrentTime);
+                    node->beginTimestampedSegment(initData);
+                    automaticSegmentFreeRows = automaticSegmentSize;
                 }
                 catch (const MDSplus::MdsException &exc) {
-                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed putRow() Error: %s", exc.what());
+                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed beginTimestampedSegment() Error: %s", exc.what());
                     ok = false;
                 }
-                MDSplus::deleteData(value);
+                MDSplus::deleteData(initData);
             }
         }
-        else {
-            MDSplus::Scalar *value = NULL_PTR(MDSplus::Scalar*);
-            if (nodeType == DTYPE_B) {
-                value = new MDSplus::Int8(reinterpret_cast<char8*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_BU) {
-                value = new MDSplus::Uint8(reinterpret_cast<uint8*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_W) {
-                value = new MDSplus::Int16(reinterpret_cast<int16*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_WU) {
-                value = new MDSplus::Uint16(reinterpret_cast<uint16*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_L) {
-                value = new MDSplus::Int32(reinterpret_cast<int32*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_LU) {
-                value = new MDSplus::Uint32(reinterpret_cast<uint32*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_Q) {
-                value = new MDSplus::Int64(reinterpret_cast<int64_t*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_QU) {
-                value = new MDSplus::Uint64(reinterpret_cast<uint64_t*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_FLOAT) {
-                value = new MDSplus::Float32(reinterpret_cast<float32*>(bufferedData)[i]);
-            }
-            else if (nodeType == DTYPE_DOUBLE) {
-                value = new MDSplus::Float64(reinterpret_cast<float64*>(bufferedData)[i]);
-            }
-            else {
-                //An invalid nodeType is trapped before.
+        if (ok) {
+            uint32 rowsToWrite = (numberOfSamplesPerSegment - row);
+            if (rowsToWrite > automaticSegmentFreeRows) {
+                rowsToWrite = automaticSegmentFreeRows;
             }
-            if (value != NULL_PTR(MDSplus::Scalar*)) {
-                //lint -e{613} node is checked not to be null in the beginning of the function
+            rowDims[0] = static_cast<int32>(rowsToWrite);
+            MDSplus::Array *value = CreateArray(&bufferedDataC[row * rowSize], nDims, &rowDims[0]);
+            ok = (value != NULL_PTR(MDSplus::Array*));
+            if (ok) {
+                //lint -e{613} node is checked not to be null in the Execute
                 try {
-                    node->putRow(value, &auxCurrentTime);
+                    node->putTimestampedSegment(value, &timestamps[row]);
+                    automaticSegmentFreeRows -= rowsToWrite;
                 }
                 catch (const MDSplus::MdsException &exc) {
-                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed putRow() Error: %s", exc.what());
+                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed putTimestampedSegment() Error: %s", exc.what());
+                    //Start a new segment on the next write.
+                    automaticSegmentFreeRows = 0u;
                     ok = false;
                 }
                 MDSplus::deleteData(value);
             }
+            row += rowsToWrite;
         }
     }
     return ok;
 }
 
+//lint -e{429} the returned array is freed by the caller using MDSplus::deleteData
+MDSplus::Array *MDSWriterNode::CreateArray(void * const data,
+                                           const int32 nDims,
+                                           int32 * const dims) const {
+    MDSplus::Array *array = NULL_PTR(MDSplus::Array*);
+    if (nodeType == DTYPE_B) {
+        array = new MDSplus::Int8Array(reinterpret_cast<char8*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_BU) {
+        array = new MDSplus::Uint8Array(reinterpret_cast<uint8*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_W) {
+        array = new MDSplus::Int16Array(reinterpret_cast<int16*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_WU) {
+        array = new MDSplus::Uint16Array(reinterpret_cast<uint16*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_L) {
+        array = new MDSplus::Int32Array(reinterpret_cast<int32*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_LU) {
+        array = new MDSplus::Uint32Array(reinterpret_cast<uint32*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_Q) {
+        array = new MDSplus::Int64Array(reinterpret_cast<int64_t*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_QU) {
+        array = new MDSplus::Uint64Array(reinterpret_cast<uint64_t*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_FLOAT) {
+        array = new MDSplus::Float32Array(reinterpret_cast<float32*>(data), nDims, dims);
+    }
+    else if (nodeType == DTYPE_DOUBLE) {
+        array = new MDSplus::Float64Array(reinterpret_cast<float64*>(data), nDims, dims);
+    }
+    else {
+        //An invalid nodeType is trapped before.
+    }
+    return array;
+}
+
+uint32 MDSWriterNode::GetAutomaticSegmentSize() const {
+    return automaticSegmentSize;
+}
+
 uint64 MDSWriterNode::GetTimeSignalMemoryTime() const {
     uint64 ret = 0u;
     if (timeSignalMemory != NULL_PTR(void*)) {
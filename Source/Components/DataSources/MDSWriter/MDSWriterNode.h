@@ -61,6 +61,7 @@ public:
      *   GetExecutePeriod() == 0 &&
      *   IsFlush() == false &&
      *   GetMakeSegmentAfterNWrites() == 0 &&
+     *   GetAutomaticSegmentSize() == 0 &&
      *   GetMinMaxResampleFactor() == 0 &&
      *   GetNodeName() == "" &&
      *   GetNodeType() == 0 &&
@@ -90,6 +91,7 @@ public:
      *  - SamplePhase (optional): shift the time vector by SamplePhase * Period
      *  - MakeSegmentAfterNWrites (>0): a segment will be written after MakeSegmentAfterNWrites time samples are available (which in practice means after the Execute method has been called MakeSegmentAfterNWrites)
      *  - MinMaxResampleFactor (>0): the decimation factor to be applied by MDS+ when a DecimatedNodeName is specified
+     *  - AutomaticSegmentSize (optional >0): when AutomaticSegmentation = 1, the number of time samples (rows) of each MDS+ segment. Default is 1024.
      * @param data the StructuredDataI with all the parameters described above.
      * @return true if all the parameters above are correctly specified.
      */
@@ -163,6 +165,12 @@ public:
      */
     uint32 GetMakeSegmentAfterNWrites() const;
 
+    /**
+     * @brief Gets the number of time samples (rows) of the segments created when the automatic segmentation is enabled.
+     * @return the number of rows of each automatic segment (0 if the automatic segmentation is not enabled).
+     */
+    uint32 GetAutomaticSegmentSize() const;
+
     /**
      * @brief Returns the decimation factor MDS+ will use to automatically compute a decimated version of the stored signal.
      * @return the decimation factor MDS+ will use to automatically compute a decimated version of the stored signal.
@@ -325,6 +333,27 @@ private:
      */
     void *bufferedData;
 
+    /**
+     * Time (see start) of each of the rows in the bufferedData. Only allocated when automaticSegmentation = 1.
+     */
+    int64_t *timestamps;
+
+    /**
+     * Zeroed memory with the size of a full automatic segment, used to begin each new segment.
+     * Only allocated when automaticSegmentation = 1.
+     */
+    void *segmentInitData;
+
+    /**
+     * Number of rows of each segment when automaticSegmentation = 1.
+     */
+    uint32 automaticSegmentSize;
+
+    /**
+     * Number of rows that are still free in the segment that is currently open (automaticSegmentation = 1).
+     */
+    uint32 automaticSegmentFreeRows;
+
     /**
      * Current pointer where the bufferedData is being written to. Incremented every time the
      * Execute method is called.
@@ -332,7 +361,7 @@ private:
     uint32 currentBuffer;
 
     /**
-     * Indicates the method to save data in MDSplus. automaticSegmentation = 1 --> putRow(), automaticSegmentation = 0 makeSegment()
+     * Indicates the method to save data in MDSplus. automaticSegmentation = 1 --> putTimestampedSegment(), automaticSegmentation = 0 makeSegment()
      */
     bool automaticSegmentation;
     /**
@@ -390,12 +419,21 @@ private:
     bool ForceSegment();
 
     /**
-     * @brief Save data in MDSplus tree using MDSplus::putRow()
-     * @details the number of different time values per segment is automatically adjusted by MDSplus engine, they are directly
-     * related with Samples.
+     * @brief Save data in MDSplus tree using MDSplus::beginTimestampedSegment() and MDSplus::putTimestampedSegment()
+     * @details All the rows in the bufferedData are written with a single putTimestampedSegment() call into the segment
+     * that is currently open. A new segment with automaticSegmentSize rows is started when the open segment is full.
      * @return true if the data can be copied to the MDSplus database.
      */
     bool AddDataToSegment();
+
+    /**
+     * @brief Creates an MDSplus array of the node type with a copy of \a data.
+     * @param[in] data the memory to be copied into the array.
+     * @param[in] nDims the number of dimensions of the array.
+     * @param[in] dims the dimensions of the array.
+     * @return the array, which shall be freed with MDSplus::deleteData, or NULL if the node type is not valid.
+     */
+    MDSplus::Array *CreateArray(void * const data, const int32 nDims, int32 * const dims) const;
 };
 }
 
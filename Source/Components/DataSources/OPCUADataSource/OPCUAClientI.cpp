@@ -54,6 +54,7 @@ OPCUAClientI::OPCUAClientI() {
     serverAddress = "";
     dataPtr = NULL_PTR(void*);
     tempDataPtr = NULL_PTR(uint8*);
+    dataPtrSize = 0u;
     nOfNodes = 0u;
 }
 
@@ -101,6 +102,7 @@ void OPCUAClientI::SetValueMemories(const uint32 numberOfNodes) {
 void OPCUAClientI::SetDataPtr(const uint32 bodyLength) {
     dataPtr = HeapManager::Malloc(bodyLength);
     tempDataPtr = reinterpret_cast<uint8*>(dataPtr);
+    dataPtrSize = (dataPtr != NULL_PTR(void*)) ? (bodyLength) : (0u);
 }
 
 bool OPCUAClientI::GetSignalMemory(void *&mem,
@@ -121,10 +123,52 @@ bool OPCUAClientI::GetSignalMemory(void *&mem,
     return ok;
 }
 
-void OPCUAClientI::SeekDataPtr(const uint32 bodyLength) {
-    if (dataPtr != NULL_PTR(void*)) {
-        dataPtr = reinterpret_cast<uint8*>(dataPtr) - bodyLength;
+bool OPCUAClientI::CopyFromExtensionObjects(const UA_ExtensionObject *const eos,
+                                            const uint32 nOfEos) {
+    bool ok = ((dataPtr != NULL_PTR(void*)) && (eos != NULL_PTR(const UA_ExtensionObject*)));
+    uint8 *destination = reinterpret_cast<uint8*>(dataPtr);
+    uint32 offset = 0u;
+    for (uint32 j = 0u; (j < nOfEos) && (ok); j++) {
+        /*lint -e{641} UA_ExtensionObjectEncoding is an enum of open62541*/
+        ok = (eos[j].encoding == UA_EXTENSIONOBJECT_ENCODED_BYTESTRING);
+        uint32 bodyLength = 0u;
+        if (ok) {
+            bodyLength = static_cast<uint32>(eos[j].content.encoded.body.length);
+            ok = ((offset + bodyLength) <= dataPtrSize);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(&destination[offset], eos[j].content.encoded.body.data, bodyLength);
+            offset += bodyLength;
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The ExtensionObject body does not match the configured structure.");
     }
+    return ok;
+}
+
+bool OPCUAClientI::CopyToExtensionObjects(UA_ExtensionObject *const eos,
+                                          const uint32 nOfEos) const {
+    bool ok = ((dataPtr != NULL_PTR(void*)) && (eos != NULL_PTR(UA_ExtensionObject*)));
+    const uint8 *source = reinterpret_cast<const uint8*>(dataPtr);
+    uint32 offset = 0u;
+    for (uint32 j = 0u; (j < nOfEos) && (ok); j++) {
+        /*lint -e{641} UA_ExtensionObjectEncoding is an enum of open62541*/
+        ok = (eos[j].encoding == UA_EXTENSIONOBJECT_ENCODED_BYTESTRING);
+        uint32 bodyLength = 0u;
+        if (ok) {
+            bodyLength = static_cast<uint32>(eos[j].content.encoded.body.length);
+            ok = ((offset + bodyLength) <= dataPtrSize);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(eos[j].content.encoded.body.data, &source[offset], bodyLength);
+            offset += bodyLength;
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The ExtensionObject body does not match the configured structure.");
+    }
+    return ok;
 }
 
 /*lint -e{1746} no need to make bReq const reference.*/
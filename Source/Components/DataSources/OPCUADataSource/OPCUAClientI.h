@@ -159,10 +159,24 @@ public:
 protected:
 
     /**
-     * @brief Moves back the data pointer of bodyLength bytes.
-     * @param[in] bodyLength how many steps the pointer has to be moved
+     * @brief Copies the encoded bodies of the ExtensionObjects, one after the other, to the dataPtr.
+     * @param[in] eos the ExtensionObjects (e.g. the value of a read response), which are not modified.
+     * @param[in] nOfEos the number of ExtensionObjects.
+     * @pre SetDataPtr
+     * @return true if all the ExtensionObjects are encoded and their bodies fit in the dataPtr.
+     */
+    bool CopyFromExtensionObjects(const UA_ExtensionObject *const eos,
+                                  const uint32 nOfEos);
+
+    /**
+     * @brief Copies the dataPtr to the already allocated encoded bodies of the ExtensionObjects.
+     * @param[in,out] eos the ExtensionObjects, whose bodies shall have been allocated with the right length.
+     * @param[in] nOfEos the number of ExtensionObjects.
+     * @pre SetDataPtr
+     * @return true if all the ExtensionObjects are encoded and their bodies fit in the dataPtr.
      */
-    void SeekDataPtr(const uint32 bodyLength);
+    bool CopyToExtensionObjects(UA_ExtensionObject *const eos,
+                                const uint32 nOfEos) const;
 
     /**
      * @brief Gets the reference associated to a specific OPCUA NodeId
@@ -211,6 +225,11 @@ protected:
      */
     uint8 *tempDataPtr;
 
+    /**
+     * The size of the memory allocated for the dataPtr.
+     */
+    uint32 dataPtrSize;
+
 };
 
 }
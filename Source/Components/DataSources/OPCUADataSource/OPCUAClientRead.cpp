@@ -32,10 +32,67 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "OPCUAClientRead.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Value of monitorReading when no snapshot is being copied.
+ */
+static const uint32 OPCUA_CLIENT_READ_NO_SNAPSHOT = 2u;
+
+/*lint -e{715} -e{818} function must match the open62541 prototype.*/
+void OPCUAClientReadDataChange(UA_Client *client,
+                               UA_UInt32 subId,
+                               void *subContext,
+                               UA_UInt32 monId,
+                               void *monContext,
+                               UA_DataValue *value) {
+    OPCUAClientReadMonitoredItem *item = reinterpret_cast<OPCUAClientReadMonitoredItem*>(monContext);
+    bool ok = ((item != NULL_PTR(OPCUAClientReadMonitoredItem*)) && (value != NULL_PTR(UA_DataValue*)));
+    if (ok) {
+        /*lint -e{613} item is not NULL*/
+        ok = (item->client != NULL_PTR(OPCUAClientRead*));
+    }
+    if (ok) {
+        /*lint -e{613} value is not NULL*/
+        ok = ((value->hasValue) && (value->value.data != NULL_PTR(void*)) && (value->value.type != NULL_PTR(const UA_DataType*)));
+    }
+    if (ok) {
+        OPCUAClientRead *ocr = item->client;
+        uint32 idx = item->nodeIdx;
+        if ((ocr->monitorWorkBuffer != NULL_PTR(uint8*)) && (idx < ocr->nOfNodes)) {
+            uint32 nOfElements = static_cast<uint32>(value->value.arrayLength);
+            if (nOfElements == 0u) {
+                nOfElements = 1u;
+            }
+            uint32 nOfBytes = (nOfElements * static_cast<uint32>(value->value.type->memSize));
+            if (nOfBytes > ocr->monitorSizes[idx]) {
+                nOfBytes = ocr->monitorSizes[idx];
+            }
+            (void) MemoryOperationsHelper::Copy(&ocr->monitorWorkBuffer[ocr->monitorOffsets[idx]], value->value.data, nOfBytes);
+            ocr->monitorDirty = true;
+            ocr->monitorNotifications++;
+        }
+    }
+}
+
+/*lint -e{715} -e{818} function must match the open62541 prototype.*/
+void OPCUAClientReadSubscriptionDeleted(UA_Client *client,
+                                        UA_UInt32 subId,
+                                        void *subContext) {
+    OPCUAClientRead *ocr = reinterpret_cast<OPCUAClientRead*>(subContext);
+    if (ocr != NULL_PTR(OPCUAClientRead*)) {
+        if (subId == ocr->subscriptionId) {
+            ocr->subscribed = false;
+        }
+    }
+}
+
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -49,10 +106,50 @@ OPCUAClientRead::OPCUAClientRead() :
         OPCUAClientI() {
     monitoredNodes = NULL_PTR(UA_NodeId*);
     readValues = NULL_PTR(UA_ReadValueId*);
+    monitoredItems = NULL_PTR(OPCUAClientReadMonitoredItem*);
+    monitorOffsets = NULL_PTR(uint32*);
+    monitorSizes = NULL_PTR(uint32*);
+    monitorBufferSize = 0u;
+    monitorWorkBuffer = NULL_PTR(uint8*);
+    monitorSnapshots[0u] = NULL_PTR(uint8*);
+    monitorSnapshots[1u] = NULL_PTR(uint8*);
+    monitorPublished = 0u;
+    monitorReading = OPCUA_CLIENT_READ_NO_SNAPSHOT;
+    monitorDirty = false;
+    monitorNotifications = 0u;
+    subscriptionId = 0u;
+    subscribed = false;
+    subscriptionLost = false;
+    monitorSamplingInterval = 0.0;
+    monitorQueueSize = 1u;
+    (void) monitorMux.Create();
 }
 
 /*lint -e{1579} all pointers have been freed*/
 OPCUAClientRead::~OPCUAClientRead() {
+    if (subscribed) {
+        /*lint -e{1551} no exception thrown*/
+        (void) UA_Client_Subscriptions_deleteSingle(opcuaClient, subscriptionId);
+    }
+    if (monitoredItems != NULL_PTR(OPCUAClientReadMonitoredItem*)) {
+        delete[] monitoredItems;
+    }
+    if (monitorOffsets != NULL_PTR(uint32*)) {
+        delete[] monitorOffsets;
+    }
+    if (monitorSizes != NULL_PTR(uint32*)) {
+        delete[] monitorSizes;
+    }
+    if (monitorWorkBuffer != NULL_PTR(uint8*)) {
+        /*lint -e{1551} no exception on delete*/
+        (void) HeapManager::Free(reinterpret_cast<void*&>(monitorWorkBuffer));
+    }
+    for (uint32 b = 0u; b < 2u; b++) {
+        if (monitorSnapshots[b] != NULL_PTR(uint8*)) {
+            /*lint -e{1551} no exception on delete*/
+            (void) HeapManager::Free(reinterpret_cast<void*&>(monitorSnapshots[b]));
+        }
+    }
     /*lint -e{1551} no exception thrown*/
     bool ok = UnregisterNodes(monitoredNodes);
     if (ok) {
@@ -240,43 +337,20 @@ bool OPCUAClientRead::Read(const TypeDescriptor *const types,
     UA_ReadResponse readResponse;
     readResponse = UA_Client_Service_read(opcuaClient, readRequest);
     bool ok = (readResponse.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+    if (ok) {
+        ok = ((readResponse.resultsSize > 0u) && (readResponse.results[0].value.type != NULL_PTR(const UA_DataType*)));
+    }
     if (ok) {
         if (valueMemories != NULL_PTR(void**)) {
             if (readResponse.results[0].value.type->typeId.identifier.numeric == 22u) { /* EXTENSION_OBJECT */
                 if (dataPtr != NULL_PTR(void*)) {
-                    UA_ExtensionObject *valuePtr = reinterpret_cast<UA_ExtensionObject*>(readResponse.results[0].value.data);
-                    UA_ExtensionObject *eos;
+                    /* The encoded bodies are copied straight from the response, which is released below */
+                    const UA_ExtensionObject *valuePtr = reinterpret_cast<const UA_ExtensionObject*>(readResponse.results[0].value.data);
+                    uint32 nOfEos = 1u;
                     if (readResponse.results[0].value.arrayLength > 1u) {
-                        eos = new UA_ExtensionObject[readResponse.results[0].value.arrayLength];
-                        for (uint32 j = 0u; j < readResponse.results[0].value.arrayLength; j++) {
-                            if (ok) {
-                                ok = (UA_ExtensionObject_copy(&valuePtr[j], &eos[j]) == 0x00U);
-                            }
-                        }
-                        if (ok) {
-                            for (uint32 i = 0u; i < readResponse.results[0].value.arrayLength; i++) {
-                                if (ok) {
-                                    ok = MemoryOperationsHelper::Copy(dataPtr, eos[i].content.encoded.body.data,
-                                                                      static_cast<uint32>(eos[i].content.encoded.body.length));
-                                    dataPtr = &reinterpret_cast<uint8*>(dataPtr)[eos[i].content.encoded.body.length];
-                                }
-                            }
-                        }
-                        uint32 actualBodyLength = (static_cast<uint32>(readResponse.results[0].value.arrayLength)
-                                * static_cast<uint32>(eos[0u].content.encoded.body.length));
-                        SeekDataPtr(actualBodyLength);
-                        delete[] eos;
-                    }
-                    else {
-                        eos = UA_ExtensionObject_new();
-                        (void) UA_ExtensionObject_copy(valuePtr, eos);
-                        ok = MemoryOperationsHelper::Copy(dataPtr, eos->content.encoded.body.data, static_cast<uint32>(eos->content.encoded.body.length));
-                        if (ok) {
-                            /*lint -e{526} -e{628} -e{1551} -e{1055} no exception thrown, function defined in open62541*/
-                            (void) UA_ExtensionObject_clear(eos);
-                            UA_ExtensionObject_delete(eos);
-                        }
+                        nOfEos = static_cast<uint32>(readResponse.results[0].value.arrayLength);
                     }
+                    ok = CopyFromExtensionObjects(valuePtr, nOfEos);
                 }
             }
             else {
@@ -295,9 +369,164 @@ bool OPCUAClientRead::Read(const TypeDescriptor *const types,
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "ReadError - OPC UA Status Code (Part 4 - 7.34): %x", readResponse.responseHeader.serviceResult);
         (void) UA_Client_run_iterate(opcuaClient, 100u);
     }
+    /*lint -e{526} -e{628} -e{1055} -e{746} function defined in open62541*/
+    UA_ReadResponse_clear(&readResponse);
+    return ok;
+}
+
+bool OPCUAClientRead::SetMonitoredItems(const TypeDescriptor *const types,
+                                        const uint32 *const nElements,
+                                        const float64 samplingInterval,
+                                        const uint32 queueSize) {
+    bool ok = ((monitoredNodes != NULL_PTR(UA_NodeId*)) && (monitoredItems == NULL_PTR(OPCUAClientReadMonitoredItem*)) && (nOfNodes > 0u));
+    if (ok) {
+        monitorOffsets = new uint32[nOfNodes];
+        monitorSizes = new uint32[nOfNodes];
+        monitoredItems = new OPCUAClientReadMonitoredItem[nOfNodes];
+        monitorBufferSize = 0u;
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            uint32 nOfBytes = types[i].numberOfBits;
+            nOfBytes /= 8u;
+            nOfBytes *= nElements[i];
+            monitorOffsets[i] = monitorBufferSize;
+            monitorSizes[i] = nOfBytes;
+            monitorBufferSize += nOfBytes;
+            monitoredItems[i].client = this;
+            monitoredItems[i].nodeIdx = i;
+        }
+        monitorWorkBuffer = reinterpret_cast<uint8*>(HeapManager::Malloc(monitorBufferSize));
+        monitorSnapshots[0u] = reinterpret_cast<uint8*>(HeapManager::Malloc(monitorBufferSize));
+        monitorSnapshots[1u] = reinterpret_cast<uint8*>(HeapManager::Malloc(monitorBufferSize));
+        ok = ((monitorWorkBuffer != NULL_PTR(uint8*)) && (monitorSnapshots[0u] != NULL_PTR(uint8*)) && (monitorSnapshots[1u] != NULL_PTR(uint8*)));
+    }
+    if (ok) {
+        (void) MemoryOperationsHelper::Set(monitorWorkBuffer, '\0', monitorBufferSize);
+        (void) MemoryOperationsHelper::Set(monitorSnapshots[0u], '\0', monitorBufferSize);
+        (void) MemoryOperationsHelper::Set(monitorSnapshots[1u], '\0', monitorBufferSize);
+        monitorSamplingInterval = samplingInterval;
+        monitorQueueSize = queueSize;
+        ok = CreateSubscription();
+    }
+    return ok;
+}
+
+bool OPCUAClientRead::CreateSubscription() {
+    /*lint -e{1055} -e{746} -e{526} -e{628} function defined in open62541*/
+    UA_CreateSubscriptionRequest sReq = UA_CreateSubscriptionRequest_default();
+    sReq.requestedPublishingInterval = monitorSamplingInterval;
+    UA_CreateSubscriptionResponse sResp = UA_Client_Subscriptions_create(opcuaClient, sReq, this, NULL_PTR(UA_Client_StatusChangeNotificationCallback),
+                                                                         &OPCUAClientReadSubscriptionDeleted);
+    bool ok = (sResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+    if (ok) {
+        subscriptionId = sResp.subscriptionId;
+        subscribed = true;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CreateSubscription failed - OPC UA Status Code (Part 4 - 7.34): %x",
+                            sResp.responseHeader.serviceResult);
+    }
+    for (uint32 i = 0u; (i < nOfNodes) && (ok); i++) {
+        /*lint -e{1055} -e{746} -e{526} -e{628} function defined in open62541*/
+        UA_MonitoredItemCreateRequest mReq = UA_MonitoredItemCreateRequest_default(monitoredNodes[i]);
+        mReq.requestedParameters.samplingInterval = monitorSamplingInterval;
+        mReq.requestedParameters.queueSize = monitorQueueSize;
+        /*lint -e{1013} -e{63} -e{40} discardOldest is a member of struct UA_MonitoringParameters.*/
+        mReq.requestedParameters.discardOldest = true;
+        /*lint -e{641} UA_TimestampsToReturn is an enum of open62541*/
+        UA_MonitoredItemCreateResult mResult = UA_Client_MonitoredItems_createDataChange(opcuaClient, subscriptionId, UA_TIMESTAMPSTORETURN_NEITHER, mReq,
+                                                                                         &monitoredItems[i], &OPCUAClientReadDataChange,
+                                                                                         NULL_PTR(UA_Client_DeleteMonitoredItemCallback));
+        ok = (mResult.statusCode == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CreateMonitoredItems failed - OPC UA Status Code (Part 4 - 7.34): %x", mResult.statusCode);
+        }
+    }
+    if ((!ok) && (subscribed)) {
+        /* Do not leave a subscription without all the monitored items */
+        (void) UA_Client_Subscriptions_deleteSingle(opcuaClient, subscriptionId);
+        subscribed = false;
+    }
+    return ok;
+}
+
+bool OPCUAClientRead::Monitor(const uint16 timeout) {
+    bool ok = (monitoredItems != NULL_PTR(OPCUAClientReadMonitoredItem*));
+    if ((ok) && (!subscribed)) {
+        /* The subscription was deleted, e.g. because the connection to the server was lost. Reconnect and create it again. */
+        ok = Connect();
+        if (ok) {
+            ok = CreateSubscription();
+        }
+        if (ok) {
+            if (subscriptionLost) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "The OPCUA subscription was re-created");
+            }
+            subscriptionLost = false;
+        }
+        else {
+            if (!subscriptionLost) {
+                REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "The OPCUA subscription was lost and could not be re-created. Retrying.");
+            }
+            subscriptionLost = true;
+            Sleep::MSec(static_cast<uint32>(timeout));
+        }
+    }
+    if (ok) {
+        UA_StatusCode code = UA_Client_run_iterate(opcuaClient, timeout);
+        ok = (code == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "MonitorError - OPC UA Status Code (Part 4 - 7.34): %x", code);
+            /* Closing the session also deletes the local subscription, which is re-created in the next call */
+            (void) UA_Client_disconnect(opcuaClient);
+            subscribed = false;
+            subscriptionLost = true;
+        }
+    }
+    if (monitorDirty) {
+        /* Only the snapshot which is not the newest can be written. Skip the publication if it is still being copied. */
+        (void) monitorMux.FastLock();
+        uint32 writeIdx = (1u - monitorPublished);
+        bool busy = (monitorReading == writeIdx);
+        monitorMux.FastUnLock();
+        if (!busy) {
+            (void) MemoryOperationsHelper::Copy(monitorSnapshots[writeIdx], monitorWorkBuffer, monitorBufferSize);
+            (void) monitorMux.FastLock();
+            monitorPublished = writeIdx;
+            monitorMux.FastUnLock();
+            monitorDirty = false;
+        }
+    }
     return ok;
 }
 
+bool OPCUAClientRead::GetMonitoredSnapshot() {
+    bool ok = ((monitorSnapshots[0u] != NULL_PTR(uint8*)) && (monitorSnapshots[1u] != NULL_PTR(uint8*)) && (valueMemories != NULL_PTR(void**))
+            && (monitorOffsets != NULL_PTR(uint32*)) && (monitorSizes != NULL_PTR(uint32*)));
+    if (ok) {
+        (void) monitorMux.FastLock();
+        uint32 readIdx = monitorPublished;
+        monitorReading = readIdx;
+        monitorMux.FastUnLock();
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            if (valueMemories[i] != NULL_PTR(void*)) {
+                (void) MemoryOperationsHelper::Copy(valueMemories[i], &monitorSnapshots[readIdx][monitorOffsets[i]], monitorSizes[i]);
+            }
+        }
+        (void) monitorMux.FastLock();
+        monitorReading = OPCUA_CLIENT_READ_NO_SNAPSHOT;
+        monitorMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool OPCUAClientRead::IsSubscribed() const {
+    return subscribed;
+}
+
+uint32 OPCUAClientRead::GetNumberOfNotifications() const {
+    return monitorNotifications;
+}
+
 bool OPCUAClientRead::RegisterNodes(const UA_NodeId *const monitoredNodes) {
     bool ok = false;
     if (monitoredNodes != NULL_PTR(UA_NodeId*)) {
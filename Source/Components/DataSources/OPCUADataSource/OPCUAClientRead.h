@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
 #include "OPCUAClientI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -38,10 +39,34 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+class OPCUAClientRead;
+
+/**
+ * Context of a monitored item, given to the open62541 data change callback.
+ */
+struct OPCUAClientReadMonitoredItem {
+    /**
+     * The client that owns the monitored item.
+     */
+    OPCUAClientRead *client;
+
+    /**
+     * The index of the monitored node.
+     */
+    uint32 nodeIdx;
+};
+
 /**
  * @brief Wrapper of a OPCUA Client for reading data to a OPCUA Server.
  * @details This class wraps all the functionalities to read data to a OPCUA Server.
  * The class supports both single nodes and ExtensionObjects.
+ *
+ * @details Besides the Read service, the nodes can be monitored with an OPCUA subscription (see SetMonitoredItems).
+ * The data change notifications are decoded, in the context of the thread that calls Monitor, in a working buffer
+ * which is then published in one of two snapshot buffers. GetMonitoredSnapshot copies the newest published snapshot to the
+ * value memories without ever waiting for the Monitor thread.
+ * If the subscription is lost (e.g. the connection to the server is closed) Monitor reconnects and creates it again;
+ * in the meanwhile GetMonitoredSnapshot keeps copying the last values received.
  */
 class OPCUAClientRead: public OPCUAClientI {
 public:
@@ -67,6 +92,67 @@ public:
     bool Read(const TypeDescriptor *const types,
               const uint32 *const nElements);
 
+    /**
+     * @brief Creates an OPCUA subscription with a data change monitored item for each node.
+     * @param[in] types the array with all the TypeDescriptor for each node to monitor.
+     * @param[in] nElements the array with all the number of elements for each node to monitor.
+     * @param[in] samplingInterval the sampling interval (and publishing interval of the subscription) in ms.
+     * @param[in] queueSize the number of notifications that the server queues for each node between two publish responses.
+     * @pre SetServiceRequest
+     * @return true if the subscription and all the monitored items were created.
+     */
+    bool SetMonitoredItems(const TypeDescriptor *const types,
+                           const uint32 *const nElements,
+                           const float64 samplingInterval,
+                           const uint32 queueSize);
+
+    /**
+     * @brief Processes the pending data change notifications and publishes a new snapshot if any value changed.
+     * @details Shall always be called from the same thread, which is the only one that uses the client after SetMonitoredItems.
+     * If the subscription was deleted (or the client iterate fails, in which case the client is disconnected) the client is reconnected
+     * and the subscription is created again. If this fails, it waits for \a timeout ms and it is retried in the next call.
+     * @param[in] timeout the maximum time (ms) to wait for notifications.
+     * @pre SetMonitoredItems
+     * @return true if the subscription exists and the client iterate succeeds.
+     */
+    bool Monitor(const uint16 timeout);
+
+    /**
+     * @brief Copies the newest snapshot published by Monitor to the value memories.
+     * @pre SetMonitoredItems
+     * @return true if the monitored items were set.
+     */
+    bool GetMonitoredSnapshot();
+
+    /**
+     * @brief Returns true if the OPCUA subscription currently exists. (Testing purposes)
+     */
+    bool IsSubscribed() const;
+
+    /**
+     * @brief Returns the number of data change notifications received. (Testing purposes)
+     */
+    uint32 GetNumberOfNotifications() const;
+
+    /**
+     * @brief Decodes a data change notification into the working buffer.
+     * @details Registered as the open62541 data change callback. Called in the context of Monitor.
+     */
+    friend void OPCUAClientReadDataChange(UA_Client *client,
+                                          UA_UInt32 subId,
+                                          void *subContext,
+                                          UA_UInt32 monId,
+                                          void *monContext,
+                                          UA_DataValue *value);
+
+    /**
+     * @brief Marks the subscription as deleted, so that Monitor creates it again.
+     * @details Registered as the open62541 delete subscription callback.
+     */
+    friend void OPCUAClientReadSubscriptionDeleted(UA_Client *client,
+                                                   UA_UInt32 subId,
+                                                   void *subContext);
+
     /**
      * @see OPCUAClientI::SetServiceRequest
      */
@@ -91,6 +177,12 @@ public:
 
 private:
 
+    /**
+     * @brief Creates the OPCUA subscription and its monitored items with the parameters given to SetMonitoredItems.
+     * @return true if the subscription and all the monitored items were created. Otherwise the subscription is deleted.
+     */
+    bool CreateSubscription();
+
     /**
      * @brief Wrapper of RegisterNodes OPCUA Service
      * @param[in] monitoredNodes the nodes to be registered
@@ -120,6 +212,86 @@ private:
      */
     UA_ReadValueId *readValues;
 
+    /**
+     * The contexts of the monitored items.
+     */
+    OPCUAClientReadMonitoredItem *monitoredItems;
+
+    /**
+     * The offset of each node in the monitor buffers.
+     */
+    uint32 *monitorOffsets;
+
+    /**
+     * The size of each node in the monitor buffers.
+     */
+    uint32 *monitorSizes;
+
+    /**
+     * The size of each monitor buffer.
+     */
+    uint32 monitorBufferSize;
+
+    /**
+     * Buffer where the notifications are decoded (only used by the Monitor thread).
+     */
+    uint8 *monitorWorkBuffer;
+
+    /**
+     * The two snapshot buffers.
+     */
+    uint8 *monitorSnapshots[2u];
+
+    /**
+     * The index of the newest snapshot.
+     */
+    uint32 monitorPublished;
+
+    /**
+     * The index of the snapshot being copied by GetMonitoredSnapshot (2 if none).
+     */
+    uint32 monitorReading;
+
+    /**
+     * True if the working buffer has values that were not yet published.
+     */
+    bool monitorDirty;
+
+    /**
+     * Protects monitorPublished and monitorReading.
+     */
+    FastPollingMutexSem monitorMux;
+
+    /**
+     * The number of data change notifications received.
+     */
+    uint32 monitorNotifications;
+
+    /**
+     * The identifier of the OPCUA subscription.
+     */
+    uint32 subscriptionId;
+
+    /**
+     * True if the OPCUA subscription was created.
+     */
+    bool subscribed;
+
+    /**
+     * True if the subscription was lost and could not be re-created yet (the error is only reported once).
+     */
+    bool subscriptionLost;
+
+    /**
+     * The sampling and publishing interval of the subscription in ms.
+     */
+    float64 monitorSamplingInterval;
+
+    /**
+     * The server side queue size of each monitored item.
+     */
+    uint32 monitorQueueSize;
+
 };
 
 }
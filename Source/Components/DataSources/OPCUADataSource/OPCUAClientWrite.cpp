@@ -299,6 +299,10 @@ bool OPCUAClientWrite::SetExtensionObject() {
                 /*lint -e{1055} function defined in open62541*/
                 (void) UA_Variant_setScalar(&tempVariant[0u], eos, &UA_TYPES[UA_TYPES_EXTENSIONOBJECT]);
             }
+            /* The encoded bodies are allocated once here and then only overwritten with the dataPtr */
+            for (uint32 j = 0u; (j < nOfEos) && (ok); j++) {
+                ok = (UA_ExtensionObject_copy(&valuePtr[j], &eos[j]) == 0x00U); /* UA_STATUSCODE_GOOD */
+            }
         }
     }
     /*lint -e{526} -e{628} -e{1551} -e{1055} no exception thrown, function defined in open62541*/
@@ -450,22 +454,7 @@ bool OPCUAClientWrite::Write() {
     bool ok = true;
     if (dataPtr != NULL_PTR(void*)) {
         if ((eos != NULL_PTR(UA_ExtensionObject*)) && (valuePtr != NULL_PTR(UA_ExtensionObject*)) && (tempVariant != NULL_PTR(UA_Variant*))) {
-            uint32 actualBodyLength;
-            if (nOfEos > 1u) {
-                for (uint32 j = 0u; j < nOfEos; j++) {
-                    if (ok) {
-                        (void) UA_ExtensionObject_copy(&valuePtr[j], &eos[j]);
-                        ok = MemoryOperationsHelper::Copy(eos[j].content.encoded.body.data, dataPtr, static_cast<uint32>(eos[j].content.encoded.body.length));
-                        dataPtr = &reinterpret_cast<uint8*>(dataPtr)[eos[j].content.encoded.body.length];
-                    }
-                }
-                actualBodyLength = (nOfEos * static_cast<uint32>(eos[0u].content.encoded.body.length));
-                SeekDataPtr(actualBodyLength);
-            }
-            else {
-                (void) UA_ExtensionObject_copy(valuePtr, eos);
-                ok = MemoryOperationsHelper::Copy(eos->content.encoded.body.data, dataPtr, static_cast<uint32>(eos->content.encoded.body.length));
-            }
+            ok = CopyToExtensionObjects(eos, nOfEos);
             if (writeValues != NULL_PTR(UA_WriteValue*)) {
                 writeValues[0u].value.value = static_cast<const UA_Variant>(tempVariant[0u]);
                 /*lint -e{1013} -e{63} -e{40} hasValue is a member of struct UA_DataValue.*/
@@ -36,6 +36,12 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum time (ms) that the SingleThreadService waits for notifications in each Execute.
+ */
+static const uint16 OPCUA_DS_INPUT_MONITOR_TIMEOUT = 100u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -61,6 +67,7 @@ OPCUADSInput::OPCUADSInput() :
     readMode = "";
     sync = "";
     samplingTime = 0.0;
+    queueSize = 1u;
     nElements = NULL_PTR(uint32*);
     tempNElements = NULL_PTR(uint32*);
     entryArrayElements = NULL_PTR(uint32*);
@@ -140,7 +147,7 @@ bool OPCUADSInput::Initialise(StructuredDataI &data) {
                 ok = true;
             }
         }
-        if (sync == "no") {
+        if ((sync == "no") || (readMode == "Monitor")) {
             if (ok) {
                 ok = data.Read("CpuMask", cpuMask);
                 if (!ok) {
@@ -164,6 +171,16 @@ bool OPCUADSInput::Initialise(StructuredDataI &data) {
                 ok = true;
             }
         }
+        if ((readMode == "Monitor") && (ok)) {
+            if (!data.Read("QueueSize", queueSize)) {
+                REPORT_ERROR(ErrorManagement::Information, "QueueSize not set. Using default value: 1");
+                queueSize = 1u;
+            }
+            ok = (queueSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize shall be > 0");
+            }
+        }
         if (ok) {
             ok = data.MoveRelative("Signals");
             if (!ok) {
@@ -403,6 +420,16 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
                     else {
                         REPORT_ERROR(ErrorManagement::ParametersError, "SetServiceRequest Failed.");
                     }
+                    if ((readMode == "Monitor") && (ok)) {
+                        ok = masterClient->SetMonitoredItems(types, nElements, samplingTime, queueSize);
+                        if (!ok) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "SetMonitoredItems Failed.");
+                        }
+                    }
+                }
+                else if (readMode == "Monitor") {
+                    ok = false;
+                    REPORT_ERROR(ErrorManagement::ParametersError, "ReadMode Monitor does not support ExtensionObject.");
                 }
                 else {
                     ok = masterClient->SetServiceRequest(tempNamespaceIndexes, tempPaths, nOfSignals);
@@ -430,7 +457,7 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
-    if ((sync == "no") && ok) {
+    if (((sync == "no") || (readMode == "Monitor")) && ok) {
         executor.SetCPUMask(cpuMask);
         executor.SetStackSize(stackSize);
         executor.SetName(GetName());
@@ -473,7 +500,12 @@ bool OPCUADSInput::GetSignalMemoryBuffer(const uint32 signalIdx,
 const char8* OPCUADSInput::GetBrokerName(StructuredDataI &data,
                                          const SignalDirection direction) {
     const char8 *brokerName = "";
-    if (sync == "no") {
+    if (readMode == "Monitor") {
+        if (direction == InputSignals) {
+            brokerName = "MemoryMapSynchronisedInputBroker";
+        }
+    }
+    else if (sync == "no") {
         if (direction == InputSignals) {
             brokerName = "MemoryMapInputBroker";
         }
@@ -507,7 +539,10 @@ ErrorManagement::ErrorType OPCUADSInput::Execute(ExecutionInfo &info) {
                 }
             }
             else if (readMode == "Monitor") {
-                err = ErrorManagement::UnsupportedFeature;
+                ok = masterClient->Monitor(OPCUA_DS_INPUT_MONITOR_TIMEOUT);
+                if (!ok) {
+                    err = ErrorManagement::CommunicationError;
+                }
             }
             else {
                 REPORT_ERROR(ErrorManagement::ParametersError, "ReadMode defines an unsupported service.");
@@ -519,14 +554,16 @@ ErrorManagement::ErrorType OPCUADSInput::Execute(ExecutionInfo &info) {
 
 bool OPCUADSInput::Synchronise() {
     bool ok = true;
-    if (sync == "yes") {
+    if (readMode == "Monitor") {
+        if (masterClient != NULL_PTR(OPCUAClientRead*)) {
+            ok = masterClient->GetMonitoredSnapshot();
+        }
+    }
+    else if (sync == "yes") {
         if ((types != NULL_PTR(TypeDescriptor*)) && (nElements != NULL_PTR(uint32*)) && (masterClient != NULL_PTR(OPCUAClientRead*))) {
             if (readMode == "Read") {
                 ok = masterClient->Read(types, nElements);
             }
-            else if (readMode == "Monitor") {
-                ok = false;
-            }
             else {
                 REPORT_ERROR(ErrorManagement::ParametersError, "ReadMode defines an unsupported service.");
             }
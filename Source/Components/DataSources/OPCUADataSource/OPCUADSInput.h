@@ -63,10 +63,11 @@ namespace MARTe {
  *     Class = OPCUADataSource::OPCUADSInput
  *     Address = "opc.tcp://192.168.130.20:4840" //The OPCUA Server Address
  *     ReadMode = "Read" //"Read" uses OPCUA Read Service, "Monitor" uses OPCUA MonitoredItem Service. (Optional) Default = "Read"
- *     SamplingTime = 1 //ms. Only if ReadMode is "Monitor"
+ *     SamplingTime = 1 //ms. Only if ReadMode is "Monitor". (Optional) Default = 250
+ *     QueueSize = 1 //Number of notifications queued by the server for each node. Only if ReadMode is "Monitor". (Optional) Default = 1
  *     Synchronise = "yes" //"yes" uses the Synchronise method (and thus is executed in the context of the real-time thread, "no" to enable a decoupled SingleThreadService Execute method). Default = "no"
- *     CpuMask = 0xffu //(Optional) Only if Synchronise option is "no". Default = 0xffu
- *     StackSize = 10000000 //(Optional) Only if Synchronise option is "no". Default = THREADS_DEFAULT_STACKSIZE
+ *     CpuMask = 0xffu //(Optional) Only if Synchronise option is "no" or ReadMode is "Monitor". Default = 0xffu
+ *     StackSize = 10000000 //(Optional) Only if Synchronise option is "no" or ReadMode is "Monitor". Default = THREADS_DEFAULT_STACKSIZE
  *     Signals = {
  *         Node1 = {
  *             Type = uint32
@@ -105,6 +106,11 @@ namespace MARTe {
  * </pre>
  * When using Complex DataType Extension, the DataSource only allows to write 1 structure. If you need to add more signals you must add
  * another OPCUADSInput DataSource to your real time application.
+ *
+ * With ReadMode = "Monitor" the nodes are read with an OPCUA subscription, so that the server only sends the values that changed.
+ * The data change notifications are decoded by the SingleThreadService into a double buffered snapshot and the Synchronise method
+ * (called by the MemoryMapSynchronisedInputBroker, independently of the Synchronise option) copies the newest snapshot to the signals.
+ * The Monitor mode does not support the ExtensionObject option.
  */
 class OPCUADSInput: public DataSourceI, public EmbeddedServiceMethodBinderI {
 
@@ -157,7 +163,7 @@ public:
     /**
      * @see DataSourceI::GetBrokerName
      * @details Only InputSignals are supported.
-     * @return MemoryMapInputBroker if Synchronise option is set to "no", otherwise it returns MemoryMapSynchronisedInputBroker.
+     * @return MemoryMapInputBroker if Synchronise option is set to "no" and ReadMode is "Read", otherwise it returns MemoryMapSynchronisedInputBroker.
      */
     virtual const char8* GetBrokerName(StructuredDataI &data,
                                        const SignalDirection direction);
@@ -179,7 +185,7 @@ public:
     virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
 
     /**
-     * @details Provides the context to create the OPCUA Subscription and Monitored Item request or the Read service request.
+     * @details Executes the Read service request or, if ReadMode is "Monitor", copies the newest snapshot of the monitored items.
      * @return true if all the services are executed correctly.
      * @see DataSourceI::Synchronise
      */
@@ -275,6 +281,11 @@ private:
      */
     float64 samplingTime;
 
+    /**
+     * Holds the value of the configuration parameter QueueSize
+     */
+    uint32 queueSize;
+
     /**
      * The array that stores all the browse paths for each
      * node to read
@@ -46,9 +46,22 @@ RealTimeThreadSynchBroker::RealTimeThreadSynchBroker() :
         MemoryMapInputBroker() {
     functionIdx = 0u;
     numberOfDataSourceSignals = 0u;
-    currentBufferIdx = 0u;
-    signalMemory = NULL_PTR(char8 **);
+    bufferMemory = NULL_PTR(char8 *);
+    bufferSize = 0u;
+    numberOfBuffers = 2u;
+    signalBufferOffset = NULL_PTR(uint32 *);
     signalSize = NULL_PTR(uint32 *);
+    numberOfBrokerSignals = 0u;
+    brokerSignals = NULL_PTR(uint32 *);
+    writePointers = NULL_PTR(char8 **);
+    fillBuffer = 0u;
+    readyBuffers = NULL_PTR(uint32 *);
+    readyHead = 0u;
+    readyCount = 0u;
+    freeBuffers = NULL_PTR(uint32 *);
+    freeCount = 0u;
+    overruns = 0u;
+    missedBuffers = 0u;
     dataSourceMemory = NULL_PTR(char8 *);
     dataSourceMemoryOffsets = NULL_PTR(uint32 *);
     numberOfSamples = 0u;
@@ -61,28 +74,39 @@ RealTimeThreadSynchBroker::RealTimeThreadSynchBroker() :
 /*lint -e{1551} -e{1740} must free the allocated memory in the destructor and close the semaphore. The dataSourceMemory,
  * the dataSourceMemoryOffsets are freed by the DataSourceI not by the broker. The dataSource is freed by the framework.*/
 RealTimeThreadSynchBroker::~RealTimeThreadSynchBroker() {
-    if (signalMemory != NULL_PTR(char8 **)) {
-        uint32 s;
-        for (s = 0u; s < (numberOfDataSourceSignals * 2u); s++) { //*2 -> dual-buffer
-            if (signalMemory[s] != NULL_PTR(char8 *)) {
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(signalMemory[s]));
-            }
-        }
-        delete[] signalMemory;
+    if (bufferMemory != NULL_PTR(char8 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(bufferMemory));
+    }
+    if (signalBufferOffset != NULL_PTR(uint32 *)) {
+        delete[] signalBufferOffset;
     }
     if (signalSize != NULL_PTR(uint32 *)) {
         delete[] signalSize;
     }
+    if (brokerSignals != NULL_PTR(uint32 *)) {
+        delete[] brokerSignals;
+    }
+    if (writePointers != NULL_PTR(char8 **)) {
+        delete[] writePointers;
+    }
+    if (readyBuffers != NULL_PTR(uint32 *)) {
+        delete[] readyBuffers;
+    }
+    if (freeBuffers != NULL_PTR(uint32 *)) {
+        delete[] freeBuffers;
+    }
 
     (void) synchSem.Post();
     (void) synchSem.Close();
 }
 
-void RealTimeThreadSynchBroker::SetFunctionIndex(DataSourceI * const dataSourceIn, const uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn) {
+void RealTimeThreadSynchBroker::SetFunctionIndex(DataSourceI * const dataSourceIn, const uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn,
+                                                 const uint32 numberOfBuffersIn) {
     dataSource = dataSourceIn;
     functionIdx = functionIdxIn;
     timeout = timeoutIn;
     waitForNext = waitForNextIn;
+    numberOfBuffers = numberOfBuffersIn;
     if (dataSource != NULL_PTR(DataSourceI *)) {
         (void) dataSource->GetFunctionName(functionIdx, gamName);
     }
@@ -94,18 +118,18 @@ bool RealTimeThreadSynchBroker::AllocateMemory(char8 * const dataSourceMemoryIn,
         dataSourceMemory = dataSourceMemoryIn;
         dataSourceMemoryOffsets = dataSourceMemoryOffsetsIn;
         numberOfDataSourceSignals = dataSource->GetNumberOfSignals();
-        //lint -e{647} -e{9114} numberOfDataSourceSignals * 2u does not have a truncation risk
-        signalMemory = new char8*[numberOfDataSourceSignals * 2u];//*2 -> dual-buffer
+        signalBufferOffset = new uint32[numberOfDataSourceSignals];
         signalSize = new uint32[numberOfDataSourceSignals];
         uint32 numberOfFunctionSignals = 0u;
         uint32 s;
         for (s = 0u; s < numberOfDataSourceSignals; s++) {
-            signalMemory[s] = NULL_PTR(char8 *);
-            //lint -e{679} not a truncation risk
-            signalMemory[s + numberOfDataSourceSignals] = NULL_PTR(char8 *);
+            signalBufferOffset[s] = 0u;
+            signalSize[s] = 0u;
         }
         ok = dataSource->GetFunctionNumberOfSignals(InputSignals, functionIdx, numberOfFunctionSignals);
         if (ok) {
+            brokerSignals = new uint32[numberOfFunctionSignals];
+            writePointers = new char8*[numberOfFunctionSignals];
             for (s = 0u; (s < numberOfFunctionSignals) && (ok); s++) {
                 uint32 numberOfSamplesRead;
                 ok = dataSource->GetFunctionSignalSamples(InputSignals, functionIdx, s, numberOfSamplesRead);
@@ -126,19 +150,49 @@ bool RealTimeThreadSynchBroker::AllocateMemory(char8 * const dataSourceMemoryIn,
                 if (ok) {
                     ok = dataSource->GetSignalIndex(signalIdx, functionSignalAlias.Buffer());
                 }
+                //The same signal may be read more than once (e.g. with different ranges) but is only stored once.
                 if (ok) {
-                    uint32 signalSizeRead;
-                    ok = dataSource->GetSignalByteSize(s, signalSizeRead);
-                    signalSize[signalIdx] = signalSizeRead;
-                }
-                //The memory has to be reordered so that each signal can store the numberOfSamples required.
-                if (ok) {
-                    signalMemory[signalIdx] = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(signalSize[signalIdx] * numberOfSamples));
-                    //lint -e{679} signalIdx +  numberOfDataSourceSignals does not have a truncation risk
-                    signalMemory[signalIdx + numberOfDataSourceSignals] = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(signalSize[signalIdx] * numberOfSamples));
+                    if (signalSize[signalIdx] == 0u) {
+                        uint32 signalSizeRead;
+                        ok = dataSource->GetSignalByteSize(signalIdx, signalSizeRead);
+                        if (ok) {
+                            signalSize[signalIdx] = signalSizeRead;
+                            //The memory has to be reordered so that each signal can store the numberOfSamples required.
+                            signalBufferOffset[signalIdx] = bufferSize;
+                            bufferSize += (signalSizeRead * numberOfSamples);
+                            brokerSignals[numberOfBrokerSignals] = signalIdx;
+                            numberOfBrokerSignals++;
+                        }
+                    }
                 }
             }
         }
+        if (ok) {
+            ok = (numberOfBuffers > 1u);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The number of buffers shall be at least 2");
+            }
+        }
+        if (ok) {
+            //lint -e{647} bufferSize * numberOfBuffers is checked by the heap
+            bufferMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(bufferSize * numberOfBuffers));
+            ok = (bufferMemory != NULL_PTR(char8 *));
+        }
+        if (ok) {
+            readyBuffers = new uint32[numberOfBuffers];
+            freeBuffers = new uint32[numberOfBuffers];
+            //Buffer 0 is filled first, the others are free
+            fillBuffer = 0u;
+            readyHead = 0u;
+            readyCount = 0u;
+            freeCount = 0u;
+            uint32 b;
+            for (b = (numberOfBuffers - 1u); b > 0u; b--) {
+                freeBuffers[freeCount] = b;
+                freeCount++;
+            }
+            ResetWritePointers();
+        }
     }
     if (ok) {
         ok = synchSem.Create();
@@ -149,39 +203,65 @@ bool RealTimeThreadSynchBroker::AllocateMemory(char8 * const dataSourceMemoryIn,
     return ok;
 }
 
+void RealTimeThreadSynchBroker::ResetWritePointers() {
+    /*lint -e{613} All the memory must have been successfully allocated.*/
+    char8 *fillBufferMemory = &bufferMemory[fillBuffer * bufferSize];
+    uint32 n;
+    for (n = 0u; n < numberOfBrokerSignals; n++) {
+        writePointers[n] = &fillBufferMemory[signalBufferOffset[brokerSignals[n]]];
+    }
+}
+
 bool RealTimeThreadSynchBroker::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress) const {
-    bool ok = (signalMemory != NULL_PTR(char8 **));
+    bool ok = (bufferMemory != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < numberOfDataSourceSignals) && (bufferIdx < numberOfBuffers));
+    }
+    if (ok) {
+        /*lint -e{613} signalSize cannot be NULL as otherwise bufferMemory would be NULL*/
+        ok = (signalSize[signalIdx] > 0u);
+    }
     if (ok) {
-        /*lint -e{613} -e{679} signalMemory cannot be NULL as otherwise ok = false*/
-        signalAddress = reinterpret_cast<void *>(&signalMemory[signalIdx + (bufferIdx * numberOfDataSourceSignals)][0u]);
+        /*lint -e{613} signalBufferOffset cannot be NULL as otherwise bufferMemory would be NULL*/
+        signalAddress = reinterpret_cast<void *>(&bufferMemory[(bufferIdx * bufferSize) + signalBufferOffset[signalIdx]]);
     }
     return ok;
 }
 
 bool RealTimeThreadSynchBroker::AddSample() {
-    bool ok = false;
-    uint32 s;
-    for (s = 0u; s < numberOfDataSourceSignals; s++) {
+    bool ok = true;
+    uint32 n;
+    for (n = 0u; (n < numberOfBrokerSignals) && (ok); n++) {
         /*lint -e{613} All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.*/
-        if (signalMemory[s] != NULL_PTR(char8 *)) {
-            uint32 signalIdx = currentSample * signalSize[s];
-            //lint -e{679} not a truncation risk
-            void *destination = &signalMemory[s + (currentBufferIdx * numberOfDataSourceSignals)][signalIdx];
-            const void *source = &dataSourceMemory[dataSourceMemoryOffsets[s]];
-            ok = MemoryOperationsHelper::Copy(destination, source, signalSize[s]);
-        }
+        uint32 s = brokerSignals[n];
+        ok = MemoryOperationsHelper::Copy(writePointers[n], &dataSourceMemory[dataSourceMemoryOffsets[s]], signalSize[s]);
+        writePointers[n] = &writePointers[n][signalSize[s]];
     }
     currentSample++;
     if (currentSample == numberOfSamples) {
         currentSample = 0u;
-        if(mux.FastLock() == ErrorManagement::NoError) {
-            currentBufferIdx++;
-            if (currentBufferIdx > 1u) {
-                currentBufferIdx = 0u;
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            uint32 tail = ((readyHead + readyCount) % numberOfBuffers);
+            readyBuffers[tail] = fillBuffer;
+            readyCount++;
+            if (freeCount > 0u) {
+                freeCount--;
+                fillBuffer = freeBuffers[freeCount];
+            }
+            else {
+                //All the other buffers are queued or being read. Recycle the oldest queued buffer.
+                fillBuffer = readyBuffers[readyHead];
+                readyHead = ((readyHead + 1u) % numberOfBuffers);
+                readyCount--;
+                overruns++;
+                missedBuffers++;
+            }
+            if (!synchSem.Post()) {
+                ok = false;
             }
-            ok = synchSem.Post();
         }
         mux.FastUnLock();
+        ResetWritePointers();
     }
     return ok;
 }
@@ -192,43 +272,72 @@ const char8 * const RealTimeThreadSynchBroker::GetGAMName() {
 
 bool RealTimeThreadSynchBroker::Execute() {
     bool ok = true;
-   
-    //First Reset 
-    if (waitForNext == 1u) {
-        if(mux.FastLock() == ErrorManagement::NoError) {
-            ok = synchSem.Reset();
+    bool available = false;
+    if (mux.FastLock() == ErrorManagement::NoError) {
+        //Discard what was not read and wait for the next buffer
+        if (waitForNext == 1u) {
+            while (readyCount > 0u) {
+                freeBuffers[freeCount] = readyBuffers[readyHead];
+                freeCount++;
+                readyHead = ((readyHead + 1u) % numberOfBuffers);
+                readyCount--;
+                missedBuffers++;
+            }
         }
-        mux.FastUnLock();
-        if (ok) {
-            ok = (synchSem.Wait(timeout) == ErrorManagement::NoError);
+        available = (readyCount > 0u);
+        //Reset under the mux, so that a buffer completed after this point posts the semaphore again
+        if (!available) {
+            ok = synchSem.Reset();
         }
     }
-    //First wait
-    else {
+    mux.FastUnLock();
+    if ((ok) && (!available)) {
         ok = (synchSem.Wait(timeout) == ErrorManagement::NoError);
-        if (ok) {
-            if(mux.FastLock() == ErrorManagement::NoError) {
-                ok = synchSem.Reset();
+    }
+    uint32 readBuffer = 0u;
+    if (ok) {
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            ok = (readyCount > 0u);
+            if (ok) {
+                readBuffer = readyBuffers[readyHead];
+                readyHead = ((readyHead + 1u) % numberOfBuffers);
+                readyCount--;
             }
-            mux.FastUnLock();
         }
+        mux.FastUnLock();
     }
-    uint32 n;
-    /*lint -e{613} null pointer checked before.*/
-    uint32 idx = 0u;
-    if(currentBufferIdx == 0u) {
-        idx = 1u;
-    }
-    if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-        for (n = 0u; (n < numberOfCopies) && (ok); n++) {
-            uint32 dataSourceIndex = ((idx * numberOfCopies) + n);
-            ok = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize);
+    if (ok) {
+        //The copy table was built against the first buffer. Redirect the source pointers to the buffer being read.
+        uint32 readBufferOffset = (readBuffer * bufferSize);
+        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
+            uint32 n;
+            for (n = 0u; (n < numberOfCopies) && (ok); n++) {
+                const char8 *source = reinterpret_cast<const char8 *>(copyTable[n].dataSourcePointer);
+                ok = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, &source[readBufferOffset], copyTable[n].copySize);
+            }
         }
+        //Give the buffer back to the producer
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            freeBuffers[freeCount] = readBuffer;
+            freeCount++;
+        }
+        mux.FastUnLock();
     }
     return ok;
 }
 
-CLASS_REGISTER(RealTimeThreadSynchBroker, "1.0")
+uint32 RealTimeThreadSynchBroker::GetNumberOfBuffers() const {
+    return numberOfBuffers;
+}
+
+uint32 RealTimeThreadSynchBroker::GetNumberOfOverruns() const {
+    return overruns;
+}
 
+uint32 RealTimeThreadSynchBroker::GetNumberOfMissedBuffers() const {
+    return missedBuffers;
 }
 
+CLASS_REGISTER(RealTimeThreadSynchBroker, "1.0")
+
+}
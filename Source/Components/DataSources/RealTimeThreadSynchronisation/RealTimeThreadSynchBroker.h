@@ -44,6 +44,13 @@ namespace MARTe {
  * @brief Input broker for the RealTimeThreadSynchronisation DataSourceI.
  * @details A MemoryMapInputBroker which will store in memory the required number of samples copies of the DataSourceI memory.
  * It will lock in Execute until the required number of samples are added by calling the AddSample method.
+ *
+ * The samples are stored in NumberOfBuffers buffers (see RealTimeThreadSynchronisation), allocated in a single memory area.
+ * The producer (AddSample) fills one buffer while the consumer (Execute) reads another one, so that a slow consumer
+ *  never sees a buffer which is being written. Completed buffers are queued and delivered in order. The buffer to read is selected
+ *  by offsetting the copy table source pointers (i.e. the consumer copies directly from the completed buffer, irrespectively of the number of buffers).
+ * If all the buffers are either queued or being read when the producer completes a buffer, the oldest queued buffer is recycled
+ *  (this is counted as an overrun and as a missed buffer).
  */
 class RealTimeThreadSynchBroker : public MemoryMapInputBroker {
 public:
@@ -63,13 +70,15 @@ public:
      * @param[in] dataSourceIn the RealTimeThreadSynchronisation DataSourceI instance using this broker.
      * @param[in] functionIdxIn the index of the function in the DataSourceI.
      * @param[in] timeoutIn the maximum time to wait for the expected number of samples to be available.
-     * @param[in] waitForNextIn if 1 first reset and then wait at the synchronisation point.
+     * @param[in] waitForNextIn if 1 first discard the buffers which were not read and then wait at the synchronisation point.
+     * @param[in] numberOfBuffersIn number of buffers (>= 2) where the samples are stored.
      */
-    void SetFunctionIndex(DataSourceI *dataSourceIn, uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn);
+    void SetFunctionIndex(DataSourceI *dataSourceIn, uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn,
+                          const uint32 numberOfBuffersIn);
 
     /**
      * @brief Allocates memory to hold N copies of the dataSourceMemoryIn, where the N is the number of samples that are to be
-     * stored by the signals allocated to this broker.
+     * stored by the signals allocated to this broker, for each of the buffers.
      * @param[in] dataSourceMemoryIn the RealTimeThreadSynchronisation DataSourceI memory holding the latest values.
      * @param[in] dataSourceMemoryOffsetsIn the signals offsets in the \a dataSourceMemoryIn.
      * @return true if the number of samples is the same for all signals and if the memory could be successfully allocated.
@@ -78,11 +87,13 @@ public:
 
     /**
      * @brief Proxy method to the DataSourceI::GetSignalMemoryBuffer
+     * @return true if the memory was allocated, the signal is read by this broker and bufferIdx < numberOfBuffers.
      */
     bool GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress) const;
 
     /**
-     * @brief Adds a new sample of all the signals into the memory managed by this broker.
+     * @brief Adds a new sample of all the signals into the buffer being filled.
+     * @details When the number of samples is reached the buffer is queued, the next free buffer is selected and the consumer is posted.
      * @return true if the memory could be successfully copied.
      * @pre
      *   All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.
@@ -96,33 +107,121 @@ public:
     const char8 *const GetGAMName();
 
     /**
-     * @brief Locks until the expected number of samples is written into this broker instance (see AddSample) and then copies the samples
-     * using the MemoryMapInputBroker::Execute().
-     * @return true if MemoryMapInputBroker::Execute().
+     * @brief Locks until a completed buffer is available (see AddSample) and then copies the oldest one to the GAM memory.
+     * @return true if a buffer was available before the timeout and could be copied.
      */
     virtual bool Execute();
 
+    /**
+     * @brief Gets the number of buffers.
+     * @return the number of buffers.
+     */
+    uint32 GetNumberOfBuffers() const;
+
+    /**
+     * @brief Gets the number of times that the producer found all the buffers busy and had to recycle a buffer which was not read.
+     * @return the number of overruns.
+     */
+    uint32 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the number of completed buffers which were never copied to the GAM (overruns and buffers discarded with WaitForNext = 1).
+     * @return the number of missed buffers.
+     */
+    uint32 GetNumberOfMissedBuffers() const;
+
 private:
+
+    /**
+     * @brief Points the write pointers to the start of the buffer being filled.
+     */
+    void ResetWritePointers();
+
     /**
      * Number of signals in the DataSourceI (not all will necessarily be writing to this broker instance).
      */
     uint32 numberOfDataSourceSignals;
 
     /**
-     * Memory to hold N samples of all the DataSourceI signals.
+     * Memory to hold the numberOfBuffers buffers, each with N samples of the signals read by this broker.
      */
-    char8 **signalMemory;
+    char8 *bufferMemory;
 
     /**
-     * Dual-buffer pointer
+     * Size of each buffer.
      */
-    uint32 currentBufferIdx;
+    uint32 bufferSize;
 
     /**
-     * Size of each signal to be copied.
+     * Number of buffers.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * Offset of each DataSourceI signal in a buffer.
+     */
+    uint32 *signalBufferOffset;
+
+    /**
+     * Size of each signal to be copied (0 if the signal is not read by this broker).
      */
     uint32 *signalSize;
 
+    /**
+     * Number of signals read by this broker.
+     */
+    uint32 numberOfBrokerSignals;
+
+    /**
+     * DataSourceI indexes of the signals read by this broker.
+     */
+    uint32 *brokerSignals;
+
+    /**
+     * Where the next sample of each broker signal is to be written.
+     */
+    char8 **writePointers;
+
+    /**
+     * The buffer being filled by the producer.
+     */
+    uint32 fillBuffer;
+
+    /**
+     * Completed buffers (circular queue).
+     */
+    uint32 *readyBuffers;
+
+    /**
+     * Index of the oldest completed buffer in readyBuffers.
+     */
+    uint32 readyHead;
+
+    /**
+     * Number of completed buffers.
+     */
+    uint32 readyCount;
+
+    /**
+     * Buffers which are neither being filled, queued nor read (stack).
+     */
+    uint32 *freeBuffers;
+
+    /**
+     * Number of elements in freeBuffers.
+     */
+    uint32 freeCount;
+
+    /**
+     * Number of overruns.
+     */
+    uint32 overruns;
+
+    /**
+     * Number of missed buffers.
+     */
+    uint32 missedBuffers;
+
     /**
      * Pointer to the memory of the DataSourceI.
      */
@@ -164,12 +263,12 @@ private:
     TimeoutType timeout;
 
     /**
-     * If 1 => first reset and then wait at the synchronisation point.
+     * If 1 => first discard the buffers not read and then wait at the synchronisation point.
      */
     uint8 waitForNext;
 
     /**
-     * Protect the event sem
+     * Protects the event sem and the buffer queues.
      */
     FastPollingMutexSem mux;
 };
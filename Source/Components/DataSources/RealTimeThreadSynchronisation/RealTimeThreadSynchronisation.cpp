@@ -51,6 +51,7 @@ RealTimeThreadSynchronisation::RealTimeThreadSynchronisation() :
     synchInputBrokers = NULL_PTR(RealTimeThreadSynchBroker **);
     currentInitBrokerIndex = -1;
     waitForNext = 0u;
+    numberOfBuffers = 2u;
 }
 
 /*lint -e{1551} must free the allocated memory in the destructor. */
@@ -170,6 +171,15 @@ bool RealTimeThreadSynchronisation::Initialise(StructuredDataI & data) {
     if (!data.Read("WaitForNext", waitForNext)) {
         waitForNext = 0u;
     }
+    if (ok) {
+        if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
+            numberOfBuffers = 2u;
+        }
+        ok = (numberOfBuffers > 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBuffers shall be at least 2");
+        }
+    }
     return ok;
 }
 
@@ -241,7 +251,7 @@ bool RealTimeThreadSynchronisation::SetConfiguredDatabase(StructuredDataI & data
             else {
                 ReferenceT<RealTimeThreadSynchBroker> synchInputBroker(new RealTimeThreadSynchBroker());
                 (void) synchInputBrokersContainer.Insert(synchInputBroker);
-                synchInputBroker->SetFunctionIndex(this, n, timeout, waitForNext);
+                synchInputBroker->SetFunctionIndex(this, n, timeout, waitForNext, numberOfBuffers);
             }
         }
     }
@@ -268,6 +278,26 @@ TimeoutType RealTimeThreadSynchronisation::GetSynchroniseTimeout() const {
     return timeout;
 }
 
+uint32 RealTimeThreadSynchronisation::GetNumberOfBuffers() const {
+    return numberOfBuffers;
+}
+
+bool RealTimeThreadSynchronisation::GetBufferCounters(const char8 * const functionName, uint32 &overrunsOut, uint32 &missedBuffersOut) const {
+    bool ok = false;
+    if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
+        uint32 n;
+        for (n = 0u; (n < numberOfSyncGAMs) && (!ok); n++) {
+            StreamString gamName = synchInputBrokers[n]->GetGAMName();
+            if (gamName == functionName) {
+                overrunsOut = synchInputBrokers[n]->GetNumberOfOverruns();
+                missedBuffersOut = synchInputBrokers[n]->GetNumberOfMissedBuffers();
+                ok = true;
+            }
+        }
+    }
+    return ok;
+}
+
 uint32 RealTimeThreadSynchronisation::GetNumberOfStatefulMemoryBuffers() {
     return 2u;
 }
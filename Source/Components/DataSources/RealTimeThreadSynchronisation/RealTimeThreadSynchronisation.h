@@ -56,6 +56,11 @@ namespace MARTe {
  * useful if cycles were lost and the thread should wait for the next synchronisation cycle. The default behaviour (WaitForNext=0) is to 
  * first wait and then reset the semaphore and, as a consequence, if the semaphore had already been posted, it will not wait.
  *
+ * The samples for each reading GAM are stored in NumberOfBuffers buffers. The writing GAM never waits for a reading GAM: it fills a free buffer
+ * while the reading GAM copies a completed one, and completed buffers are delivered to the reading GAM in order. A reading GAM which is slower
+ * than the writing GAM can thus be up to NumberOfBuffers - 2 buffers late without losing data. If all the buffers are busy, the oldest
+ * completed buffer is recycled (see GetBufferCounters). With WaitForNext = 1 the buffers which were not read are discarded before waiting.
+ *
  * The configuration syntax is (names are only given as an example):
  * <pre>
  * +Functions = {"
@@ -142,6 +147,7 @@ namespace MARTe {
  *     Timeout = 1000 //Timeout in ms to wait for the thread to cycle.
  *                    //If this parameter is not set it will wait forever to be triggered and might lock a state change.
  *                    //Default is 1000
+ *     NumberOfBuffers = 4 //Optional. Number of buffers (>= 2) for each GAM reading from this DataSource. Default is 2
  *   }
  * }
  * </pre>
@@ -214,8 +220,8 @@ RealTimeThreadSynchronisation    ();
             const char8 * const nextStateName);
 
     /**
-     * @brief Calls DataSourceI::Initialise.
-     * @return see DataSourceI::Initialise.
+     * @brief Calls DataSourceI::Initialise and reads the Timeout, WaitForNext and NumberOfBuffers parameters.
+     * @return see DataSourceI::Initialise and NumberOfBuffers >= 2.
      */
     virtual bool Initialise(StructuredDataI & data);
 
@@ -238,7 +244,8 @@ RealTimeThreadSynchronisation    ();
     virtual bool Synchronise();
 
     /**
-     * @brief Returns 2 since this is a dual-buffer implementation.
+     * @brief Returns 2 so that the brokers copy tables are built against the first buffers.
+     * @details The RealTimeThreadSynchBroker redirects the copy table to the buffer being read (see NumberOfBuffers).
      * @return 2 buffers.
      */
     virtual uint32 GetNumberOfStatefulMemoryBuffers();
@@ -249,6 +256,23 @@ RealTimeThreadSynchronisation    ();
      */
     TimeoutType GetSynchroniseTimeout() const;
 
+    /**
+     * @brief Gets the number of buffers for each GAM reading from this DataSource.
+     * @return the number of buffers.
+     */
+    uint32 GetNumberOfBuffers() const;
+
+    /**
+     * @brief Gets the counters of the buffers read by the GAM \a functionName.
+     * @param[in] functionName the name of the GAM reading from this DataSource.
+     * @param[out] overrunsOut number of times the writing GAM found all the buffers busy and recycled a completed buffer.
+     * @param[out] missedBuffersOut number of completed buffers which were never copied to the GAM.
+     * @return true if \a functionName reads from this DataSource.
+     */
+    bool GetBufferCounters(const char8 * const functionName,
+            uint32 &overrunsOut,
+            uint32 &missedBuffersOut) const;
+
 private:
     /**
      * List of input brokers. One for each GAM reading from this DataSourceI.
@@ -294,6 +318,11 @@ private:
      * If 1 => first reset and then wait at the synchronisation point.
      */
     uint8 waitForNext;
+
+    /**
+     * Number of buffers for each GAM reading from this DataSourceI.
+     */
+    uint32 numberOfBuffers;
 };
 }
 
@@ -43,6 +43,10 @@ TimestampProvider::TimestampProvider() :
 TimestampProvider::~TimestampProvider() {
 }
 
+uint64 TimestampProvider::Frequency() {
+    return 1000000000LLU;
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -55,10 +55,16 @@ public:
     virtual ~TimestampProvider();
 
     /**
-     * @brief Returns a timestamp in nanoseconds
+     * @brief Returns a timestamp in units of 1 / Frequency() (nanoseconds by default)
      */
     virtual uint64 Timestamp() = 0;
 
+    /**
+     * @brief Returns the number of Timestamp() units per second.
+     * @return 1000000000 (i.e. Timestamp() is in nanoseconds). Providers which use a different unit shall override it.
+     */
+    virtual uint64 Frequency();
+
 };
 
 }
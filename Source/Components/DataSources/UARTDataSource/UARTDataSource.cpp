@@ -31,12 +31,42 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
+#include "HighResolutionTimer.h"
 #include "HighResolutionTimestampProvider.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
 #include "UARTDataSource.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Default size of the byte ring.
+ */
+static const uint32 UART_DATA_SOURCE_DEFAULT_RING_SIZE = 4096u;
+
+/**
+ * Number of bits which are needed to transmit one byte (start bit + 8 data bits + stop bit).
+ */
+static const uint64 UART_DATA_SOURCE_BITS_PER_BYTE = 10u;
+
+/**
+ * @brief Updates a CRC-16/CCITT-FALSE (polynomial 0x1021) with one more byte.
+ */
+static uint16 UARTDataSourceUpdateCRC(const uint16 crc,
+                                      const uint8 value) {
+    uint16 ret = static_cast<uint16>(crc ^ static_cast<uint16>(static_cast<uint16>(value) << 8u));
+    for (uint32 b = 0u; b < 8u; b++) {
+        if ((ret & 0x8000u) != 0u) {
+            ret = static_cast<uint16>(static_cast<uint16>(ret << 1u) ^ 0x1021u);
+        }
+        else {
+            ret = static_cast<uint16>(ret << 1u);
+        }
+    }
+    return ret;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -49,19 +79,38 @@ UARTDataSource::UARTDataSource() :
     EmbeddedServiceMethodBinderT<UARTDataSource>(*this, &UARTDataSource::CRIOThreadCallback),
     executor(*this) {
         lastReadIdx = 0u;
+        copyIdx = 0u;
         lastWrittenIdx = 0u;
+        producedFrames = 0u;
+        consumedFrames = 0u;
         serialTimeout = 0u;
         packetByteSize = 0u;
         lastDataCopyHadTimeout = true;
         timeoutToSynchronise = 500000u;
         timeout = 1000u;
+        baudRate = 0u;
+        timestampFrequency = 0u;
+        framing = UARTDataSourceFramingFixedLength;
+        syncWordSize = 0u;
+        lengthSize = 1u;
+        byteRing = NULL_PTR(uint8 *);
+        byteRingSize = 0u;
+        byteRingHead = 0u;
+        byteRingTail = 0u;
+        lastByteTicks = 0u;
+        lastFrameTimestamp = 0u;
+        nOfFrames = 0u;
+        nOfDiscardedBytes = 0u;
+        nOfCRCErrors = 0u;
+        nOfOverruns = 0u;
+        nOfReads = 0u;
+        overrunReported = false;
         ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
         filter->SetDestination(this);
         ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
         if (!ret.ErrorsCleared()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
         }
-        writeMark = NULL_PTR(bool *);
 }
 
 /*lint -e{1551} the destructor must guarantee that the thread and servers are closed.*/
@@ -72,8 +121,8 @@ UARTDataSource::~UARTDataSource() {
     if (!eventSem.Close()) {
         REPORT_ERROR(ErrorManagement::OSError, "Failed to close EventSem");
     }
-    if (writeMark != NULL_PTR(bool *)) {
-        delete[] writeMark;
+    if (byteRing != NULL_PTR(uint8 *)) {
+        delete[] byteRing;
     }
 
     serial.Close();
@@ -104,7 +153,6 @@ bool UARTDataSource::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The port name property shall be set");
         }
     }
-    uint32 baudRate = 0u;
     if (ok) {
         ok = data.Read("BaudRate", baudRate);
         if (ok) {
@@ -128,6 +176,12 @@ bool UARTDataSource::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The serial timeout property shall be set");
         }
     }
+    if (ok) {
+        ok = (baudRate > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The baud rate shall be > 0");
+        }
+    }
     if (ok) {
         ok = serial.SetSpeed(baudRate);
     }
@@ -141,6 +195,75 @@ bool UARTDataSource::Initialise(StructuredDataI &data) {
         }
     }
 
+    if (ok) {
+        StreamString framingStr;
+        if (!data.Read("Framing", framingStr)) {
+            framingStr = "FixedLength";
+        }
+        if (framingStr == "FixedLength") {
+            framing = UARTDataSourceFramingFixedLength;
+        }
+        else if (framingStr == "SyncWord") {
+            framing = UARTDataSourceFramingSyncWord;
+        }
+        else if (framingStr == "LengthPrefixed") {
+            framing = UARTDataSourceFramingLengthPrefixed;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Framing shall be FixedLength, SyncWord or LengthPrefixed");
+        }
+    }
+    if (ok) {
+        AnyType syncWordDescription = data.GetType("SyncWord");
+        if (syncWordDescription.GetDataPointer() != NULL_PTR(void *)) {
+            syncWordSize = syncWordDescription.GetNumberOfElements(0u);
+            ok = ((syncWordSize > 0u) && (syncWordSize <= UART_DATA_SOURCE_MAX_SYNC_WORD_SIZE));
+            if (ok) {
+                Vector<uint8> syncWordVector(&syncWord[0], syncWordSize);
+                ok = data.Read("SyncWord", syncWordVector);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The SyncWord shall be an array of 1 to %d uint8", UART_DATA_SOURCE_MAX_SYNC_WORD_SIZE);
+            }
+        }
+    }
+    if (ok) {
+        if (framing == UARTDataSourceFramingSyncWord) {
+            ok = (syncWordSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The SyncWord shall be set if Framing = SyncWord");
+            }
+        }
+        else if (framing == UARTDataSourceFramingFixedLength) {
+            if (syncWordSize > 0u) {
+                REPORT_ERROR(ErrorManagement::Warning, "The SyncWord is ignored if Framing = FixedLength");
+                syncWordSize = 0u;
+            }
+        }
+        else {
+            if (!data.Read("LengthSize", lengthSize)) {
+                lengthSize = 1u;
+            }
+            ok = ((lengthSize == 1u) || (lengthSize == 2u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The LengthSize shall be 1 or 2");
+            }
+        }
+    }
+    if (ok) {
+        if (data.Read("RingSize", byteRingSize)) {
+            //Power of 2 so that the free running counters can be used to index the ring
+            ok = ((byteRingSize > 0u) && ((byteRingSize & (byteRingSize - 1u)) == 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The RingSize shall be a power of 2");
+            }
+        }
+        else {
+            byteRingSize = 0u;
+        }
+    }
+
     if (ok) {
         ok = (Size() < 2u);
         if (!ok) {
@@ -157,6 +280,18 @@ bool UARTDataSource::Initialise(StructuredDataI &data) {
         else {
             timeProvider = Get(0u);
         }
+        ok = timeProvider.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The time provider shall inherit from TimestampProvider");
+        }
+    }
+    if (ok) {
+        //The time-stamps are interpolated in the units of the time provider
+        timestampFrequency = timeProvider->Frequency();
+        ok = (timestampFrequency > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The frequency of the time provider shall be > 0");
+        }
     }
 
     //Do not allow to add signals in run-time
@@ -181,10 +316,6 @@ bool UARTDataSource::Initialise(StructuredDataI &data) {
         executor.SetPriorityClass(Threads::RealTimePriorityClass);
         executor.SetCPUMask(cpuMask);
     }
-
-    if (ok) {
-        muxSem.Create();
-    }
     return ok;
 }
 
@@ -222,14 +353,57 @@ bool UARTDataSource::SetConfiguredDatabase(StructuredDataI &data) {
         ok = GetSignalByteSize(2u, packetByteSize);
     }
     if (ok) {
-        REPORT_ERROR(ErrorManagement::Information, "Going to read %d bytes from the serial interface.", packetByteSize);
-
-        writeMark = new bool[numberOfBuffers];
-        uint32 i;
-        for (i = 0u; i < numberOfBuffers; i++) {
-            writeMark[i] = false;
+        //One of the buffers is always kept for the RealTimeThread to copy when there is no data
+        ok = (numberOfBuffers > 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The NumberOfBuffers shall be at least 2");
+        }
+    }
+    uint32 maxFrameSize = packetByteSize;
+    if (ok) {
+        if (framing == UARTDataSourceFramingSyncWord) {
+            ok = (syncWordSize < packetByteSize);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The SyncWord shall be smaller than the packet");
+            }
+        }
+        else if (framing == UARTDataSourceFramingLengthPrefixed) {
+            ok = ((lengthSize == 2u) || (packetByteSize <= 0xFFu));
+            if (ok) {
+                ok = (packetByteSize <= 0xFFFFu);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The packet size (%d) cannot be represented with LengthSize = %d bytes", packetByteSize, lengthSize);
+            }
+            //SyncWord + Length + Payload + CRC
+            maxFrameSize = syncWordSize + lengthSize + packetByteSize + 2u;
+        }
+        else {
+            //FixedLength is delimited by the packet size
         }
-
+    }
+    if (ok) {
+        if (byteRingSize == 0u) {
+            byteRingSize = UART_DATA_SOURCE_DEFAULT_RING_SIZE;
+            while (byteRingSize < (4u * maxFrameSize)) {
+                byteRingSize *= 2u;
+            }
+        }
+        ok = (byteRingSize >= (2u * maxFrameSize));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The RingSize (%d) shall be at least twice the largest frame (%d)", byteRingSize, maxFrameSize);
+        }
+    }
+    if (ok) {
+        ok = (byteRing == NULL_PTR(uint8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The byte ring was already allocated");
+        }
+    }
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to read frames of up to %d bytes from the serial interface into a ring of %d bytes.", maxFrameSize,
+                     byteRingSize);
+        byteRing = new uint8[byteRingSize];
     }
     return ok;
 }
@@ -237,73 +411,35 @@ bool UARTDataSource::SetConfiguredDatabase(StructuredDataI &data) {
 ErrorManagement::ErrorType UARTDataSource::CRIOThreadCallback(ExecutionInfo &info) {
     ErrorManagement::ErrorType err;
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        if (muxSem.FastLock() == ErrorManagement::NoError) {
-            if (writeMark != NULL_PTR(bool*)) {
-                if (writeMark[lastWrittenIdx]) {
-                    REPORT_ERROR(ErrorManagement::Warning, "Buffer overflow at index %d", lastWrittenIdx);
-                }
-            }
-        }
-        muxSem.FastUnLock();
-
-        //Memory is not interleaved, thus there will be numberOfBuffers dataOK before the actual data
-        uint32 serialWriteIdx = static_cast<uint32>((numberOfBuffers * (sizeof(uint64) + sizeof(uint8)))) + (lastWrittenIdx * packetByteSize);
-        uint32 timeWriteIdx = numberOfBuffers + static_cast<uint32>(lastWrittenIdx * sizeof(uint64));
-        uint32 timeWriteIdx_1 = numberOfBuffers;
-        if (lastWrittenIdx > 0u) {
-            timeWriteIdx_1 += ((lastWrittenIdx - 1u) * static_cast<uint32>(sizeof(uint64)));
-        }
-        else {
-            timeWriteIdx_1 += ((numberOfBuffers - 1u) * static_cast<uint32>(sizeof(uint64)));
-        }
-
-        uint32 bytesToRead = packetByteSize;
-        uint8 *dataOK = reinterpret_cast<uint8*>(&(memory[lastWrittenIdx]));
-        /*lint -e{927, 826} memory is a uint64, thus the casting will not lead to precision error. timePacket will be 8 bytes on the memory array*/
-        uint64 *timePacket = reinterpret_cast<uint64*>(&(memory[timeWriteIdx]));
-        /*lint -e{927, 826} memory is a uint64, thus the casting will not lead to precision error. timePacket will be 8 bytes on the memory array*/
-        *timePacket = *reinterpret_cast<uint64*>(&(memory[timeWriteIdx_1]));
-
-        if (serial.Read(reinterpret_cast<char8*>(&(memory[serialWriteIdx])), bytesToRead, serialTimeout)) {
-            if (muxSem.FastLock() == ErrorManagement::NoError) {
-                *dataOK = 1u;
-                if (writeMark != NULL_PTR(bool *)) {
-                    writeMark[lastWrittenIdx] = true;
-                    lastWrittenIdx++;
-                    if (lastWrittenIdx == numberOfBuffers) {
-                        lastWrittenIdx = 0u;
-                    }
-                    if (!eventSem.Post()) {
-                        REPORT_ERROR(ErrorManagement::OSError, "Failed to post EventSem");
-                    }
+        uint32 lastProducedFrames = producedFrames;
+        bool dataRead = serial.WaitRead(serialTimeout);
+        if (dataRead) {
+            dataRead = DrainUART();
+        }
+        if (dataRead) {
+            lastByteTicks = HighResolutionTimer::Counter();
+            //Wake the RealTimeThread once per read and not once per frame
+            if (producedFrames != lastProducedFrames) {
+                if (!eventSem.Post()) {
+                    REPORT_ERROR(ErrorManagement::OSError, "Failed to post EventSem");
                 }
             }
-            *timePacket = timeProvider->Timestamp();
-            err = (*timePacket != 0LLU);
-
-            muxSem.FastUnLock();
         }
         else {
-            //No data received from the serial.Read. Allow the MARTe real-time thread to execute, but set the dataOK to false.
-            if (bytesToRead == 0u) {
-                if (muxSem.FastLock() == ErrorManagement::NoError) {
-                    *dataOK = 0u;
-                    if (!eventSem.Post()) {
-                        REPORT_ERROR(ErrorManagement::OSError, "Failed to post EventSem");
-                    }
+            //Without a SyncWord the only way to find the beginning of a frame is to wait for a silent period. After a period of no data,
+            //assume that the data is framed again...
+            uint32 pendingBytes = (byteRingHead - byteRingTail);
+            if ((framing == UARTDataSourceFramingFixedLength) && (pendingBytes > 0u)) {
+                float64 silence = static_cast<float64>(HighResolutionTimer::Counter() - lastByteTicks) * HighResolutionTimer::Period() * 1e6;
+                if (silence >= static_cast<float64>(timeoutToSynchronise)) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Discarding %d bytes of an incomplete packet after %d us without data. The next packet should be synchronised.",
+                                 pendingBytes, timeoutToSynchronise);
+                    ConsumeBytes(pendingBytes, true);
                 }
-                muxSem.FastUnLock();
             }
-            //Read only part of the packet from the serial.Read.
-            else {
-                //We are lost. Ignore anything coming from the serial until we have a silent period. After a period of no data, assume that the data is framed again...
-                REPORT_ERROR(ErrorManagement::Warning, "Failed to read %d bytes from serial. Trying to resynchronise by waiting %d us for no data", packetByteSize, timeoutToSynchronise);
-                while (serial.WaitRead(timeoutToSynchronise)) {
-                    char8 ignoredMem;
-                    uint32 ignoredSize = 1u;
-                    (void) serial.Read(&ignoredMem, ignoredSize);
-                }
-                REPORT_ERROR(ErrorManagement::Warning, "No data arrived in the last %d us. As such, the next packet should be synchronised.", timeoutToSynchronise);
+            //No data received from the serial. Allow the MARTe real-time thread to execute, but with the dataOK set to false.
+            if (!eventSem.Post()) {
+                REPORT_ERROR(ErrorManagement::OSError, "Failed to post EventSem");
             }
         }
     }
@@ -314,6 +450,8 @@ ErrorManagement::ErrorType UARTDataSource::CRIOThreadCallback(ExecutionInfo &inf
             uint32 ignoredSize = 1u;
             (void) serial.Read(&ignoredMem, ignoredSize);
         }
+        byteRingTail = byteRingHead;
+        lastByteTicks = HighResolutionTimer::Counter();
         REPORT_ERROR(ErrorManagement::Warning, "UART should now be empty");
     }
     else {
@@ -323,21 +461,199 @@ ErrorManagement::ErrorType UARTDataSource::CRIOThreadCallback(ExecutionInfo &inf
     return err;
 }
 
-void UARTDataSource::PrepareInputOffsets() {
+bool UARTDataSource::DrainUART() {
+    bool readAny = false;
+    bool readMore = (byteRing != NULL_PTR(uint8 *));
+    while (readMore) {
+        //Read directly into the largest contiguous free region of the ring
+        uint32 headIdx = (byteRingHead & (byteRingSize - 1u));
+        uint32 readSize = (byteRingSize - (byteRingHead - byteRingTail));
+        if (readSize > (byteRingSize - headIdx)) {
+            readSize = (byteRingSize - headIdx);
+        }
+        uint32 requestedSize = readSize;
+        readMore = (readSize > 0u);
+        if (readMore) {
+            /*lint -e{613} byteRing cannot be NULL as otherwise readMore would be false*/
+            readMore = serial.Read(reinterpret_cast<char8 *>(&byteRing[headIdx]), readSize);
+        }
+        if (readMore) {
+            readMore = (readSize > 0u);
+        }
+        if (readMore) {
+            readAny = true;
+            nOfReads++;
+            byteRingHead += readSize;
+            ExtractFrames(timeProvider->Timestamp());
+            //Only if the region was completely filled there might be more data waiting
+            readMore = (readSize == requestedSize);
+            if (readMore) {
+                readMore = serial.WaitRead(0u);
+            }
+        }
+    }
+    return readAny;
+}
 
-    if (muxSem.FastLock() == ErrorManagement::NoError) {
-        if (writeMark != NULL_PTR(bool *)) {
-            if (!writeMark[lastReadIdx]) {
-                if (!eventSem.Reset()) {
-                    REPORT_ERROR(ErrorManagement::OSError, "Failed to reset EventSem");
+void UARTDataSource::ExtractFrames(const uint64 readTimestamp) {
+    bool searching = true;
+    while (searching) {
+        uint32 available = (byteRingHead - byteRingTail);
+        uint32 frameSize = 0u;
+        uint32 payloadOffset = 0u;
+        uint32 payloadSize = packetByteSize;
+        bool discard = false;
+        if (framing == UARTDataSourceFramingFixedLength) {
+            if (available >= packetByteSize) {
+                frameSize = packetByteSize;
+            }
+        }
+        else if (framing == UARTDataSourceFramingSyncWord) {
+            if (available >= packetByteSize) {
+                if (MatchSyncWord()) {
+                    frameSize = packetByteSize;
                 }
-                muxSem.FastUnLock();
-                if (!eventSem.Wait(timeout)) {
-                    REPORT_ERROR(ErrorManagement::OSError, "Failed to wait EventSem");
+                else {
+                    discard = true;
                 }
             }
-            else {
-                muxSem.FastUnLock();
+        }
+        else {
+            uint32 headerSize = (syncWordSize + lengthSize);
+            if (available >= headerSize) {
+                if (MatchSyncWord()) {
+                    //Length is little endian
+                    payloadSize = PeekByte(syncWordSize);
+                    if (lengthSize == 2u) {
+                        payloadSize |= (static_cast<uint32>(PeekByte(syncWordSize + 1u)) << 8u);
+                    }
+                    if (payloadSize > packetByteSize) {
+                        discard = true;
+                    }
+                    else if (available >= (headerSize + payloadSize + 2u)) {
+                        uint16 crc = 0xFFFFu;
+                        uint32 crcIdx = (headerSize + payloadSize);
+                        for (uint32 i = syncWordSize; i < crcIdx; i++) {
+                            crc = UARTDataSourceUpdateCRC(crc, PeekByte(i));
+                        }
+                        //CRC is big endian
+                        uint16 frameCRC = static_cast<uint16>(static_cast<uint16>(static_cast<uint16>(PeekByte(crcIdx)) << 8u) | PeekByte(crcIdx + 1u));
+                        if (crc == frameCRC) {
+                            frameSize = (crcIdx + 2u);
+                            payloadOffset = headerSize;
+                        }
+                        else {
+                            nOfCRCErrors++;
+                            discard = true;
+                        }
+                    }
+                    else {
+                        //Wait for the rest of the frame
+                    }
+                }
+                else {
+                    discard = true;
+                }
+            }
+        }
+        if (frameSize > 0u) {
+            //Interpolate the time at which the last byte of the frame arrived, given the bytes that were received after it.
+            uint64 frameTimestamp = 0u;
+            //Multiply before dividing, so that the fraction of a time unit that each byte takes is not truncated.
+            uint64 bytesAfterFrameDuration = ((static_cast<uint64>(available - frameSize) * UART_DATA_SOURCE_BITS_PER_BYTE * timestampFrequency)
+                    / static_cast<uint64>(baudRate));
+            if (readTimestamp > bytesAfterFrameDuration) {
+                frameTimestamp = (readTimestamp - bytesAfterFrameDuration);
+            }
+            if (frameTimestamp < lastFrameTimestamp) {
+                frameTimestamp = lastFrameTimestamp;
+            }
+            lastFrameTimestamp = frameTimestamp;
+            StoreFrame(payloadOffset, payloadSize, frameTimestamp);
+            ConsumeBytes(frameSize, false);
+        }
+        else if (discard) {
+            //Only skip one byte, as the beginning of a valid frame might be inside of the rejected one.
+            ConsumeBytes(1u, true);
+        }
+        else {
+            searching = false;
+        }
+    }
+}
+
+void UARTDataSource::StoreFrame(const uint32 payloadOffset,
+                                const uint32 payloadSize,
+                                const uint64 frameTimestamp) {
+    nOfFrames++;
+    //One of the buffers is kept for the RealTimeThread to copy when there is no data (see GetInputOffset)
+    if ((producedFrames - consumedFrames) < (numberOfBuffers - 1u)) {
+        //Memory is not interleaved, thus there will be numberOfBuffers dataOK and numberOfBuffers times before the actual data
+        uint32 serialWriteIdx = static_cast<uint32>((numberOfBuffers * (sizeof(uint64) + sizeof(uint8)))) + (lastWrittenIdx * packetByteSize);
+        uint32 timeWriteIdx = numberOfBuffers + static_cast<uint32>(lastWrittenIdx * sizeof(uint64));
+        uint8 *packet = &(memory[serialWriteIdx]);
+        /*lint -e{927, 826} memory is a uint64, thus the casting will not lead to precision error. timePacket will be 8 bytes on the memory array*/
+        uint64 *timePacket = reinterpret_cast<uint64*>(&(memory[timeWriteIdx]));
+        //The payload might wrap around the end of the ring
+        uint32 ringIdx = ((byteRingTail + payloadOffset) & (byteRingSize - 1u));
+        uint32 firstCopySize = (byteRingSize - ringIdx);
+        if (firstCopySize > payloadSize) {
+            firstCopySize = payloadSize;
+        }
+        /*lint -e{613} byteRing cannot be NULL if there are frames*/
+        (void) MemoryOperationsHelper::Copy(packet, &byteRing[ringIdx], firstCopySize);
+        if (firstCopySize < payloadSize) {
+            /*lint -e{613} byteRing cannot be NULL if there are frames*/
+            (void) MemoryOperationsHelper::Copy(&packet[firstCopySize], &byteRing[0], (payloadSize - firstCopySize));
+        }
+        if (payloadSize < packetByteSize) {
+            (void) MemoryOperationsHelper::Set(&packet[payloadSize], '\0', (packetByteSize - payloadSize));
+        }
+        *timePacket = frameTimestamp;
+        memory[lastWrittenIdx] = 1u;
+        lastWrittenIdx++;
+        if (lastWrittenIdx == numberOfBuffers) {
+            lastWrittenIdx = 0u;
+        }
+        //The buffer shall be completely written before being released
+        __sync_synchronize();
+        producedFrames++;
+        overrunReported = false;
+    }
+    else {
+        nOfOverruns++;
+        if (!overrunReported) {
+            REPORT_ERROR(ErrorManagement::Warning, "Buffer overflow at index %d. Discarding frames (%d frames discarded so far)", lastWrittenIdx, nOfOverruns);
+            overrunReported = true;
+        }
+    }
+}
+
+void UARTDataSource::ConsumeBytes(const uint32 nOfBytes,
+                                  const bool discarded) {
+    byteRingTail += nOfBytes;
+    if (discarded) {
+        nOfDiscardedBytes += nOfBytes;
+    }
+}
+
+bool UARTDataSource::MatchSyncWord() const {
+    bool match = true;
+    for (uint32 i = 0u; (i < syncWordSize) && (match); i++) {
+        match = (PeekByte(i) == syncWord[i]);
+    }
+    return match;
+}
+
+void UARTDataSource::PrepareInputOffsets() {
+    if (producedFrames == consumedFrames) {
+        if (!eventSem.Reset()) {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to reset EventSem");
+        }
+        //A frame might have been released (and the EventSem posted) before the Reset.
+        if (producedFrames == consumedFrames) {
+            if (!eventSem.Wait(timeout)) {
+                REPORT_ERROR(ErrorManagement::OSError, "Failed to wait EventSem");
             }
         }
     }
@@ -348,57 +664,52 @@ bool UARTDataSource::GetInputOffset(const uint32 signalIdx,
         const uint32 numberOfSamples,
         uint32 &offset) {
     if (signalIdx == 0u) {
-        //Remember that the memory is organised as non-interleaved, i.e. signal1_1, signal1_2, ..., signal1_N, signal2_1, ..., signal2_N
-        offset = lastReadIdx;
-        if (muxSem.FastLock() == ErrorManagement::NoError) {
-            uint8 *dataOK = reinterpret_cast<uint8*>(&(memory[offset]));
-            //Remember with 100% guarantee if the data was copied with a timeout or not, so that the lastReadIdx does not get incremented if new data
-            //become available between here and TerminateInputCopy
-            //See comment below in TerminateInputCopy.
-            lastDataCopyHadTimeout = (*dataOK == 0u);
+        //Remember if the data was copied with a timeout or not, so that the lastReadIdx does not get incremented if new data
+        //become available between here and TerminateInputCopy.
+        lastDataCopyHadTimeout = (producedFrames == consumedFrames);
+        if (lastDataCopyHadTimeout) {
+            //Copy the buffer that was last read. It has DataOK = 0 and the previous time and it will not be written until lastReadIdx is read.
+            copyIdx = ((lastReadIdx > 0u) ? (lastReadIdx - 1u) : (numberOfBuffers - 1u));
+        }
+        else {
+            copyIdx = lastReadIdx;
         }
-        muxSem.FastUnLock();
+        //Do not read the buffer before it was released
+        __sync_synchronize();
+        //Remember that the memory is organised as non-interleaved, i.e. signal1_1, signal1_2, ..., signal1_N, signal2_1, ..., signal2_N
+        offset = copyIdx;
     }
     else if (signalIdx == 1u) {
         //Remember that the memory pointer returned by the MemoryDataSourceI::GetSignalMemoryBuffer (and used by the broker) already points
         //to the beginning of each signal memory, so that each signal memory starts with a zero offset. Nevertheless, the "memory" variable points to the beginning
         //of the full memory (i.e. at the beginning of the memory of signal zero).
-        offset = (lastReadIdx * static_cast<uint32>(sizeof(uint64)));
+        offset = (copyIdx * static_cast<uint32>(sizeof(uint64)));
     }
     else {
-        offset = (lastReadIdx * packetByteSize);
+        offset = (copyIdx * packetByteSize);
     }
 
     return true;
 }
-///home/Giuseppe/MARTe2Project/GIT/MARTe2Hieratika/CSS_OPI/CSS_EPICS_3.1.4/configuration/org.eclipse.osgi/bundles/58/1/.cp/:
+
 /*lint -e{715} function prototype is derived from upper class*/
 bool UARTDataSource::TerminateInputCopy(const uint32 signalIdx,
         const uint32 offset,
         const uint32 numberOfSamples) {
-    //Only clear the dataOK after the data signal (i.e. signalIdx == 1) has been copied.
+    //Only release the buffer after the data signal (i.e. signalIdx == 2) has been copied.
     if (signalIdx == 2u) {
-        //Only increment if there was no timeout. The status of dataOK could have changed between the GetInputOffset and the TerminateInputCopy
-        //i.e. GetInputOffset could have copied data with a timeout for a given index, but when getting into TerminateInputCopy new data could
-        //be available. This would imply writeMark[lastReadIdx] = true and as such the lastReadIdx would be incremented and the data in lastReadIdx - 1 would not get coppied in
-        //the next GetInputOffset
         if (!lastDataCopyHadTimeout) {
-            if (muxSem.FastLock() == ErrorManagement::NoError) {
-                if (writeMark != NULL_PTR(bool *)) {
-                    if (writeMark[lastReadIdx]) {
-                        writeMark[lastReadIdx] = false;
-                        //Data was already read. Reset to zero the DataOK flag. (Memory is not interleaved, thus there will be numberOfBuffers dataOK before the data)
-                        uint8 *dataOK = reinterpret_cast<uint8*>(&(memory[lastReadIdx]));
-                        *dataOK = 0u;
-                        lastReadIdx++;
-                        if (lastReadIdx == numberOfBuffers) {
-                            lastReadIdx = 0u;
-                        }
-                    }
-                }
+            //Data was already read. Reset to zero the DataOK flag, as this buffer will be copied if there is no data in the next cycle.
+            //(Memory is not interleaved, thus there will be numberOfBuffers dataOK before the data)
+            memory[lastReadIdx] = 0u;
+            lastReadIdx++;
+            if (lastReadIdx == numberOfBuffers) {
+                lastReadIdx = 0u;
             }
+            //The buffer shall be completely read before being given back to the asynchronous thread
+            __sync_synchronize();
+            consumedFrames++;
             lastDataCopyHadTimeout = true;
-            muxSem.FastUnLock();
         }
     }
     return true;
@@ -465,6 +776,30 @@ ErrorManagement::ErrorType UARTDataSource::StopAcquisition() {
     return err;
 }
 
+UARTDataSourceFraming UARTDataSource::GetFraming() const {
+    return framing;
+}
+
+uint32 UARTDataSource::GetNumberOfFrames() const {
+    return nOfFrames;
+}
+
+uint32 UARTDataSource::GetNumberOfDiscardedBytes() const {
+    return nOfDiscardedBytes;
+}
+
+uint32 UARTDataSource::GetNumberOfCRCErrors() const {
+    return nOfCRCErrors;
+}
+
+uint32 UARTDataSource::GetNumberOfOverruns() const {
+    return nOfOverruns;
+}
+
+uint32 UARTDataSource::GetNumberOfReads() const {
+    return nOfReads;
+}
+
 CLASS_REGISTER(UARTDataSource, "1.0")
     CLASS_METHOD_REGISTER(UARTDataSource, StopAcquisition)
 }
@@ -47,6 +47,17 @@
 
 namespace MARTe {
 
+typedef enum {
+    UARTDataSourceFramingFixedLength,
+    UARTDataSourceFramingSyncWord,
+    UARTDataSourceFramingLengthPrefixed
+} UARTDataSourceFraming;
+
+/**
+ * Maximum number of bytes of the SyncWord.
+ */
+static const uint32 UART_DATA_SOURCE_MAX_SYNC_WORD_SIZE = 8u;
+
 /**
  * @brief A DataSource which implements a circular buffer implementation (using a MemoryMapMultiBufferInputBroker) to a CRIOUARTSerial.
  *
@@ -62,18 +73,30 @@ namespace MARTe {
  * <pre>
  *   +CRIOUART = {
  *     Class = UARTDataSource
- *     NumberOfBuffers = 500 //Number of buffer of the circular buffer
+ *     NumberOfBuffers = 500 //Number of buffer of the circular buffer (at least 2). Up to NumberOfBuffers - 1 frames can wait to be read.
  *     PortName = "/dev/ttyUSB0" //Name of the UART port
  *     BaudRate = 115200 //BAUD UART rate
  *     Timeout = 200000 //Maximum time to wait for data
+ *     SerialTimeout = 100000 //Maximum time (in micro-seconds) to wait for the UART to have data. If it elapses the RealTimeThread is released with DataOK = 0.
+ *     TimeoutToSynchronise = 500000 //Optional (default 500000 us). Only for Framing = FixedLength. Silence period after which an incomplete frame is discarded.
  *     CPUMask = 8 //Affinity of the CPU of where to read data from
+ *     Framing = FixedLength //Optional (default FixedLength). How frames are delimited in the byte stream:
+ *       If Framing == FixedLength each frame has exactly the size of the Packet signal.
+ *       If Framing == SyncWord each frame has exactly the size of the Packet signal and starts with the SyncWord.
+ *       If Framing == LengthPrefixed each frame is [SyncWord][Length][Payload][CRC], where Length is the number of bytes of the Payload
+ *         (little endian, LengthSize bytes, no larger than the Packet signal) and CRC is the CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF)
+ *         of the Length and of the Payload, most significant byte first. The Payload is written in the Packet signal, padded with zeros.
+ *     SyncWord = {0xEB 0x90} //Compulsory if Framing == SyncWord, optional if Framing == LengthPrefixed. Up to 8 bytes.
+ *     LengthSize = 1 //Optional (default 1). Only for Framing == LengthPrefixed. 1 or 2 bytes.
+ *     RingSize = 4096 //Optional (default the largest of 4096 and four frames). Size in bytes of the ring where the UART is drained.
+ *                     //Shall be at least twice the largest frame.
  *     Signals = {
  *       DataOK = { //Compulsory - is the data valid?
  *         Type = uint8
  *         NumberOfElements = 1
  *       }
  *       Time = {
- *         Type = uint64 //Compulsory - time-stamp in nano-seconds at which the data was read.
+ *         Type = uint64 //Compulsory - time-stamp in nano-seconds at which the last byte of the frame was received.
  *         NumberOfElements = 1
  *       }
  *       Packet = { //Actual data to read
@@ -85,6 +108,16 @@ namespace MARTe {
  *       Class = TimestampProvider //A class that provides the absolute time in ns. It shall inherit from TimestampProvider.
  *     }
  *   }
+ * </pre>
+ *
+ * Every time that the UART has data, the thread drains everything that is available directly into a byte ring (one read per contiguous region of the ring)
+ * and then extracts all the complete frames, copying them directly from the byte ring to the next free buffer. If a frame does not start with the
+ * SyncWord, or if its Length or CRC are not valid, only its first byte is discarded and the search continues from the next byte, so that a
+ * corrupted frame never causes the loss of the frames that follow. The thread and the RealTimeThread share the buffers without locks:
+ * the thread only writes the buffers which were already read and the RealTimeThread only reads the buffers which were completely written.
+ *
+ * As many frames may arrive in the same read, the Time of each frame is interpolated back from the time of the read, given that each byte
+ * takes 10 bits (8N1) at the configured BaudRate. The interpolation uses the TimestampProvider::Frequency of the configured time provider.
  */
 class UARTDataSource: public MemoryDataSourceI, public MessageI, public EmbeddedServiceMethodBinderT<UARTDataSource> {
 public:
@@ -158,42 +191,126 @@ public:
 
     ErrorManagement::ErrorType StopAcquisition();
 
+    /**
+     * @brief Gets the configured Framing.
+     * @return the configured Framing.
+     */
+    UARTDataSourceFraming GetFraming() const;
+
+    /**
+     * @brief Gets the number of frames extracted from the UART (including the ones lost in overruns).
+     * @return the number of frames extracted from the UART.
+     */
+    uint32 GetNumberOfFrames() const;
+
+    /**
+     * @brief Gets the number of bytes which were discarded while searching for a valid frame.
+     * @return the number of bytes which were discarded while searching for a valid frame.
+     */
+    uint32 GetNumberOfDiscardedBytes() const;
+
+    /**
+     * @brief Gets the number of frames with a wrong CRC (only for Framing == LengthPrefixed).
+     * @return the number of frames with a wrong CRC.
+     */
+    uint32 GetNumberOfCRCErrors() const;
+
+    /**
+     * @brief Gets the number of valid frames lost because all the buffers were waiting to be read by the RealTimeThread.
+     * @return the number of valid frames lost because all the buffers were waiting to be read by the RealTimeThread.
+     */
+    uint32 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the number of reads from the UART which returned data.
+     * @return the number of reads from the UART which returned data.
+     */
+    uint32 GetNumberOfReads() const;
+
 private:
 
+    /**
+     * @brief Reads everything that is available in the UART into the byte ring and extracts the frames.
+     * @return true if at least one byte was read.
+     */
+    bool DrainUART();
+
+    /**
+     * @brief Extracts all the complete frames from the byte ring.
+     * @param[in] readTimestamp time at which the last byte in the ring was read.
+     */
+    void ExtractFrames(const uint64 readTimestamp);
+
+    /**
+     * @brief Copies a frame from the byte ring to the next free buffer and releases it to the RealTimeThread.
+     * @param[in] payloadOffset offset of the data to copy, with respect to the beginning of the byte ring data.
+     * @param[in] payloadSize number of bytes to copy (the remaining bytes of the buffer are set to zero).
+     * @param[in] frameTimestamp the interpolated time of the last byte of the frame.
+     */
+    void StoreFrame(const uint32 payloadOffset,
+                    const uint32 payloadSize,
+                    const uint64 frameTimestamp);
+
+    /**
+     * @brief Sets the nOfBytes first bytes of the byte ring as read.
+     * @param[in] nOfBytes number of bytes to remove from the byte ring.
+     * @param[in] discarded true if the bytes do not belong to a valid frame.
+     */
+    void ConsumeBytes(const uint32 nOfBytes,
+                      const bool discarded);
+
+    /**
+     * @brief Gets a byte from the byte ring.
+     * @param[in] offset offset of the byte, with respect to the beginning of the byte ring data.
+     * @return the byte.
+     */
+    inline uint8 PeekByte(const uint32 offset) const;
+
+    /**
+     * @brief Checks if the SyncWord is at the beginning of the byte ring data.
+     * @return true if the SyncWord is at the beginning of the byte ring data.
+     */
+    bool MatchSyncWord() const;
+
     /**
      * Asynchronous thread executor.
      */
     SingleThreadService executor;
 
     /**
-     * Last index read by the RTThread.
+     * Next buffer to be read by the RealTimeThread.
      */
     uint32 lastReadIdx;
 
     /**
-     * Last index written by the asynchronous thread.
+     * Buffer being copied by the RealTimeThread (lastReadIdx or, if there is no data, the buffer before).
+     */
+    uint32 copyIdx;
+
+    /**
+     * Next buffer to be written by the asynchronous thread.
      */
     uint32 lastWrittenIdx;
 
     /**
-     * Number of bytes to read from the UART.
+     * Number of frames released to the RealTimeThread. Only written by the asynchronous thread.
      */
-    uint32 packetByteSize;
+    volatile uint32 producedFrames;
 
     /**
-     * RealTimeThread waits on the PrepareInputOffsets for data to be available.
+     * Number of frames read by the RealTimeThread. Only written by the RealTimeThread.
      */
-    EventSem eventSem;
+    volatile uint32 consumedFrames;
 
     /**
-     * Fast locking semaphore to reset the eventSem.
+     * Number of bytes to read from the UART.
      */
-    FastPollingMutexSem muxSem;
+    uint32 packetByteSize;
 
     /**
-     * Marks that a given signal has been written.
+     * RealTimeThread waits on the PrepareInputOffsets for data to be available.
      */
-    bool *writeMark;
+    EventSem eventSem;
 
     /**
      * Synchronise the GetInputOffset with the TerminateInputCopy
@@ -222,6 +339,95 @@ private:
 
     uint32 timeout;
 
+    /**
+     * The configured BaudRate.
+     */
+    uint32 baudRate;
+
+    /**
+     * The TimestampProvider::Frequency of the timeProvider (a byte takes 10 * timestampFrequency / baudRate time-stamp units).
+     */
+    uint64 timestampFrequency;
+
+    /**
+     * The configured Framing.
+     */
+    UARTDataSourceFraming framing;
+
+    /**
+     * The SyncWord.
+     */
+    uint8 syncWord[UART_DATA_SOURCE_MAX_SYNC_WORD_SIZE];
+
+    /**
+     * Number of bytes of the SyncWord.
+     */
+    uint32 syncWordSize;
+
+    /**
+     * Number of bytes of the Length (Framing == LengthPrefixed).
+     */
+    uint32 lengthSize;
+
+    /**
+     * The byte ring where the UART is drained.
+     */
+    uint8 *byteRing;
+
+    /**
+     * Size of the byteRing (a power of 2).
+     */
+    uint32 byteRingSize;
+
+    /**
+     * Number of bytes written in the byteRing since the beginning.
+     */
+    uint32 byteRingHead;
+
+    /**
+     * Number of bytes removed from the byteRing since the beginning.
+     */
+    uint32 byteRingTail;
+
+    /**
+     * HighResolutionTimer counter when the last byte was received (to detect the silence periods).
+     */
+    uint64 lastByteTicks;
+
+    /**
+     * Timestamp of the last frame (the interpolated timestamps never go back in time).
+     */
+    uint64 lastFrameTimestamp;
+
+    /**
+     * Number of frames extracted from the UART.
+     */
+    volatile uint32 nOfFrames;
+
+    /**
+     * Number of bytes discarded while searching for a frame.
+     */
+    volatile uint32 nOfDiscardedBytes;
+
+    /**
+     * Number of frames with a wrong CRC.
+     */
+    volatile uint32 nOfCRCErrors;
+
+    /**
+     * Number of frames lost because all the buffers were full.
+     */
+    volatile uint32 nOfOverruns;
+
+    /**
+     * Number of reads from the UART which returned data.
+     */
+    volatile uint32 nOfReads;
+
+    /**
+     * True if the last overrun was already reported.
+     */
+    bool overrunReported;
 };
 
 }
@@ -229,6 +435,14 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+uint8 UARTDataSource::PeekByte(const uint32 offset) const {
+    /*lint -e{613} byteRing cannot be NULL after SetConfiguredDatabase*/
+    return byteRing[(byteRingTail + offset) & (byteRingSize - 1u)];
+}
+
+}
 
 #endif /* UARTDATASOURCE_H_ */
 
@@ -23,17 +23,28 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "MemoryMapInputBroker.h"
 #include "UDPReceiver.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+static const uint32 UDP_RECEIVER_DEFAULT_BATCH_SIZE = 32u;
+static const uint32 UDP_RECEIVER_HANDOFF_FRESH = 0x4u;
+static const uint32 UDP_RECEIVER_HANDOFF_INDEX_MASK = 0x3u;
+static const uint32 UDP_RECEIVER_AGE_UNKNOWN = 0xFFFFFFFFu;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -53,9 +64,42 @@ UDPReceiver::UDPReceiver() :
     stackSize = THREADS_DEFAULT_STACKSIZE;
     executionMode = UDPReceiverExecutionModeRealTime;
     socket = NULL_PTR(UDPSocket*);
-    muxIThread.Create();
-    copyInProgress = false;
-    memoryIndependentThread = NULL_PTR(void *);
+    receiveMode = UDPReceiverReceiveModeSingle;
+    batchSize = UDP_RECEIVER_DEFAULT_BATCH_SIZE;
+    numberOfPackets = 1u;
+    packetSize = 0u;
+    signalByteSizes = NULL_PTR(uint32 *);
+    packetOffsets = NULL_PTR(uint32 *);
+    batchOffsets = NULL_PTR(uint32 *);
+    handoffMemory = NULL_PTR(char8 *);
+    handoffBufferSize = 0u;
+    numberOfHandoffBuffers = 1u;
+    //Buffer 0 is read by the real-time thread, buffer 1 is the middle buffer and buffer 2 is written by the independent thread
+    readBuffer = 0u;
+    middleBuffer = 1;
+    writeBuffer = 2u;
+    uint32 b;
+    for (b = 0u; b < NUMBER_OF_HANDOFF_BUFFERS; b++) {
+        receiveTimestamps[b] = 0u;
+        publishedPackets[b] = 0u;
+        publishedDropped[b] = 0u;
+    }
+    lastReceiveTimestamp = 0u;
+    datagramSize = 0u;
+    ageSignalIdx = 0u;
+    hasAgeSignal = false;
+    receiveBuffer = NULL_PTR(char8 *);
+    messageHeaders = NULL_PTR(struct mmsghdr *);
+    messageIOVectors = NULL_PTR(struct iovec *);
+    messageControl = NULL_PTR(char8 *);
+    messageControlSize = 0u;
+    ring = NULL_PTR(char8 *);
+    ringNext = 0u;
+    storedPackets = 0u;
+    consumedPackets = 0u;
+    kernelDroppedPackets = 0u;
+    wrongSizePackets = 0u;
+    overrunPackets = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the thread and servers are closed.*/
@@ -73,15 +117,50 @@ UDPReceiver::~UDPReceiver() {
             delete socket;
         }
     }
-    if (memoryIndependentThread != NULL_PTR(void *)) {
-        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(memoryIndependentThread);
+    if (signalByteSizes != NULL_PTR(uint32 *)) {
+        delete[] signalByteSizes;
+    }
+    if (packetOffsets != NULL_PTR(uint32 *)) {
+        delete[] packetOffsets;
+    }
+    if (batchOffsets != NULL_PTR(uint32 *)) {
+        delete[] batchOffsets;
+    }
+    if (handoffMemory != NULL_PTR(char8 *)) {
+        delete[] handoffMemory;
+    }
+    if (receiveBuffer != NULL_PTR(char8 *)) {
+        delete[] receiveBuffer;
+    }
+    if (messageHeaders != NULL_PTR(struct mmsghdr *)) {
+        delete[] messageHeaders;
+    }
+    if (messageIOVectors != NULL_PTR(struct iovec *)) {
+        delete[] messageIOVectors;
+    }
+    if (messageControl != NULL_PTR(char8 *)) {
+        delete[] messageControl;
+    }
+    if (ring != NULL_PTR(char8 *)) {
+        delete[] ring;
     }
 }
 
 bool UDPReceiver::AllocateMemory() {
     bool ok = MemoryDataSourceI::AllocateMemory();
+    if ((ok) && (receiveMode == UDPReceiverReceiveModeSingle)) {
+        //The age signal is the last signal and is not part of the datagram
+        datagramSize = totalMemorySize;
+        if (hasAgeSignal) {
+            datagramSize -= static_cast<uint32>(sizeof(uint32));
+        }
+        if (executionMode == UDPReceiverExecutionModeIndependent) {
+            handoffBufferSize = totalMemorySize;
+            handoffMemory = new char8[numberOfHandoffBuffers * handoffBufferSize];
+            ok = MemoryOperationsHelper::Set(handoffMemory, '\0', numberOfHandoffBuffers * handoffBufferSize);
+        }
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
-        memoryIndependentThread = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(totalMemorySize);
         if (ok) {
             executor.SetName(GetName());
             ok = (executor.Start() == ErrorManagement::NoError);
@@ -90,12 +169,45 @@ bool UDPReceiver::AllocateMemory() {
     return ok;
 }
 
-bool UDPReceiver::BrokerCopyTerminated() {
-    if (muxIThread.FastLock() == ErrorManagement::NoError) {
-        copyInProgress = false;
+bool UDPReceiver::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                        const uint32 bufferIdx,
+                                        void *&signalAddress) {
+    bool ok;
+    if (handoffMemory != NULL_PTR(char8 *)) {
+        ok = (signalIdx < numberOfSignals);
+        if (ok) {
+            //The broker adds the offset of the buffer being read (see GetInputOffset)
+            /*lint -e{613} batchOffsets cannot be NULL in Batch mode*/
+            uint32 signalOffset = (receiveMode == UDPReceiverReceiveModeBatch) ? (batchOffsets[signalIdx]) : (signalOffsets[signalIdx]);
+            char8 *memPtr = &handoffMemory[signalOffset];
+            signalAddress = reinterpret_cast<void *&>(memPtr);
+        }
+    }
+    else {
+        ok = MemoryDataSourceI::GetSignalMemoryBuffer(signalIdx, bufferIdx, signalAddress);
     }
-    muxIThread.FastUnLock();
-    return true;
+    return ok;
+}
+
+void UDPReceiver::PrepareInputOffsets() {
+    if (executionMode == UDPReceiverExecutionModeIndependent) {
+        //Only swap if the independent thread has published a newer buffer since the last swap
+        if ((static_cast<uint32>(middleBuffer) & UDP_RECEIVER_HANDOFF_FRESH) != 0u) {
+            readBuffer = (static_cast<uint32>(Atomic::Exchange(&middleBuffer, static_cast<int32>(readBuffer))) & UDP_RECEIVER_HANDOFF_INDEX_MASK);
+            if (receiveMode == UDPReceiverReceiveModeBatch) {
+                UpdateBatchCounters();
+            }
+        }
+        PublishAge();
+    }
+}
+
+/*lint -e{715} numberOfSamples not required for this implementation.*/
+bool UDPReceiver::GetInputOffset(const uint32 signalIdx,
+                                 const uint32 numberOfSamples,
+                                 uint32 &offset) {
+    offset = (readBuffer * handoffBufferSize);
+    return (signalIdx < numberOfSignals);
 }
 
 bool UDPReceiver::Initialise(StructuredDataI &data) {
@@ -157,7 +269,45 @@ bool UDPReceiver::Initialise(StructuredDataI &data) {
             timeout.SetTimeoutSec(timeoutVal);
         }
     }
+    if (ok) {
+        StreamString receiveModeStr;
+        if (data.Read("ReceiveMode", receiveModeStr)) {
+            if (receiveModeStr == "Batch") {
+                receiveMode = UDPReceiverReceiveModeBatch;
+                REPORT_ERROR(ErrorManagement::Information, "Receiving in Batch mode");
+            }
+            else if (receiveModeStr == "Single") {
+                receiveMode = UDPReceiverReceiveModeSingle;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Allowed ReceiveMode [Single, Batch], Specified %s", receiveModeStr.Buffer());
+                ok = false;
+            }
+        }
+    }
+    if ((ok) && (receiveMode == UDPReceiverReceiveModeBatch)) {
+        if (!data.Read("BatchSize", batchSize)) {
+            batchSize = UDP_RECEIVER_DEFAULT_BATCH_SIZE;
+        }
+        ok = (batchSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize shall be > 0");
+        }
+        if (ok) {
+            if (!data.Read("NumberOfPackets", numberOfPackets)) {
+                numberOfPackets = 1u;
+            }
+            ok = (numberOfPackets > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPackets shall be > 0");
+            }
+        }
+    }
+    if (ok) {
+        hasAgeSignal = data.Read("AgeSignal", ageSignalName);
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
+        numberOfHandoffBuffers = NUMBER_OF_HANDOFF_BUFFERS;
         if (ok) {
             ok = data.Read("CPUMask", cpuMask);
             if (!ok) {
@@ -212,6 +362,135 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
             ok = socket->Listen(port);
         }
     }
+    //Index of the first signal which is not part of the packet
+    uint32 packetSignalsEnd = numberOfSignals;
+    if ((ok) && (hasAgeSignal)) {
+        ok = GetSignalIndex(ageSignalIdx, ageSignalName.Buffer());
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "AgeSignal %s is not defined", ageSignalName.Buffer());
+        }
+        if (ok) {
+            uint32 ageByteSize = 0u;
+            ok = GetSignalByteSize(ageSignalIdx, ageByteSize);
+            if (ok) {
+                //At least one signal shall be part of the packet
+                ok = ((ageSignalIdx > 0u) && (ageSignalIdx == (numberOfSignals - 1u)));
+                if (ok) {
+                    ok = (GetSignalType(ageSignalIdx) == UnsignedInteger32Bit);
+                }
+                if (ok) {
+                    ok = (ageByteSize == static_cast<uint32>(sizeof(uint32)));
+                }
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "AgeSignal %s shall be the last signal and shall be a uint32 scalar", ageSignalName.Buffer());
+            }
+        }
+        if (ok) {
+            packetSignalsEnd--;
+        }
+    }
+    if ((ok) && (receiveMode == UDPReceiverReceiveModeBatch)) {
+        ok = (packetSignalsEnd > NUMBER_OF_BATCH_COUNTERS);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ReceiveMode = Batch requires the two counter signals followed by at least one packet signal");
+        }
+        uint32 batchMemorySize = 0u;
+        uint32 n;
+        if (ok) {
+            signalByteSizes = new uint32[numberOfSignals];
+            packetOffsets = new uint32[numberOfSignals];
+            batchOffsets = new uint32[numberOfSignals];
+            packetSize = 0u;
+        }
+        /*lint -e{613} signalByteSizes, packetOffsets and batchOffsets cannot be NULL as otherwise ok would be false*/
+        for (n = 0u; (n < numberOfSignals) && (ok); n++) {
+            ok = GetSignalByteSize(n, signalByteSizes[n]);
+            batchOffsets[n] = batchMemorySize;
+            if (ok) {
+                if (n >= packetSignalsEnd) {
+                    packetOffsets[n] = 0u;
+                    batchMemorySize += signalByteSizes[n];
+                }
+                else if (n < NUMBER_OF_BATCH_COUNTERS) {
+                    ok = ((GetSignalType(n) == UnsignedInteger32Bit) && (signalByteSizes[n] == static_cast<uint32>(sizeof(uint32))));
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The first two signals shall be uint32 counters when ReceiveMode = Batch");
+                    }
+                    packetOffsets[n] = 0u;
+                    batchMemorySize += signalByteSizes[n];
+                }
+                else {
+                    packetOffsets[n] = packetSize;
+                    packetSize += signalByteSizes[n];
+                    batchMemorySize += (signalByteSizes[n] * numberOfPackets);
+                }
+            }
+        }
+        //The counters (and the age) are read once and the packet signals are read as numberOfPackets samples
+        uint32 f;
+        uint32 nOfFunctions = GetNumberOfFunctions();
+        for (f = 0u; (f < nOfFunctions) && (ok); f++) {
+            uint32 nOfFunctionSignals = 0u;
+            ok = GetFunctionNumberOfSignals(InputSignals, f, nOfFunctionSignals);
+            uint32 i;
+            for (i = 0u; (i < nOfFunctionSignals) && (ok); i++) {
+                StreamString signalName;
+                uint32 signalIdx = 0u;
+                uint32 nSamples = 0u;
+                ok = GetFunctionSignalAlias(InputSignals, f, i, signalName);
+                if (ok) {
+                    ok = GetSignalIndex(signalIdx, signalName.Buffer());
+                }
+                if (ok) {
+                    ok = GetFunctionSignalSamples(InputSignals, f, i, nSamples);
+                }
+                if (ok) {
+                    bool isPacketSignal = ((signalIdx >= NUMBER_OF_BATCH_COUNTERS) && (signalIdx < packetSignalsEnd));
+                    uint32 expectedSamples = (isPacketSignal) ? (numberOfPackets) : (1u);
+                    ok = (nSamples == expectedSamples);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Signal %s shall be read with %u samples", signalName.Buffer(), expectedSamples);
+                    }
+                }
+            }
+        }
+        if (ok) {
+            handoffBufferSize = batchMemorySize;
+            handoffMemory = new char8[numberOfHandoffBuffers * handoffBufferSize];
+            ring = new char8[numberOfPackets * packetSize];
+            receiveBuffer = new char8[batchSize * packetSize];
+            ok = MemoryOperationsHelper::Set(handoffMemory, '\0', numberOfHandoffBuffers * handoffBufferSize);
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(ring, '\0', numberOfPackets * packetSize);
+            }
+        }
+        if (ok) {
+            messageHeaders = new struct mmsghdr[batchSize];
+            messageIOVectors = new struct iovec[batchSize];
+            messageControlSize = static_cast<uint32>(CMSG_SPACE(sizeof(uint32)));
+            messageControl = new char8[batchSize * messageControlSize];
+            ok = MemoryOperationsHelper::Set(messageHeaders, '\0', static_cast<uint32>(sizeof(struct mmsghdr)) * batchSize);
+            uint32 i;
+            for (i = 0u; (i < batchSize) && (ok); i++) {
+                messageIOVectors[i].iov_base = &receiveBuffer[i * packetSize];
+                messageIOVectors[i].iov_len = packetSize;
+                messageHeaders[i].msg_hdr.msg_iov = &messageIOVectors[i];
+                messageHeaders[i].msg_hdr.msg_iovlen = 1u;
+            }
+        }
+#ifdef SO_RXQ_OVFL
+        if (ok) {
+            //Ask the kernel to report, with each datagram, the number of datagrams dropped by the socket
+            int32 enable = 1;
+            /*lint -e{613} socket cannot be NULL as otherwise ok would be false*/
+            int32 fd = static_cast<int32>(socket->GetReadHandle());
+            if (setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &enable, static_cast<socklen_t>(sizeof(enable))) != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not enable SO_RXQ_OVFL. Datagrams dropped by the kernel will not be counted.");
+            }
+        }
+#endif
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
         executor.SetPriorityClass(Threads::RealTimePriorityClass);
         executor.SetCPUMask(cpuMask);
@@ -223,25 +502,173 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
 
 bool UDPReceiver::Synchronise() {
     bool ok = true;
-    if (executionMode == UDPReceiverExecutionModeIndependent) {
-        if (muxIThread.FastLock() == ErrorManagement::NoError) {
-            copyInProgress = true;
+    //In IndependentThread mode the buffers are exchanged in PrepareInputOffsets
+    if (executionMode == UDPReceiverExecutionModeRealTime) {
+        if (receiveMode == UDPReceiverReceiveModeBatch) {
+            ok = ReceiveBatch();
+            PublishBatch(readBuffer);
+            UpdateBatchCounters();
         }
-        muxIThread.FastUnLock();
+        else {
+            char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
+            if (socket != NULL_PTR(UDPSocket*)) {
+                uint32 readSize = datagramSize;
+                ok = socket->Read(dataBuffer, readSize, timeout);
+            }
+            if (ok) {
+                receiveTimestamps[readBuffer] = HighResolutionTimer::Counter();
+            }
+        }
+        PublishAge();
     }
-    else {
-        char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
-        if (socket != NULL_PTR(UDPSocket*)) {
-            ok = socket->Read(dataBuffer, totalMemorySize, timeout);
+    return ok;
+}
+
+bool UDPReceiver::ReceiveBatch() {
+    bool ok = (socket != NULL_PTR(UDPSocket*));
+    int32 fd = -1;
+    if (ok) {
+        /*lint -e{613} socket cannot be NULL as otherwise ok would be false*/
+        fd = static_cast<int32>(socket->GetReadHandle());
+        struct pollfd pollDescriptor;
+        pollDescriptor.fd = fd;
+        pollDescriptor.events = POLLIN;
+        pollDescriptor.revents = 0;
+        int32 pollTimeout = -1;
+        if (timeout.IsFinite()) {
+            pollTimeout = static_cast<int32>(timeout.GetTimeoutMSec());
+        }
+        ok = (poll(&pollDescriptor, 1u, pollTimeout) > 0);
+    }
+    //Drain everything which is pending, batchSize datagrams per system call
+    bool drained = !ok;
+    while (!drained) {
+        uint32 i;
+        /*lint -e{613} messageHeaders cannot be NULL in Batch mode*/
+        for (i = 0u; i < batchSize; i++) {
+            //The kernel updates these fields on each call
+            messageHeaders[i].msg_hdr.msg_control = &messageControl[i * messageControlSize];
+            messageHeaders[i].msg_hdr.msg_controllen = messageControlSize;
+            messageHeaders[i].msg_hdr.msg_flags = 0;
+            messageHeaders[i].msg_len = 0u;
+        }
+        int32 nOfMessages = recvmmsg(fd, messageHeaders, batchSize, MSG_DONTWAIT, NULL_PTR(struct timespec *));
+        if (nOfMessages > 0) {
+            StoreBatch(static_cast<uint32>(nOfMessages));
+            drained = (static_cast<uint32>(nOfMessages) < batchSize);
+        }
+        else {
+            //EAGAIN: nothing else pending
+            drained = true;
         }
     }
     return ok;
 }
 
+void UDPReceiver::StoreBatch(const uint32 nOfMessages) {
+    uint32 i;
+    /*lint -e{613} messageHeaders, ring and receiveBuffer cannot be NULL in Batch mode*/
+    for (i = 0u; i < nOfMessages; i++) {
+        struct msghdr *header = &messageHeaders[i].msg_hdr;
+        bool validSize = (messageHeaders[i].msg_len == packetSize);
+        if (validSize) {
+            validSize = ((static_cast<uint32>(header->msg_flags) & static_cast<uint32>(MSG_TRUNC)) == 0u);
+        }
+        if (validSize) {
+            (void) MemoryOperationsHelper::Copy(&ring[ringNext * packetSize], &receiveBuffer[i * packetSize], packetSize);
+            ringNext++;
+            if (ringNext == numberOfPackets) {
+                ringNext = 0u;
+            }
+            storedPackets++;
+            lastReceiveTimestamp = HighResolutionTimer::Counter();
+        }
+        else {
+            wrongSizePackets++;
+        }
+#ifdef SO_RXQ_OVFL
+        struct cmsghdr *controlMessage = CMSG_FIRSTHDR(header);
+        while (controlMessage != NULL_PTR(struct cmsghdr *)) {
+            if ((controlMessage->cmsg_level == SOL_SOCKET) && (controlMessage->cmsg_type == SO_RXQ_OVFL)) {
+                //Cumulative count for the socket
+                (void) MemoryOperationsHelper::Copy(&kernelDroppedPackets, CMSG_DATA(controlMessage), static_cast<uint32>(sizeof(uint32)));
+            }
+            controlMessage = CMSG_NXTHDR(header, controlMessage);
+        }
+#endif
+    }
+}
+
+void UDPReceiver::PublishBatch(const uint32 bufferIdx) {
+    char8 *const buffer = GetHandoffBuffer(bufferIdx);
+    publishedPackets[bufferIdx] = storedPackets;
+    publishedDropped[bufferIdx] = (kernelDroppedPackets + wrongSizePackets);
+    receiveTimestamps[bufferIdx] = lastReceiveTimestamp;
+    //ringNext is the oldest datagram, which becomes the first sample
+    uint32 slot = ringNext;
+    uint32 packetSignalsEnd = (hasAgeSignal) ? (ageSignalIdx) : (numberOfSignals);
+    uint32 k;
+    for (k = 0u; k < numberOfPackets; k++) {
+        const char8 *const packet = &ring[slot * packetSize];
+        uint32 n;
+        /*lint -e{613} batchOffsets, signalByteSizes, packetOffsets and ring cannot be NULL in Batch mode*/
+        for (n = NUMBER_OF_BATCH_COUNTERS; n < packetSignalsEnd; n++) {
+            uint32 sampleOffset = batchOffsets[n] + (k * signalByteSizes[n]);
+            (void) MemoryOperationsHelper::Copy(&buffer[sampleOffset], &packet[packetOffsets[n]], signalByteSizes[n]);
+        }
+        slot++;
+        if (slot == numberOfPackets) {
+            slot = 0u;
+        }
+    }
+}
+
+void UDPReceiver::UpdateBatchCounters() {
+    char8 *const buffer = GetHandoffBuffer(readBuffer);
+    //Valid datagrams published since the previously read buffer which did not fit in this one were never seen by the real-time thread
+    uint32 newPackets = (publishedPackets[readBuffer] - consumedPackets);
+    if (newPackets > numberOfPackets) {
+        overrunPackets += (newPackets - numberOfPackets);
+    }
+    consumedPackets = publishedPackets[readBuffer];
+    /*lint -e{613} batchOffsets cannot be NULL in Batch mode*/
+    (void) MemoryOperationsHelper::Copy(&buffer[batchOffsets[0u]], &publishedDropped[readBuffer], static_cast<uint32>(sizeof(uint32)));
+    (void) MemoryOperationsHelper::Copy(&buffer[batchOffsets[1u]], &overrunPackets, static_cast<uint32>(sizeof(uint32)));
+}
+
+void UDPReceiver::PublishAge() {
+    if (hasAgeSignal) {
+        uint32 age = UDP_RECEIVER_AGE_UNKNOWN;
+        uint64 receiveTimestamp = receiveTimestamps[readBuffer];
+        if (receiveTimestamp != 0u) {
+            float64 ageMicroSec = static_cast<float64>(HighResolutionTimer::Counter() - receiveTimestamp) * HighResolutionTimer::Period() * 1e6;
+            if (ageMicroSec < static_cast<float64>(UDP_RECEIVER_AGE_UNKNOWN)) {
+                age = static_cast<uint32>(ageMicroSec);
+            }
+        }
+        /*lint -e{613} batchOffsets cannot be NULL in Batch mode*/
+        uint32 ageOffset = (receiveMode == UDPReceiverReceiveModeBatch) ? (batchOffsets[ageSignalIdx]) : (signalOffsets[ageSignalIdx]);
+        char8 *const buffer = GetHandoffBuffer(readBuffer);
+        (void) MemoryOperationsHelper::Copy(&buffer[ageOffset], &age, static_cast<uint32>(sizeof(uint32)));
+    }
+}
+
+char8 *UDPReceiver::GetHandoffBuffer(const uint32 bufferIdx) {
+    char8 *buffer = reinterpret_cast<char8 *>(memory);
+    if (handoffMemory != NULL_PTR(char8 *)) {
+        buffer = &handoffMemory[bufferIdx * handoffBufferSize];
+    }
+    return buffer;
+}
+
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the data is independent of the broker name.*/
 const char8* UDPReceiver::GetBrokerName(StructuredDataI &data,
                                         const SignalDirection direction) {
     const char8 *brokerName = "MemoryMapSynchronisedInputBroker";
+    if (executionMode == UDPReceiverExecutionModeIndependent) {
+        //The real-time thread never waits for the socket and reads the newest buffer published by the independent thread
+        brokerName = "MemoryMapMultiBufferInputBroker";
+    }
     return brokerName;
 }
 
@@ -255,17 +682,27 @@ bool UDPReceiver::PrepareNextState(const char8 *const currentStateName,
 ErrorManagement::ErrorType UDPReceiver::Execute(ExecutionInfo &info) {
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
-        char8 *const dataBuffer = reinterpret_cast<char8*>(memoryIndependentThread);
-        if (socket != NULL_PTR(UDPSocket*)) {
-            err.timeout = !socket->Read(dataBuffer, totalMemorySize, timeout);
+        bool received = false;
+        if (receiveMode == UDPReceiverReceiveModeBatch) {
+            received = ReceiveBatch();
+            if (received) {
+                PublishBatch(writeBuffer);
+            }
         }
-        bool canCopyMemory = false;
-        if (muxIThread.FastLock() == ErrorManagement::NoError) {
-            canCopyMemory = !copyInProgress;
+        else if (socket != NULL_PTR(UDPSocket*)) {
+            uint32 readSize = datagramSize;
+            received = socket->Read(GetHandoffBuffer(writeBuffer), readSize, timeout);
+            if (received) {
+                receiveTimestamps[writeBuffer] = HighResolutionTimer::Counter();
+            }
+        }
+        else {
+            err.fatalError = true;
         }
-        muxIThread.FastUnLock();
-        if (canCopyMemory) {
-            err.fatalError = !MemoryOperationsHelper::Copy(memory, dataBuffer, totalMemorySize);
+        err.timeout = !received;
+        if (received) {
+            //Publish the buffer just written and take over the previous middle buffer, which is never being read
+            writeBuffer = (static_cast<uint32>(Atomic::Exchange(&middleBuffer, static_cast<int32>(writeBuffer | UDP_RECEIVER_HANDOFF_FRESH))) & UDP_RECEIVER_HANDOFF_INDEX_MASK);
         }
     }
     return err;
@@ -291,6 +728,18 @@ const UDPReceiverExecutionMode UDPReceiver::GetExecutionMode() const {
     return executionMode;
 }
 
+UDPReceiverReceiveMode UDPReceiver::GetReceiveMode() const {
+    return receiveMode;
+}
+
+uint32 UDPReceiver::GetBatchSize() const {
+    return batchSize;
+}
+
+uint32 UDPReceiver::GetNumberOfPackets() const {
+    return numberOfPackets;
+}
+
 CLASS_REGISTER(UDPReceiver, "1.0")
 
 }
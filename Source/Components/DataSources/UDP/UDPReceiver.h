@@ -27,6 +27,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <sys/socket.h>
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
@@ -49,6 +50,11 @@ typedef enum {
     UDPReceiverExecutionModeRealTime
 } UDPReceiverExecutionMode;
 
+typedef enum {
+    UDPReceiverReceiveModeSingle,
+    UDPReceiverReceiveModeBatch
+} UDPReceiverReceiveMode;
+
 
 /**
  * @brief A DataSource which receives given signals via UDP with Multicast support.
@@ -61,9 +67,17 @@ typedef enum {
  *     Timeout = "5.0" //Optional (seconds) The time the receiver will wait while listening before timing out. Default: Infinite
  *     ExecutionMode = RealTimeThread//Optional (default RealTimeThread)
  *       If ExecutionMode == IndependentThread a thread is spawned to read from the socket and the memory copy is immediate (i.e. it will not block).
+ *         The thread and the real-time thread exchange the data through a lock-free triple buffer, so that the real-time thread always reads the newest
+ *         complete packet and the thread never has to skip a packet because the real-time thread is copying.
  *       If ExecutionMode == RealTimeThread the DataSource socket read is blocking and handled in the context of the real-time thread.
  *     CPUMask = 0x1
  *     StackSize = 10000000
+ *     ReceiveMode = Single //Optional (default Single)
+ *       If ReceiveMode == Single one datagram is read per cycle.
+ *       If ReceiveMode == Batch all the pending datagrams are drained with recvmmsg and the last NumberOfPackets are kept (see below).
+ *     BatchSize = 32 //Optional (default 32). Only for ReceiveMode == Batch. Maximum number of datagrams received by each recvmmsg call.
+ *     NumberOfPackets = 1 //Optional (default 1, i.e. the latest datagram). Only for ReceiveMode == Batch. Number of datagrams kept in the ring.
+ *     AgeSignal = PacketAge //Optional. Name of a uint32 signal, which shall be the last signal, where the age (in microseconds) of the data is written.
  *     Signals = {
  *          Signal2 = {
  *             Type = uint32 //Any MARTe2 type
@@ -73,6 +87,29 @@ typedef enum {
  * }
  *
  * The Signals section is in practice a description of the structure of the UDP Packet read.
+ *
+ * If ReceiveMode == Batch the first two signals are not part of the packet and shall be uint32 counters:
+ * the first counts the datagrams that were lost before being received (socket buffer overflows reported by the kernel
+ * and datagrams whose size does not match the packet size) and the second counts the valid datagrams that were overwritten
+ * in the ring before being copied into the DataSource memory (overruns).
+ * The remaining signals describe the packet and shall be read with Samples = NumberOfPackets, the oldest datagram being the first sample.
+ *
+ * If AgeSignal is set, the last signal is not part of the packet and holds the time elapsed between the reception of the (newest) datagram
+ * and the copy into the real-time thread. It is set to 0xFFFFFFFF until the first datagram is received.
+ * <pre>
+ *     Signals = {
+ *          DroppedPackets = {
+ *             Type = uint32
+ *          }
+ *          OverrunPackets = {
+ *             Type = uint32
+ *          }
+ *          Signal2 = {
+ *             Type = uint32
+ *          }
+ *          ...
+ *     }
+ * </pre>
  */
 class UDPReceiver : public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
 public:
@@ -99,7 +136,7 @@ public:
     /**
      * @brief See DataSourceI::GetBrokerName.
      * @details Only Input signals are supported.
-     * @return MemoryMapSynchronisedInputBroker
+     * @return MemoryMapMultiBufferInputBroker if ExecutionMode == IndependentThread, MemoryMapSynchronisedInputBroker otherwise.
      */
     virtual const char8* GetBrokerName(StructuredDataI& data,
                                             const SignalDirection direction);
@@ -135,10 +172,29 @@ public:
     virtual bool AllocateMemory();
 
     /**
-     * @brief Indicates that the broker has finished to copy the data from the data source memory.
-     * @return true
+     * @brief See DataSourceI::GetSignalMemoryBuffer.
+     * @details If ReceiveMode == Batch the signals memory holds NumberOfPackets samples of each packet signal.
+     * If ExecutionMode == IndependentThread the address is in the first of the triple buffers (see GetInputOffset).
+     * Otherwise see MemoryDataSourceI::GetSignalMemoryBuffer.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+                                       const uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief See DataSourceI::PrepareInputOffsets.
+     * @details If ExecutionMode == IndependentThread and a newer buffer was published by the thread, exchanges it
+     * with the buffer being read (one atomic exchange, no copy). Updates the age signal.
      */
-    virtual bool BrokerCopyTerminated();
+    virtual void PrepareInputOffsets();
+
+    /**
+     * @brief See DataSourceI::GetInputOffset.
+     * @return the offset of the triple buffer currently owned by the real-time thread (0 if ExecutionMode == RealTimeThread).
+     */
+    virtual bool GetInputOffset(const uint32 signalIdx,
+                                const uint32 numberOfSamples,
+                                uint32 &offset);
 
     /**
      * @brief Recieve signals when UDP data is recieved.
@@ -176,8 +232,71 @@ public:
      */
     const UDPReceiverExecutionMode GetExecutionMode() const;
 
+    /**
+     * @brief Gets the receive mode.
+     * @return the receive mode.
+     */
+    UDPReceiverReceiveMode GetReceiveMode() const;
+
+    /**
+     * @brief Gets the maximum number of datagrams received by each recvmmsg call.
+     * @return the maximum number of datagrams received by each recvmmsg call.
+     */
+    uint32 GetBatchSize() const;
+
+    /**
+     * @brief Gets the number of datagrams kept in the ring.
+     * @return the number of datagrams kept in the ring.
+     */
+    uint32 GetNumberOfPackets() const;
+
 private:
 
+    /**
+     * @brief Waits (up to the timeout) for the first datagram and drains all the pending datagrams into the ring.
+     * @return true if at least one datagram was received.
+     */
+    bool ReceiveBatch();
+
+    /**
+     * @brief Stores the \a nOfMessages datagrams received by recvmmsg into the ring and updates the dropped counter.
+     * @param[in] nOfMessages number of datagrams received.
+     */
+    void StoreBatch(const uint32 nOfMessages);
+
+    /**
+     * @brief Copies the ring (oldest datagram first) into the buffer \a bufferIdx and records the counters to be published with it.
+     * @param[in] bufferIdx the index of the triple buffer (0 if ExecutionMode == RealTimeThread).
+     */
+    void PublishBatch(const uint32 bufferIdx);
+
+    /**
+     * @brief Updates the overrun counter and writes the counters into the buffer being read by the real-time thread.
+     */
+    void UpdateBatchCounters();
+
+    /**
+     * @brief Writes the age of the buffer being read by the real-time thread into the age signal (if any).
+     */
+    void PublishAge();
+
+    /**
+     * @brief Gets the memory of the buffer \a bufferIdx.
+     * @param[in] bufferIdx the index of the triple buffer.
+     * @return the memory of the buffer \a bufferIdx or the MemoryDataSourceI memory if the data is not exchanged through buffers.
+     */
+    char8 *GetHandoffBuffer(const uint32 bufferIdx);
+
+    /**
+     * The number of signals which are not part of the packet when ReceiveMode == Batch.
+     */
+    static const uint32 NUMBER_OF_BATCH_COUNTERS = 2u;
+
+    /**
+     * The number of buffers exchanged between the independent thread and the real-time thread.
+     */
+    static const uint32 NUMBER_OF_HANDOFF_BUFFERS = 3u;
+
     /**
      * The EmbeddedThread where the Execute method waits for the period to elapse.
      */
@@ -219,19 +338,171 @@ private:
     UDPReceiverExecutionMode executionMode;
 
     /**
-     * Mux for the IndependentThread implementation.
+     * Memory of the buffers exchanged with the real-time thread (numberOfHandoffBuffers buffers of handoffBufferSize bytes).
+     * NULL if ExecutionMode == RealTimeThread and ReceiveMode == Single, in which case the MemoryDataSourceI memory is used.
+     */
+    char8 *handoffMemory;
+
+    /**
+     * Size of each buffer in the handoffMemory.
+     */
+    uint32 handoffBufferSize;
+
+    /**
+     * NUMBER_OF_HANDOFF_BUFFERS if ExecutionMode == IndependentThread, 1 otherwise.
+     */
+    uint32 numberOfHandoffBuffers;
+
+    /**
+     * Index of the buffer owned by the real-time thread.
+     */
+    uint32 readBuffer;
+
+    /**
+     * Index of the buffer which is not owned by any thread, or'ed with the fresh flag when it was published and not yet read.
+     */
+    volatile int32 middleBuffer;
+
+    /**
+     * Index of the buffer owned by the independent thread.
+     */
+    uint32 writeBuffer;
+
+    /**
+     * HighResolutionTimer counter when the data in each buffer was received (0 if never).
+     */
+    uint64 receiveTimestamps[NUMBER_OF_HANDOFF_BUFFERS];
+
+    /**
+     * Value of storedPackets when each buffer was published.
+     */
+    uint32 publishedPackets[NUMBER_OF_HANDOFF_BUFFERS];
+
+    /**
+     * Value of the dropped counter when each buffer was published.
+     */
+    uint32 publishedDropped[NUMBER_OF_HANDOFF_BUFFERS];
+
+    /**
+     * HighResolutionTimer counter when the last valid datagram was stored in the ring.
+     */
+    uint64 lastReceiveTimestamp;
+
+    /**
+     * Size of the datagram when ReceiveMode == Single.
+     */
+    uint32 datagramSize;
+
+    /**
+     * Name of the age signal.
+     */
+    StreamString ageSignalName;
+
+    /**
+     * Index of the age signal.
+     */
+    uint32 ageSignalIdx;
+
+    /**
+     * True if the AgeSignal was set.
+     */
+    bool hasAgeSignal;
+
+    /**
+     * The receive mode.
+     */
+    UDPReceiverReceiveMode receiveMode;
+
+    /**
+     * Maximum number of datagrams received by each recvmmsg call.
+     */
+    uint32 batchSize;
+
+    /**
+     * Number of datagrams kept in the ring.
+     */
+    uint32 numberOfPackets;
+
+    /**
+     * Size of each datagram (i.e. of all the packet signals).
+     */
+    uint32 packetSize;
+
+    /**
+     * Byte size of each signal.
+     */
+    uint32 *signalByteSizes;
+
+    /**
+     * Offset of each packet signal in the datagram.
+     */
+    uint32 *packetOffsets;
+
+    /**
+     * Offset of each signal in each buffer of the handoffMemory when ReceiveMode == Batch: the counters followed by numberOfPackets samples of each packet signal.
+     */
+    uint32 *batchOffsets;
+
+
+    /**
+     * Memory where recvmmsg writes the datagrams (batchSize datagrams).
+     */
+    char8 *receiveBuffer;
+
+    /**
+     * The recvmmsg message headers (batchSize headers).
+     */
+    struct mmsghdr *messageHeaders;
+
+    /**
+     * The recvmmsg scatter/gather descriptors (batchSize descriptors).
+     */
+    struct iovec *messageIOVectors;
+
+    /**
+     * The recvmmsg ancillary data, used to receive the socket drop counter (batchSize buffers).
+     */
+    char8 *messageControl;
+
+    /**
+     * Size of the ancillary data of each message.
+     */
+    uint32 messageControlSize;
+
+    /**
+     * The last numberOfPackets datagrams received.
+     */
+    char8 *ring;
+
+    /**
+     * Index of the ring slot where the next datagram will be written (i.e. of the oldest datagram).
+     */
+    uint32 ringNext;
+
+    /**
+     * Number of valid datagrams stored in the ring (wraps around).
+     */
+    uint32 storedPackets;
+
+    /**
+     * Value of publishedPackets for the buffer last read by the real-time thread.
+     */
+    uint32 consumedPackets;
+
+    /**
+     * Number of datagrams dropped by the kernel, as reported by the socket.
      */
-    FastPollingMutexSem muxIThread;
+    uint32 kernelDroppedPackets;
 
     /**
-     * Copy in progres flag for the IndependentThread implementation.
+     * Number of datagrams discarded because their size does not match the packet size.
      */
-    bool copyInProgress;
+    uint32 wrongSizePackets;
 
     /**
-     * Memory for the independent thread reading.
+     * Number of valid datagrams overwritten in the ring before being published.
      */
-    void *memoryIndependentThread;
+    uint32 overrunPackets;
 };
 }
 #endif
@@ -46,6 +46,8 @@ ConversionGAM::ConversionGAM() :
         GAM() {
     numberOfSignals = 0u;
     conversionHelpers = NULL_PTR(ConversionHelper **);
+    fusedHelpers = NULL_PTR(ConversionHelper **);
+    numberOfFusedHelpers = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the conversionHelpers memory is freed.*/
@@ -59,6 +61,9 @@ ConversionGAM::~ConversionGAM() {
         }
         delete[] conversionHelpers;
     }
+    if (fusedHelpers != NULL_PTR(ConversionHelper **)) {
+        delete[] fusedHelpers;
+    }
 }
 
 bool ConversionGAM::Initialise(StructuredDataI & data) {
@@ -500,6 +505,28 @@ bool ConversionGAM::Setup() {
                         if (conversionHelpers[idx]->LoadGain(cdb)) {
                             REPORT_ERROR(ErrorManagement::ParametersError, "Gain set for conversion %d", idx);
                         }
+                        if (conversionHelpers[idx]->LoadOffset(cdb)) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "Offset set for conversion %d", idx);
+                        }
+                        uint32 saturateOutput = 0u;
+                        if (!cdb.Read("Saturate", saturateOutput)) {
+                            saturateOutput = 0u;
+                        }
+                        uint32 roundOutput = 0u;
+                        if (!cdb.Read("Round", roundOutput)) {
+                            roundOutput = 0u;
+                        }
+                        if ((saturateOutput != 0u) || (roundOutput != 0u)) {
+                            ret = ((outputSignalType.type == SignedInteger) || (outputSignalType.type == UnsignedInteger));
+                            if (ret) {
+                                conversionHelpers[idx]->SetIntegerMode(saturateOutput != 0u, roundOutput != 0u);
+                            }
+                            else {
+                                REPORT_ERROR(ErrorManagement::InitialisationError, "Saturate and Round are only supported for integer OutputSignals (%d)", idx);
+                            }
+                        }
+                    }
+                    if (ret) {
                         ret = cdb.MoveToAncestor(1u);
                     }
                 }
@@ -507,14 +534,42 @@ bool ConversionGAM::Setup() {
         }
     }
 
+    //Fuse the conversions with the same types and parameters so that Execute only calls one helper for each of them.
+    if (ret) {
+        fusedHelpers = new ConversionHelper*[numberOfSignals];
+        uint32 *fusedSignalIdx = new uint32[numberOfSignals];
+        for (n = 0u; n < numberOfSignals; n++) {
+            TypeDescriptor inputSignalType = GetSignalType(InputSignals, n);
+            TypeDescriptor outputSignalType = GetSignalType(OutputSignals, n);
+            bool fused = false;
+            uint32 k;
+            for (k = 0u; (k < numberOfFusedHelpers) && (!fused); k++) {
+                uint32 fusedIdx = fusedSignalIdx[k];
+                if ((GetSignalType(InputSignals, fusedIdx) == inputSignalType) && (GetSignalType(OutputSignals, fusedIdx) == outputSignalType)) {
+                    fused = fusedHelpers[k]->Fuse(*conversionHelpers[n]);
+                }
+            }
+            if (!fused) {
+                fusedHelpers[numberOfFusedHelpers] = conversionHelpers[n];
+                fusedSignalIdx[numberOfFusedHelpers] = n;
+                numberOfFusedHelpers++;
+            }
+        }
+        delete[] fusedSignalIdx;
+    }
+
     return ret;
 }
 
+uint32 ConversionGAM::GetNumberOfFusedConversions() const {
+    return numberOfFusedHelpers;
+}
+
 bool ConversionGAM::Execute() {
     uint32 i;
-    if (conversionHelpers != NULL_PTR(ConversionHelper **)) {
-        for (i = 0u; i < numberOfSignals; i++) {
-            conversionHelpers[i]->Convert();
+    if (fusedHelpers != NULL_PTR(ConversionHelper **)) {
+        for (i = 0u; i < numberOfFusedHelpers; i++) {
+            fusedHelpers[i]->Convert();
         }
     }
 
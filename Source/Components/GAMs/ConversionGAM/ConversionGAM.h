@@ -41,10 +41,20 @@ namespace MARTe {
 /**
  * @brief GAM which allows to convert between different signal types.
  *
- * @details This GAM converts and copies the input signals to the output signals. A gain can
- * also be specified so that outputSignal[i] = gain[i] * inputSignal[i], where i is the input signal index (see GetNumberOfInputSignals()).
+ * @details This GAM converts and copies the input signals to the output signals. A gain and an offset can
+ * also be specified so that outputSignal[i] = gain[i] * inputSignal[i] + offset[i], where i is the input signal index (see GetNumberOfInputSignals()).
  * If the signal is an array (or has more than one sample), this operation is applied to each element/sample.
  *
+ * For integer OutputSignals, Saturate = 1 clips the result to the range of the output type and Round = 1 rounds it
+ * to the nearest integer (halfway cases away from zero), instead of casting (and truncating) it. When any of these is set
+ * the result is computed in float64. The result is also computed in float64 if the Gain or the Offset cannot be represented in the
+ * output type (e.g. a negative Gain for an unsigned output). Results computed in float64 are always clipped to the range of the output type.
+ *
+ * The conversions are performed by kernels that are selected in Setup() and that convert all the elements/samples of a signal
+ * in a single loop. Signals with the same input and output types and the same kind of conversion (i.e. Gain, Offset, Saturate and Round
+ * set or not) are fused so that they are converted by a single helper call and, if they are contiguous in memory and
+ * have the same Gain and Offset, by a single loop.
+ *
  * The number of input and output signals shall be the same, i.e. GetNumberOfInputSignals() == GetNumberOfOutputSignals().
  *
  * For each input signal, the number of elements multiplied by the number of samples shall be the
@@ -73,10 +83,13 @@ namespace MARTe {
  *             Type = float32
  *             Elements = 200
  *             Gain = 3
+ *             Offset = -1.5 //Optional. Default = 0.
  *         }
  *         Signal2 = {
  *             DataSource = "LCD"
  *             Type = int32
+ *             Saturate = 1 //Optional. Only for integer types. Default = 0.
+ *             Round = 1 //Optional. Only for integer types. Default = 0.
  *         }
  *     }
  * }
@@ -106,9 +119,16 @@ ConversionGAM    ();
      *   for each signal i: GetSignalByteSize(InputSignals, i) * GetSignalNumberOfSamples(InputSignals, i) == GetSignalByteSize(OutputSignals, i) * GetSignalNumberOfSamples(OutputSignals, i) &&
      *   for each signal i: GetSignalType(InputSignals, i) == uint8 or int8 or uint16 or int16 or uint32 or int32 or uint64 or int64 or float32 or float64
      *   for each signal i: GetSignalType(OutputSignals, i) == uint8 or int8 or uint16 or int16 or uint32 or int32 or uint64 or int64 or float32 or float64
+     *   for each signal i with Saturate or Round set: GetSignalType(OutputSignals, i) is an integer type
      */
     virtual bool Setup();
 
+    /**
+     * @brief Gets the number of helpers called by Execute(), after the conversions were fused.
+     * @return the number of helpers called by Execute().
+     */
+    uint32 GetNumberOfFusedConversions() const;
+
     /**
      * @brief see GAM::Initialise.
      * @details Stores the GAM configuration in order to read the Gain of each OutputSignal
@@ -116,7 +136,7 @@ ConversionGAM    ();
     virtual bool Initialise(StructuredDataI & data);
 
     /**
-     * @brief Convert the input signals memory to the output signal memory, eventually multiplying by a gain factor.
+     * @brief Convert the input signals memory to the output signal memory, eventually multiplying by a gain factor and adding an offset.
      * @return true if all the signals memory can be successfully copied.
      */
     virtual bool Execute();
@@ -127,6 +147,16 @@ private:
      */
     ConversionHelper **conversionHelpers;
 
+    /**
+     * The helpers called by Execute() (the others were fused into one of these).
+     */
+    ConversionHelper **fusedHelpers;
+
+    /**
+     * Number of helpers called by Execute().
+     */
+    uint32 numberOfFusedHelpers;
+
     /**
      * Number of signals to copy.
      */
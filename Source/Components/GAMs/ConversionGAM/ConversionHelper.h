@@ -69,6 +69,39 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data) = 0;
 
+    /**
+     * @brief Reads the Offset parameter which is added to the scaled input.
+     * @param data where to read the Offset parameter.
+     * @return true if the Offset was specified.
+     */
+    virtual bool LoadOffset(StructuredDataI &data) = 0;
+
+    /**
+     * @brief Sets how the (scaled) input is converted to an integer output.
+     * @details When any of the modes is set the value is computed in float64. Values computed in float64 are always clipped to the range
+     * of the output type, as casting them would be undefined.
+     * @param[in] saturateIn if true the output is computed in float64 and clipped to the range of the output type (otherwise it is cast).
+     * @param[in] roundIn if true the output is rounded to the nearest integer, halfway cases away from zero (otherwise it is truncated).
+     * @pre the output type is an integer type.
+     */
+    virtual void SetIntegerMode(const bool saturateIn, const bool roundIn) = 0;
+
+    /**
+     * @brief Appends the conversion of \a other to this helper, so that both are performed by Convert().
+     * @details The conversion is merged with the last one if both are contiguous in memory and use the same Gain and Offset.
+     * @param[in] other the helper to fuse. Its Convert() shall no longer be called.
+     * @return true if the conversions use the same kernel (i.e. same Gain/Offset/integer mode settings), the memory of
+     * \a other is defined and \a other was not itself fused with another helper.
+     * @pre other has the same input and output types of this helper and all its parameters have been set.
+     */
+    virtual bool Fuse(ConversionHelper &other) = 0;
+
+    /**
+     * @brief Gets the number of contiguous memory segments converted by Convert().
+     * @return the number of contiguous memory segments converted by Convert().
+     */
+    virtual uint32 GetNumberOfSegments() const = 0;
+
     /**
      * @brief Gets a pointer to input signal memory.
      * @return a pointer to input signal memory.
@@ -38,8 +38,83 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Contiguous block of memory converted by a ConversionHelperT kernel.
+ */
+/*lint -esym(9107, MARTe::ConversionHelperTSegment*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
+ * No code is actually being generated and the header files can be included in multiple unit files.*/
+template<typename inputType, typename outputType>
+struct ConversionHelperTSegment {
+    /**
+     * The first input value.
+     */
+    const inputType *input;
+
+    /**
+     * The first output value.
+     */
+    outputType *output;
+
+    /**
+     * The number of values to convert.
+     */
+    uint32 numberOfValues;
+
+    /**
+     * The gain in the output type (kernels without integer mode).
+     */
+    outputType gain;
+
+    /**
+     * The offset in the output type (kernels without integer mode).
+     */
+    outputType offset;
+
+    /**
+     * The gain used by the integer mode kernels.
+     */
+    float64 gain64;
+
+    /**
+     * The offset used by the integer mode kernels.
+     */
+    float64 offset64;
+};
+
+/**
+ * @brief Range of the values that can be represented by an integer output type.
+ */
+/*lint -esym(9107, MARTe::ConversionHelperTLimits*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
+ * No code is actually being generated and the header files can be included in multiple unit files.*/
+template<typename outputType>
+class ConversionHelperTLimits {
+public:
+    /**
+     * @brief Gets the largest value of the type.
+     * @return the largest value of the type.
+     */
+    static inline outputType MaxValue();
+
+    /**
+     * @brief Gets the smallest value of the type.
+     * @return the smallest value of the type.
+     */
+    static inline outputType MinValue();
+};
+
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
+ * @details The conversion is performed by a kernel, selected when the parameters are loaded, which converts a
+ * contiguous block of memory in a single loop without any per-element test, so that it can be vectorised by the compiler:
+ *  - no Gain and no Offset: output = input;
+ *  - Gain: output = Gain * input;
+ *  - Offset: output = Gain * input + Offset;
+ *  - integer mode (see SetIntegerMode): output = Saturate(Round(Gain * input + Offset)), computed in float64.
+ *    This kernel (without rounding) is also used if the Gain or the Offset cannot be represented in the outputType.
+ *    It always saturates, as casting a float64 which is out of the range of the outputType is undefined.
+ *
+ * Helpers with the same input and output types and the same kernel can be fused (see Fuse), so that the conversions
+ * of many signals are performed by a single Convert() call.
  */
 /*lint -esym(9107, MARTe::ConversionHelperT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
  * No code is actually being generated and the header files can be included in multiple unit files.*/
@@ -52,13 +127,14 @@ public:
     ConversionHelperT(const void * inputMemoryIn, void * outputMemoryIn);
 
     /**
-     * @brief Default destructor. NOOP.
+     * @brief Destructor. Frees the fused segments.
      */
     virtual ~ConversionHelperT();
 
     /**
      * @see ConversionHelper::Convert.
      * @details Converts for the declared type names. A cast to the declared inputType and outputType is performed and the signals are copied.
+     * If the helper was fused with other helpers, all the fused segments are converted.
      */
     virtual void Convert();
 
@@ -67,16 +143,138 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data);
 
+    /**
+     * @see ConversionHelper::LoadOffset.
+     */
+    virtual bool LoadOffset(StructuredDataI &data);
+
+    /**
+     * @see ConversionHelper::SetIntegerMode.
+     */
+    virtual void SetIntegerMode(const bool saturateIn, const bool roundIn);
+
+    /**
+     * @see ConversionHelper::Fuse.
+     */
+    virtual bool Fuse(ConversionHelper &other);
+
+    /**
+     * @see ConversionHelper::GetNumberOfSegments.
+     */
+    virtual uint32 GetNumberOfSegments() const;
+
 private:
+    /**
+     * The kernel type.
+     */
+    typedef void (*ConversionKernel)(const ConversionHelperTSegment<inputType, outputType> &segment);
+
+    /**
+     * @brief Converts without gain nor offset.
+     */
+    static void ConvertCast(const ConversionHelperTSegment<inputType, outputType> &segment);
+
+    /**
+     * @brief Converts with a gain.
+     */
+    static void ConvertGain(const ConversionHelperTSegment<inputType, outputType> &segment);
+
+    /**
+     * @brief Converts with a gain and an offset.
+     */
+    static void ConvertGainOffset(const ConversionHelperTSegment<inputType, outputType> &segment);
+
+    /**
+     * @brief Converts in float64 with a gain and an offset and then (optionally) rounds and saturates the result.
+     * @details Values out of the range of the outputType (and NaN) are always saturated, even if the saturate mode is not set.
+     */
+    template<bool roundT>
+    static void ConvertFloat64(const ConversionHelperTSegment<inputType, outputType> &segment);
+
+    /**
+     * @brief Selects the kernel for the current parameters.
+     */
+    void UpdateKernel();
+
+    /**
+     * @brief Fills a segment with the memory and the parameters of this helper.
+     */
+    void GetSegment(ConversionHelperTSegment<inputType, outputType> &segment) const;
+
+    /**
+     * @brief Appends a segment to the segments array.
+     */
+    void AddSegment(const ConversionHelperTSegment<inputType, outputType> &segment);
+
     /**
      * True if the Gain parameter was defined.
      */
     bool gainDefined;
 
+    /**
+     * True if the Offset parameter was defined.
+     */
+    bool offsetDefined;
+
+    /**
+     * False if the Gain cannot be represented in the outputType (e.g. a negative Gain for an unsigned outputType).
+     */
+    bool gainInOutputType;
+
+    /**
+     * False if the Offset cannot be represented in the outputType (e.g. a negative Offset for an unsigned outputType).
+     */
+    bool offsetInOutputType;
+
+    /**
+     * True if the output is to be saturated.
+     */
+    bool saturate;
+
+    /**
+     * True if the output is to be rounded.
+     */
+    bool round;
+
     /**
      * The gain that is used to scale the input signal.
      */
     outputType gain;
+
+    /**
+     * The offset that is added to the scaled input signal.
+     */
+    outputType offset;
+
+    /**
+     * The gain used in integer mode.
+     */
+    float64 gain64;
+
+    /**
+     * The offset used in integer mode.
+     */
+    float64 offset64;
+
+    /**
+     * The selected kernel.
+     */
+    ConversionKernel kernel;
+
+    /**
+     * The segments converted (only if the helper was fused).
+     */
+    ConversionHelperTSegment<inputType, outputType> *segments;
+
+    /**
+     * The number of segments.
+     */
+    uint32 numberOfSegments;
+
+    /**
+     * The number of allocated segments.
+     */
+    uint32 segmentsCapacity;
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -87,51 +285,275 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/*lint -e{9117} -e{571} -e{737} -e{734} [MISRA C++ Rule 5-0-4]. Justification: the limits are computed from the size of the integer outputType.*/
+template<typename outputType>
+outputType ConversionHelperTLimits<outputType>::MaxValue() {
+    const uint32 numberOfBits = static_cast<uint32>(sizeof(outputType)) * 8u;
+    const bool isSigned = (static_cast<outputType>(-1) < static_cast<outputType>(0));
+    uint64 maxValue = (~static_cast<uint64>(0u)) >> (64u - numberOfBits);
+    if (isSigned) {
+        maxValue >>= 1u;
+    }
+    return static_cast<outputType>(maxValue);
+}
+
+/*lint -e{9117} -e{571} -e{737} -e{734} [MISRA C++ Rule 5-0-4]. Justification: the limits are computed from the size of the integer outputType.*/
+template<typename outputType>
+outputType ConversionHelperTLimits<outputType>::MinValue() {
+    const bool isSigned = (static_cast<outputType>(-1) < static_cast<outputType>(0));
+    outputType minValue = static_cast<outputType>(0);
+    if (isSigned) {
+        minValue = static_cast<outputType>(-MaxValue() - static_cast<outputType>(1));
+    }
+    return minValue;
+}
+
+template<>
+inline float32 ConversionHelperTLimits<float32>::MaxValue() {
+    return 3.402823466e+38F;
+}
+
+template<>
+inline float32 ConversionHelperTLimits<float32>::MinValue() {
+    return -3.402823466e+38F;
+}
+
+template<>
+inline float64 ConversionHelperTLimits<float64>::MaxValue() {
+    return 1.7976931348623157e+308;
+}
+
+template<>
+inline float64 ConversionHelperTLimits<float64>::MinValue() {
+    return -1.7976931348623157e+308;
+}
+
 template<typename inputType, typename outputType>
 ConversionHelperT<inputType, outputType>::ConversionHelperT(
         const void * const inputMemoryIn, void * const outputMemoryIn) :
         ConversionHelper(inputMemoryIn, outputMemoryIn) {
     gainDefined = false;
+    offsetDefined = false;
+    gainInOutputType = true;
+    offsetInOutputType = true;
+    saturate = false;
+    round = false;
     /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the gain will depend on the outputType.*/
-    gain = static_cast<outputType>(0);
+    gain = static_cast<outputType>(1);
+    /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the offset will depend on the outputType.*/
+    offset = static_cast<outputType>(0);
+    gain64 = 1.0;
+    offset64 = 0.0;
+    kernel = &ConvertCast;
+    segments = NULL;
+    numberOfSegments = 0u;
+    segmentsCapacity = 0u;
 }
 
 template<typename inputType, typename outputType>
 ConversionHelperT<inputType, outputType>::~ConversionHelperT() {
-
+    if (segments != NULL) {
+        delete[] segments;
+    }
 }
 
 template<typename inputType, typename outputType>
 bool ConversionHelperT<inputType, outputType>::LoadGain(StructuredDataI &data) {
-    gainDefined = data.Read("Gain", gain);
+    gainDefined = data.Read("Gain", gain64);
+    gainInOutputType = true;
+    if (gainDefined) {
+        gainInOutputType = data.Read("Gain", gain);
+    }
+    UpdateKernel();
     return gainDefined;
 }
 
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::LoadOffset(StructuredDataI &data) {
+    offsetDefined = data.Read("Offset", offset64);
+    offsetInOutputType = true;
+    if (offsetDefined) {
+        offsetInOutputType = data.Read("Offset", offset);
+    }
+    UpdateKernel();
+    return offsetDefined;
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::SetIntegerMode(const bool saturateIn, const bool roundIn) {
+    saturate = saturateIn;
+    round = roundIn;
+    UpdateKernel();
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::UpdateKernel() {
+    if (round) {
+        kernel = &ConvertFloat64<true>;
+    }
+    else if ((saturate) || (!gainInOutputType) || (!offsetInOutputType)) {
+        kernel = &ConvertFloat64<false>;
+    }
+    else if (offsetDefined) {
+        kernel = &ConvertGainOffset;
+    }
+    else if (gainDefined) {
+        kernel = &ConvertGain;
+    }
+    else {
+        kernel = &ConvertCast;
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::GetSegment(ConversionHelperTSegment<inputType, outputType> &segment) const {
+    segment.input = reinterpret_cast<const inputType *>(inputMemory);
+    segment.output = reinterpret_cast<outputType *>(outputMemory);
+    segment.numberOfValues = numberOfSamples * numberOfElements;
+    segment.gain = gain;
+    segment.offset = offset;
+    segment.gain64 = gain64;
+    segment.offset64 = offset64;
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::AddSegment(const ConversionHelperTSegment<inputType, outputType> &segment) {
+    if (numberOfSegments == segmentsCapacity) {
+        uint32 newCapacity = (segmentsCapacity == 0u) ? (4u) : (segmentsCapacity * 2u);
+        ConversionHelperTSegment<inputType, outputType> *newSegments = new ConversionHelperTSegment<inputType, outputType>[newCapacity];
+        uint32 i;
+        for (i = 0u; i < numberOfSegments; i++) {
+            newSegments[i] = segments[i];
+        }
+        if (segments != NULL) {
+            delete[] segments;
+        }
+        segments = newSegments;
+        segmentsCapacity = newCapacity;
+    }
+    segments[numberOfSegments] = segment;
+    numberOfSegments++;
+}
+
+/*lint -e{9176} -e{929} -e{1774} other is guaranteed (see @pre) to have the same template parameters.*/
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::Fuse(ConversionHelper &other) {
+    ConversionHelperT<inputType, outputType> &otherT = static_cast<ConversionHelperT<inputType, outputType> &>(other);
+    bool ok = (&otherT != this);
+    if (ok) {
+        ok = (otherT.kernel == kernel) && (otherT.numberOfSegments == 0u);
+    }
+    if (ok) {
+        ok = (inputMemory != NULL) && (outputMemory != NULL) && (otherT.inputMemory != NULL) && (otherT.outputMemory != NULL);
+    }
+    if (ok) {
+        ConversionHelperTSegment<inputType, outputType> segment;
+        if (numberOfSegments == 0u) {
+            GetSegment(segment);
+            AddSegment(segment);
+        }
+        otherT.GetSegment(segment);
+        ConversionHelperTSegment<inputType, outputType> &last = segments[numberOfSegments - 1u];
+        /*lint -e{777} the parameters are compared to check if they were configured with the same value.*/
+        bool merge = ((&last.input[last.numberOfValues]) == segment.input) && ((&last.output[last.numberOfValues]) == segment.output)
+                && (last.gain == segment.gain) && (last.offset == segment.offset) && (last.gain64 == segment.gain64)
+                && (last.offset64 == segment.offset64);
+        if (merge) {
+            last.numberOfValues += segment.numberOfValues;
+        }
+        else {
+            AddSegment(segment);
+        }
+    }
+    return ok;
+}
+
+template<typename inputType, typename outputType>
+uint32 ConversionHelperT<inputType, outputType>::GetNumberOfSegments() const {
+    return (numberOfSegments > 0u) ? (numberOfSegments) : (1u);
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertCast(const ConversionHelperTSegment<inputType, outputType> &segment) {
+    const inputType * const src = segment.input;
+    outputType * const dest = segment.output;
+    const uint32 numberOfValues = segment.numberOfValues;
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = static_cast<outputType>(src[i]);
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertGain(const ConversionHelperTSegment<inputType, outputType> &segment) {
+    const inputType * const src = segment.input;
+    outputType * const dest = segment.output;
+    const uint32 numberOfValues = segment.numberOfValues;
+    const outputType g = segment.gain;
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = g * static_cast<outputType>(src[i]);
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertGainOffset(const ConversionHelperTSegment<inputType, outputType> &segment) {
+    const inputType * const src = segment.input;
+    outputType * const dest = segment.output;
+    const uint32 numberOfValues = segment.numberOfValues;
+    const outputType g = segment.gain;
+    const outputType o = segment.offset;
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = (g * static_cast<outputType>(src[i])) + o;
+    }
+}
+
+/*lint -e{506} -e{774} roundT is constant so that the test is resolved at compile time.*/
+template<typename inputType, typename outputType>
+template<bool roundT>
+void ConversionHelperT<inputType, outputType>::ConvertFloat64(const ConversionHelperTSegment<inputType, outputType> &segment) {
+    const inputType * const src = segment.input;
+    outputType * const dest = segment.output;
+    const uint32 numberOfValues = segment.numberOfValues;
+    const float64 g = segment.gain64;
+    const float64 o = segment.offset64;
+    const outputType maxValue = ConversionHelperTLimits<outputType>::MaxValue();
+    const outputType minValue = ConversionHelperTLimits<outputType>::MinValue();
+    const float64 maxValue64 = static_cast<float64>(maxValue);
+    const float64 minValue64 = static_cast<float64>(minValue);
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        float64 value = (g * static_cast<float64>(src[i])) + o;
+        if (roundT) {
+            value = (value < 0.0) ? (value - 0.5) : (value + 0.5);
+        }
+        //Written so that NaN also saturates (all the comparisons are false)
+        /*lint -e{734} -e{571} -e{9117} value is within the range of the outputType.*/
+        dest[i] = (value < maxValue64) ? ((value > minValue64) ? (static_cast<outputType>(value)) : (minValue)) : (maxValue);
+    }
+}
+
 template<typename inputType, typename outputType>
 void ConversionHelperT<inputType, outputType>::Convert() {
-    uint32 s;
-    uint32 n;
-    uint32 idx;
-    outputType *dest = reinterpret_cast<outputType *>(outputMemory);
-    const inputType *src = reinterpret_cast<const inputType *>(inputMemory);
-    if ((dest != NULL) && (src != NULL)) {
-        for (s = 0u; s < numberOfSamples; s++) {
-            for (n = 0u; n < numberOfElements; n++) {
-                idx = s * numberOfElements;
-                idx += n;
-                if (gainDefined) {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = gain * static_cast<outputType>(src[idx]);
-                }
-                else {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = static_cast<outputType>(src[idx]);
-                }
-            }
+    if (numberOfSegments > 0u) {
+        uint32 i;
+        for (i = 0u; i < numberOfSegments; i++) {
+            kernel(segments[i]);
         }
     }
+    else if ((inputMemory != NULL) && (outputMemory != NULL)) {
+        ConversionHelperTSegment<inputType, outputType> segment;
+        GetSegment(segment);
+        kernel(segment);
+    }
+    else {
+        //NOOP
+    }
 }
 
 }
 #endif /* CONVERSIONHELPERT_H_ */
-
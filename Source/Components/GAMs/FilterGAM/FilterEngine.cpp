@@ -0,0 +1,78 @@
+/**
+ * @file FilterEngine.cpp
+ * @brief Source file for class FilterEngine
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FilterEngine (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FilterEngine.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+FilterEngine::FilterEngine(const uint32 numberOfChannelsIn, const uint32 numberOfSamplesIn) {
+    numberOfChannels = numberOfChannelsIn;
+    numberOfSamples = numberOfSamplesIn;
+    inputs = new void*[numberOfChannels];
+    outputs = new void*[numberOfChannels];
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        inputs[c] = NULL_PTR(void *);
+        outputs[c] = NULL_PTR(void *);
+    }
+}
+
+/*lint -e{1551} no exception thrown deleting the memory tables*/
+FilterEngine::~FilterEngine() {
+    if (inputs != NULL_PTR(void **)) {
+        delete[] inputs;
+    }
+    if (outputs != NULL_PTR(void **)) {
+        delete[] outputs;
+    }
+}
+
+bool FilterEngine::SetChannelMemory(const uint32 channel, void * const inputMemory, void * const outputMemory) {
+    bool ok = (channel < numberOfChannels);
+    if (ok) {
+        inputs[channel] = inputMemory;
+        outputs[channel] = outputMemory;
+    }
+    return ok;
+}
+
+uint32 FilterEngine::GetNumberOfChannels() const {
+    return numberOfChannels;
+}
+
+uint32 FilterEngine::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+}
@@ -0,0 +1,127 @@
+/**
+ * @file FilterEngine.h
+ * @brief Header file for class FilterEngine
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterEngine
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILTERENGINE_H_
+#define FILTERENGINE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Support class for the FilterGAM. One instance filters all the signals (channels) of the GAM.
+ * @details The channels share the same coefficients and are processed together: the state of the filter is
+ * stored channel-interleaved (i.e. the value of all the channels for a given delay are contiguous in memory), so
+ * that the inner loops of the specialised classes run over the channels with unit stride and no branches, which
+ * allows the compiler to map the channels into SIMD lanes.
+ */
+class FilterEngine {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] numberOfChannelsIn the number of signals to be filtered.
+     * @param[in] numberOfSamplesIn the number of samples of each signal (per Process()).
+     */
+    FilterEngine(const uint32 numberOfChannelsIn, const uint32 numberOfSamplesIn);
+
+    /**
+     * @brief Destructor. Frees the channel memory tables.
+     */
+    virtual ~FilterEngine();
+
+    /**
+     * @brief Sets the memory address where the channel is to be read from and written to.
+     * @param[in] channel the channel index.
+     * @param[in] inputMemory memory address where the channel is to be read from.
+     * @param[in] outputMemory memory address where the channel is to be written to.
+     * @return true if channel < GetNumberOfChannels().
+     */
+    bool SetChannelMemory(const uint32 channel, void * const inputMemory, void * const outputMemory);
+
+    /**
+     * @brief To be specialised by the templated engines.
+     * @details Filters numberOfSamples samples of all the channels.
+     * @pre
+     *   SetChannelMemory() called for all the channels.
+     */
+    virtual void Process() = 0;
+
+    /**
+     * @brief To be specialised by the templated engines.
+     * @details Clears the state (past inputs and outputs) of all the channels.
+     */
+    virtual void Reset() = 0;
+
+    /**
+     * @brief Gets the number of channels.
+     * @return the number of channels.
+     */
+    uint32 GetNumberOfChannels() const;
+
+    /**
+     * @brief Gets the number of samples processed for each channel.
+     * @return the number of samples.
+     */
+    uint32 GetNumberOfSamples() const;
+
+protected:
+    /**
+     * The number of channels.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The number of samples of each channel.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The input memory of each channel.
+     */
+    void **inputs;
+
+    /**
+     * The output memory of each channel.
+     */
+    void **outputs;
+
+    /*lint -e{1712} This class does not have a default constructor because
+     * the number of channels and samples must be defined on construction and both remain constant
+     * during the object's lifetime*/
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILTERENGINE_H_ */
@@ -0,0 +1,371 @@
+/**
+ * @file FilterEngineT.h
+ * @brief Header file for classes DirectFormFilterT and SOSFilterT
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the classes DirectFormFilterT and SOSFilterT
+ * with all of their public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILTERENGINET_H_
+#define FILTERENGINET_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FilterEngine.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Multi-channel direct form filter (see FilterGAM for the difference equation).
+ * @details The past inputs (outputs) are stored in a channel-interleaved buffer which is immediately followed
+ * by the inputs (outputs) of the current cycle, so that x[n-k] is always read from the same buffer, i.e. without
+ * the n >= k branch. For each channel the operations (and their order) are the same of the FilterGAM scalar path,
+ * so that the results are bit-for-bit identical.
+ */
+/*lint -esym(9107, MARTe::DirectFormFilterT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
+ * No code is actually being generated and the header files can be included in multiple unit files.*/
+template<typename Type>
+class DirectFormFilterT: public FilterEngine {
+public:
+    /**
+     * @brief Constructor. Copies the coefficients and allocates the interleaved state.
+     * @param[in] numberOfChannelsIn the number of signals to be filtered.
+     * @param[in] numberOfSamplesIn the number of samples of each signal.
+     * @param[in] numIn the numerator coefficients.
+     * @param[in] numberOfNumCoeffIn the number of numerator coefficients (> 0).
+     * @param[in] denIn the (normalised) denominator coefficients.
+     * @param[in] numberOfDenCoeffIn the number of denominator coefficients (> 0).
+     * @post
+     *   Reset()
+     */
+    DirectFormFilterT(const uint32 numberOfChannelsIn,
+                      const uint32 numberOfSamplesIn,
+                      const Type * const numIn,
+                      const uint32 numberOfNumCoeffIn,
+                      const Type * const denIn,
+                      const uint32 numberOfDenCoeffIn);
+
+    /**
+     * @brief Destructor. Frees the coefficients and the state.
+     */
+    virtual ~DirectFormFilterT();
+
+    /**
+     * @see FilterEngine::Process
+     */
+    virtual void Process();
+
+    /**
+     * @see FilterEngine::Reset
+     */
+    virtual void Reset();
+
+private:
+    /**
+     * The numerator coefficients.
+     */
+    Type *num;
+
+    /**
+     * The denominator coefficients.
+     */
+    Type *den;
+
+    /**
+     * The number of numerator coefficients.
+     */
+    uint32 numberOfNumCoeff;
+
+    /**
+     * The number of denominator coefficients.
+     */
+    uint32 numberOfDenCoeff;
+
+    /**
+     * Interleaved inputs: (numberOfNumCoeff - 1) past samples followed by the numberOfSamples current ones.
+     */
+    Type *x;
+
+    /**
+     * Interleaved outputs: (numberOfDenCoeff - 1) past samples followed by the numberOfSamples current ones.
+     */
+    Type *y;
+
+    /*lint -e{1712} This class does not have a default constructor because
+     * the coefficients must be defined on construction and remain constant during the object's lifetime*/
+};
+
+/**
+ * @brief Multi-channel cascade of second-order sections.
+ * @details Each section implements, in the transposed direct form II,
+ * H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2). The output of one section is the input of the next one.
+ * A cascade of sections is numerically much more robust than the equivalent high-order direct form.
+ * The two state variables of each section are stored channel-interleaved.
+ */
+/*lint -esym(9107, MARTe::SOSFilterT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
+ * No code is actually being generated and the header files can be included in multiple unit files.*/
+template<typename Type>
+class SOSFilterT: public FilterEngine {
+public:
+    /**
+     * @brief Constructor. Copies the coefficients and allocates the interleaved state.
+     * @param[in] numberOfChannelsIn the number of signals to be filtered.
+     * @param[in] numberOfSamplesIn the number of samples of each signal.
+     * @param[in] sosIn the coefficients, six per section: b0 b1 b2 a0 a1 a2 (with a0 = 1).
+     * @param[in] numberOfSectionsIn the number of sections (> 0).
+     * @post
+     *   Reset()
+     */
+    SOSFilterT(const uint32 numberOfChannelsIn,
+               const uint32 numberOfSamplesIn,
+               const float64 * const sosIn,
+               const uint32 numberOfSectionsIn);
+
+    /**
+     * @brief Destructor. Frees the coefficients and the state.
+     */
+    virtual ~SOSFilterT();
+
+    /**
+     * @see FilterEngine::Process
+     */
+    virtual void Process();
+
+    /**
+     * @see FilterEngine::Reset
+     */
+    virtual void Reset();
+
+private:
+    /**
+     * The number of sections.
+     */
+    uint32 numberOfSections;
+
+    /**
+     * The coefficients, five per section: b0 b1 b2 a1 a2.
+     */
+    Type *coefficients;
+
+    /**
+     * First state variable of each section (numberOfSections x numberOfChannels).
+     */
+    Type *z1;
+
+    /**
+     * Second state variable of each section (numberOfSections x numberOfChannels).
+     */
+    Type *z2;
+
+    /**
+     * Interleaved samples being processed (numberOfSamples x numberOfChannels).
+     */
+    Type *work;
+
+    /*lint -e{1712} This class does not have a default constructor because
+     * the coefficients must be defined on construction and remain constant during the object's lifetime*/
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename Type>
+DirectFormFilterT<Type>::DirectFormFilterT(const uint32 numberOfChannelsIn,
+                                           const uint32 numberOfSamplesIn,
+                                           const Type * const numIn,
+                                           const uint32 numberOfNumCoeffIn,
+                                           const Type * const denIn,
+                                           const uint32 numberOfDenCoeffIn) :
+        FilterEngine(numberOfChannelsIn, numberOfSamplesIn) {
+    numberOfNumCoeff = numberOfNumCoeffIn;
+    numberOfDenCoeff = numberOfDenCoeffIn;
+    num = new Type[numberOfNumCoeff];
+    den = new Type[numberOfDenCoeff];
+    for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+        num[k] = numIn[k];
+    }
+    for (uint32 k = 0u; k < numberOfDenCoeff; k++) {
+        den[k] = denIn[k];
+    }
+    x = new Type[((numberOfNumCoeff - 1u) + numberOfSamples) * numberOfChannels];
+    y = new Type[((numberOfDenCoeff - 1u) + numberOfSamples) * numberOfChannels];
+    Reset();
+}
+
+/*lint -e{1551} no exception thrown deleting the buffers*/
+template<typename Type>
+DirectFormFilterT<Type>::~DirectFormFilterT() {
+    delete[] num;
+    delete[] den;
+    delete[] x;
+    delete[] y;
+}
+
+template<typename Type>
+void DirectFormFilterT<Type>::Process() {
+    const uint32 inputHistory = numberOfNumCoeff - 1u;
+    const uint32 outputHistory = numberOfDenCoeff - 1u;
+    //Gather the current inputs after the past inputs
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        const Type *in = static_cast<const Type *>(inputs[c]);
+        Type *dst = &x[(inputHistory * numberOfChannels) + c];
+        for (uint32 s = 0u; s < numberOfSamples; s++) {
+            dst[s * numberOfChannels] = in[s];
+        }
+    }
+    for (uint32 s = 0u; s < numberOfSamples; s++) {
+        Type *acc = &y[(outputHistory + s) * numberOfChannels];
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            acc[c] = static_cast<Type>(0.0);
+        }
+        //sum inputs
+        for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+            const Type *xk = &x[((inputHistory + s) - k) * numberOfChannels];
+            const Type b = num[k];
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                acc[c] += xk[c] * b;
+            }
+        }
+        //Sum outputs
+        for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
+            const Type *yk = &y[((outputHistory + s) - k) * numberOfChannels];
+            const Type a = den[k];
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                acc[c] -= yk[c] * a;
+            }
+        }
+    }
+    //Scatter the outputs
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        Type *out = static_cast<Type *>(outputs[c]);
+        const Type *src = &y[(outputHistory * numberOfChannels) + c];
+        for (uint32 s = 0u; s < numberOfSamples; s++) {
+            out[s] = src[s * numberOfChannels];
+        }
+    }
+    //The most recent samples become the past samples of the next cycle
+    if (inputHistory > 0u) {
+        (void) MemoryOperationsHelper::Move(&x[0], &x[numberOfSamples * numberOfChannels],
+                                            static_cast<uint32>(inputHistory * numberOfChannels * sizeof(Type)));
+    }
+    if (outputHistory > 0u) {
+        (void) MemoryOperationsHelper::Move(&y[0], &y[numberOfSamples * numberOfChannels],
+                                            static_cast<uint32>(outputHistory * numberOfChannels * sizeof(Type)));
+    }
+}
+
+template<typename Type>
+void DirectFormFilterT<Type>::Reset() {
+    for (uint32 i = 0u; i < ((numberOfNumCoeff - 1u) * numberOfChannels); i++) {
+        x[i] = static_cast<Type>(0.0);
+    }
+    for (uint32 i = 0u; i < ((numberOfDenCoeff - 1u) * numberOfChannels); i++) {
+        y[i] = static_cast<Type>(0.0);
+    }
+}
+
+template<typename Type>
+SOSFilterT<Type>::SOSFilterT(const uint32 numberOfChannelsIn,
+                             const uint32 numberOfSamplesIn,
+                             const float64 * const sosIn,
+                             const uint32 numberOfSectionsIn) :
+        FilterEngine(numberOfChannelsIn, numberOfSamplesIn) {
+    numberOfSections = numberOfSectionsIn;
+    coefficients = new Type[5u * numberOfSections];
+    for (uint32 l = 0u; l < numberOfSections; l++) {
+        const float64 *section = &sosIn[6u * l];
+        Type *dst = &coefficients[5u * l];
+        dst[0] = static_cast<Type>(section[0]);
+        dst[1] = static_cast<Type>(section[1]);
+        dst[2] = static_cast<Type>(section[2]);
+        dst[3] = static_cast<Type>(section[4]);
+        dst[4] = static_cast<Type>(section[5]);
+    }
+    z1 = new Type[numberOfSections * numberOfChannels];
+    z2 = new Type[numberOfSections * numberOfChannels];
+    work = new Type[numberOfSamples * numberOfChannels];
+    Reset();
+}
+
+/*lint -e{1551} no exception thrown deleting the buffers*/
+template<typename Type>
+SOSFilterT<Type>::~SOSFilterT() {
+    delete[] coefficients;
+    delete[] z1;
+    delete[] z2;
+    delete[] work;
+}
+
+template<typename Type>
+void SOSFilterT<Type>::Process() {
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        const Type *in = static_cast<const Type *>(inputs[c]);
+        for (uint32 s = 0u; s < numberOfSamples; s++) {
+            work[(s * numberOfChannels) + c] = in[s];
+        }
+    }
+    for (uint32 l = 0u; l < numberOfSections; l++) {
+        const Type b0 = coefficients[5u * l];
+        const Type b1 = coefficients[(5u * l) + 1u];
+        const Type b2 = coefficients[(5u * l) + 2u];
+        const Type a1 = coefficients[(5u * l) + 3u];
+        const Type a2 = coefficients[(5u * l) + 4u];
+        Type *z1l = &z1[l * numberOfChannels];
+        Type *z2l = &z2[l * numberOfChannels];
+        for (uint32 s = 0u; s < numberOfSamples; s++) {
+            Type *w = &work[s * numberOfChannels];
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                const Type in = w[c];
+                const Type out = (b0 * in) + z1l[c];
+                z1l[c] = ((b1 * in) - (a1 * out)) + z2l[c];
+                z2l[c] = (b2 * in) - (a2 * out);
+                w[c] = out;
+            }
+        }
+    }
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        Type *out = static_cast<Type *>(outputs[c]);
+        for (uint32 s = 0u; s < numberOfSamples; s++) {
+            out[s] = work[(s * numberOfChannels) + c];
+        }
+    }
+}
+
+template<typename Type>
+void SOSFilterT<Type>::Reset() {
+    for (uint32 i = 0u; i < (numberOfSections * numberOfChannels); i++) {
+        z1[i] = static_cast<Type>(0.0);
+        z2[i] = static_cast<Type>(0.0);
+    }
+}
+
+}
+
+#endif /* FILTERENGINET_H_ */
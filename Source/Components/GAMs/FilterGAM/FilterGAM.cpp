@@ -31,7 +31,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "FilterEngineT.h"
 #include "FilterGAM.h"
+#include "Matrix.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -46,6 +48,10 @@ FilterGAM::FilterGAM() :
         GAM() {
     num = NULL_PTR(float32 *);
     den = NULL_PTR(float32 *);
+    numFloat64 = NULL_PTR(float64 *);
+    denFloat64 = NULL_PTR(float64 *);
+    sos = NULL_PTR(float64 *);
+    numberOfSections = 0u;
     numberOfNumCoeff = 0u;
     numberOfDenCoeff = 0u;
     staticGain = 0.0F;
@@ -57,6 +63,8 @@ FilterGAM::FilterGAM() :
     numberOfSignals = 0u;
     gainInfinite = false;
     resetInEachState = true;
+    interleaved = false;
+    engine = NULL_PTR(FilterEngine *);
 }
 
 FilterGAM::~FilterGAM() {
@@ -66,6 +74,18 @@ FilterGAM::~FilterGAM() {
     if (den != NULL_PTR(float32 *)) {
         delete[] den;
     }
+    if (numFloat64 != NULL_PTR(float64 *)) {
+        delete[] numFloat64;
+    }
+    if (denFloat64 != NULL_PTR(float64 *)) {
+        delete[] denFloat64;
+    }
+    if (sos != NULL_PTR(float64 *)) {
+        delete[] sos;
+    }
+    if (engine != NULL_PTR(FilterEngine *)) {
+        delete engine;
+    }
     if (lastInputs != NULL_PTR(float32 **)) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
             if (lastInputs[i] != NULL_PTR(float32 *)) {
@@ -104,85 +124,108 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
     AnyType functionsArray = data.GetType("Num");
     bool errorDetected = false;
     bool ok = GAM::Initialise(data);
-    if (ok) {
-        ok = (functionsArray.GetDataPointer() != NULL);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
-            errorDetected = true;
+    AnyType sosArray = data.GetType("SOS");
+    if (sosArray.GetDataPointer() != NULL) {
+        if (ok) {
+            ok = InitialiseSOS(data);
         }
+        errorDetected = !ok;
     }
-    if (ok) {
-        numberOfNumCoeff = functionsArray.GetNumberOfElements(0u);
-        ok = (numberOfNumCoeff > 0u);
-    }
-    if ((!ok) && (!errorDetected)) {
-        //Unlikely to be hit as empty arrays should be detected by the condition above.
-        REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfNumCoeff must be > 0");
-        errorDetected = true;
-    }
-    if (ok) {
-        num = new float32[numberOfNumCoeff];
-        Vector<float32> numVector(num, numberOfNumCoeff);
-        ok = (data.Read("Num", numVector));
+    else {
+        if (ok) {
+            ok = (functionsArray.GetDataPointer() != NULL);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
+                errorDetected = true;
+            }
+        }
+        if (ok) {
+            numberOfNumCoeff = functionsArray.GetNumberOfElements(0u);
+            ok = (numberOfNumCoeff > 0u);
+        }
         if ((!ok) && (!errorDetected)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading numerator");
+            //Unlikely to be hit as empty arrays should be detected by the condition above.
+            REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfNumCoeff must be > 0");
             errorDetected = true;
         }
-    }
-    AnyType functionsArray1 = data.GetType("Den");
-    if (ok) {
-        ok = (functionsArray1.GetDataPointer() != NULL);
-    }
-    if ((!ok) && (!errorDetected)) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the denominator");
-        errorDetected = true;
-    }
-    if (ok) {
-        numberOfDenCoeff = functionsArray1.GetNumberOfElements(0u);
-        ok = (numberOfDenCoeff > 0u);
-    }
-    if ((!ok) && (!errorDetected)) {
-        //Unlikely to be hit as empty arrays should be detected by the condition above.
-        REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfDenCoeff must be > 0");
-        errorDetected = true;
-    }
-    if (ok) {
-        den = new float32[numberOfDenCoeff];
-        Vector<float32> denVector(den, numberOfDenCoeff);
-        ok = data.Read("Den", denVector);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading denominator");
+        if (ok) {
+            num = new float32[numberOfNumCoeff];
+            Vector<float32> numVector(num, numberOfNumCoeff);
+            ok = (data.Read("Num", numVector));
+            if ((!ok) && (!errorDetected)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading numerator");
+                errorDetected = true;
+            }
+        }
+        if (ok) {
+            numFloat64 = new float64[numberOfNumCoeff];
+            Vector<float64> numVector(numFloat64, numberOfNumCoeff);
+            ok = (data.Read("Num", numVector));
+            if ((!ok) && (!errorDetected)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading numerator as float64");
+                errorDetected = true;
+            }
+        }
+        AnyType functionsArray1 = data.GetType("Den");
+        if (ok) {
+            ok = (functionsArray1.GetDataPointer() != NULL);
+        }
+        if ((!ok) && (!errorDetected)) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the denominator");
             errorDetected = true;
         }
-        else {
-            ok = CheckNormalisation();
+        if (ok) {
+            numberOfDenCoeff = functionsArray1.GetNumberOfElements(0u);
+            ok = (numberOfDenCoeff > 0u);
+        }
+        if ((!ok) && (!errorDetected)) {
+            //Unlikely to be hit as empty arrays should be detected by the condition above.
+            REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfDenCoeff must be > 0");
+            errorDetected = true;
+        }
+        if (ok) {
+            den = new float32[numberOfDenCoeff];
+            Vector<float32> denVector(den, numberOfDenCoeff);
+            ok = data.Read("Den", denVector);
+            if (ok) {
+                denFloat64 = new float64[numberOfDenCoeff];
+                Vector<float64> denVectorFloat64(denFloat64, numberOfDenCoeff);
+                ok = data.Read("Den", denVectorFloat64);
+            }
             if (!ok) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The coefficients of the filter must be normalised before being introduced into the GAM");
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading denominator");
                 errorDetected = true;
             }
-        }
-    }
-    if (ok) {
-        float32 sumNumerator = 0.0F;
-        for (uint32 i = 0u; i < numberOfNumCoeff; i++) {
-            //if due to MISRA rules however it is not necessary. At his line the initialization of num is guaranteed b the ok = true...
-            if (num != NULL_PTR(float32 *)) {
-                sumNumerator += num[i];
+            else {
+                ok = CheckNormalisation();
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The coefficients of the filter must be normalised before being introduced into the GAM");
+                    errorDetected = true;
+                }
             }
         }
-        float32 sumDenominator = 0.0F;
-        for (uint32 i = 0u; i < numberOfDenCoeff; i++) {
-            //if due to MISRA rules however it is not necessary. At his line the initialization of den is guaranteed b the ok = true...
-            if (den != NULL_PTR(float32 *)) {
-                sumDenominator += den[i];
+        if (ok) {
+            float32 sumNumerator = 0.0F;
+            for (uint32 i = 0u; i < numberOfNumCoeff; i++) {
+                //if due to MISRA rules however it is not necessary. At his line the initialization of num is guaranteed b the ok = true...
+                if (num != NULL_PTR(float32 *)) {
+                    sumNumerator += num[i];
+                }
+            }
+            float32 sumDenominator = 0.0F;
+            for (uint32 i = 0u; i < numberOfDenCoeff; i++) {
+                //if due to MISRA rules however it is not necessary. At his line the initialization of den is guaranteed b the ok = true...
+                if (den != NULL_PTR(float32 *)) {
+                    sumDenominator += den[i];
+                }
+            }
+            if (!IsEqual(sumDenominator, 0.0F)) {
+                //lint -e{414} sumDenominator cannot be 0.
+                staticGain = sumNumerator / sumDenominator;
+            }
+            else {
+                gainInfinite = true;
             }
-        }
-        if (!IsEqual(sumDenominator, 0.0F)) {
-            //lint -e{414} sumDenominator cannot be 0.
-            staticGain = sumNumerator / sumDenominator;
-        }
-        else {
-            gainInfinite = true;
         }
     }
     if (ok) {
@@ -206,9 +249,80 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
             }
         }
     }
+    if (!errorDetected) {
+        StreamString executionMode;
+        if (data.Read("ExecutionMode", executionMode)) {
+            if (executionMode == "Interleaved") {
+                interleaved = true;
+            }
+            else if (executionMode == "Scalar") {
+                interleaved = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ExecutionMode (expected values Scalar or Interleaved)");
+                errorDetected = true;
+            }
+        }
+    }
     return !errorDetected;
 }
 
+bool FilterGAM::InitialiseSOS(StructuredDataI & data) {
+    AnyType sosArray = data.GetType("SOS");
+    AnyType numArray = data.GetType("Num");
+    AnyType denArray = data.GetType("Den");
+    bool ok = ((numArray.GetDataPointer() == NULL) && (denArray.GetDataPointer() == NULL));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "SOS cannot be defined together with Num or Den");
+    }
+    if (ok) {
+        ok = (sosArray.GetNumberOfDimensions() == 2u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SOS must be a matrix with one row per section");
+        }
+    }
+    if (ok) {
+        uint32 numberOfColumns = sosArray.GetNumberOfElements(0u);
+        numberOfSections = sosArray.GetNumberOfElements(1u);
+        ok = ((numberOfColumns == 6u) && (numberOfSections > 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SOS must have 6 columns (b0 b1 b2 a0 a1 a2) and at least one row");
+        }
+    }
+    if (ok) {
+        sos = new float64[6u * numberOfSections];
+        Matrix<float64> sosMatrix(sos, numberOfSections, 6u);
+        ok = data.Read("SOS", sosMatrix);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading SOS");
+        }
+    }
+    float64 gain = 1.0;
+    for (uint32 l = 0u; (l < numberOfSections) && (ok); l++) {
+        //if due to MISRA rules. At this line sos is initialised.
+        if (sos != NULL_PTR(float64 *)) {
+            const float64 *section = &sos[6u * l];
+            ok = IsEqual(section[3], 1.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The coefficients of section %u must be normalised (a0 = 1)", l);
+            }
+            float64 sumNumerator = (section[0] + section[1]) + section[2];
+            float64 sumDenominator = (section[3] + section[4]) + section[5];
+            if (!IsEqual(sumDenominator, 0.0)) {
+                //lint -e{414} sumDenominator cannot be 0.
+                gain *= (sumNumerator / sumDenominator);
+            }
+            else {
+                gainInfinite = true;
+            }
+        }
+    }
+    if ((ok) && (!gainInfinite)) {
+        staticGain = static_cast<float32>(gain);
+    }
+    return ok;
+}
+
 bool FilterGAM::Setup() {
     bool errorDetected = false;
 
@@ -226,29 +340,21 @@ bool FilterGAM::Setup() {
             errorDetected = true;
         }
     }
-    //initialise lastInputs & lastOutputs
+
+    TypeDescriptor signalType = Float32Bit;
     if (!errorDetected) {
-        lastInputs = new float32 *[numberOfSignals];
-        lastOutputs = new float32*[numberOfSignals];
-        //if due to MISRA rules
-        if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
-            for (uint32 m = 0u; (m < numberOfSignals) && (!errorDetected); m++) {
-                uint32 auxToTrickMISRA = numberOfNumCoeff - 1u;
-                uint32 aux2ToTrickMISRA = numberOfDenCoeff - 1u;
-                lastInputs[m] = new float32[auxToTrickMISRA];
-                lastOutputs[m] = new float32[aux2ToTrickMISRA];
-                if ((lastInputs[m] != NULL_PTR(float32 *)) && (lastOutputs[m] != NULL_PTR(float32 *))) {
-                    for (uint32 i = 0u; i < (numberOfDenCoeff - 1u); i++) {
-                        lastOutputs[m][i] = 0.0F;
-                    }
-                    for (uint32 i = 0u; i < (numberOfNumCoeff - 1u); i++) {
-                        lastInputs[m][i] = 0.0F;
-                    }
-                }
-            }
+        signalType = GetSignalType(InputSignals, 0u);
+        if (signalType == Float64Bit) {
+            REPORT_ERROR(ErrorManagement::Information, "float64 signals are filtered with the interleaved engine");
+        }
+        else if (signalType != Float32Bit) {
+            //Forces the type check below to fail for all the signals
+            signalType = Float32Bit;
+        }
+        else {
+            //NOOP
         }
     }
-
     uint32 *numberOfSamplesInput = NULL_PTR(uint32 *);
     uint32 *numberOfElementsInput = NULL_PTR(uint32 *);
     uint32 *numberOfSamplesOutput = NULL_PTR(uint32 *);
@@ -291,14 +397,14 @@ bool FilterGAM::Setup() {
                     REPORT_ERROR(ErrorManagement::ParametersError, "numberOfSamplesOutput must be 1 ");
                     errorDetected = true;
                 }
-                ok = (GetSignalType(InputSignals, i) == Float32Bit);
+                ok = (GetSignalType(InputSignals, i) == signalType);
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be) ", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 or float64 as it should be, or different from the first signal) ", auxIndex);
                     errorDetected = true;
                 }
-                ok = (GetSignalType(OutputSignals, i) == Float32Bit);
+                ok = (GetSignalType(OutputSignals, i) == signalType);
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be)", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the output signal %u failed (not the same type of the input signals)", auxIndex);
                     errorDetected = true;
                 }
             }
@@ -410,7 +516,33 @@ bool FilterGAM::Setup() {
             errorDetected = true;
         }
     }
-    if (!errorDetected) {
+    bool useEngine = ((interleaved) || (numberOfSections > 0u) || (signalType == Float64Bit));
+    if ((!errorDetected) && (useEngine)) {
+        errorDetected = !CreateEngine(signalType);
+    }
+    //initialise lastInputs & lastOutputs
+    if ((!errorDetected) && (!useEngine)) {
+        lastInputs = new float32 *[numberOfSignals];
+        lastOutputs = new float32*[numberOfSignals];
+        //if due to MISRA rules
+        if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
+            for (uint32 m = 0u; (m < numberOfSignals) && (!errorDetected); m++) {
+                uint32 auxToTrickMISRA = numberOfNumCoeff - 1u;
+                uint32 aux2ToTrickMISRA = numberOfDenCoeff - 1u;
+                lastInputs[m] = new float32[auxToTrickMISRA];
+                lastOutputs[m] = new float32[aux2ToTrickMISRA];
+                if ((lastInputs[m] != NULL_PTR(float32 *)) && (lastOutputs[m] != NULL_PTR(float32 *))) {
+                    for (uint32 i = 0u; i < (numberOfDenCoeff - 1u); i++) {
+                        lastOutputs[m][i] = 0.0F;
+                    }
+                    for (uint32 i = 0u; i < (numberOfNumCoeff - 1u); i++) {
+                        lastInputs[m][i] = 0.0F;
+                    }
+                }
+            }
+        }
+    }
+    if ((!errorDetected) && (!useEngine)) {
         input = new float32 *[numberOfSignals];
         output = new float32 *[numberOfSignals];
         if ((input != NULL_PTR(float32 **)) && (output != NULL_PTR(float32 **))) {
@@ -436,7 +568,37 @@ bool FilterGAM::Setup() {
     return !errorDetected;
 }
 
+bool FilterGAM::CreateEngine(const TypeDescriptor &signalType) {
+    if (signalType == Float64Bit) {
+        if (numberOfSections > 0u) {
+            engine = new SOSFilterT<float64>(numberOfSignals, numberOfSamples, sos, numberOfSections);
+        }
+        else {
+            engine = new DirectFormFilterT<float64>(numberOfSignals, numberOfSamples, numFloat64, numberOfNumCoeff, denFloat64, numberOfDenCoeff);
+        }
+    }
+    else {
+        if (numberOfSections > 0u) {
+            engine = new SOSFilterT<float32>(numberOfSignals, numberOfSamples, sos, numberOfSections);
+        }
+        else {
+            engine = new DirectFormFilterT<float32>(numberOfSignals, numberOfSamples, num, numberOfNumCoeff, den, numberOfDenCoeff);
+        }
+    }
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        ok = engine->SetChannelMemory(i, GetInputSignalMemory(i), GetOutputSignalMemory(i));
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not set the signal memory of the filter engine");
+    }
+    return ok;
+}
+
 bool FilterGAM::Execute() {
+    if (engine != NULL_PTR(FilterEngine *)) {
+        engine->Process();
+    }
     uint32 n = 0u;
     float32 accumulator;
     //if due to MISRA rules...
@@ -488,7 +650,15 @@ bool FilterGAM::GetResetInEachState() const {
 }
 bool FilterGAM::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
     bool ret = true;
-    if (resetInEachState) {
+    if (engine != NULL_PTR(FilterEngine *)) {
+        if ((resetInEachState) || (lastStateExecuted != currentStateName)) {
+            engine->Reset();
+        }
+        if (!resetInEachState) {
+            lastStateExecuted = nextStateName;
+        }
+    }
+    else if (resetInEachState) {
         if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
             for (uint32 i = 0u; i < numberOfSignals; i++) {
                 if (lastInputs[i] != NULL_PTR(float32 *)) {
@@ -584,6 +754,10 @@ uint32 FilterGAM::GetNumberOfSignals() const {
 uint32 FilterGAM::GetNumberOfSamples() const {
     return numberOfSamples;
 }
+
+uint32 FilterGAM::GetNumberOfSections() const {
+    return numberOfSections;
+}
 CLASS_REGISTER(FilterGAM, "1.0")
 }
 
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FilterEngine.h"
 #include "GAM.h"
 #include "StructuredDataI.h"
 /*---------------------------------------------------------------------------*/
@@ -40,7 +41,7 @@
 
 namespace MARTe {
 /**
- * @brief GAM which allows to implement FIR & IIR filter with float32 type.
+ * @brief GAM which allows to implement FIR & IIR filter with float32 or float64 type.
  * @details The GAM configured coefficients of the filter must have
  * the numerator (num) and denominator (den) defined and normalised. If a FIR filter is implemented the Den = 1;
  *
@@ -62,7 +63,24 @@ namespace MARTe {
  * \f$
  *
  * The GAM supports multiple input signals (and output signal) only if the characteristics of the input arrays are the same
- * (i.e. The input signals have the same number of elements, the same number of samples and the same type). Currently, the only type supported is float32.
+ * (i.e. The input signals have the same number of elements, the same number of samples and the same type). The supported types are float32 and float64.
+ *
+ * Two execution modes are available:
+ *  - Scalar (default): each signal is filtered on its own, one after the other.
+ *  - Interleaved: all the signals are filtered together (see FilterEngine). The state of the filter is stored channel-interleaved
+ *  and the inner loops run over the signals, which allows the compiler to vectorise them when many signals share the same coefficients.
+ *  For each signal the arithmetic is the same of the Scalar mode, so that the outputs are bit-for-bit identical.
+ *
+ * float64 signals and second-order sections are always executed with the Interleaved engine.
+ *
+ * As an alternative to Num and Den, the filter can be specified as a cascade of second-order sections (SOS), one row per section,
+ * each with the six coefficients b0 b1 b2 a0 a1 a2 (normalised, i.e. a0 = 1). Each section implements
+ *
+ * \f$
+ * H_l(z)=\frac{b0 + b1*z^{-1} + b2*z^{-2}}{1 + a1*z^{-1} + a2*z^{-2}}
+ * \f$
+ *
+ * in the transposed direct form II. High-order IIR filters should be specified as SOS since the direct form is numerically unstable.
  *
  * The inputs and outputs must be arrays (could be arrays of 1 elements).
  *
@@ -82,10 +100,12 @@ namespace MARTe {
  *     Num = {0.5 0.5} //Compulsory. Filter numerator coefficient.
  *     Den = {1} //Compulsory. Filter denominator coefficient.
  *     ResetInEachState //Optional. If true the filter will be reset on each state change. Otherwise it will be reset only if the filter was not used in the previous state.
+ *     ExecutionMode = Interleaved //Optional. Scalar (default) or Interleaved.
+ *     //SOS = {{0.2 0.4 0.2 1.0 -0.3 0.1} {1.0 2.0 1.0 1.0 -0.5 0.2}} //Alternative to Num and Den (which shall not be defined in this case).
  *     InputSignals = {
  *         InputSignal1 = { //Filter will be applied to each signal. The number of input and output signals must be the same.
  *             DataSource = "DDB1"
- *             Type = float32 //Only supported type.
+ *             Type = float32 //float32 or float64. All the signals shall have the same type.
  *         }
  *         InputSignal2 = {
  *             DataSource = "DDB1"
@@ -281,7 +301,27 @@ public:
      */
     uint32 GetNumberOfSignals() const;
 
+    /**
+     * @brief Query the number of second-order sections.
+     * @return the number of second-order sections (0 if the filter is specified with Num and Den).
+     */
+    uint32 GetNumberOfSections() const;
+
 private:
+    /**
+     * @brief Reads and validates the SOS matrix and computes the static gain.
+     * @param[in] data the GAM configuration.
+     * @return true if the SOS matrix has six columns, at least one row and all the sections are normalised.
+     */
+    bool InitialiseSOS(StructuredDataI & data);
+
+    /**
+     * @brief Allocates the FilterEngine for the configured signal type and coefficients.
+     * @param[in] signalType the type of all the signals.
+     * @return true if the engine was successfully created and the signal memory assigned.
+     */
+    bool CreateEngine(const TypeDescriptor &signalType);
+
     /**
      * Pointer to the numerator coefficients.
      */
@@ -292,6 +332,26 @@ private:
      */
     float32 *den;
 
+    /**
+     * The numerator coefficients read as float64 (used for float64 signals).
+     */
+    float64 *numFloat64;
+
+    /**
+     * The denominator coefficients read as float64 (used for float64 signals).
+     */
+    float64 *denFloat64;
+
+    /**
+     * The second-order sections coefficients (numberOfSections x 6).
+     */
+    float64 *sos;
+
+    /**
+     * Number of second-order sections
+     */
+    uint32 numberOfSections;
+
     /**
      * Holds the number of numerator coefficients
      */
@@ -347,6 +407,12 @@ private:
 
     /*allows to choose between reset the filter every time the state changes or only when in the previous state the filter was not executed. */
     bool resetInEachState;
+
+    /* true if ExecutionMode = Interleaved */
+    bool interleaved;
+
+    /* Multi-channel engine. NULL when the scalar float32 direct form path is used */
+    FilterEngine *engine;
 };
 
 }
@@ -84,6 +84,18 @@ public:
      */
     virtual uint32 InRange(const void * const mem)=0;
 
+    /**
+     * @brief Computes the bin of each of the \a numberOfValues values stored contiguously in \a mem.
+     * @details Equivalent to calling InRange for each value, but without any per-value virtual call
+     * and with a branch-free loop that the compiler can vectorise (see the flags in the Makefile.inc of this component).
+     * @param[in] mem holds the occurrence values.
+     * @param[in] numberOfValues the number of values in \a mem.
+     * @param[out] bins where to write the bin of each value (shall hold at least \a numberOfValues elements).
+     */
+    virtual void GetBins(const void * const mem,
+                         const uint32 numberOfValues,
+                         uint32 * const bins)=0;
+
 };
 
 }
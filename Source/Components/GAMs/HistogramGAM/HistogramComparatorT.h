@@ -80,8 +80,37 @@ public:
      */
     virtual uint32 InRange(const void * const mem);
 
+    /**
+     * @see HistogramComparator::GetBins()
+     */
+    virtual void GetBins(const void * const mem,
+                         const uint32 numberOfValues,
+                         uint32 * const bins);
+
 private:
 
+    /**
+     * @brief Computes the bin of \a value.
+     * @details The bin is estimated by multiplying the distance to \a minValue by the precomputed reciprocal of the bin width
+     * and then corrected (by at most one bin) by comparing against the bin edges, so that the result is the same as
+     * comparing against each edge (minValue + k * width). The selection is written without branches.
+     * @param[in] value the occurrence value.
+     * @param[in] minValue the lower bound.
+     * @param[in] maxValue the upper bound.
+     * @param[in] minValue64 the lower bound as a float64.
+     * @param[in] width the width of the in range bins.
+     * @param[in] scale the reciprocal of \a width.
+     * @param[in] lastInRange the number of bins - 3.
+     * @return the bin of \a value.
+     */
+    static inline uint32 Bin(const T value,
+                             const T minValue,
+                             const T maxValue,
+                             const float64 minValue64,
+                             const float64 width,
+                             const float64 scale,
+                             const uint32 lastInRange);
+
     /**
      * The upper bound
      */
@@ -93,14 +122,24 @@ private:
     T minLim;
 
     /**
-     * The size of a bin range
+     * The number of bins
      */
-    T delta;
+    uint32 nBins;
 
     /**
-     * The number of bins
+     * minLim as a float64.
      */
-    uint32 nBins;
+    float64 minLim64;
+
+    /**
+     * Width of the (nBins - 2) in range bins.
+     */
+    float64 binWidth;
+
+    /**
+     * Reciprocal of binWidth.
+     */
+    float64 binScale;
 };
 }
 
@@ -116,7 +155,9 @@ HistogramComparatorT<T>::HistogramComparatorT() :
     maxLim = static_cast<T>(0);
     minLim = static_cast<T>(0);
     nBins = 3u;
-    delta = static_cast<T>(0);
+    minLim64 = 0.0;
+    binWidth = 0.0;
+    binScale = 0.0;
 
 }
 
@@ -139,10 +180,12 @@ template<typename T>
 void HistogramComparatorT<T>::SetNumberOfBins(const uint32 nBinsIn) {
     nBins = nBinsIn;
     if (nBins > 2u) {
-        T range = (maxLim - minLim);
         uint32 nBinsTemp = (nBins - 2u);
-        /*lint -e{737} -e{9117} -e{9125} -e{573} -e{9115} Loss of precision is responsibility of the conversion requested by the user.*/
-        delta = static_cast<T>(range / nBinsTemp);
+        /*lint -e{9117} -e{747} Loss of precision is responsibility of the conversion requested by the user.*/
+        minLim64 = static_cast<float64>(minLim);
+        /*lint -e{9117} -e{747} Loss of precision is responsibility of the conversion requested by the user.*/
+        binWidth = (static_cast<float64>(maxLim) - minLim64) / static_cast<float64>(nBinsTemp);
+        binScale = (binWidth > 0.0) ? (1.0 / binWidth) : (0.0);
     }
 }
 
@@ -152,34 +195,51 @@ uint32 HistogramComparatorT<T>::GetNumberOfBins() {
 }
 
 
+/*lint -e{9117} -e{747} -e{737} -e{9125} Loss of precision is responsibility of the conversion requested by the user.*/
 template<typename T>
-uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
+inline uint32 HistogramComparatorT<T>::Bin(const T value,
+                                           const T minValue,
+                                           const T maxValue,
+                                           const float64 minValue64,
+                                           const float64 width,
+                                           const float64 scale,
+                                           const uint32 lastInRange) {
+    const float64 distance = static_cast<float64>(value) - minValue64;
+    float64 estimate = distance * scale;
+    estimate = (estimate < static_cast<float64>(lastInRange)) ? (estimate) : (static_cast<float64>(lastInRange));
+    //Also catches NaN
+    estimate = (estimate >= 0.0) ? (estimate) : (0.0);
+    uint32 k = static_cast<uint32>(static_cast<int32>(estimate));
+    //The reciprocal multiply may be one bin off next to the edges. k may wrap if value < minValue, which is handled below.
+    k -= static_cast<uint32>(distance < (static_cast<float64>(k) * width));
+    k += static_cast<uint32>(distance >= (static_cast<float64>(k + 1u) * width));
+    k = (k < lastInRange) ? (k) : (lastInRange);
+    k = (value >= minValue) ? (k + 1u) : (0u);
+    k = (value >= maxValue) ? (lastInRange + 2u) : (k);
+    return k;
+}
 
+template<typename T>
+uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
     const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
+    return Bin(*toCompare, minLim, maxLim, minLim64, binWidth, binScale, nBins - 3u);
+}
 
-    uint32 ret = 0u;
-    if (*toCompare < minLim) {
-        ret = 0u;
-    }
-    else if (*toCompare >= maxLim) {
-        ret = (nBins - 1u);
-    }
-    else {
-        //do the division with a
-        for (uint32 i = 0u; (i < (nBins - 2u)); i++) {
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T minRange = (minLim + static_cast<T>(i * delta));
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T maxRange = (minLim + static_cast<T>((i + 1u) * delta));
-            /*lint -e{737} -e{9117} -e{9125} Loss of precision is responsibility of the conversion requested by the user.*/
-            if (((*toCompare) >= (minRange)) && ((*toCompare) < maxRange)) {
-                ret = (i + 1u);
-                break;
-            }
-        }
+template<typename T>
+void HistogramComparatorT<T>::GetBins(const void * const mem,
+                                      const uint32 numberOfValues,
+                                      uint32 * const bins) {
+    const T* values = reinterpret_cast<T*>(const_cast<void *>(mem));
+    //Copies so that the compiler does not have to reload the members after each store in bins
+    const T minValue = minLim;
+    const T maxValue = maxLim;
+    const float64 minValue64 = minLim64;
+    const float64 width = binWidth;
+    const float64 scale = binScale;
+    const uint32 lastInRange = nBins - 3u;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        bins[i] = Bin(values[i], minValue, maxValue, minValue64, width, scale, lastInRange);
     }
-
-    return ret;
 }
 
 }
@@ -186,9 +186,15 @@ namespace MARTe {
 HistogramGAM::HistogramGAM() :
         GAM() {
     comps = NULL_PTR(HistogramComparator **);
+    binIndexes = NULL_PTR(uint32 **);
+    numberOfValues = NULL_PTR(uint32 *);
 
     beginCycle = 0u;
     cycleCounter = 0u;
+    windowCycles = 0u;
+    windowPosition = 0u;
+    windowFull = false;
+    decayShift = 0u;
 }
 
 /*lint -e{1551} destructor does not throw any exception */
@@ -203,6 +209,20 @@ HistogramGAM::~HistogramGAM() {
         delete[] comps;
         comps = NULL_PTR(HistogramComparator **);
     }
+    if (binIndexes != NULL_PTR(uint32 **)) {
+        for (uint32 i = 0u; i < numberOfInputSignals; i++) {
+            if (binIndexes[i] != NULL_PTR(uint32 *)) {
+                delete[] binIndexes[i];
+                binIndexes[i] = NULL_PTR(uint32 *);
+            }
+        }
+        delete[] binIndexes;
+        binIndexes = NULL_PTR(uint32 **);
+    }
+    if (numberOfValues != NULL_PTR(uint32 *)) {
+        delete[] numberOfValues;
+        numberOfValues = NULL_PTR(uint32 *);
+    }
 }
 
 bool HistogramGAM::Initialise(StructuredDataI &data) {
@@ -219,6 +239,24 @@ bool HistogramGAM::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Information, "Going to reset when the next state name is: %s", stateChangeResetName.Buffer());
         }
     }
+    if (ret) {
+        if (!data.Read("WindowCycles", windowCycles)) {
+            windowCycles = 0u;
+        }
+        if (!data.Read("DecayShift", decayShift)) {
+            decayShift = 0u;
+        }
+        ret = ((windowCycles == 0u) || (decayShift == 0u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "WindowCycles and DecayShift cannot be both set");
+        }
+    }
+    if (ret) {
+        ret = (decayShift < 32u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "DecayShift shall be < 32");
+        }
+    }
     return ret;
 }
 
@@ -228,31 +266,30 @@ bool HistogramGAM::Setup() {
 
     if (ret) {
         comps = new HistogramComparator *[numberOfInputSignals];
+        binIndexes = new uint32 *[numberOfInputSignals];
+        numberOfValues = new uint32[numberOfInputSignals];
 
         for (uint32 i = 0u; (i < numberOfInputSignals); i++) {
             /*lint -e{613} the NULL pointer is checked before*/
             comps[i] = NULL_PTR(HistogramComparator *);
+            /*lint -e{613} the NULL pointer is checked before*/
+            binIndexes[i] = NULL_PTR(uint32 *);
         }
-        //check that the number of dimensions of the input signals is one
+        //all the elements and samples of each input signal are binned
+        uint32 numberOfWindowSlots = (windowCycles > 0u) ? (windowCycles) : (1u);
         /*lint -e{850} the variable i does not change in the loop */
         for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
-            uint32 numberOfElements;
+            uint32 numberOfElements = 0u;
+            uint32 numberOfSamples = 0u;
             ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
             if (ret) {
-                ret = (numberOfElements == 1u);
-                if (!ret) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfElements=1", i);
-                }
+                ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
             }
             if (ret) {
-                uint32 numberOfSamples;
-                ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
-                if (ret) {
-                    ret = (numberOfSamples == 1u);
-                    if (!ret) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfSamples=1", i);
-                    }
-                }
+                /*lint -e{613} the NULL pointer is checked before*/
+                numberOfValues[i] = (numberOfElements * numberOfSamples);
+                /*lint -e{613} the NULL pointer is checked before*/
+                binIndexes[i] = new uint32[numberOfValues[i] * numberOfWindowSlots];
             }
             if (ret) {
                 TypeDescriptor td = GetSignalType(InputSignals, i);
@@ -342,6 +379,8 @@ bool HistogramGAM::PrepareNextState(const char8 * const currentStateName, const
     }
     if (reset) {
         cycleCounter = 0u;
+        windowPosition = 0u;
+        windowFull = false;
         /*lint -e{613} the NULL pointer is checked before*/
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             uint32 *outputSignal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
@@ -354,13 +393,37 @@ bool HistogramGAM::PrepareNextState(const char8 * const currentStateName, const
     return true;
 }
 
+/*lint -e{613} the NULL pointers are checked in Setup*/
 bool HistogramGAM::Execute() {
     if (cycleCounter >= beginCycle) {
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             uint32 *outputSignal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
-            /*lint -e{613} the NULL pointer is checked before*/
-            uint32 index = comps[i]->InRange(GetInputSignalMemory(i));
-            outputSignal[index]++;
+            uint32 nValues = numberOfValues[i];
+            uint32 *indexes = &(binIndexes[i][windowPosition * nValues]);
+            uint32 v;
+            //Remove the cycle that leaves the window (stored in the slot that is going to be overwritten)
+            if (windowFull) {
+                for (v = 0u; v < nValues; v++) {
+                    outputSignal[indexes[v]]--;
+                }
+            }
+            if (decayShift > 0u) {
+                uint32 nBins = comps[i]->GetNumberOfBins();
+                for (v = 0u; v < nBins; v++) {
+                    outputSignal[v] -= (outputSignal[v] >> decayShift);
+                }
+            }
+            comps[i]->GetBins(GetInputSignalMemory(i), nValues, indexes);
+            for (v = 0u; v < nValues; v++) {
+                outputSignal[indexes[v]]++;
+            }
+        }
+        if (windowCycles > 0u) {
+            windowPosition++;
+            if (windowPosition == windowCycles) {
+                windowPosition = 0u;
+                windowFull = true;
+            }
         }
     }
     else {
@@ -46,7 +46,8 @@ namespace MARTe {
  * @details For each input signal the following parameters can be defined:\n
  *   MinLim = [the minimum value of the signal]\n
  *   MaxLim = [the maximum value of the signal]\n
- * All the signals in input must be scalar and the number of samples per cycle must be one.\n
+ * The input signals can be arrays and have more than one sample per cycle: every element of every sample is binned
+ * in the histogram of the signal (one virtual call per signal and per cycle computes all the bins).\n
  * Each output signal represents the histogram of the relative input signal, so the number of input and output
  * signals must coincide. The output signal must be an array of at least three elements and the number of elements
  * is the desired number of bins of the histogram. The algorithm divides the signal range (maxLim - minLim)
@@ -79,7 +80,14 @@ namespace MARTe {
  *
  * The output signals type must be uint32.\n
  * The user can also define the GAM parameter \a BeginCycleNumber that enables the histogram
- * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.
+ * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.\n
+ *
+ * By default the histograms accumulate all the occurrences since the last reset. Optionally:\n
+ *   - WindowCycles = N: the histograms only count the occurrences of the last N cycles (sliding window). The bins of the
+ *     last N cycles are stored (N * NumberOfElements * NumberOfSamples uint32 for each input signal);\n
+ *   - DecayShift = S: before adding the occurrences of each cycle, each bin is decremented by bin >> S, i.e. the bins
+ *     decay with a factor of (1 - 2^-S) per cycle (and converge to 2^S times the average number of occurrences per cycle).\n
+ * WindowCycles and DecayShift cannot be both set.
  *
  * @details
  * The configuration syntax is (names and signal quantities are only given as an example):
@@ -88,6 +96,8 @@ namespace MARTe {
  *     Class = HistogramGAM
  *     BeginCycleNumber = 0 //Optional. Start to compute histogram only after BeginCycleNumber cycles
  *     StateChangeResetName = All //Optional. If set it will reset when the PrepareNextState, nextStaName == StateChangeResetName. If the StateChangeResetName is set to "All", it will always reset.
+ *     WindowCycles = 100 //Optional. If set only the occurrences of the last WindowCycles cycles are counted.
+ *     DecayShift = 0 //Optional. If > 0 the bins decay by bin >> DecayShift every cycle. Shall be < 32.
  *     InputSignals = {
  *         BeginCycleNumber = 10
  *         Signal1 = {
@@ -137,7 +147,10 @@ public:
     /**
      * @see GAM::Initialise()
      * @details The following parameter can be defined in the configuration:\n
-     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.
+     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.\n
+     *   WindowCycles: number of cycles of the sliding window (0 = disabled).\n
+     *   DecayShift: decay of the bins at each cycle (0 = disabled).
+     * @return true if WindowCycles and DecayShift are not both set and DecayShift < 32.
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -145,8 +158,6 @@ public:
      * @see GAM::Setup()
      * @details Checks that:\n
      *   (NumberOfInputSignals==NumberOfOutputSignals)\n
-     *   (NumberOfElements == 1) for each input signal\n
-     *   (NumberOfSamples == 1) for each input signal\n
      *   (NumberOfElements >= 3) for each output signal\n
      *   (Type == uint32) for each output signal\n
      *  @return true if the conditions above are met.
@@ -192,6 +203,37 @@ protected:
      * The name of the state to reset the histogram counters.
      */
     StreamString stateChangeResetName;
+
+    /**
+     * For each signal, the bins of the values of the last cycle
+     * (or of the last windowCycles cycles).
+     */
+    uint32 **binIndexes;
+
+    /**
+     * For each signal, the number of elements * the number of samples.
+     */
+    uint32 *numberOfValues;
+
+    /**
+     * Number of cycles of the sliding window (0 if disabled).
+     */
+    uint32 windowCycles;
+
+    /**
+     * Slot of binIndexes to be written in the next cycle.
+     */
+    uint32 windowPosition;
+
+    /**
+     * True after the first windowCycles cycles.
+     */
+    bool windowFull;
+
+    /**
+     * Decay of the bins (0 if disabled).
+     */
+    uint32 decayShift;
 };
 
 }
@@ -49,10 +49,12 @@ namespace MARTe {
  * @details The class allocates circular buffers to store values of samples and
  * computes average, standard deviation, minimum and maximum over a moving time
  * window. As such, the sum of samples and sum of squares is computed upon calling
- * the PushSample() method in a way to minimise operations. The minimum or maximum
- * over the historical buffer are re-computed only when needed, i.e. in case the
- * oldest sample being pushed out of the moving time window is equal to the stored
- * minimum or maximum.
+ * the PushSample() method in a way to minimise operations. The minimum and maximum
+ * over the moving time window are tracked with two monotonic queues (ascending for
+ * the minimum, descending for the maximum) so that the historical buffer is never
+ * re-parsed. Since the queues are sorted, the samples dominated by a new one are
+ * discarded with a bisection, i.e. the worst-case cost of PushSample() is bounded by
+ * O(log(size)) and there are no spikes when the extremum leaves the time window.
  * The implementation does not perform division, rather uses bit shift operation
  * for integer types, and pre-computes 1.0 / size for floating point types. As such,
  * the computation of average and standard deviation is only exact after the window
@@ -93,10 +95,11 @@ public:
      * @details The method inserts the sample in the historical buffer and re-computes the
      * sum of samples over the time window with two operations, i.e. to remove the oldest
      * sample leaving the buffer from the cumulative sum before adding the new one.
-     * The minimum and maximum sample attributes are changed if the newly inserted sample
-     * is respectively smaller or higher than the currently stored minimum or maximum. The
-     * historical buffer is fully parsed in case the oldest sample leaving the buffer is
-     * equal to the recorded minimum or maximum.
+     * The new sample is appended to the minimum and maximum monotonic queues after having
+     * discarded (bisection) the queued samples it dominates, and the queue heads which fell out of the
+     * time window are dropped. The minimum and maximum are then read from the queue heads.
+     * If \a infiniteMaxMin is true the minimum and maximum are only ever extended by the
+     * new sample, i.e. they are computed since the last Reset().
      * The new sample is also squared and inserted into a second buffer, with similar sum
      * management.
      * The average, root mean square, and standard deviation are only computed when the
@@ -244,16 +247,71 @@ private:
     Type GetRmsSq(void) const;
 
     /**
-     * @brief Finds the maximum of samples in the sample buffer.
-     * @return maximum.
+     * Number of samples pushed since the last Reset(), used to time-stamp the queued samples.
+     * The wrap-around is harmless since only differences are computed.
      */
-    Type FindMax(void) const;
+    uint32 sampleIndex;
 
     /**
-     * @brief Finds the minimum of samples in the sample buffer.
-     * @return maximum.
+     * Descending monotonic queue of candidate maximum values (circular, size elements)
+     */
+    Type * maxQueueValues;
+
+    /**
+     * Sample index of each element in maxQueueValues
      */
-    Type FindMin(void) const;
+    uint32 * maxQueueIndexes;
+
+    /**
+     * Position of the head of the maximum queue
+     */
+    uint32 maxQueueHead;
+
+    /**
+     * Number of elements in the maximum queue
+     */
+    uint32 maxQueueCount;
+
+    /**
+     * Ascending monotonic queue of candidate minimum values (circular, size elements)
+     */
+    Type * minQueueValues;
+
+    /**
+     * Sample index of each element in minQueueValues
+     */
+    uint32 * minQueueIndexes;
+
+    /**
+     * Position of the head of the minimum queue
+     */
+    uint32 minQueueHead;
+
+    /**
+     * Number of elements in the minimum queue
+     */
+    uint32 minQueueCount;
+
+    /**
+     * @brief Allocates the monotonic queues. To be called once from the constructor.
+     */
+    void AllocateQueues(void);
+
+    /**
+     * @brief Pushes the sample with index sampleIndex into the maximum queue.
+     * @details Drops the head if it left the time window and then truncates the queue
+     * at the first value which is smaller or equal to \a sample.
+     * @return the maximum over the time window.
+     */
+    Type PushMax(const Type sample);
+
+    /**
+     * @brief Pushes the sample with index sampleIndex into the minimum queue.
+     * @details Drops the head if it left the time window and then truncates the queue
+     * at the first value which is greater or equal to \a sample.
+     * @return the minimum over the time window.
+     */
+    Type PushMin(const Type sample);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -273,6 +331,12 @@ template<typename Type> bool StatisticsHelperT<Type>::Reset() {
     Xrms = 0;
     Xstd = 0;
 
+    sampleIndex = 0u;
+    maxQueueHead = 0u;
+    maxQueueCount = 0u;
+    minQueueHead = 0u;
+    minQueueCount = 0u;
+
     /* Reset sample buffers */
     bool ok = true;
     uint32 i;
@@ -303,6 +367,12 @@ template<> inline bool StatisticsHelperT<float32>::Reset() { // Must be declared
     Xrms = 0.0F;
     Xstd = 0.0F;
 
+    sampleIndex = 0u;
+    maxQueueHead = 0u;
+    maxQueueCount = 0u;
+    minQueueHead = 0u;
+    minQueueCount = 0u;
+
     /* Reset sample buffers */
     bool ok = true;
     uint32 i;
@@ -332,6 +402,12 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
     Xrms = 0.0;
     Xstd = 0.0;
 
+    sampleIndex = 0u;
+    maxQueueHead = 0u;
+    maxQueueCount = 0u;
+    minQueueHead = 0u;
+    minQueueCount = 0u;
+
     /* Reset sample buffers */
     bool ok = true;
     uint32 i;
@@ -366,6 +442,7 @@ template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<Type>(size);
     Xsq = new CircularStaticList<Type>(size);
+    AllocateQueues();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -404,6 +481,7 @@ template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 win
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float32>(size);
     Xsq = new CircularStaticList<float32>(size);
+    AllocateQueues();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -425,6 +503,7 @@ template<> inline StatisticsHelperT<float64>::StatisticsHelperT(const uint32 win
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float64>(size);
     Xsq = new CircularStaticList<float64>(size);
+    AllocateQueues();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -446,89 +525,121 @@ template<typename Type> StatisticsHelperT<Type>::~StatisticsHelperT() {
         Xsq = NULL_PTR(CircularStaticList<Type> *);
     }
 
-}
-
-/*lint -e{534} ignore return value of GetData since initialisation error would have been caught earlier*/
-template<typename Type> Type StatisticsHelperT<Type>::FindMax() const {
-
-    Type max = std::numeric_limits<Type>::min();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
+    if (maxQueueValues != NULL_PTR(Type *)) {
+        delete[] maxQueueValues;
+        maxQueueValues = NULL_PTR(Type *);
+    }
 
-        Type sample;
+    if (maxQueueIndexes != NULL_PTR(uint32 *)) {
+        delete[] maxQueueIndexes;
+        maxQueueIndexes = NULL_PTR(uint32 *);
+    }
 
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+    if (minQueueValues != NULL_PTR(Type *)) {
+        delete[] minQueueValues;
+        minQueueValues = NULL_PTR(Type *);
+    }
 
-        if (sample > max) {
-            max = sample;
-        }
+    if (minQueueIndexes != NULL_PTR(uint32 *)) {
+        delete[] minQueueIndexes;
+        minQueueIndexes = NULL_PTR(uint32 *);
     }
 
-    return max;
 }
 
-template<> inline float32 StatisticsHelperT<float32>::FindMax() const { // Must be declared/defined before use
+template<typename Type> void StatisticsHelperT<Type>::AllocateQueues() {
 
-    float32 max = -1.0F * std::numeric_limits<float32>::max();
+    maxQueueValues = new Type[size];
+    maxQueueIndexes = new uint32[size];
+    minQueueValues = new Type[size];
+    minQueueIndexes = new uint32[size];
 
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
+}
 
-        float32 sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+template<typename Type> Type StatisticsHelperT<Type>::PushMax(const Type sample) {
 
-        if (sample > max) {
-            max = sample;
+    /* The head (at most one per push) leaves the time window */
+    if (maxQueueCount > 0u) {
+        if ((sampleIndex - maxQueueIndexes[maxQueueHead]) >= size) {
+            maxQueueHead++;
+            if (maxQueueHead == size) {
+                maxQueueHead = 0u;
+            }
+            maxQueueCount--;
         }
     }
 
-    return max;
-}
-
-template<> inline float64 StatisticsHelperT<float64>::FindMax() const { // Must be declared/defined before use
-
-    float64 max = -1.0 * std::numeric_limits<float64>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float64 sample;
-
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+    /* Samples smaller than the new one can no longer be the maximum. The queue is sorted,
+     * so that the first dominated position is found with a bisection, i.e. in bounded time */
+    uint32 lower = 0u;
+    uint32 upper = maxQueueCount;
+    while (lower < upper) {
+        uint32 middle = lower + ((upper - lower) >> 1u);
+        uint32 position = maxQueueHead + middle;
+        if (position >= size) {
+            position -= size;
+        }
+        if (maxQueueValues[position] <= sample) {
+            upper = middle;
+        }
+        else {
+            lower = middle + 1u;
         }
     }
+    maxQueueCount = lower;
 
-    return max;
-}
-
-template<typename Type> Type StatisticsHelperT<Type>::FindMin() const {
-
-    Type min = std::numeric_limits<Type>::max();
+    uint32 last = maxQueueHead + maxQueueCount;
+    if (last >= size) {
+        last -= size;
+    }
+    maxQueueValues[last] = sample;
+    maxQueueIndexes[last] = sampleIndex;
+    maxQueueCount++;
 
-    uint32 index;
+    return maxQueueValues[maxQueueHead];
+}
 
-    for (index = 0u; index < size; index++) {
+template<typename Type> Type StatisticsHelperT<Type>::PushMin(const Type sample) {
 
-        Type sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+    /* The head (at most one per push) leaves the time window */
+    if (minQueueCount > 0u) {
+        if ((sampleIndex - minQueueIndexes[minQueueHead]) >= size) {
+            minQueueHead++;
+            if (minQueueHead == size) {
+                minQueueHead = 0u;
+            }
+            minQueueCount--;
+        }
+    }
 
-        if (sample < min) {
-            min = sample;
+    /* Samples greater than the new one can no longer be the minimum. The queue is sorted,
+     * so that the first dominated position is found with a bisection, i.e. in bounded time */
+    uint32 lower = 0u;
+    uint32 upper = minQueueCount;
+    while (lower < upper) {
+        uint32 middle = lower + ((upper - lower) >> 1u);
+        uint32 position = minQueueHead + middle;
+        if (position >= size) {
+            position -= size;
+        }
+        if (minQueueValues[position] >= sample) {
+            upper = middle;
+        }
+        else {
+            lower = middle + 1u;
         }
     }
+    minQueueCount = lower;
+
+    uint32 last = minQueueHead + minQueueCount;
+    if (last >= size) {
+        last -= size;
+    }
+    minQueueValues[last] = sample;
+    minQueueIndexes[last] = sampleIndex;
+    minQueueCount++;
 
-    return min;
+    return minQueueValues[minQueueHead];
 }
 
 template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
@@ -554,23 +665,23 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
         Xavg -= oldest; /* Remove oldest sample from the accumulator */
         Xavg += Xspl; /* Sum of all sample in time window */
 
-        /* Update max/min, if necessary */
-        if (Xspl > Xmax) {
-            Xmax = Xspl;
-        }
-
-        if (Xspl < Xmin) {
-            Xmin = Xspl;
-        }
+        /* Update max/min */
+        Type windowMax = PushMax(Xspl);
+        Type windowMin = PushMin(Xspl);
+        sampleIndex++;
 
-        if(!infiniteMaxMin) {
-            if (oldest == Xmax) { /* The removed sample was the max over the time window */
-                Xmax = FindMax();
+        if (infiniteMaxMin) {
+            if (Xspl > Xmax) {
+                Xmax = Xspl;
             }
-            if (oldest == Xmin) { /* The removed sample was the min over the time window */
-                Xmin = FindMin();
+            if (Xspl < Xmin) {
+                Xmin = Xspl;
             }
         }
+        else {
+            Xmax = windowMax;
+            Xmin = windowMin;
+        }
     }
 
     Type Xspl_sq = Xspl * Xspl; /* Square of the sample */
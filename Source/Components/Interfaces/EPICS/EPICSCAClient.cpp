@@ -74,6 +74,7 @@ EPICSCAClient::EPICSCAClient() :
         ReferenceContainer(), EmbeddedServiceMethodBinderI(), MessageI(), executor(*this){
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
+    flushPeriod = 1.0F;
     eventCallbackFastMux.Create();
     ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
@@ -137,9 +138,14 @@ ErrorManagement::ErrorType EPICSCAClient::Execute(ExecutionInfo& info) {
             REPORT_ERROR(err, "ca_enable_preemptive_callback failed");
         }
         uint32 j;
+        flushPeriod = 1.0F;
         for (j = 0u; j < Size(); j++) {
             ReferenceT<EPICSPV> child = Get(j);
             if (child.IsValid()) {
+                float32 window = static_cast<float32>(child->GetCoalescingWindow());
+                if ((window > 0.F) && (window < flushPeriod)) {
+                    flushPeriod = window;
+                }
                 chid pvChid;
                 StreamString pvName = child->GetPVName();
                 (void) pvName.Seek(0LLU);
@@ -170,7 +176,16 @@ ErrorManagement::ErrorType EPICSCAClient::Execute(ExecutionInfo& info) {
         eventCallbackFastMux.FastUnLock();
     }
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
-        Sleep::Sec(1.0F);
+        Sleep::Sec(flushPeriod);
+        (void) eventCallbackFastMux.FastLock();
+        uint32 j;
+        for (j = 0u; j < Size(); j++) {
+            ReferenceT<EPICSPV> pv = Get(j);
+            if (pv.IsValid()) {
+                pv->FlushEventMessage();
+            }
+        }
+        eventCallbackFastMux.FastUnLock();
     }
     else {
         (void) eventCallbackFastMux.FastLock();
@@ -66,6 +66,9 @@ namespace MARTe {
  *   }
  * }
  * </pre>
+ *
+ * @details The EmbeddedThread periodically calls EPICSPV::FlushEventMessage on all the PVs, so that the last value of a coalesced burst
+ * of updates is sent. The period is the smallest CoalescingWindow of the PVs (and at most 1 s).
  */
 class EPICSCAClient: public ReferenceContainer, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
@@ -150,6 +153,11 @@ private:
      */
     uint32 stackSize;
 
+    /**
+     * The period (in seconds) at which the coalesced PV events are flushed.
+     */
+    float32 flushPeriod;
+
 };
 
 }
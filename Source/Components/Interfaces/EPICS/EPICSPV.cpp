@@ -32,11 +32,18 @@
 #include "CLASSMETHODREGISTER.h"
 #include "ConfigurationDatabase.h"
 #include "EPICSPV.h"
+#include "HighResolutionTimer.h"
 #include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Default number of reusable messages for each Function.
+ */
+static const uint32 EPICSPV_DEFAULT_MESSAGE_POOL_SIZE = 4u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -62,6 +69,16 @@ EPICSPV::EPICSPV() :
     typeSize = 0u;
     changedPvVal = 0u;
     handlePVEventNthTime = 0u;
+    coalescingWindow = 0.0;
+    coalescingTicks = 0u;
+    lastEventDispatch = 0u;
+    eventPending = false;
+    messageTemplates = NULL_PTR(ConfigurationDatabase *);
+    numberOfMessageTemplates = 0u;
+    messagePool = NULL_PTR(ReferenceT<Message> *);
+    messagePoolSize = EPICSPV_DEFAULT_MESSAGE_POOL_SIZE;
+    functionMapKeys = NULL_PTR(int64 *);
+    functionMapKeysValid = NULL_PTR(bool *);
 
     ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
@@ -79,6 +96,18 @@ EPICSPV::~EPICSPV() {
     if (functionMap[1u] != NULL_PTR(StreamString *)) {
         delete[] functionMap[1u];
     }
+    if (messagePool != NULL_PTR(ReferenceT<Message> *)) {
+        delete[] messagePool;
+    }
+    if (messageTemplates != NULL_PTR(ConfigurationDatabase *)) {
+        delete[] messageTemplates;
+    }
+    if (functionMapKeys != NULL_PTR(int64 *)) {
+        delete[] functionMapKeys;
+    }
+    if (functionMapKeysValid != NULL_PTR(bool *)) {
+        delete[] functionMapKeysValid;
+    }
     if (pvMemory != NULL_PTR(void *)) {
         if (pvAnyType.GetTypeDescriptor().type == SString) {
             if (numberOfElements > 1u) {
@@ -271,6 +300,27 @@ bool EPICSPV::Initialise(StructuredDataI & data) {
                 }
             }
         }
+        if (ok) {
+            if (!data.Read("CoalescingWindow", coalescingWindow)) {
+                coalescingWindow = 0.0;
+            }
+            ok = (coalescingWindow >= 0.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "CoalescingWindow shall be >= 0s");
+            }
+            else {
+                coalescingTicks = static_cast<uint64>(coalescingWindow * static_cast<float64>(HighResolutionTimer::Frequency()));
+            }
+        }
+        if (ok) {
+            if (!data.Read("MessagePoolSize", messagePoolSize)) {
+                messagePoolSize = EPICSPV_DEFAULT_MESSAGE_POOL_SIZE;
+            }
+            ok = (messagePoolSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MessagePoolSize shall be > 0");
+            }
+        }
         (void) data.MoveToAncestor(1u);
     }
     else {
@@ -283,6 +333,103 @@ bool EPICSPV::Initialise(StructuredDataI & data) {
             pvAnyType.SetNumberOfElements(0u, numberOfElements);
         }
     }
+    if (ok) {
+        if (!(eventMode.notSet.operator bool())) {
+            ok = CreateMessageTemplates();
+        }
+    }
+    return ok;
+}
+
+bool EPICSPV::CreateMessageTemplates() {
+    bool ok = true;
+    bool isFunction = eventMode.function.operator bool();
+    bool isParameter = eventMode.parameter.operator bool();
+    bool isParameterName = eventMode.parameterName.operator bool();
+    if (isFunction) {
+        //Without FunctionMap the Function is the PV value and the message is built on every event
+        numberOfMessageTemplates = nOfFunctionMaps;
+    }
+    else if (eventMode.message.operator bool()) {
+        numberOfMessageTemplates = 0u;
+    }
+    else {
+        numberOfMessageTemplates = 1u;
+    }
+    if (numberOfMessageTemplates > 0u) {
+        messageTemplates = new ConfigurationDatabase[numberOfMessageTemplates];
+        messagePool = new ReferenceT<Message> [numberOfMessageTemplates * messagePoolSize];
+    }
+    uint32 t;
+    for (t = 0u; (t < numberOfMessageTemplates) && (ok); t++) {
+        ConfigurationDatabase &cdb = messageTemplates[t];
+        ok = cdb.Write("Destination", destination.Buffer());
+        if (ok) {
+            if (isFunction) {
+                ok = cdb.Write("Function", functionMap[1u][t].Buffer());
+            }
+            else {
+                ok = cdb.Write("Function", function.Buffer());
+            }
+        }
+        if ((isParameter) || (isParameterName)) {
+            if (ok) {
+                ok = cdb.CreateAbsolute("+Parameters");
+            }
+            if (ok) {
+                ok = cdb.Write("Class", "ConfigurationDatabase");
+            }
+            if (isParameterName) {
+                const char8 *objectName = GetName();
+                if (objectName == NULL_PTR(const char8 *)) {
+                    objectName = "";
+                }
+                if (ok) {
+                    ok = cdb.Write("param1", objectName);
+                }
+                if (ok) {
+                    ok = cdb.Write("param2", pvAnyType);
+                }
+            }
+            else {
+                if (ok) {
+                    ok = cdb.Write("param1", pvAnyType);
+                }
+            }
+        }
+        uint32 p;
+        for (p = 0u; (p < messagePoolSize) && (ok); p++) {
+            ok = cdb.MoveToRoot();
+            if (ok) {
+                ReferenceT<Message> message(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+                ok = message->Initialise(cdb);
+                messagePool[(t * messagePoolSize) + p] = message;
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not create the event messages");
+        }
+    }
+    bool isInteger = (pvAnyType.GetTypeDescriptor().type == SignedInteger) || (pvAnyType.GetTypeDescriptor().type == UnsignedInteger);
+    if ((ok) && (isFunction) && (nOfFunctionMaps > 0u) && (isInteger) && (numberOfElements == 1u)) {
+        functionMapKeys = new int64[nOfFunctionMaps];
+        functionMapKeysValid = new bool[nOfFunctionMaps];
+        uint32 i;
+        for (i = 0u; i < nOfFunctionMaps; i++) {
+            functionMapKeys[i] = 0;
+            AnyType keyAnyType(SignedInteger64Bit, 0u, &functionMapKeys[i]);
+            functionMapKeysValid[i] = TypeConvert(keyAnyType, functionMap[0u][i]);
+            //Only the keys that are the exact string representation of an integer can match the PV value
+            if (functionMapKeysValid[i]) {
+                StreamString keyStr;
+                AnyType keyStrAnyType(TypeDescriptor(false, SString, static_cast<uint16>(sizeof(StreamString) * 8u)), 0u, &keyStr);
+                functionMapKeysValid[i] = TypeConvert(keyStrAnyType, keyAnyType);
+                if (functionMapKeysValid[i]) {
+                    functionMapKeysValid[i] = (keyStr == functionMap[0u][i]);
+                }
+            }
+        }
+    }
     return ok;
 }
 
@@ -392,102 +539,146 @@ void EPICSPV::HandlePVEvent(struct event_handler_args const & args) {
                 (void) MemoryOperationsHelper::Copy(pvMemory, dbr, copySize);
             }
             if (!(eventMode.notSet.operator bool())) {
-                TriggerEventMessage();
+                eventPending = true;
+                uint64 now = HighResolutionTimer::Counter();
+                if ((now - lastEventDispatch) >= coalescingTicks) {
+                    DispatchEventMessage(now);
+                }
             }
         }
     }
 }
 
-void EPICSPV::TriggerEventMessage() {
-    ConfigurationDatabase cdb;
-    //if (handlePVEventNthTime == 0u) do not trigger an event so that we only react on value transitions.
+void EPICSPV::FlushEventMessage() {
+    if (eventPending) {
+        uint64 now = HighResolutionTimer::Counter();
+        if ((now - lastEventDispatch) >= coalescingTicks) {
+            DispatchEventMessage(now);
+        }
+    }
+}
+
+void EPICSPV::DispatchEventMessage(const uint64 now) {
+    //The first (connection) event does not trigger a message and thus does not start the coalescing window
     if (handlePVEventNthTime >= 1u) {
-        bool ok = true;
-        if (!eventMode.message.operator bool()) {
-            ok = cdb.Write("Destination", destination.Buffer());
+        lastEventDispatch = now;
+    }
+    eventPending = false;
+    TriggerEventMessage();
+}
 
-            if (eventMode.function.operator bool()) {
-                if (nOfFunctionMaps == 0u) {
-                    if (ok) {
-                        ok = cdb.Write("Function", pvAnyType);
-                    }
-                }
-                else {
-                    StreamString newValue;
-                    AnyType newValueAnyType(TypeDescriptor(false, SString, static_cast<uint16>(sizeof(StreamString) * 8u)), 0u, &newValue);
-                    if (TypeConvert(newValueAnyType, pvAnyType)) {
-                        StreamString functionMapValue = GetFunctionFromMap(newValue.Buffer());
-                        if (functionMapValue.Size() > 0u) {
-                            ok = cdb.Write("Function", functionMapValue.Buffer());
-                        }
-                        else {
-                            REPORT_ERROR(ErrorManagement::FatalError, "Could not find a mapping for key: %s", newValue.Buffer());
-                            ok = false;
-                        }
+bool EPICSPV::GetFunctionMapIndex(uint32 &index) const {
+    bool found = false;
+    uint32 i;
+    if (functionMapKeys != NULL_PTR(int64 *)) {
+        int64 value = 0;
+        AnyType valueAnyType(SignedInteger64Bit, 0u, &value);
+        if (TypeConvert(valueAnyType, pvAnyType)) {
+            for (i = 0u; (i < nOfFunctionMaps) && (!found); i++) {
+                if (functionMapKeysValid[i]) {
+                    found = (functionMapKeys[i] == value);
+                    if (found) {
+                        index = i;
                     }
                 }
             }
-            else if (eventMode.ignore.operator bool()) {
-                if (ok) {
-                    ok = cdb.Write("Function", function.Buffer());
+        }
+    }
+    else {
+        StreamString newValue;
+        AnyType newValueAnyType(TypeDescriptor(false, SString, static_cast<uint16>(sizeof(StreamString) * 8u)), 0u, &newValue);
+        if (TypeConvert(newValueAnyType, pvAnyType)) {
+            for (i = 0u; (i < nOfFunctionMaps) && (!found); i++) {
+                found = (functionMap[0u][i] == newValue);
+                if (found) {
+                    index = i;
                 }
             }
-            else if (eventMode.parameterName.operator bool()) {
-                if (ok) {
-                    ok = cdb.Write("Function", function.Buffer());
-                }
-                if (ok) {
-                    ok = cdb.CreateAbsolute("+Parameters");
-                }
-                if (ok) {
-                    ok = cdb.Write("Class", "ConfigurationDatabase");
-                }
-                if (ok) {
-                    ok = cdb.Write("param1", GetName());
-                }
-                if (ok) {
-                    ok = cdb.Write("param2", pvAnyType);
+        }
+    }
+    return found;
+}
+
+bool EPICSPV::GetEventMessage(const uint32 templateIdx,
+                              ReferenceT<Message> &message) {
+    uint32 p;
+    for (p = 0u; (p < messagePoolSize) && (!message.IsValid()); p++) {
+        ReferenceT<Message> &pooled = messagePool[(templateIdx * messagePoolSize) + p];
+        //If only the pool holds the message it is no longer in flight and can be reused
+        if (pooled.NumberOfReferences() == 1u) {
+            message = pooled;
+        }
+    }
+    bool ok = true;
+    if (!message.IsValid()) {
+        message = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = messageTemplates[templateIdx].MoveToRoot();
+        if (ok) {
+            ok = message->Initialise(messageTemplates[templateIdx]);
+        }
+    }
+    bool isParameter = eventMode.parameter.operator bool();
+    bool isParameterName = eventMode.parameterName.operator bool();
+    if ((ok) && ((isParameter) || (isParameterName))) {
+        const char8 * const valueKey = (isParameterName) ? ("param2") : ("param1");
+        ReferenceT<ConfigurationDatabase> parameters = message->Get(0u);
+        ok = parameters.IsValid();
+        if (ok) {
+            ok = parameters->MoveToRoot();
+        }
+        if (ok) {
+            ok = parameters->Delete(valueKey);
+        }
+        if (ok) {
+            ok = parameters->Write(valueKey, pvAnyType);
+        }
+    }
+    return ok;
+}
+
+void EPICSPV::TriggerEventMessage() {
+    //if (handlePVEventNthTime == 0u) do not trigger an event so that we only react on value transitions.
+    if (handlePVEventNthTime >= 1u) {
+        bool ok = true;
+        if (!eventMode.message.operator bool()) {
+            ReferenceT<Message> message;
+            if (numberOfMessageTemplates > 0u) {
+                uint32 templateIdx = 0u;
+                if (nOfFunctionMaps > 0u) {
+                    ok = GetFunctionMapIndex(templateIdx);
+                    if (!ok) {
+                        StreamString val;
+                        (void) val.Printf("%!", pvAnyType);
+                        REPORT_ERROR(ErrorManagement::FatalError, "Could not find a mapping for key: %s", val.Buffer());
+                    }
                 }
                 if (ok) {
-                    ok = cdb.MoveToAncestor(1u);
-                }
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "Could not create ConfigurationDatabase for message");
+                    ok = GetEventMessage(templateIdx, message);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Could not update the message parameters");
+                    }
                 }
             }
-            //Must be eventMode.parameter.operator bool()
+            //PVValue=Function without FunctionMap: the PV value is the Function
             else {
+                ConfigurationDatabase cdb;
+                ok = cdb.Write("Destination", destination.Buffer());
                 if (ok) {
-                    ok = cdb.Write("Function", function.Buffer());
-                }
-                if (ok) {
-                    ok = cdb.CreateAbsolute("+Parameters");
-                }
-                if (ok) {
-                    ok = cdb.Write("Class", "ConfigurationDatabase");
+                    ok = cdb.Write("Function", pvAnyType);
                 }
                 if (ok) {
-                    ok = cdb.Write("param1", pvAnyType);
-                }
-                if (ok) {
-                    ok = cdb.MoveToAncestor(1u);
-                }
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "Could not create ConfigurationDatabase for message");
+                    message = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+                    ok = message->Initialise(cdb);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Could not Initialise message");
+                    }
                 }
             }
             if (ok) {
-                ReferenceT<Message> message(GlobalObjectsDatabase::Instance()->GetStandardHeap());
-                ok = message->Initialise(cdb);
-                if (ok) {
-                    if (MessageI::SendMessage(message, this) != ErrorManagement::NoError) {
-                        StreamString val;
-                        (void) val.Printf("%!", pvAnyType);
-                        REPORT_ERROR(ErrorManagement::FatalError, "Could not send message to %s with value %s", destination.Buffer(), val.Buffer());
-                    }
-                }
-                else {
-                    REPORT_ERROR(ErrorManagement::FatalError, "Could not Initialise message");
+                if (MessageI::SendMessage(message, this) != ErrorManagement::NoError) {
+                    StreamString val;
+                    (void) val.Printf("%!", pvAnyType);
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not send message to %s with value %s", destination.Buffer(), val.Buffer());
                 }
             }
         }
@@ -633,6 +824,14 @@ uint32 EPICSPV::GetMemorySize() const {
     return memorySize;
 }
 
+float64 EPICSPV::GetCoalescingWindow() const {
+    return coalescingWindow;
+}
+
+uint32 EPICSPV::GetMessagePoolSize() const {
+    return messagePoolSize;
+}
+
 CLASS_REGISTER(EPICSPV, "1.0")
 /*lint -e{1023} There is no ambiguity on the function to be called as the compiler can distinguish between both template definitions.*/
 CLASS_METHOD_REGISTER(EPICSPV, CAPut)
@@ -34,6 +34,8 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "Message.h"
 #include "MessageI.h"
 #include "Object.h"
 #include "StreamString.h"
@@ -74,6 +76,8 @@ namespace MARTe {
  *                        //If Ignore, the PV value will not be used and the Function will always be called.
  *      Function = STOP //Compulsory if PVValue=Parameter, PVValue=ParameterName or PVValue=Ignore. Shall not be set if FunctionMap is defined or if PVValue=Function.
  *      FunctionMap = {{"1", "RUN"}, {"0", "STOP"}} //Optional Nx2 matrix. Only allowed if PVValue == Function. If defined then the PV value (first column of the matrix) will be used to map the Function name (second column of the matrix).
+ *      CoalescingWindow = 0.1 //Optional. Minimum time in seconds between two triggered messages. The PV updates received inside the window are coalesced and only the latest value is sent (see FlushEventMessage). Default value is 0 (every update triggers a message).
+ *      MessagePoolSize = 4 //Optional but if set shall be > 0. Number of reusable messages pre-built for each Function (see below). Default value is 4.
  *   }
  *   AMessage = {  //Only if the PVValue = Message
  *      Class = Message
@@ -93,6 +97,12 @@ namespace MARTe {
  * The CAPut and CAGet class methods are registered as call-backs. The parameter to put/get shall be encoded as "param1" in a StructuredDataI attached to the message.
  *
  * If the Event section is defined the Messages triggered will have the Function defined as above and the parameter (if set) will be written with the key "param1".
+ *
+ * With PVValue=Parameter, PVValue=ParameterName, PVValue=Ignore and PVValue=Function with a FunctionMap, the messages are pre-built in Initialise: a
+ * template and a pool of MessagePoolSize messages for each Function (i.e. for each FunctionMap entry). On every event only the PV value is updated
+ * in a pooled message which is not in flight (i.e. which is only referenced by the pool). If all the pooled messages are in flight (e.g. still queued
+ * at the destination) a new message is created from the template. With PVValue=Function and no FunctionMap the message is built on every event.
+ * For integer scalar PVs the FunctionMap keys are converted to integers in Initialise, so that the mapping does not require a string conversion.
  */
 class EPICSPV: public ReferenceContainer, public MessageI {
 public:
@@ -286,14 +296,60 @@ public:
      */
     uint32 GetMemorySize() const;
 
+    /**
+     * @brief Sends the latest coalesced PV value if an event is pending and the CoalescingWindow has elapsed since the last triggered message.
+     * @details Called periodically by the EPICSCAClient, so that the last update of a burst is not lost.
+     */
+    void FlushEventMessage();
+
+    /**
+     * @brief Gets the CoalescingWindow.
+     * @return the CoalescingWindow in seconds (0 if the updates are not coalesced).
+     */
+    float64 GetCoalescingWindow() const;
+
+    /**
+     * @brief Gets the number of reusable messages pre-built for each Function.
+     * @return the number of reusable messages pre-built for each Function.
+     */
+    uint32 GetMessagePoolSize() const;
+
 private:
 
     /**
      * @brief Triggers the sending of a Message with the rules defined in the class description.
-     * @param[in] newValue the value to be sent (either as the Function name or the Function parameter).
      */
     void TriggerEventMessage();
 
+    /**
+     * @brief Calls TriggerEventMessage and restarts the CoalescingWindow.
+     * @param[in] now the HighResolutionTimer counter.
+     */
+    void DispatchEventMessage(const uint64 now);
+
+    /**
+     * @brief Builds the message templates and the pools of reusable messages.
+     * @return true if all the messages can be initialised.
+     */
+    bool CreateMessageTemplates();
+
+    /**
+     * @brief Gets the FunctionMap row matching the current PV value.
+     * @param[out] index the matching row.
+     * @return true if a matching row was found.
+     */
+    bool GetFunctionMapIndex(uint32 &index) const;
+
+    /**
+     * @brief Gets a message for the template \a templateIdx with the current PV value.
+     * @details Returns a pooled message which is not in flight or, if all are in flight, a new message initialised from the template.
+     * @param[in] templateIdx the template index.
+     * @param[out] message the message to be sent.
+     * @return true if the message parameters could be updated.
+     */
+    bool GetEventMessage(const uint32 templateIdx,
+                         ReferenceT<Message> &message);
+
     /**
      * The EPICS client context.
      */
@@ -384,6 +440,56 @@ private:
      */
     uint8 handlePVEventNthTime;
 
+    /**
+     * The minimum time between two triggered messages, in seconds.
+     */
+    float64 coalescingWindow;
+
+    /**
+     * The coalescingWindow in HighResolutionTimer ticks.
+     */
+    uint64 coalescingTicks;
+
+    /**
+     * The HighResolutionTimer counter when the last message was triggered.
+     */
+    uint64 lastEventDispatch;
+
+    /**
+     * True if a PV update was received and not yet sent.
+     */
+    bool eventPending;
+
+    /**
+     * One template for each Function (see CreateMessageTemplates).
+     */
+    ConfigurationDatabase *messageTemplates;
+
+    /**
+     * The number of message templates.
+     */
+    uint32 numberOfMessageTemplates;
+
+    /**
+     * messagePoolSize reusable messages for each template.
+     */
+    ReferenceT<Message> *messagePool;
+
+    /**
+     * The number of reusable messages for each template.
+     */
+    uint32 messagePoolSize;
+
+    /**
+     * The FunctionMap keys converted to integers (only for integer scalar PVs).
+     */
+    int64 *functionMapKeys;
+
+    /**
+     * False if the FunctionMap key cannot be the string representation of an integer.
+     */
+    bool *functionMapKeysValid;
+
 };
 
 }
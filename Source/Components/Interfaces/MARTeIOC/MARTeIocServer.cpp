@@ -47,6 +47,25 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Minimum number of slots of the PV hash index.
+ */
+const MARTe::uint32 PV_INDEX_MIN_SIZE = 64u;
+
+/**
+ * @brief FNV-1a hash of the first \a nameLength characters of \a pvName.
+ */
+MARTe::uint32 PvNameHash(const MARTe::char8 * const pvName,
+                         const MARTe::uint32 nameLength) {
+    MARTe::uint32 hash = 2166136261u;
+    for (MARTe::uint32 i = 0u; i < nameLength; i++) {
+        hash ^= static_cast<MARTe::uint8>(pvName[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -69,6 +88,11 @@ MARTeIocServer::MARTeIocServer() :
 
     cpuMask = 0u;
     numberOfPVs = 0u;
+    pvIndex = NULL_PTR(ReferenceT<MARTePv> *);
+    pvIndexHashes = NULL_PTR(uint32 *);
+    pvIndexSize = 0u;
+    numberOfIndexedPVs = 0u;
+    pvIndexSem.Create();
 }
 
 /*lint -e{1551} No exception thrown.*/
@@ -78,6 +102,12 @@ MARTeIocServer::~MARTeIocServer() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
+    if (pvIndex != NULL_PTR(ReferenceT<MARTePv> *)) {
+        delete[] pvIndex;
+    }
+    if (pvIndexHashes != NULL_PTR(uint32 *)) {
+        delete[] pvIndexHashes;
+    }
 }
 
 bool MARTeIocServer::Initialise(StructuredDataI &data) {
@@ -99,13 +129,25 @@ bool MARTeIocServer::Initialise(StructuredDataI &data) {
     }
 
     if (ret) {
-        for (uint32 i = 0u; i < Size(); i++) {
+        ret = static_cast<bool>(pvIndexSem.FastLock());
+    }
+    if (ret) {
+        for (uint32 i = 0u; (i < Size()) && (ret); i++) {
             ReferenceT<MARTePv> pvChild = Get(i);
             if (pvChild.IsValid()) {
                 pvChild->SetIocServer(*this);
-                numberOfPVs++;
+                ret = IndexInsert(pvChild);
+                if (ret) {
+                    numberOfPVs++;
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Could not index the PV %s", pvChild->GetName());
+                }
             }
         }
+        pvIndexSem.FastUnLock();
+    }
+    if (ret) {
 
         REPORT_ERROR(ErrorManagement::Information, "Loaded %d Process Variables.", numberOfPVs);
     }
@@ -119,14 +161,7 @@ pvExistReturn MARTeIocServer::pvExistTest(const casCtx & ctx,
                                           const char8 * pPVAliasName) {
 
     pvExistReturn ret = pverDoesNotExistHere;
-    uint32 len=StringHelper::Length(pPVAliasName);
-    StreamString pvName=pPVAliasName;
-
-    if(StringHelper::Compare(&pPVAliasName[len-4u], ".VAL")==0){
-        /*lint -e{9123} needed cast to larger type*/
-        (void)pvName.SetSize(static_cast<uint64>(len-4u));
-    }
-    ReferenceT<MARTePv> pv = Find(pvName.Buffer());
+    ReferenceT<MARTePv> pv = FindPv(pPVAliasName);
     if (pv.IsValid()) {
         ret = pverExistsHere;
     }
@@ -144,14 +179,7 @@ pvAttachReturn MARTeIocServer::pvAttach(const casCtx &ctx,
     /*lint -e{9130} depends on external library*/
     pvAttachReturn ret = static_cast<caStatus>(S_casApp_pvNotFound);
 
-    uint32 len=StringHelper::Length(pPVAliasName);
-    StreamString pvName=pPVAliasName;
-
-    if(StringHelper::Compare(&pPVAliasName[len-4u], ".VAL")==0){
-        /*lint -e{9123} needed cast to larger type*/
-        (void)pvName.SetSize(static_cast<uint64>(len-4u));
-    }
-    ReferenceT<MARTePv> pv = Find(pvName.Buffer());
+    ReferenceT<MARTePv> pv = FindPv(pPVAliasName);
     if (pv.IsValid()) {
         /*lint -e{64} not a type mismatch error because pvAttachReturn has a
          * constructor from casPV
@@ -172,7 +200,7 @@ caStatus MARTeIocServer::IocWrite(const char8 * const pvNameIn,
                                   const AnyType &value) {
 
     caStatus status = static_cast<caStatus>(S_casApp_success);
-    ReferenceT<MARTePv> pv = Find(pvNameIn);
+    ReferenceT<MARTePv> pv = FindPv(pvNameIn);
     if (pv.IsValid()) {
         status = pv->WriteDirect(value);
     }
@@ -182,7 +210,7 @@ caStatus MARTeIocServer::IocWrite(const char8 * const pvNameIn,
 caStatus MARTeIocServer::IocRead(const char8 * const pvNameIn,
                                  const AnyType &value) {
     caStatus status = static_cast<caStatus>(S_casApp_success);
-    ReferenceT<MARTePv> pv = Find(pvNameIn);
+    ReferenceT<MARTePv> pv = FindPv(pvNameIn);
     if (pv.IsValid()) {
         status = pv->ReadDirect(value);
     }
@@ -192,11 +220,29 @@ caStatus MARTeIocServer::IocRead(const char8 * const pvNameIn,
 bool MARTeIocServer::IocAddPv(Reference newPvIn) {
     ReferenceT<MARTePv> newPv = newPvIn;
     bool ret = newPv.IsValid();
+    if (ret) {
+        ret = static_cast<bool>(pvIndexSem.FastLock());
+    }
+    if (ret) {
+        ret = IndexInsert(newPv);
+        pvIndexSem.FastUnLock();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not index the PV %s (is the name already used?)", newPv->GetName());
+        }
+    }
     if (ret) {
         newPv->SetIocServer(*this);
     }
     if (ret) {
         ret = ReferenceContainer::Insert(newPv);
+        if (!ret) {
+            const char8 * const pvName = newPv->GetName();
+            uint32 nameLength = StringHelper::Length(pvName);
+            if (static_cast<bool>(pvIndexSem.FastLock())) {
+                IndexRemove(IndexSlot(pvName, nameLength, PvNameHash(pvName, nameLength)));
+                pvIndexSem.FastUnLock();
+            }
+        }
     }
     if (ret) {
         numberOfPVs++;
@@ -205,6 +251,12 @@ bool MARTeIocServer::IocAddPv(Reference newPvIn) {
 }
 
 bool MARTeIocServer::IocRemovePv(const char8 * const pvName) {
+    uint32 nameLength = StringHelper::Length(pvName);
+    uint32 hash = PvNameHash(pvName, nameLength);
+    if (static_cast<bool>(pvIndexSem.FastLock())) {
+        IndexRemove(IndexSlot(pvName, nameLength, hash));
+        pvIndexSem.FastUnLock();
+    }
     bool ret = ReferenceContainer::Delete(pvName);
     if (ret) {
         numberOfPVs--;
@@ -216,6 +268,139 @@ uint32 MARTeIocServer::GetNumberOfPVs() const {
     return numberOfPVs;
 }
 
+ReferenceT<MARTePv> MARTeIocServer::FindPv(const char8 * const pvNameIn) {
+    ReferenceT<MARTePv> pv;
+    uint32 nameLength = 0u;
+    if (pvNameIn != NULL_PTR(const char8 *)) {
+        while ((pvNameIn[nameLength] != '\0') && (pvNameIn[nameLength] != '.')) {
+            nameLength++;
+        }
+        uint32 hash = PvNameHash(pvNameIn, nameLength);
+        if (static_cast<bool>(pvIndexSem.FastLock())) {
+            uint32 slot = IndexSlot(pvNameIn, nameLength, hash);
+            if (slot < pvIndexSize) {
+                pv = pvIndex[slot];
+            }
+            pvIndexSem.FastUnLock();
+        }
+    }
+    if (pv.IsValid()) {
+        /*lint -e{613} pvNameIn cannot be NULL if pv is valid*/
+        if (pvNameIn[nameLength] == '.') {
+            const char8 * const fieldName = &pvNameIn[nameLength + 1u];
+            if (StringHelper::Compare(fieldName, "VAL") != 0) {
+                ReferenceT<MARTePv> pvField;
+                uint32 numberOfFields = pv->Size();
+                for (uint32 i = 0u; (i < numberOfFields) && (!pvField.IsValid()); i++) {
+                    ReferenceT<MARTePv> field = pv->Get(i);
+                    if (field.IsValid()) {
+                        const char8 * const name = field->GetName();
+                        if (name != NULL_PTR(const char8 *)) {
+                            if (StringHelper::Compare(name, fieldName) == 0) {
+                                pvField = field;
+                            }
+                        }
+                    }
+                }
+                pv = pvField;
+            }
+        }
+    }
+    return pv;
+}
+
+uint32 MARTeIocServer::IndexSlot(const char8 * const pvName,
+                                 const uint32 nameLength,
+                                 const uint32 hash) const {
+    uint32 slot = pvIndexSize;
+    if (pvIndexSize > 0u) {
+        uint32 mask = pvIndexSize - 1u;
+        uint32 i = hash & mask;
+        /* The index is never more than half full, so an empty slot terminates the probe sequence */
+        while (pvIndex[i].IsValid() && (slot == pvIndexSize)) {
+            if (pvIndexHashes[i] == hash) {
+                const char8 * const name = pvIndex[i]->GetName();
+                if (StringHelper::CompareN(name, pvName, nameLength) == 0) {
+                    if (name[nameLength] == '\0') {
+                        slot = i;
+                    }
+                }
+            }
+            i = (i + 1u) & mask;
+        }
+    }
+    return slot;
+}
+
+bool MARTeIocServer::IndexInsert(const ReferenceT<MARTePv> &pv) {
+    const char8 * const pvName = pv->GetName();
+    bool ret = (pvName != NULL_PTR(const char8 *));
+    uint32 nameLength = 0u;
+    uint32 hash = 0u;
+    if (ret) {
+        nameLength = StringHelper::Length(pvName);
+        hash = PvNameHash(pvName, nameLength);
+        ret = (IndexSlot(pvName, nameLength, hash) == pvIndexSize);
+    }
+    if (ret) {
+        if ((2u * (numberOfIndexedPVs + 1u)) > pvIndexSize) {
+            uint32 newSize = (pvIndexSize > 0u) ? (2u * pvIndexSize) : (PV_INDEX_MIN_SIZE);
+            ReferenceT<MARTePv> *newIndex = new ReferenceT<MARTePv> [newSize];
+            uint32 *newHashes = new uint32[newSize];
+            uint32 newMask = newSize - 1u;
+            for (uint32 i = 0u; i < pvIndexSize; i++) {
+                if (pvIndex[i].IsValid()) {
+                    uint32 j = pvIndexHashes[i] & newMask;
+                    while (newIndex[j].IsValid()) {
+                        j = (j + 1u) & newMask;
+                    }
+                    newIndex[j] = pvIndex[i];
+                    newHashes[j] = pvIndexHashes[i];
+                }
+            }
+            if (pvIndex != NULL_PTR(ReferenceT<MARTePv> *)) {
+                delete[] pvIndex;
+            }
+            if (pvIndexHashes != NULL_PTR(uint32 *)) {
+                delete[] pvIndexHashes;
+            }
+            pvIndex = newIndex;
+            pvIndexHashes = newHashes;
+            pvIndexSize = newSize;
+        }
+        uint32 mask = pvIndexSize - 1u;
+        uint32 i = hash & mask;
+        while (pvIndex[i].IsValid()) {
+            i = (i + 1u) & mask;
+        }
+        pvIndex[i] = pv;
+        pvIndexHashes[i] = hash;
+        numberOfIndexedPVs++;
+    }
+    return ret;
+}
+
+void MARTeIocServer::IndexRemove(uint32 slot) {
+    if (slot < pvIndexSize) {
+        uint32 mask = pvIndexSize - 1u;
+        uint32 hole = slot;
+        pvIndex[hole].RemoveReference();
+        uint32 i = (hole + 1u) & mask;
+        /* Backward shift deletion: move back the entries whose probe sequence crosses the hole */
+        while (pvIndex[i].IsValid()) {
+            uint32 home = pvIndexHashes[i] & mask;
+            if (((i - home) & mask) >= ((i - hole) & mask)) {
+                pvIndex[hole] = pvIndex[i];
+                pvIndexHashes[hole] = pvIndexHashes[i];
+                pvIndex[i].RemoveReference();
+                hole = i;
+            }
+            i = (i + 1u) & mask;
+        }
+        numberOfIndexedPVs--;
+    }
+}
+
 CLASS_REGISTER(MARTeIocServer, "1.0")
 
 }
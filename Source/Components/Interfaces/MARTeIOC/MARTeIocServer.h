@@ -36,6 +36,7 @@
 /*---------------------------------------------------------------------------*/
 #include "ReferenceT.h"
 #include "ReferenceContainer.h"
+#include "FastPollingMutexSem.h"
 #include "StreamString.h"
 #include "Threads.h"
 #include "EmbeddedServiceMethodBinderI.h"
@@ -50,12 +51,18 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+class MARTePv;
 
 /**
  * @brief MARTe implementation of EPICS IOC server.
  *
  * @details This interface allows MARTe to publish PVs to EPICS. It is a container of MARTePv objects.
  *
+ * @details The PVs are indexed by name in an open addressing hash table, which is built in Initialise and kept
+ * up to date by IocAddPv and IocRemovePv (PVs must not be inserted or removed with the ReferenceContainer methods).
+ * The PV name lookups of pvExistTest, pvAttach, IocRead and IocWrite do not allocate memory and accept an optional
+ * field suffix (e.g. jane.VAL refers to the PV jane and jane.HOPR to its HOPR field).
+ *
  * @details Follows an example of configuration:
  * <pre>
  * MARTeIoc = {
@@ -136,7 +143,7 @@ public:
     /**
      * @brief Adds a PV to the IOC.
      * @param[in] newPvIn the Reference (must be a ReferenceT<MARTePv>) to the PV to be added.
-     * @return true if the PV is added successfully, false otherwise.
+     * @return true if the PV is added successfully, false otherwise (including if a PV with the same name already exists).
      */
     bool IocAddPv(Reference newPvIn);
 
@@ -152,8 +159,39 @@ public:
      * @return the number of PVs.
      */
     uint32 GetNumberOfPVs() const;
+
+    /**
+     * @brief Finds a PV by name using the hash index.
+     * @details The name may be followed by a field suffix: .VAL refers to the PV itself, any other suffix to the
+     * field of the PV with that name.
+     * @param[in] pvNameIn the name of the PV.
+     * @return a valid reference to the PV (or to the PV field) if found, an invalid reference otherwise.
+     */
+    ReferenceT<MARTePv> FindPv(const char8 * const pvNameIn);
 private:
 
+    /**
+     * @brief Returns the index slot holding the PV named as the first \a nameLength characters of \a pvName.
+     * @details Shall be called with pvIndexSem locked.
+     * @return the slot or pvIndexSize if the PV is not indexed.
+     */
+    uint32 IndexSlot(const char8 * const pvName,
+                     const uint32 nameLength,
+                     const uint32 hash) const;
+
+    /**
+     * @brief Adds \a pv to the index, growing it if it is more than half full.
+     * @details Shall be called with pvIndexSem locked.
+     * @return false if a PV with the same name is already indexed.
+     */
+    bool IndexInsert(const ReferenceT<MARTePv> &pv);
+
+    /**
+     * @brief Empties the index \a slot, moving back the entries of the same probe sequence.
+     * @details Shall be called with pvIndexSem locked.
+     */
+    void IndexRemove(uint32 slot);
+
     /**
      * The cpu mask where the internal thread shall be executed
      */
@@ -169,6 +207,31 @@ private:
      */
     SingleThreadService executor;
 
+    /**
+     * The PV hash index (open addressing with linear probing, pvIndexSize slots)
+     */
+    ReferenceT<MARTePv> *pvIndex;
+
+    /**
+     * The hash of the name of the PV in each slot of pvIndex
+     */
+    uint32 *pvIndexHashes;
+
+    /**
+     * The number of slots of pvIndex (power of two)
+     */
+    uint32 pvIndexSize;
+
+    /**
+     * The number of PVs in pvIndex
+     */
+    uint32 numberOfIndexedPVs;
+
+    /**
+     * Protects the PV hash index
+     */
+    FastPollingMutexSem pvIndexSem;
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -51,6 +51,7 @@ MemoryGate::MemoryGate() :
     spinlocksWrite = NULL_PTR(FastPollingMutexSem *);
     whatIsNewestCounter = NULL_PTR(uint32 *);
     whatIsNewestGlobCounter = 0u;
+    newestBuffer = 0;
 }
 
 MemoryGate::~MemoryGate() {
@@ -164,89 +165,86 @@ bool MemoryGate::SetMemorySize(uint32 size) {
 }
 
 bool MemoryGate::MemoryRead(uint8 * const bufferToFill) {
-    //get input offset
-    bool ok = false;
-    uint64 checkedMask = 0ull;
+    const uint8 *buffer = NULL_PTR(const uint8 *);
     uint32 bufferIdx = 0u;
+    bool ok = MemoryBorrow(buffer, bufferIdx);
+    //copy the memory to the data source buffer
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(bufferToFill, buffer, memSize);
+        (void) MemoryRelease(bufferIdx);
+    }
+
+    return ok;
+}
 
-    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-        //check the last written
-        bufferIdx = 0u;
-        uint32 max = 0u;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
+bool MemoryGate::MemoryBorrow(const uint8 *&buffer,
+                              uint32 &bufferIdx) {
+    bool ok = (mem != NULL_PTR(uint8 *));
+    if (ok) {
+        ok = false;
+        //the last written first, then the ones written before it
+        uint32 newest = static_cast<uint32>(newestBuffer);
+        for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
+            bufferIdx = (((newest + numberOfBuffers) - k) % numberOfBuffers);
+            //a writer is not copying on it
             /*lint -e{613} NULL pointer checked.*/
-            if (spinlocksWrite[h].FastTryLock()) {
+            if (spinlocksWrite[bufferIdx].FastTryLock()) {
                 /*lint -e{613} NULL pointer checked.*/
-                uint32 tempMax = whatIsNewestCounter[h];
+                Atomic::Increment(&spinlocksRead[bufferIdx]);
                 /*lint -e{613} NULL pointer checked.*/
-                spinlocksWrite[h].FastUnLock();
-                if ((tempMax >= max) && (((1ull << h) & checkedMask) == 0u)) {
-                    max = tempMax;
-                    bufferIdx = h;
-                }
+                spinlocksWrite[bufferIdx].FastUnLock();
+                ok = true;
             }
         }
-
-        checkedMask |= (1ull << bufferIdx);
-        ok = false;
-        //try to lock the next buffer to write
-        /*lint -e{613} NULL pointer checked.*/
-        if (spinlocksWrite[bufferIdx].FastTryLock()) {
-            /*lint -e{613} NULL pointer checked.*/
-            Atomic::Increment(&spinlocksRead[bufferIdx]);
-            /*lint -e{613} NULL pointer checked.*/
-            spinlocksWrite[bufferIdx].FastUnLock();
-            ok = true;
-        }
     }
-    //copy the memory to the data source buffer
     if (ok) {
         uint32 offset = (memSize * bufferIdx);
         /*lint -e{613} NULL pointer checked.*/
-        ok = MemoryOperationsHelper::Copy(bufferToFill, &mem[offset], memSize);
+        buffer = &mem[offset];
     }
 
+    return ok;
+}
+
+bool MemoryGate::MemoryRelease(const uint32 bufferIdx) {
+    bool ok = (bufferIdx < numberOfBuffers) && (spinlocksRead != NULL_PTR(volatile int32 *));
     if (ok) {
         /*lint -e{613} NULL pointer checked.*/
         Atomic::Decrement(&spinlocksRead[bufferIdx]);
-        //REPORT_ERROR(ErrorManagement::Information, "buffer read=%d", bufferIdx);
-
     }
-
     return ok;
 }
 
+const uint8 *MemoryGate::GetBuffersMemory() const {
+    return mem;
+}
+
+uint32 MemoryGate::GetNumberOfBuffers() const {
+    return numberOfBuffers;
+}
+
 bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
 
-    bool ok = false;
+    bool ok = (mem != NULL_PTR(uint8 *));
     uint32 bufferIdx = 0u;
-    uint64 checkedMask = 0ull;
-    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-        //check the oldest written
-        uint32 min = 0xFFFFFFFFu;
-        bufferIdx = 0u;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            uint32 index = h;
-            /*lint -e{613} NULL pointer checked.*/
-            uint32 tempMin = whatIsNewestCounter[index];
-            if ((tempMin < min) && (((1ull << h) & checkedMask) == 0ull)) {
-                min = tempMin;
-                bufferIdx = h;
-            }
-        }
-        checkedMask |= (1ull << bufferIdx);
+    if (ok) {
         ok = false;
-        //try to lock the next buffer to write
-        /*lint -e{613} NULL pointer checked.*/
-        if (spinlocksWrite[bufferIdx].FastTryLock()) {
-            //no readers!
+        //the oldest is the one after the last written
+        uint32 newest = static_cast<uint32>(newestBuffer);
+        for (uint32 k = 1u; (k <= numberOfBuffers) && (!ok); k++) {
+            bufferIdx = ((newest + k) % numberOfBuffers);
+            //try to lock the next buffer to write
             /*lint -e{613} NULL pointer checked.*/
-            if (spinlocksRead[bufferIdx] == 0) {
-                ok = true;
-            }
-            else {
+            if (spinlocksWrite[bufferIdx].FastTryLock()) {
+                //no readers!
                 /*lint -e{613} NULL pointer checked.*/
-                spinlocksWrite[bufferIdx].FastUnLock();
+                if (spinlocksRead[bufferIdx] == 0) {
+                    ok = true;
+                }
+                else {
+                    /*lint -e{613} NULL pointer checked.*/
+                    spinlocksWrite[bufferIdx].FastUnLock();
+                }
             }
         }
     }
@@ -256,11 +254,13 @@ bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
         uint32 offset = (memSize * bufferIdx);
         /*lint -e{613} NULL pointer checked.*/
         ok = MemoryOperationsHelper::Copy(&mem[offset], bufferToFlush, memSize);
+        if (!ok) {
+            /*lint -e{613} NULL pointer checked.*/
+            spinlocksWrite[bufferIdx].FastUnLock();
+        }
     }
 
     if (ok) {
-        //REPORT_ERROR(ErrorManagement::Information, "buffer write=%d", bufferIdx);
-
         whatIsNewestGlobCounter++;
         /*lint -e{613} NULL pointer checked.*/
         whatIsNewestCounter[bufferIdx] = whatIsNewestGlobCounter;
@@ -296,6 +296,8 @@ bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
             /*lint -e{613} NULL pointer checked.*/
             whatIsNewestCounter[bufferIdx] -= min;
         }
+        //publish it as the newest before letting the readers in
+        (void) Atomic::Exchange(&newestBuffer, static_cast<int32>(bufferIdx));
         /*lint -e{613} NULL pointer checked.*/
         spinlocksWrite[bufferIdx].FastUnLock();
     }
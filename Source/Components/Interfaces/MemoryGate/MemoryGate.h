@@ -51,6 +51,13 @@ namespace MARTe{
  * @details The writers call the function MemoryWrite() that will flush the input buffer to the oldest written available buffer. If all
  * the buffers are busy by readers or other writers, the MemoryWrite() returns false.
  *
+ * @details The index of the last written buffer is published atomically at the end of each write, so that readers find it
+ * in constant time. Writers fill the buffers in round-robin order starting after the last written one, which is then also the
+ * oldest one. Only if a buffer is busy the next ones (in write order) are tried.
+ *
+ * @details Readers that do not need a private copy can call MemoryBorrow() to access the last written buffer in place. The buffer
+ * cannot be written until it is given back with MemoryRelease(). The address of all the buffers is returned by GetBuffersMemory().
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -117,6 +124,36 @@ public:
      */
     virtual bool MemoryWrite(const uint8 * const bufferToFlush);
 
+    /**
+     * @brief Gives direct access to the last written available buffer.
+     * @details The buffer is protected from writers until MemoryRelease() is called with the returned \a bufferIdx.
+     * The buffer shall not be modified.
+     * @param[out] buffer the address of the borrowed buffer.
+     * @param[out] bufferIdx the index of the borrowed buffer (to be passed to MemoryRelease()).
+     * @return true if at least one buffer is available, false otherwise.
+     */
+    virtual bool MemoryBorrow(const uint8 *&buffer,
+                              uint32 &bufferIdx);
+
+    /**
+     * @brief Gives back a buffer borrowed with MemoryBorrow().
+     * @param[in] bufferIdx the index returned by MemoryBorrow().
+     * @return true if \a bufferIdx is a valid buffer index.
+     */
+    virtual bool MemoryRelease(const uint32 bufferIdx);
+
+    /**
+     * @brief Returns the address of the memory of all the buffers, where the buffer i starts at i * memory size.
+     * @details Allows the readers that use MemoryBorrow() to precompute the address of the data inside any buffer.
+     * @return the address of the buffers memory or NULL if the memory is not allocated or if the buffers cannot be borrowed.
+     */
+    virtual const uint8 *GetBuffersMemory() const;
+
+    /**
+     * @brief Gets the number of buffers.
+     * @return the number of buffers.
+     */
+    uint32 GetNumberOfBuffers() const;
 
 protected:
 
@@ -155,6 +192,11 @@ protected:
      */
     uint32 whatIsNewestGlobCounter;
 
+    /**
+     * The index of the last written buffer. Published atomically by the writers.
+     */
+    volatile int32 newestBuffer;
+
     /**
      * Stores the signal offset in case of more write operations.
      */
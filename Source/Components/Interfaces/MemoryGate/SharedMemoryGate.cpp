@@ -0,0 +1,525 @@
+/**
+ * @file SharedMemoryGate.cpp
+ * @brief Source file for class SharedMemoryGate
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGate (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "SharedMemoryGate.h"
+#include "Sleep.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Identifies a shared memory created by a SharedMemoryGate.
+ */
+static const uint32 SHARED_MEMORY_GATE_MAGIC = 0x4D474154u;
+
+/**
+ * Maximum number of buffers (same as the MemoryGate).
+ */
+static const uint32 SHARED_MEMORY_GATE_MAX_BUFFERS = 64u;
+
+/**
+ * Number of times MemoryRead tries to get a consistent copy before failing.
+ */
+static const uint32 SHARED_MEMORY_GATE_READ_RETRIES = 16u;
+
+/**
+ * The buffers start at a cache line boundary after the header.
+ */
+static const uint32 SHARED_MEMORY_GATE_ALIGNMENT = 64u;
+
+/*lint -e{9130} the mode argument of shm_open is defined as int and it can not be changed*/
+static const mode_t SHARED_MEMORY_GATE_OPEN_MODE = (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+
+/**
+ * @brief Control block at the beginning of the shared memory.
+ */
+struct SharedMemoryGateHeader {
+    /**
+     * SHARED_MEMORY_GATE_MAGIC once the owner has initialised the shared memory.
+     */
+    volatile uint32 magic;
+
+    /**
+     * The number of buffers declared by the owner.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * The size of each buffer declared by the owner.
+     */
+    uint32 memSize;
+
+    /**
+     * Process identifier of the owner.
+     */
+    volatile int32 ownerPid;
+
+    /**
+     * Process identifier of the process which is writing (0 if no process is writing).
+     */
+    volatile int32 writeLock;
+
+    /**
+     * Index of the last published buffer.
+     */
+    volatile uint32 newestBuffer;
+
+    /**
+     * Number of published buffers.
+     */
+    volatile uint32 generation;
+
+    /**
+     * Seqlock sequence number of each buffer. Odd while the buffer is being written.
+     */
+    volatile uint32 sequence[SHARED_MEMORY_GATE_MAX_BUFFERS];
+};
+
+/*lint -estring(526,__sync_synchronize) -estring(628,__sync_synchronize) -estring(746,__sync_synchronize) -estring(1055,__sync_synchronize) The __sync_synchronize function is a GCC built-in function, so it does not have declaration.*/
+/**
+ * @brief Full memory barrier between the accesses to the sequence numbers and to the buffers.
+ */
+static inline void SharedMemoryGateBarrier() {
+    __sync_synchronize();
+}
+
+/*lint -estring(526,__sync_bool_compare_and_swap) -estring(628,__sync_bool_compare_and_swap) -estring(746,__sync_bool_compare_and_swap) -estring(1055,__sync_bool_compare_and_swap) GCC built-in function.*/
+/**
+ * @brief Atomically sets the writeLock to newValue if it is equal to oldValue.
+ */
+static inline bool SharedMemoryGateCompareAndSwap(volatile int32 * const writeLock,
+                                                  const int32 oldValue,
+                                                  const int32 newValue) {
+    return __sync_bool_compare_and_swap(writeLock, oldValue, newValue);
+}
+
+/**
+ * @brief Checks if a process no longer exists.
+ */
+static bool SharedMemoryGateIsProcessDead(const int32 pid) {
+    bool dead = false;
+    if (pid > 0) {
+        if (kill(static_cast<pid_t>(pid), 0) != 0) {
+            dead = (errno == ESRCH);
+        }
+    }
+    return dead;
+}
+
+/**
+ * @brief Offset of the first buffer in the shared memory.
+ */
+static uint32 SharedMemoryGateDataOffset() {
+    uint32 headerSize = static_cast<uint32>(sizeof(SharedMemoryGateHeader));
+    return (((headerSize + SHARED_MEMORY_GATE_ALIGNMENT) - 1u) / SHARED_MEMORY_GATE_ALIGNMENT) * SHARED_MEMORY_GATE_ALIGNMENT;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemoryGate::SharedMemoryGate() :
+        MemoryGate() {
+    header = NULL_PTR(SharedMemoryGateHeader *);
+    sharedMemorySize = 0u;
+    owner = false;
+    joinTimeout = 1000u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the shared memory is unmapped and, if owned, unlinked.*/
+SharedMemoryGate::~SharedMemoryGate() {
+    if (header != NULL_PTR(SharedMemoryGateHeader *)) {
+        if (munmap(reinterpret_cast<void *>(header), static_cast<size_t>(sharedMemorySize)) != 0) {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to unmap the shared memory");
+        }
+        if (owner) {
+            if (shm_unlink(sharedMemoryName.Buffer()) != 0) {
+                REPORT_ERROR(ErrorManagement::OSError, "Failed to unlink the shared memory");
+            }
+        }
+        header = NULL_PTR(SharedMemoryGateHeader *);
+    }
+    //The buffers belong to the shared memory and shall not be deleted by the MemoryGate.
+    mem = NULL_PTR(uint8 *);
+}
+
+bool SharedMemoryGate::Initialise(StructuredDataI &data) {
+    //The MemoryGate::Initialise is not called as it would allocate the buffers in the process heap.
+    bool ret = ReferenceContainer::Initialise(data);
+    if (ret) {
+        ret = data.Read("SharedMemoryName", sharedMemoryName);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SharedMemoryName shall be specified");
+        }
+    }
+    if (ret) {
+        ret = (sharedMemoryName.Size() > 1u);
+        if (ret) {
+            ret = (sharedMemoryName.Buffer()[0u] == '/');
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SharedMemoryName shall start with / and have at least one more character");
+        }
+    }
+    if (ret) {
+        if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
+            numberOfBuffers = 2u;
+        }
+        ret = (numberOfBuffers <= SHARED_MEMORY_GATE_MAX_BUFFERS) && (numberOfBuffers > 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfBuffers shall be in [2-64]");
+        }
+    }
+    if (ret) {
+        if (!data.Read("JoinTimeout", joinTimeout)) {
+            joinTimeout = 1000u;
+        }
+        if (!data.Read("MemorySize", memSize)) {
+            memSize = 0u;
+        }
+        if (memSize > 0u) {
+            ret = MapSharedMemory();
+        }
+    }
+    return ret;
+}
+
+bool SharedMemoryGate::SetMemorySize(const uint32 size) {
+    bool ret = true;
+    if (header == NULL_PTR(SharedMemoryGateHeader *)) {
+        memSize = size;
+        ret = (memSize > 0u);
+        if (ret) {
+            ret = MapSharedMemory();
+        }
+    }
+    else {
+        ret = (memSize == size);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Memory size mismatch (%d != %d). All the components must specify the same size", size, memSize);
+        }
+    }
+    return ret;
+}
+
+bool SharedMemoryGate::MapSharedMemory() {
+    uint32 dataOffset = SharedMemoryGateDataOffset();
+    uint64 requiredSize = static_cast<uint64>(dataOffset) + (static_cast<uint64>(memSize) * static_cast<uint64>(numberOfBuffers));
+    bool ok = (requiredSize <= 0xFFFFFFFFull);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The shared memory %s would be larger than 4 GB (MemorySize = %u, NumberOfBuffers = %u)",
+                     sharedMemoryName.Buffer(), memSize, numberOfBuffers);
+    }
+    int32 fd = -1;
+    if (ok) {
+        sharedMemorySize = static_cast<uint32>(requiredSize);
+        UnlinkStaleSharedMemory();
+        /*lint -e{9130} the oflag argument of shm_open is defined as int and it can not be changed*/
+        fd = shm_open(sharedMemoryName.Buffer(), O_CREAT | O_EXCL | O_RDWR, SHARED_MEMORY_GATE_OPEN_MODE);
+    }
+    owner = (fd != -1);
+    if (!ok) {
+        //Nothing to create or to join.
+    }
+    else if (owner) {
+        //ftruncate fills the shared memory with zeros.
+        ok = (ftruncate(fd, static_cast<off_t>(sharedMemorySize)) == 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to size the shared memory %s", sharedMemoryName.Buffer());
+        }
+    }
+    else {
+        //Join the shared memory. Wait for the owner to size it.
+        bool sized = false;
+        uint32 t;
+        for (t = 0u; (t <= joinTimeout) && (!sized) && (ok); t++) {
+            if (fd == -1) {
+                /*lint -e{9130} the oflag argument of shm_open is defined as int and it can not be changed*/
+                fd = shm_open(sharedMemoryName.Buffer(), O_RDWR, SHARED_MEMORY_GATE_OPEN_MODE);
+            }
+            if (fd != -1) {
+                struct stat info;
+                ok = (fstat(fd, &info) == 0);
+                if (ok) {
+                    sized = (info.st_size > 0);
+                }
+                if (sized) {
+                    ok = (info.st_size == static_cast<off_t>(sharedMemorySize));
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::InitialisationError,
+                                     "The shared memory %s has a different size. All the components must specify the same NumberOfBuffers and MemorySize",
+                                     sharedMemoryName.Buffer());
+                    }
+                }
+            }
+            if ((!sized) && (ok)) {
+                Sleep::MSec(1u);
+            }
+        }
+        if ((ok) && (!sized)) {
+            REPORT_ERROR(ErrorManagement::Timeout, "Timeout while joining the shared memory %s", sharedMemoryName.Buffer());
+            ok = false;
+        }
+    }
+    void *shm = NULL_PTR(void *);
+    if (ok) {
+        /*lint -e{9130} the prot argument of mmap is defined as int and it can not be changed*/
+        shm = mmap(NULL_PTR(void *), static_cast<size_t>(sharedMemorySize), PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(0));
+        ok = (shm != /*lint -e(1924) -e(923)*/MAP_FAILED);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to map the shared memory %s", sharedMemoryName.Buffer());
+        }
+    }
+    if (fd != -1) {
+        (void) close(fd);
+    }
+    if (ok) {
+        header = reinterpret_cast<SharedMemoryGateHeader *>(shm);
+        mem = &(reinterpret_cast<uint8 *>(shm)[dataOffset]);
+        if (owner) {
+            header->numberOfBuffers = numberOfBuffers;
+            header->memSize = memSize;
+            header->ownerPid = static_cast<int32>(getpid());
+            header->writeLock = 0;
+            header->newestBuffer = 0u;
+            header->generation = 0u;
+            uint32 b;
+            for (b = 0u; b < SHARED_MEMORY_GATE_MAX_BUFFERS; b++) {
+                header->sequence[b] = 0u;
+            }
+            SharedMemoryGateBarrier();
+            header->magic = SHARED_MEMORY_GATE_MAGIC;
+        }
+        else {
+            bool ready = false;
+            uint32 t;
+            for (t = 0u; (t <= joinTimeout) && (!ready); t++) {
+                ready = (header->magic == SHARED_MEMORY_GATE_MAGIC);
+                if (!ready) {
+                    Sleep::MSec(1u);
+                }
+            }
+            SharedMemoryGateBarrier();
+            ok = ready;
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::Timeout, "Timeout while waiting for the initialisation of the shared memory %s", sharedMemoryName.Buffer());
+            }
+            if (ok) {
+                ok = ((header->numberOfBuffers == numberOfBuffers) && (header->memSize == memSize));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The shared memory %s was created with %u buffers of %u bytes", sharedMemoryName.Buffer(),
+                                 header->numberOfBuffers, header->memSize);
+                }
+            }
+        }
+        if (!ok) {
+            (void) munmap(shm, static_cast<size_t>(sharedMemorySize));
+            header = NULL_PTR(SharedMemoryGateHeader *);
+            mem = NULL_PTR(uint8 *);
+        }
+    }
+    return ok;
+}
+
+void SharedMemoryGate::UnlinkStaleSharedMemory() const {
+    /*lint -e{9130} the oflag argument of shm_open is defined as int and it can not be changed*/
+    int32 fd = shm_open(sharedMemoryName.Buffer(), O_RDWR, SHARED_MEMORY_GATE_OPEN_MODE);
+    if (fd != -1) {
+        //Only one process at a time checks and unlinks a stale shared memory (the lock is released by close).
+        bool ok = (flock(fd, LOCK_EX) == 0);
+        struct stat info;
+        if (ok) {
+            ok = (fstat(fd, &info) == 0);
+        }
+        if (ok) {
+            ok = (info.st_size >= static_cast<off_t>(sizeof(SharedMemoryGateHeader)));
+        }
+        void *shm = NULL_PTR(void *);
+        if (ok) {
+            /*lint -e{9130} the prot argument of mmap is defined as int and it can not be changed*/
+            shm = mmap(NULL_PTR(void *), sizeof(SharedMemoryGateHeader), PROT_READ, MAP_SHARED, fd, static_cast<off_t>(0));
+            ok = (shm != /*lint -e(1924) -e(923)*/MAP_FAILED);
+        }
+        if (ok) {
+            const SharedMemoryGateHeader *staleHeader = reinterpret_cast<const SharedMemoryGateHeader *>(shm);
+            int32 stalePid = staleHeader->ownerPid;
+            if ((staleHeader->magic == SHARED_MEMORY_GATE_MAGIC) && (SharedMemoryGateIsProcessDead(stalePid))) {
+                //While this process was waiting for the lock, another one may have already unlinked the stale shared memory and created
+                //a new one with the same name. Only unlink if the name still refers to the stale shared memory.
+                /*lint -e{9130} the oflag argument of shm_open is defined as int and it can not be changed*/
+                int32 currentFd = shm_open(sharedMemoryName.Buffer(), O_RDONLY, SHARED_MEMORY_GATE_OPEN_MODE);
+                if (currentFd != -1) {
+                    struct stat currentInfo;
+                    if (fstat(currentFd, &currentInfo) == 0) {
+                        if ((currentInfo.st_dev == info.st_dev) && (currentInfo.st_ino == info.st_ino)) {
+                            REPORT_ERROR(ErrorManagement::Warning, "The owner (%d) of the shared memory %s no longer exists. Recreating it", stalePid,
+                                         sharedMemoryName.Buffer());
+                            //The processes which are still mapping the old shared memory keep it until they unmap it.
+                            (void) shm_unlink(sharedMemoryName.Buffer());
+                        }
+                    }
+                    (void) close(currentFd);
+                }
+            }
+            (void) munmap(shm, sizeof(SharedMemoryGateHeader));
+        }
+        (void) close(fd);
+    }
+}
+
+bool SharedMemoryGate::MemoryRead(uint8 * const bufferToFill) {
+    bool ok = (header != NULL_PTR(SharedMemoryGateHeader *));
+    bool consistent = false;
+    uint32 k;
+    for (k = 0u; (k < SHARED_MEMORY_GATE_READ_RETRIES) && (!consistent) && (ok); k++) {
+        /*lint -e{613} header checked not to be NULL.*/
+        uint32 bufferIdx = header->newestBuffer;
+        //Acquire: the sequence is read after the newest buffer index and before the buffer
+        SharedMemoryGateBarrier();
+        /*lint -e{613} header checked not to be NULL.*/
+        uint32 sequence = header->sequence[bufferIdx];
+        SharedMemoryGateBarrier();
+        if ((sequence & 1u) == 0u) {
+            uint32 offset = (memSize * bufferIdx);
+            /*lint -e{613} mem is not NULL if header is not NULL.*/
+            ok = MemoryOperationsHelper::Copy(bufferToFill, &mem[offset], memSize);
+            //The buffer is completely read before the sequence is checked again
+            SharedMemoryGateBarrier();
+            /*lint -e{613} header checked not to be NULL.*/
+            consistent = (header->sequence[bufferIdx] == sequence);
+        }
+    }
+    return (ok && consistent);
+}
+
+bool SharedMemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
+    bool ok = (header != NULL_PTR(SharedMemoryGateHeader *));
+    if (ok) {
+        //Only one writer at a time, as for the MemoryGate the write fails if the gate is busy.
+        int32 pid = static_cast<int32>(getpid());
+        /*lint -e{613} header checked not to be NULL.*/
+        ok = SharedMemoryGateCompareAndSwap(&header->writeLock, 0, pid);
+        if (!ok) {
+            //Take over the lock if the writer died while holding it.
+            /*lint -e{613} header checked not to be NULL.*/
+            int32 writerPid = header->writeLock;
+            if (SharedMemoryGateIsProcessDead(writerPid)) {
+                /*lint -e{613} header checked not to be NULL.*/
+                ok = SharedMemoryGateCompareAndSwap(&header->writeLock, writerPid, pid);
+                if (ok) {
+                    REPORT_ERROR(ErrorManagement::Warning, "The writer (%d) of the shared memory %s died while writing. Taking over the lock", writerPid,
+                                 sharedMemoryName.Buffer());
+                }
+            }
+        }
+    }
+    if (ok) {
+        /*lint -e{613} header checked not to be NULL.*/
+        uint32 bufferIdx = ((header->newestBuffer + 1u) % numberOfBuffers);
+        /*lint -e{613} header checked not to be NULL.*/
+        uint32 sequence = header->sequence[bufferIdx];
+        //A writer which died while writing leaves the sequence odd.
+        if ((sequence & 1u) != 0u) {
+            sequence++;
+        }
+        /*lint -e{613} header checked not to be NULL.*/
+        header->sequence[bufferIdx] = (sequence + 1u);
+        //The odd sequence is visible before the buffer is modified
+        SharedMemoryGateBarrier();
+        uint32 offset = (memSize * bufferIdx);
+        /*lint -e{613} mem is not NULL if header is not NULL.*/
+        ok = MemoryOperationsHelper::Copy(&mem[offset], bufferToFlush, memSize);
+        //Release: the buffer is visible before the even sequence
+        SharedMemoryGateBarrier();
+        /*lint -e{613} header checked not to be NULL.*/
+        header->sequence[bufferIdx] = (sequence + 2u);
+        //The even sequence is visible before the buffer is published as the newest one
+        SharedMemoryGateBarrier();
+        if (ok) {
+            /*lint -e{613} header checked not to be NULL.*/
+            header->newestBuffer = bufferIdx;
+            /*lint -e{613} header checked not to be NULL.*/
+            header->generation++;
+        }
+        SharedMemoryGateBarrier();
+        /*lint -e{613} header checked not to be NULL.*/
+        header->writeLock = 0;
+    }
+    return ok;
+}
+
+/*lint -e{715} the buffers of other processes cannot be pinned by the seqlock protocol.*/
+bool SharedMemoryGate::MemoryBorrow(const uint8 *&buffer,
+                                    uint32 &bufferIdx) {
+    return false;
+}
+
+/*lint -e{715} nothing can be borrowed.*/
+bool SharedMemoryGate::MemoryRelease(const uint32 bufferIdx) {
+    return false;
+}
+
+const uint8 *SharedMemoryGate::GetBuffersMemory() const {
+    return NULL_PTR(const uint8 *);
+}
+
+bool SharedMemoryGate::IsOwner() const {
+    return owner;
+}
+
+uint32 SharedMemoryGate::GetGeneration() const {
+    uint32 generation = 0u;
+    if (header != NULL_PTR(SharedMemoryGateHeader *)) {
+        generation = header->generation;
+    }
+    return generation;
+}
+
+const StreamString &SharedMemoryGate::GetSharedMemoryName() const {
+    return sharedMemoryName;
+}
+
+CLASS_REGISTER(SharedMemoryGate, "1.0")
+
+}
@@ -0,0 +1,216 @@
+/**
+ * @file SharedMemoryGate.h
+ * @brief Header file for class SharedMemoryGate
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryGate
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYGATE_H_
+#define SHAREDMEMORYGATE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryGate.h"
+#include "StreamString.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Control block stored at the beginning of the shared memory (defined in SharedMemoryGate.cpp).
+ */
+struct SharedMemoryGateHeader;
+
+/**
+ * @brief A MemoryGate whose buffers live in a named POSIX shared memory, so that components
+ * (e.g. LinkDataSource) running in different MARTe processes can exchange data.
+ *
+ * @details The first process that sets the memory size creates the shared memory (shm_open with O_EXCL)
+ * and becomes its owner. The other processes join it, waiting up to JoinTimeout for the owner to
+ * initialise it, and verify that they declare the same NumberOfBuffers and MemorySize.
+ * The owner unlinks the shared memory when it is destroyed.
+ *
+ * @details If the owner process dies without being destroyed the shared memory is left behind. The process which next sets the
+ * memory size detects that the owner stored in the shared memory no longer exists, unlinks the stale shared memory and creates (and
+ * initialises) a new one. The check and the unlink are serialised with an flock on the stale shared memory and the unlink is skipped
+ * if the name already refers to a shared memory recreated by another process, so that processes recovering at the same time end up
+ * on the same new shared memory. Processes which are still mapping the stale shared memory keep using it until they are restarted, so that,
+ * after the owner dies, all the processes sharing the memory should be restarted. If a writer dies while writing, the next MemoryWrite()
+ * takes over its lock and the buffer which was being written is discarded (readers keep on reading the newest complete buffer).
+ *
+ * @details The buffers are exchanged with a seqlock protocol: MemoryWrite() takes a (non-blocking) writer
+ * flag, writes the buffer after the newest one, bracketing the copy with two increments of the buffer sequence
+ * number, and then publishes it as the newest buffer. MemoryRead() copies the newest buffer and retries if the
+ * sequence number was odd or changed during the copy. Readers never block writers and never write to the
+ * shared memory. MemoryWrite() returns false if another writer is active and MemoryRead() returns false if it
+ * could not get a consistent copy after a bounded number of retries.
+ *
+ * @details As the object is a MemoryGate, it can be used as the Link of a LinkDataSource without any change. MemoryBorrow()
+ * is not supported, so a LinkDataSource with ZeroCopy = 1 cannot be linked to a SharedMemoryGate.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ *    +SharedMem = {
+ *        Class = SharedMemoryGate
+ *        SharedMemoryName = "/MARTeLink1" //Compulsory. The system wide name of the shared memory. Shall start with /.
+ *        NumberOfBuffers = 4 //The number of buffers that should be in [2-64]. Default = 2
+ *        MemorySize = 100 //The size of each buffer memory. If this parameter is not set or if it is equal to zero and the buffer size will be set by the first component that calls SetMemorySize().
+ *        JoinTimeout = 1000 //Optional. Time in milliseconds to wait for the owner to initialise the shared memory. Default = 1000.
+ *    }
+ * </pre>
+ */
+class SharedMemoryGate: public MemoryGate {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor
+     */
+    SharedMemoryGate();
+
+    /**
+     * @brief Destructor. Unmaps the shared memory and, if IsOwner(), unlinks it.
+     */
+    virtual ~SharedMemoryGate();
+
+    /**
+     * @see ReferenceContainer::Initialise()
+     * @details The user can specify the following configuration parameters:\n
+     *   - SharedMemoryName (compulsory, shall start with /)\n
+     *   - NumberOfBuffers = N (the number of buffers that should be in [2-64]. Default = 2)\n
+     *   - MemorySize = N (the size of each buffer memory. If this parameter is not set or if it is equal to zero,
+     *     the shared memory will be created or joined by the first component that calls SetMemorySize()).\n
+     *   - JoinTimeout = N (milliseconds to wait for the owner to initialise the shared memory. Default = 1000).
+     * @return true if the parameters are valid and, if MemorySize > 0, the shared memory could be created or joined.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @see MemoryGate::SetMemorySize()
+     * @details The first call creates or joins the shared memory.
+     */
+    virtual bool SetMemorySize(uint32 size);
+
+    /**
+     * @brief Copies the newest buffer into \a bufferToFill.
+     * @details Retries if a writer modified the buffer during the copy.
+     * @param[in] bufferToFill is the buffer to be filled with read data.
+     * @return true if a consistent copy could be made.
+     */
+    virtual bool MemoryRead(uint8 * const bufferToFill);
+
+    /**
+     * @brief Copies \a bufferToFlush into the buffer after the newest one and publishes it as the newest.
+     * @param[in] bufferToFlush is the buffer contains the data to be written.
+     * @return true if no other writer was active and the shared memory is mapped.
+     */
+    virtual bool MemoryWrite(const uint8 * const bufferToFlush);
+
+    /**
+     * @brief Not supported: writers in other processes cannot be held off a buffer.
+     * @return false.
+     */
+    virtual bool MemoryBorrow(const uint8 *&buffer,
+                              uint32 &bufferIdx);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool MemoryRelease(const uint32 bufferIdx);
+
+    /**
+     * @brief The buffers cannot be borrowed.
+     * @return NULL.
+     */
+    virtual const uint8 *GetBuffersMemory() const;
+
+    /**
+     * @brief Returns true if this object created the shared memory.
+     * @return true if this object created the shared memory.
+     */
+    bool IsOwner() const;
+
+    /**
+     * @brief Returns the number of successful MemoryWrite() calls, from any process, since the shared memory was created.
+     * @return the number of buffers published in the shared memory (0 if not mapped).
+     */
+    uint32 GetGeneration() const;
+
+    /**
+     * @brief Returns the name of the shared memory.
+     * @return the name of the shared memory.
+     */
+    const StreamString &GetSharedMemoryName() const;
+
+private:
+
+    /**
+     * @brief Creates or joins the shared memory with memSize * numberOfBuffers bytes of data.
+     * @return true if the shared memory (control block included) is smaller than 4 GB, is mapped and is consistent with the
+     * configuration of this object.
+     */
+    bool MapSharedMemory();
+
+    /**
+     * @brief Unlinks the shared memory with the same name if it was left behind by an owner which no longer exists.
+     */
+    void UnlinkStaleSharedMemory() const;
+
+    /**
+     * The name of the shared memory.
+     */
+    StreamString sharedMemoryName;
+
+    /**
+     * The control block at the beginning of the shared memory.
+     */
+    SharedMemoryGateHeader *header;
+
+    /**
+     * Total size of the mapped shared memory.
+     */
+    uint32 sharedMemorySize;
+
+    /**
+     * True if this object created the shared memory.
+     */
+    bool owner;
+
+    /**
+     * Time in milliseconds to wait for the owner to initialise the shared memory.
+     */
+    uint32 joinTimeout;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYGATE_H_ */
@@ -55,6 +55,7 @@ OPCUAServer::OPCUAServer() :
     cpuMask = 0xffu;
     stackSize = THREADS_DEFAULT_STACKSIZE;
     nodeNumber = 3000u;
+    pendingObjectsSem.Create();
 }
 /*lint -e{1551} No exception thrown.*/
 /*lint -e{1579} opcuaConfig and opcuaServer haven't been freed by any function before.*/
@@ -178,10 +179,17 @@ ErrorManagement::ErrorType OPCUAServer::Execute(ExecutionInfo & info) {
         if (ok) {
             SetRunning(true);
         }
-        //This is a blocking call
-        /*lint -e{64} No type mismatch because open62541 redefines boolean.*/
+        //This is a blocking call. Equivalent to UA_Server_run, but the objects added with RegisterObject are inserted between iterations.
         if (ok) {
-            UA_StatusCode code = UA_Server_run(opcuaServer, &opcuaRunning);
+            UA_StatusCode code = UA_Server_run_startup(opcuaServer);
+            if (code == 0x00U) { /* UA_STATUSCODE_GOOD */
+                while (opcuaRunning) {
+                    AddPendingObjects();
+                    /*lint -e{534} The time until the next timed callback is not needed.*/
+                    (void) UA_Server_run_iterate(opcuaServer, true);
+                }
+                code = UA_Server_run_shutdown(opcuaServer);
+            }
             if (code != 0x00U) { /* UA_STATUSCODE_GOOD */
                 err = ErrorManagement::CommunicationError;
             }
@@ -234,11 +242,23 @@ bool OPCUAServer::InitAddressSpace(ReferenceT<OPCUAReferenceContainer> ref) {
         TypeDescriptor typeName = ref->GetNodeType();
         OPCUA::OPCUANodeSettings settings = new OPCUA::NodeProperties;
         ok = ref->GetOPCVariable(settings, typeName, nodeNumber);
+        ReferenceT<OPCUASignalNode> signalNode = ref;
+        if (signalNode.IsValid()) {
+            settings->attr.accessLevel = 0x1u; /* UA_ACCESSLEVELMASK_READ */
+        }
         do {
-            if (ok) {
+            if ((ok) && (signalNode.IsValid())) {
+                code = UA_Server_addDataSourceVariableNode(opcuaServer, settings->nodeId, settings->parentNodeId, settings->parentReferenceNodeId,
+                                                           settings->nodeName, UA_NODEID_NUMERIC(0u, 63u), settings->attr, signalNode->GetDataSource(),
+                                                           signalNode.operator->(), NULL_PTR(UA_NodeId *)); /* UA_NS0ID_BASEDATAVARIABLETYPE = 63 */
+            }
+            else if (ok) {
                 code = UA_Server_addVariableNode(opcuaServer, settings->nodeId, settings->parentNodeId, settings->parentReferenceNodeId, settings->nodeName,
                                                  UA_NODEID_NUMERIC(0u, 63u), settings->attr, NULL_PTR(void *), NULL_PTR(UA_NodeId *)); /* UA_NS0ID_BASEDATAVARIABLETYPE = 63 */
             }
+            else {
+                //GetOPCVariable failed. Nothing to add.
+            }
             if (code == 0x805E0000U) { /* UA_STATUSCODE_BADNODEIDEXISTS */
                 nodeNumber++;
                 ref->SetNodeId(nodeNumber);
@@ -333,6 +353,51 @@ const uint16 OPCUAServer::GetPort() const {
     return port;
 }
 
+bool OPCUAServer::RegisterObject(ReferenceT<OPCUAObject> object) {
+    bool ok = object.IsValid();
+    if (ok) {
+        ok = static_cast<bool>(pendingObjectsSem.FastLock());
+    }
+    if (ok) {
+        object->SetParent(0u);
+        object->SetFirst(true);
+        ok = pendingObjects.Insert(object);
+        pendingObjectsSem.FastUnLock();
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not register the object in the Address Space");
+    }
+    return ok;
+}
+
+uint32 OPCUAServer::GetNumberOfPendingObjects() {
+    uint32 nOfPending = 0u;
+    if (static_cast<bool>(pendingObjectsSem.FastLock())) {
+        nOfPending = pendingObjects.Size();
+        pendingObjectsSem.FastUnLock();
+    }
+    return nOfPending;
+}
+
+void OPCUAServer::AddPendingObjects() {
+    //The lock is kept while the objects are added so that GetNumberOfPendingObjects only returns 0 once they are in the Address Space.
+    if (static_cast<bool>(pendingObjectsSem.FastLock())) {
+        while (pendingObjects.Size() > 0u) {
+            Reference pending = pendingObjects.Get(0u);
+            (void) pendingObjects.Delete(pending);
+            ReferenceT<OPCUAObject> object = pending;
+            if (object.IsValid()) {
+                if (!InitAddressSpace(object)) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not add the object %s to the Address Space", object->GetName());
+                }
+                //Keep the OPCUASignalNode contexts alive for as long as the open62541 server.
+                (void) registeredObjects.Insert(object);
+            }
+        }
+        pendingObjectsSem.FastUnLock();
+    }
+}
+
 CLASS_REGISTER(OPCUAServer, "");
 
 }
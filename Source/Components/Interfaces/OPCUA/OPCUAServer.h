@@ -36,10 +36,12 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "EmbeddedServiceMethodBinderT.h"
+#include "FastPollingMutexSem.h"
 #include "ObjectRegistryDatabase.h"
 #include "OPCUANode.h"
 #include "OPCUAObject.h"
 #include "OPCUAReferenceContainer.h"
+#include "OPCUASignalNode.h"
 #include "ReferenceContainer.h"
 #include "SingleThreadService.h"
 
@@ -75,6 +77,11 @@ namespace MARTe {
  *         }
  *     }
  * </pre>
+ *
+ * Other components (e.g. the OPCUAServerOutput DataSource) can add objects to the Address Space while the server is running with RegisterObject().
+ * The server thread runs the open62541 server one iteration at a time and adds the registered objects between two iterations,
+ * given that the open62541 server is not thread-safe. The OPCUASignalNode children are added as data source variables, whose value is read from
+ * the OPCUASignalNode triple buffer every time that a client reads or samples them.
  */
 class OPCUAServer: public Object, public EmbeddedServiceMethodBinderI {
 public:
@@ -138,6 +145,21 @@ public:
      */
     const uint16 GetPort() const;
 
+    /**
+     * @brief Queues an OPCUAObject, with all its OPCUAObject, OPCUANode and OPCUASignalNode children, to be added to the Address Space.
+     * @details The object is added under the Objects folder by the server thread, before its next iteration. The OPCUAServer keeps
+     * a Reference to the object until it is destroyed, so that the OPCUASignalNode can be read for as long as the open62541 server exists.
+     * @param[in] object the OPCUAObject to add.
+     * @return true if the object is valid.
+     */
+    bool RegisterObject(ReferenceT<OPCUAObject> object);
+
+    /**
+     * @brief Gets the number of objects queued with RegisterObject() which were not yet added to the Address Space.
+     * @return the number of objects waiting to be added.
+     */
+    uint32 GetNumberOfPendingObjects();
+
     /**
      * The thread that manage the OPC UA Server functionalities.
      */
@@ -162,6 +184,12 @@ private:
      */
     bool GetStructure(ReferenceT<OPCUAReferenceContainer> refContainer, const Introspection * const intro);
 
+    /**
+     * @brief Adds the objects queued with RegisterObject() to the Address Space.
+     * @details Shall only be called by the server thread.
+     */
+    void AddPendingObjects();
+
     /**
      * open62541 server object declaration
      */
@@ -202,6 +230,21 @@ private:
      */
     ConfigurationDatabase cdb;
 
+    /**
+     * The objects queued with RegisterObject().
+     */
+    ReferenceContainer pendingObjects;
+
+    /**
+     * The objects already added to the Address Space by AddPendingObjects().
+     */
+    ReferenceContainer registeredObjects;
+
+    /**
+     * Protects pendingObjects.
+     */
+    FastPollingMutexSem pendingObjectsSem;
+
 };
 }
 
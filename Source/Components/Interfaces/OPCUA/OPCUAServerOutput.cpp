@@ -0,0 +1,269 @@
+/**
+ * @file OPCUAServerOutput.cpp
+ * @brief Source file for class OPCUAServerOutput
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUAServerOutput (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "ObjectRegistryDatabase.h"
+#include "OPCUAServerOutput.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+/*-e909 and -e9133 redefines bool. -e578 symbol ovveride in CLASS_REGISTER*/
+/*lint -save -e909 -e9133 -e578*/
+namespace MARTe {
+
+OPCUAServerOutput::OPCUAServerOutput() :
+        DataSourceI() {
+    serverName = "";
+    objectName = "";
+    signalNodes = NULL_PTR(ReferenceT<OPCUASignalNode>*);
+    numberOfSignalNodes = 0u;
+    offsets = NULL_PTR(uint32*);
+    dataSourceMemory = NULL_PTR(char8*);
+}
+
+/*lint -e{1551} No exception thrown.*/
+OPCUAServerOutput::~OPCUAServerOutput() {
+    if (signalNodes != NULL_PTR(ReferenceT<OPCUASignalNode>*)) {
+        delete[] signalNodes;
+    }
+    if (offsets != NULL_PTR(uint32*)) {
+        delete[] offsets;
+    }
+    if (dataSourceMemory != NULL_PTR(char8*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(dataSourceMemory));
+    }
+}
+
+bool OPCUAServerOutput::Initialise(StructuredDataI &data) {
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("Server", serverName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Cannot read the Server attribute");
+        }
+    }
+    if (ok) {
+        if (!data.Read("ObjectName", objectName)) {
+            objectName = GetName();
+            REPORT_ERROR(ErrorManagement::Information, "No ObjectName defined. Using %s", objectName.Buffer());
+        }
+        ok = (objectName.Size() > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The ObjectName shall not be empty");
+        }
+    }
+    return ok;
+}
+
+bool OPCUAServerOutput::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    if (ok) {
+        ok = (nOfSignals > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one signal shall be defined");
+        }
+    }
+    if (ok) {
+        //Do not allow samples in any of the functions writing to this DataSourceI
+        uint32 nOfFunctions = GetNumberOfFunctions();
+        for (uint32 f = 0u; (f < nOfFunctions) && (ok); f++) {
+            uint32 functionNumberOfSignals = 0u;
+            if (GetFunctionNumberOfSignals(OutputSignals, f, functionNumberOfSignals)) {
+                for (uint32 n = 0u; (n < functionNumberOfSignals) && (ok); n++) {
+                    uint32 nSamples;
+                    ok = GetFunctionSignalSamples(OutputSignals, f, n, nSamples);
+                    if (ok) {
+                        ok = (nSamples == 1u);
+                    }
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The number of samples shall be exactly 1");
+                    }
+                }
+            }
+        }
+    }
+    ReferenceT<OPCUAServer> server;
+    if (ok) {
+        server = ObjectRegistryDatabase::Instance()->Find(serverName.Buffer());
+        ok = server.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not find the OPCUA::OPCUAServer %s", serverName.Buffer());
+        }
+    }
+    if (ok) {
+        ok = !signalsObject.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The signals were already registered");
+        }
+    }
+    if (ok) {
+        signalsObject = ReferenceT<OPCUAObject>("OPCUAObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        signalsObject->SetName(objectName.Buffer());
+        numberOfSignalNodes = nOfSignals;
+        signalNodes = new ReferenceT<OPCUASignalNode>[numberOfSignalNodes];
+        offsets = new uint32[numberOfSignalNodes];
+    }
+    uint32 memorySize = 0u;
+    for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+        StreamString signalName;
+        ok = GetSignalName(n, signalName);
+        uint8 nDimensions = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfDimensions(n, nDimensions);
+        }
+        if (ok) {
+            ok = (nDimensions <= 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signal %s has Number Of Dimensions = %d. Multidimensional arrays not supported yet.",
+                             signalName.Buffer(), nDimensions);
+            }
+        }
+        uint32 nElements = 1u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(n, nElements);
+        }
+        if ((ok) && (signalNodes != NULL_PTR(ReferenceT<OPCUASignalNode>*)) && (offsets != NULL_PTR(uint32*))) {
+            ReferenceT<OPCUASignalNode> node("OPCUASignalNode", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            node->SetName(signalName.Buffer());
+            node->SetNodeType(GetSignalType(n));
+            if (nElements > 1u) {
+                node->SetNumberOfDimensions(1u);
+                node->SetNumberOfElements(0u, nElements);
+            }
+            ok = node->AllocateValue();
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The type of the signal %s is not supported", signalName.Buffer());
+            }
+            if (ok) {
+                ok = signalsObject->Insert(node);
+            }
+            if (ok) {
+                signalNodes[n] = node;
+                offsets[n] = memorySize;
+                memorySize += node->GetValueSize();
+            }
+        }
+    }
+    if (ok) {
+        ok = server->RegisterObject(signalsObject);
+    }
+    return ok;
+}
+
+bool OPCUAServerOutput::AllocateMemory() {
+    uint32 memorySize = 0u;
+    for (uint32 n = 0u; n < numberOfSignalNodes; n++) {
+        if (signalNodes != NULL_PTR(ReferenceT<OPCUASignalNode>*)) {
+            if (signalNodes[n].IsValid()) {
+                memorySize += signalNodes[n]->GetValueSize();
+            }
+        }
+    }
+    bool ok = (memorySize > 0u);
+    if (ok) {
+        dataSourceMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize));
+        ok = (dataSourceMemory != NULL_PTR(char8*));
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(dataSourceMemory, '\0', memorySize);
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The signalAddress is independent of the bufferIdx.*/
+bool OPCUAServerOutput::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                              const uint32 bufferIdx,
+                                              void *&signalAddress) {
+    bool ok = (dataSourceMemory != NULL_PTR(char8*));
+    if (ok) {
+        ok = (signalIdx < numberOfSignalNodes);
+    }
+    if (ok) {
+        /*lint -e{613} dataSourceMemory and offsets cannot be NULL here*/
+        char8 *memPtr = &dataSourceMemory[offsets[signalIdx]];
+        signalAddress = reinterpret_cast<void *&>(memPtr);
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The brokerName only depends on the direction */
+const char8* OPCUAServerOutput::GetBrokerName(StructuredDataI &data,
+                                              const SignalDirection direction) {
+    const char8 *brokerName = "";
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapSynchronisedOutputBroker";
+    }
+    return brokerName;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+bool OPCUAServerOutput::PrepareNextState(const char8 *const currentStateName,
+                                         const char8 *const nextStateName) {
+    return true;
+}
+
+bool OPCUAServerOutput::Synchronise() {
+    if ((dataSourceMemory != NULL_PTR(char8*)) && (signalNodes != NULL_PTR(ReferenceT<OPCUASignalNode>*)) && (offsets != NULL_PTR(uint32*))) {
+        for (uint32 n = 0u; n < numberOfSignalNodes; n++) {
+            signalNodes[n]->Publish(&dataSourceMemory[offsets[n]]);
+        }
+    }
+    return true;
+}
+
+const char8* OPCUAServerOutput::GetServerName() const {
+    return serverName.Buffer();
+}
+
+const char8* OPCUAServerOutput::GetObjectName() const {
+    return objectName.Buffer();
+}
+
+ReferenceT<OPCUASignalNode> OPCUAServerOutput::GetSignalNode(const uint32 signalIdx) {
+    ReferenceT<OPCUASignalNode> node;
+    if ((signalNodes != NULL_PTR(ReferenceT<OPCUASignalNode>*)) && (signalIdx < numberOfSignalNodes)) {
+        node = signalNodes[signalIdx];
+    }
+    return node;
+}
+
+CLASS_REGISTER(OPCUAServerOutput, "1.0")
+
+}
+/*lint -restore*/
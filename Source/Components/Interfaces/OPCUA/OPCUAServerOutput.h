@@ -0,0 +1,208 @@
+/**
+ * @file OPCUAServerOutput.h
+ * @brief Header file for class OPCUAServerOutput
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class OPCUAServerOutput
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_INTERFACES_OPCUA_OPCUASERVEROUTPUT_H_
+#define SOURCE_COMPONENTS_INTERFACES_OPCUA_OPCUASERVEROUTPUT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "DataSourceI.h"
+#include "OPCUAObject.h"
+#include "OPCUAServer.h"
+#include "OPCUASignalNode.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Output DataSource which publishes its signals as Node Variables of an OPCUAServer running in the same application.
+ * @details Each signal is added, as an OPCUASignalNode, to an OPCUA Object (with name ObjectName) inside the "Objects" folder of the server.
+ * The nodes are read-only and have numeric NodeIds in the namespace 1, assigned by the server.
+ *
+ * @details Synchronise only copies each signal into the triple buffer of its OPCUASignalNode and never waits for the server.
+ * The server thread copies the newest published values every time that a client reads the nodes or that a subscription samples them.
+ * This means that the clients are not notified of every value written by the real-time thread: a subscription gets the newest value
+ * at each sampling interval.
+ *
+ * @details It supports int8/16/32/64, uint8/16/32/64, float32/64 scalars and arrays (one dimension). Each signal shall have exactly one sample.
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +OPCUAOut = {
+ *     Class = OPCUA::OPCUAServerOutput
+ *     Server = OPCUAServer //Compulsory. The path of the OPCUA::OPCUAServer in the ObjectRegistryDatabase.
+ *     ObjectName = MARTe2_Signals //Optional. The name of the OPCUA Object with the signals. Default is the name of the DataSource.
+ *     Signals = {
+ *         Node1 = {
+ *             Type = float64
+ *         }
+ *         Node2 = {
+ *             Type = uint32
+ *             NumberOfElements = 8
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class OPCUAServerOutput: public DataSourceI {
+
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default Constructor
+     */
+    OPCUAServerOutput();
+
+    /**
+     * @brief Default Destructor
+     * @details The nodes stay in the Address Space of the server (with the last published values).
+     */
+    virtual ~OPCUAServerOutput();
+
+    /**
+     * @brief Loads and verifies all the configuration parameters detailed in the class description.
+     * @return true if all the mandatory parameters are correctly specified and if the specified optional parameters have valid values.
+     * @see DataSourceI::Initialise
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Creates the OPCUASignalNode for each signal and registers them in the OPCUAServer.
+     * @return true if the server exists, if all the signals have a supported type, at most one dimension and one sample,
+     * and if the object could be registered in the server.
+     * @see DataSourceI::SetConfiguredDatabase
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the memory of the signals.
+     * @return true if the memory could be allocated.
+     * @see DataSourceI::AllocateMemory
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @see DataSourceI::GetSignalMemoryBuffer
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+                                       const uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @details Only OutputSignals are supported.
+     * @return MemoryMapSynchronisedOutputBroker
+     * @see DataSourceI::GetBrokerName
+     */
+    virtual const char8* GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @return true
+     * @see DataSourceI::PrepareNextState
+     */
+    virtual bool PrepareNextState(const char8 *const currentStateName,
+                                  const char8 *const nextStateName);
+
+    /**
+     * @brief Publishes the value of all the signals in the triple buffer of their OPCUASignalNode.
+     * @return true
+     * @see DataSourceI::Synchronise
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Gets the path of the OPCUAServer.
+     * @return the path of the OPCUAServer.
+     */
+    const char8* GetServerName() const;
+
+    /**
+     * @brief Gets the name of the OPCUA Object with the signals.
+     * @return the name of the OPCUA Object with the signals.
+     */
+    const char8* GetObjectName() const;
+
+    /**
+     * @brief Gets the OPCUASignalNode of a signal.
+     * @param[in] signalIdx the signal index.
+     * @return the OPCUASignalNode of the signal or an invalid Reference if \a signalIdx does not exist.
+     */
+    ReferenceT<OPCUASignalNode> GetSignalNode(const uint32 signalIdx);
+
+private:
+
+    /**
+     * The path of the OPCUAServer.
+     */
+    StreamString serverName;
+
+    /**
+     * The name of the OPCUA Object with the signals.
+     */
+    StreamString objectName;
+
+    /**
+     * The OPCUA Object with the signals.
+     */
+    ReferenceT<OPCUAObject> signalsObject;
+
+    /**
+     * The OPCUASignalNode of each signal.
+     */
+    ReferenceT<OPCUASignalNode> *signalNodes;
+
+    /**
+     * The number of elements of signalNodes.
+     */
+    uint32 numberOfSignalNodes;
+
+    /**
+     * The offset of each signal in the dataSourceMemory.
+     */
+    uint32 *offsets;
+
+    /**
+     * The memory of all the signals.
+     */
+    char8 *dataSourceMemory;
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_INTERFACES_OPCUA_OPCUASERVEROUTPUT_H_ */
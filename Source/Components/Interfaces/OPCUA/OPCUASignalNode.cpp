@@ -0,0 +1,288 @@
+/**
+ * @file OPCUASignalNode.cpp
+ * @brief Source file for class OPCUASignalNode
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUASignalNode (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "OPCUASignalNode.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/*-e909 and -e9133 redefines bool. -e578 symbol ovveride in CLASS_REGISTER*/
+/*lint -save -e909 -e9133 -e578*/
+namespace MARTe {
+
+/**
+ * Number of value buffers (one owned by Publish, one owned by ReadValue and one being exchanged).
+ */
+static const uint32 OPCUA_SIGNAL_NODE_N_BUFFERS = 3u;
+
+/**
+ * Bits of OPCUASignalNode::exchange which hold the index of the exchanged buffer.
+ */
+static const uint32 OPCUA_SIGNAL_NODE_INDEX_MASK = 0x3u;
+
+/**
+ * Bit of OPCUASignalNode::exchange which is set when the exchanged buffer holds a value not yet read.
+ */
+static const uint32 OPCUA_SIGNAL_NODE_NEW_VALUE = 0x4u;
+
+/**
+ * @brief Atomically replaces \a exchange with \a newValue (full memory barrier).
+ * @details Publish and ReadValue are the only callers, so that the loop is only repeated if the other one swapped in the meanwhile.
+ * @return the previous value of \a exchange.
+ */
+/*lint -estring(526,__sync_bool_compare_and_swap) -estring(628,__sync_bool_compare_and_swap) -estring(746,__sync_bool_compare_and_swap) -estring(1055,__sync_bool_compare_and_swap) GCC built-in function.*/
+static inline uint32 OPCUASignalNodeSwap(volatile uint32 &exchange,
+                                         const uint32 newValue) {
+    uint32 oldValue;
+    do {
+        oldValue = exchange;
+    }
+    while (!__sync_bool_compare_and_swap(&exchange, oldValue, newValue));
+    return oldValue;
+}
+
+/**
+ * @brief Gets the open62541 data type which is used by OPCUANode::GetOPCVariable for a given TypeDescriptor.
+ * @return the open62541 data type or NULL if the type is not supported.
+ */
+static const UA_DataType *OPCUASignalNodeGetUADataType(const TypeDescriptor &nType) {
+    const UA_DataType *uaType = NULL_PTR(const UA_DataType *);
+    if (nType == UnsignedInteger8Bit) {
+        uaType = &UA_TYPES[UA_TYPES_BYTE];
+    }
+    else if (nType == UnsignedInteger16Bit) {
+        uaType = &UA_TYPES[UA_TYPES_UINT16];
+    }
+    else if (nType == UnsignedInteger32Bit) {
+        uaType = &UA_TYPES[UA_TYPES_UINT32];
+    }
+    else if (nType == UnsignedInteger64Bit) {
+        uaType = &UA_TYPES[UA_TYPES_UINT64];
+    }
+    else if (nType == SignedInteger8Bit) {
+        uaType = &UA_TYPES[UA_TYPES_SBYTE];
+    }
+    else if (nType == SignedInteger16Bit) {
+        uaType = &UA_TYPES[UA_TYPES_INT16];
+    }
+    else if (nType == SignedInteger32Bit) {
+        uaType = &UA_TYPES[UA_TYPES_INT32];
+    }
+    else if (nType == SignedInteger64Bit) {
+        uaType = &UA_TYPES[UA_TYPES_INT64];
+    }
+    else if (nType == Float32Bit) {
+        uaType = &UA_TYPES[UA_TYPES_FLOAT];
+    }
+    else if (nType == Float64Bit) {
+        uaType = &UA_TYPES[UA_TYPES_DOUBLE];
+    }
+    else {
+        uaType = NULL_PTR(const UA_DataType *);
+    }
+    return uaType;
+}
+
+/**
+ * @brief Read callback of the OPCUASignalNode data sources (see UA_DataSource).
+ * @details Called by the OPCUAServer thread for reads and subscription samples. Copies the newest published value in a new UA_Variant.
+ */
+/*lint -e{715} -e{818} the prototype is defined by open62541.*/
+static UA_StatusCode OPCUASignalNodeRead(UA_Server *server,
+                                         const UA_NodeId *sessionId,
+                                         void *sessionContext,
+                                         const UA_NodeId *nodeId,
+                                         void *nodeContext,
+                                         UA_Boolean includeSourceTimeStamp,
+                                         const UA_NumericRange *range,
+                                         UA_DataValue *value) {
+    UA_StatusCode code = 0x00U; /* UA_STATUSCODE_GOOD */
+    OPCUASignalNode *node = static_cast<OPCUASignalNode *>(nodeContext);
+    const UA_DataType *uaType = NULL_PTR(const UA_DataType *);
+    if (node != NULL_PTR(OPCUASignalNode *)) {
+        uaType = node->GetUADataType();
+    }
+    if (uaType == NULL_PTR(const UA_DataType *)) {
+        code = 0x80020000U; /* UA_STATUSCODE_BADINTERNALERROR */
+    }
+    else if (range != NULL_PTR(const UA_NumericRange *)) {
+        code = 0x80360000U; /* UA_STATUSCODE_BADINDEXRANGEINVALID */
+    }
+    else {
+        uint32 nElements = node->GetValueNumberOfElements();
+        void *data = UA_Array_new(static_cast<osulong>(nElements), uaType);
+        if (data == NULL_PTR(void *)) {
+            code = 0x80030000U; /* UA_STATUSCODE_BADOUTOFMEMORY */
+        }
+        else {
+            int64 timestamp = 0;
+            (void) node->ReadValue(data, timestamp);
+            if (node->GetNumberOfDimensions() > 0u) {
+                UA_Variant_setArray(&value->value, data, static_cast<osulong>(nElements), uaType);
+            }
+            else {
+                UA_Variant_setScalar(&value->value, data, uaType);
+            }
+            value->hasValue = true;
+            if ((includeSourceTimeStamp) && (timestamp != 0)) {
+                value->sourceTimestamp = timestamp;
+                value->hasSourceTimestamp = true;
+            }
+        }
+    }
+    return code;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+OPCUASignalNode::OPCUASignalNode() :
+        OPCUANode() {
+    for (uint32 i = 0u; i < OPCUA_SIGNAL_NODE_N_BUFFERS; i++) {
+        buffer[i] = NULL_PTR(uint8 *);
+        bufferTimestamp[i] = 0;
+    }
+    writeIndex = 0u;
+    exchange = 1u;
+    readIndex = 2u;
+    publications = 0u;
+    valueSize = 0u;
+    valueNumberOfElements = 0u;
+    uaDataType = NULL_PTR(const UA_DataType *);
+}
+
+/*lint -e{1551} No exception thrown.*/
+OPCUASignalNode::~OPCUASignalNode() {
+    for (uint32 i = 0u; i < OPCUA_SIGNAL_NODE_N_BUFFERS; i++) {
+        if (buffer[i] != NULL_PTR(uint8 *)) {
+            delete[] buffer[i];
+        }
+    }
+    uaDataType = NULL_PTR(const UA_DataType *);
+}
+
+bool OPCUASignalNode::AllocateValue() {
+    bool ok = (buffer[0u] == NULL_PTR(uint8 *));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "The value of the node %s was already allocated", GetName());
+    }
+    if (ok) {
+        uaDataType = OPCUASignalNodeGetUADataType(nodeType);
+        ok = (uaDataType != NULL_PTR(const UA_DataType *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The type of the node %s is not supported", GetName());
+        }
+    }
+    if (ok) {
+        valueNumberOfElements = 1u;
+        if (numberOfElements != NULL_PTR(uint32 *)) {
+            for (uint8 i = 0u; i < numberOfDimensions; i++) {
+                valueNumberOfElements *= numberOfElements[i];
+            }
+        }
+        ok = (valueNumberOfElements > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The node %s has no elements", GetName());
+        }
+    }
+    if (ok) {
+        valueSize = valueNumberOfElements * (static_cast<uint32>(nodeType.numberOfBits) / 8u);
+        for (uint32 i = 0u; (i < OPCUA_SIGNAL_NODE_N_BUFFERS) && (ok); i++) {
+            buffer[i] = new uint8[valueSize];
+            ok = MemoryOperationsHelper::Set(buffer[i], '\0', valueSize);
+        }
+    }
+    return ok;
+}
+
+uint32 OPCUASignalNode::GetValueSize() const {
+    return valueSize;
+}
+
+uint32 OPCUASignalNode::GetValueNumberOfElements() const {
+    return valueNumberOfElements;
+}
+
+void OPCUASignalNode::Publish(const void * const value) {
+    if (buffer[writeIndex] != NULL_PTR(uint8 *)) {
+        (void) MemoryOperationsHelper::Copy(buffer[writeIndex], value, valueSize);
+        /*lint -e{746} -e{1055} -e{526} -e{628} UA_DateTime_now is defined in open62541.*/
+        bufferTimestamp[writeIndex] = UA_DateTime_now();
+        //Hand over the written buffer and keep writing on the one which was not read.
+        uint32 previous = OPCUASignalNodeSwap(exchange, (writeIndex | OPCUA_SIGNAL_NODE_NEW_VALUE));
+        writeIndex = (previous & OPCUA_SIGNAL_NODE_INDEX_MASK);
+        publications++;
+    }
+}
+
+bool OPCUASignalNode::ReadValue(void * const value,
+                                int64 &timestamp) {
+    bool ok = (buffer[readIndex] != NULL_PTR(uint8 *));
+    if (ok) {
+        if ((exchange & OPCUA_SIGNAL_NODE_NEW_VALUE) != 0u) {
+            uint32 previous = OPCUASignalNodeSwap(exchange, readIndex);
+            readIndex = (previous & OPCUA_SIGNAL_NODE_INDEX_MASK);
+        }
+        //Publish never writes the buffer at readIndex.
+        (void) MemoryOperationsHelper::Copy(value, buffer[readIndex], valueSize);
+        timestamp = bufferTimestamp[readIndex];
+    }
+    return ok;
+}
+
+uint32 OPCUASignalNode::GetNumberOfPublications() const {
+    return publications;
+}
+
+UA_DataSource OPCUASignalNode::GetDataSource() const {
+    UA_DataSource dataSource;
+    dataSource.read = &OPCUASignalNodeRead;
+    dataSource.write = NULL_PTR(UA_StatusCode (*)(UA_Server *, const UA_NodeId *, void *, const UA_NodeId *, void *, const UA_NumericRange *, const UA_DataValue *));
+    return dataSource;
+}
+
+const UA_DataType *OPCUASignalNode::GetUADataType() const {
+    return uaDataType;
+}
+
+CLASS_REGISTER(OPCUASignalNode, "");
+
+}
+/*lint -restore*/
@@ -0,0 +1,181 @@
+/**
+ * @file OPCUASignalNode.h
+ * @brief Header file for class OPCUASignalNode
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class OPCUASignalNode
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_INTERFACES_OPCUA_OPCUASIGNALNODE_H_
+#define SOURCE_COMPONENTS_INTERFACES_OPCUA_OPCUASIGNALNODE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+/*lint -u__cplusplus This is required as otherwise lint will get confused after including this header file.*/
+#include "open62541.h"
+/*lint -D__cplusplus*/
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "OPCUANode.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief OPCUANode whose value is published by a real-time thread.
+ * @details The value is not stored in the OPCUA Address Space. The OPCUAServer adds the node as a data source variable
+ * and the open62541 server thread reads it through GetDataSource().read every time that a client reads or samples (subscriptions) the node.
+ *
+ * @details The value is kept in a triple buffer. Publish() owns one buffer and ReadValue() owns another one, so that neither
+ * can see the other writing. The third buffer is exchanged: Publish() swaps the buffer that it has just written with the exchanged one,
+ * and ReadValue() swaps its own buffer with the exchanged one only when a new value was published since its last swap.
+ * Neither Publish() nor ReadValue() ever wait for each other, and ReadValue() always copies a complete value (the newest one).
+ *
+ * @details Only one thread shall call Publish() and only one thread (the OPCUAServer thread) shall call ReadValue().
+ * The node is read-only for the OPCUA clients.
+ */
+class OPCUASignalNode: public OPCUANode {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default Constructor
+     */
+    OPCUASignalNode();
+
+    /**
+     * Default Destructor
+     */
+    virtual ~OPCUASignalNode();
+
+    /**
+     * @brief Allocates the triple buffer for the node type and number of elements.
+     * @pre SetNodeType and, for arrays, SetNumberOfDimensions and SetNumberOfElements.
+     * @return true if the node type is supported by OPCUANode::GetOPCVariable and the buffers were not yet allocated.
+     */
+    bool AllocateValue();
+
+    /**
+     * @brief Gets the size of the value in bytes.
+     * @return the size of the value in bytes (0 before AllocateValue).
+     */
+    uint32 GetValueSize() const;
+
+    /**
+     * @brief Gets the total number of elements of the value.
+     * @return the total number of elements of the value.
+     */
+    uint32 GetValueNumberOfElements() const;
+
+    /**
+     * @brief Copies GetValueSize() bytes from \a value into the triple buffer and publishes them.
+     * @details Does not block and does not allocate memory.
+     * @param[in] value the new value of the node.
+     */
+    void Publish(const void * const value);
+
+    /**
+     * @brief Copies the newest published value into \a value.
+     * @param[out] value the memory where to copy GetValueSize() bytes.
+     * @param[out] timestamp the UA_DateTime when the value was published (0 if no value was published yet).
+     * @return true if the value was copied (i.e. AllocateValue was called).
+     */
+    bool ReadValue(void * const value,
+                   int64 &timestamp);
+
+    /**
+     * @brief Gets the number of calls to Publish().
+     * @return the number of values published.
+     */
+    uint32 GetNumberOfPublications() const;
+
+    /**
+     * @brief Gets the open62541 callbacks to be used with UA_Server_addDataSourceVariableNode.
+     * @details The node context of the variable shall be this object.
+     * @return the open62541 data source (read-only).
+     */
+    UA_DataSource GetDataSource() const;
+
+    /**
+     * @brief Gets the open62541 data type of the value.
+     * @return the open62541 data type of the value or NULL if AllocateValue was not called.
+     */
+    const UA_DataType *GetUADataType() const;
+
+private:
+
+    /**
+     * The value buffers.
+     */
+    uint8 *buffer[3];
+
+    /**
+     * The UA_DateTime when each buffer was published.
+     */
+    int64 bufferTimestamp[3];
+
+    /**
+     * The index of the buffer written by Publish().
+     */
+    uint32 writeIndex;
+
+    /**
+     * The index of the buffer read by ReadValue().
+     */
+    uint32 readIndex;
+
+    /**
+     * The index of the exchanged buffer and, if it holds a value not yet read, OPCUA_SIGNAL_NODE_NEW_VALUE.
+     */
+    volatile uint32 exchange;
+
+    /**
+     * Number of values published.
+     */
+    volatile uint32 publications;
+
+    /**
+     * The size of the value in bytes.
+     */
+    uint32 valueSize;
+
+    /**
+     * The total number of elements of the value.
+     */
+    uint32 valueNumberOfElements;
+
+    /**
+     * The open62541 data type of the value.
+     */
+    const UA_DataType *uaDataType;
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_INTERFACES_OPCUA_OPCUASIGNALNODE_H_ */
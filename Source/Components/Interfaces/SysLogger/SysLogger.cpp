@@ -24,107 +24,409 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <sys/un.h>
 #include <syslog.h>
+#include <time.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ErrorInformation.h"
 #include "ErrorType.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamMemoryReference.h"
 #include "SysLogger.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/*lint -e{9130} -e{9117} the LOG_ constants are defined by <syslog.h>*/
+/**
+ * The syslog priority of each message type (see SysLoggerGetErrorTypeIndex).
+ */
+const MARTe::int32 SYSLOGGER_PRIORITIES[MARTe::SYSLOGGER_NUMBER_OF_ERROR_TYPES] = { LOG_INFO, LOG_WARNING, LOG_CRIT, LOG_ERR, LOG_DEBUG, LOG_ERR, LOG_CRIT,
+        LOG_CRIT, LOG_INFO, LOG_WARNING, LOG_WARNING, LOG_ERR, LOG_CRIT, LOG_CRIT, LOG_CRIT, LOG_ERR, LOG_ERR, LOG_CRIT, LOG_CRIT, LOG_CRIT, LOG_CRIT };
+
+/**
+ * The name of each message type used in the summaries (see SysLoggerGetErrorTypeIndex).
+ */
+const MARTe::char8 * const SYSLOGGER_TYPE_NAMES[MARTe::SYSLOGGER_NUMBER_OF_ERROR_TYPES] = { "Information", "Warning", "FatalError", "RecoverableError",
+        "Debug", "Timeout", "ParametersError", "CommunicationError", "NoError", "Completed", "NotCompleted", "ErrorAccessDenied", "InitialisationError",
+        "InternalSetupError", "OSError", "IllegalOperation", "ErrorSharing", "Exception", "UnsupportedFeature", "SyntaxError", "Unknown" };
+
+/**
+ * The facility of all the messages.
+ */
+/*lint -e{9130} -e{9117} the LOG_USER constant is defined by <syslog.h>*/
+const MARTe::int32 SYSLOGGER_FACILITY = LOG_USER;
+
+/**
+ * @brief Gets the index of the message type in SYSLOGGER_PRIORITIES and SYSLOGGER_TYPE_NAMES.
+ */
+MARTe::uint32 SysLoggerGetErrorTypeIndex(const MARTe::ErrorManagement::ErrorType &errorType) {
+    using namespace MARTe;
+    uint32 typeIdx;
+    if (errorType == ErrorManagement::Information) {
+        typeIdx = 0u;
+    }
+    else if (errorType == ErrorManagement::Warning) {
+        typeIdx = 1u;
+    }
+    else if (errorType == ErrorManagement::FatalError) {
+        typeIdx = 2u;
+    }
+    else if (errorType == ErrorManagement::RecoverableError) {
+        typeIdx = 3u;
+    }
+    else if (errorType == ErrorManagement::Debug) {
+        typeIdx = 4u;
+    }
+    else if (errorType == ErrorManagement::Timeout) {
+        typeIdx = 5u;
+    }
+    else if (errorType == ErrorManagement::ParametersError) {
+        typeIdx = 6u;
+    }
+    else if (errorType == ErrorManagement::CommunicationError) {
+        typeIdx = 7u;
+    }
+    else if (errorType == ErrorManagement::NoError) {
+        typeIdx = 8u;
+    }
+    else if (errorType == ErrorManagement::Completed) {
+        typeIdx = 9u;
+    }
+    else if (errorType == ErrorManagement::NotCompleted) {
+        typeIdx = 10u;
+    }
+    else if (errorType == ErrorManagement::ErrorAccessDenied) {
+        typeIdx = 11u;
+    }
+    else if (errorType == ErrorManagement::InitialisationError) {
+        typeIdx = 12u;
+    }
+    else if (errorType == ErrorManagement::InternalSetupError) {
+        typeIdx = 13u;
+    }
+    else if (errorType == ErrorManagement::OSError) {
+        typeIdx = 14u;
+    }
+    else if (errorType == ErrorManagement::IllegalOperation) {
+        typeIdx = 15u;
+    }
+    else if (errorType == ErrorManagement::ErrorSharing) {
+        typeIdx = 16u;
+    }
+    else if (errorType == ErrorManagement::Exception) {
+        typeIdx = 17u;
+    }
+    else if (errorType == ErrorManagement::UnsupportedFeature) {
+        typeIdx = 18u;
+    }
+    else if (errorType == ErrorManagement::SyntaxError) {
+        typeIdx = 19u;
+    }
+    else {
+        typeIdx = 20u;
+    }
+    return typeIdx;
+}
+
+/**
+ * @brief Full memory barrier between the ring indexes and the records.
+ */
+inline void SysLoggerBarrier() {
+    __sync_synchronize();
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
-SysLogger::SysLogger() : Object(), LoggerConsumerI() {
+SysLogger::SysLogger() :
+        Object(),
+        LoggerConsumerI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
     ident = "";
+    mode = SysLoggerModeSynchronous;
+    socketPath = "/dev/log";
+    socketFd = -1;
+    pid = 0;
+    numberOfRecords = 256u;
+    recordSize = 1024u;
+    batchSize = 32u;
+    records = NULL_PTR(char8 *);
+    recordSizes = NULL_PTR(uint32 *);
+    producedRecords = 0u;
+    consumedRecords = 0u;
+    messageHeaders = NULL_PTR(struct mmsghdr *);
+    messageVectors = NULL_PTR(struct iovec *);
+    summaryRecord = NULL_PTR(char8 *);
+    flushTimeout = 10u;
+    rateLimitTicks = 0u;
+    rateLimitBurst = 0u;
+    for (uint32 i = 0u; i < SYSLOGGER_NUMBER_OF_ERROR_TYPES; i++) {
+        rateLimitWindowStart[i] = 0u;
+        rateLimitWindowCount[i] = 0u;
+        suppressedMessages[i] = 0u;
+        reportedSuppressedMessages[i] = 0u;
+    }
+    droppedMessages = 0u;
+    reportedDroppedMessages = 0u;
+    lastSummaryTicks = 0u;
+    sentMessages = 0u;
+    failedMessages = 0u;
+    cpuMask = 0xFFu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    if (!flushSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
 }
 
+/*lint -e{1551} the destructor must guarantee that the thread is stopped and that the queued records are sent.*/
 SysLogger::~SysLogger() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (records != NULL_PTR(char8 *)) {
+        //The thread is stopped: flush whatever is still in the ring
+        SendRecords();
+        SendSummaries(true);
+    }
+    Disconnect();
+    (void) flushSem.Close();
+    if (records != NULL_PTR(char8 *)) {
+        delete[] records;
+    }
+    if (recordSizes != NULL_PTR(uint32 *)) {
+        delete[] recordSizes;
+    }
+    if (messageHeaders != NULL_PTR(struct mmsghdr *)) {
+        delete[] messageHeaders;
+    }
+    if (messageVectors != NULL_PTR(struct iovec *)) {
+        delete[] messageVectors;
+    }
+    if (summaryRecord != NULL_PTR(char8 *)) {
+        delete[] summaryRecord;
+    }
 }
 
 void SysLogger::ConsumeLogMessage(LoggerPage * const logPage) {
     if (logPage != NULL_PTR(LoggerPage *)) {
-        /*lint -e{9130} -e{9117} the LOG_NDELAY and LOG_USER constants are defined by <syslog.h>*/
-        openlog(ident.Buffer(), LOG_NDELAY, LOG_USER);
-
-        StreamString err;
-        PrintToStream(logPage, err);
-        ErrorManagement::ErrorType errorType = logPage->errorInfo.header.errorType;
-
-        int32 syslogErrorCode;
-        if (errorType == ErrorManagement::Information) {
-            syslogErrorCode = LOG_INFO;
-        }
-        else if (errorType == ErrorManagement::Warning) {
-            syslogErrorCode = LOG_WARNING;
-        }
-        else if (errorType == ErrorManagement::FatalError) {
-            syslogErrorCode = LOG_CRIT;
-        }
-        else if (errorType == ErrorManagement::RecoverableError) {
-            syslogErrorCode = LOG_ERR;
-        }
-        else if (errorType == ErrorManagement::Debug) {
-            syslogErrorCode = LOG_DEBUG;
+        uint32 typeIdx = SysLoggerGetErrorTypeIndex(logPage->errorInfo.header.errorType);
+        int32 syslogErrorCode = SYSLOGGER_PRIORITIES[typeIdx];
+        if (mode == SysLoggerModeAsynchronous) {
+            if (AcceptMessage(typeIdx)) {
+                if (!QueueMessage(logPage, syslogErrorCode)) {
+                    droppedMessages++;
+                }
+            }
         }
-        else if (errorType == ErrorManagement::Timeout) {
-            syslogErrorCode = LOG_ERR;
-        }
-        else if (errorType == ErrorManagement::ParametersError) {
-            syslogErrorCode = LOG_CRIT;
-        }
-        else if (errorType == ErrorManagement::CommunicationError) {
-            syslogErrorCode = LOG_CRIT;
-        }
-        else if (errorType == ErrorManagement::NoError) {
-            syslogErrorCode = LOG_INFO;
-        }
-        else if (errorType == ErrorManagement::Completed) {
-            syslogErrorCode = LOG_WARNING;
+        else {
+            /*lint -e{9130} -e{9117} the LOG_NDELAY and LOG_USER constants are defined by <syslog.h>*/
+            openlog(ident.Buffer(), LOG_NDELAY, LOG_USER);
+
+            StreamString err;
+            PrintToStream(logPage, err);
+            syslog(syslogErrorCode, "%s", err.Buffer());
         }
-        else if (errorType == ErrorManagement::NotCompleted) {
-            syslogErrorCode = LOG_WARNING;
+    }
+}
+
+bool SysLogger::AcceptMessage(const uint32 typeIdx) {
+    bool accept = (rateLimitBurst == 0u);
+    if (!accept) {
+        uint64 now = HighResolutionTimer::Counter();
+        if ((now - rateLimitWindowStart[typeIdx]) >= rateLimitTicks) {
+            rateLimitWindowStart[typeIdx] = now;
+            rateLimitWindowCount[typeIdx] = 0u;
         }
-        else if (errorType == ErrorManagement::ErrorAccessDenied) {
-            syslogErrorCode = LOG_ERR;
+        accept = (rateLimitWindowCount[typeIdx] < rateLimitBurst);
+        if (accept) {
+            rateLimitWindowCount[typeIdx]++;
         }
-        else if (errorType == ErrorManagement::InitialisationError) {
-            syslogErrorCode = LOG_CRIT;
+        else {
+            suppressedMessages[typeIdx]++;
         }
-        else if (errorType == ErrorManagement::InternalSetupError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+    return accept;
+}
+
+bool SysLogger::QueueMessage(LoggerPage * const logPage,
+                             const int32 priority) {
+    SysLoggerBarrier();
+    //Only this method writes producedRecords and only the SysLogger thread writes consumedRecords
+    bool ok = ((producedRecords - consumedRecords) < numberOfRecords);
+    if (ok) {
+        uint32 slot = (producedRecords % numberOfRecords);
+        /*lint -e{613} records and recordSizes cannot be NULL in Mode == Asynchronous*/
+        StreamMemoryReference recordStream(&records[slot * recordSize], recordSize);
+        ok = PrintHeader(recordStream, priority);
+        if (ok) {
+            //Messages which do not fit in the record are truncated
+            PrintToStream(logPage, recordStream);
+            recordSizes[slot] = static_cast<uint32>(recordStream.Size());
+            //The record shall be complete before the SysLogger thread can see it
+            SysLoggerBarrier();
+            producedRecords++;
+            if ((producedRecords - consumedRecords) >= batchSize) {
+                (void) flushSem.Post();
+            }
         }
-        else if (errorType == ErrorManagement::OSError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+    return ok;
+}
+
+bool SysLogger::PrintHeader(BufferedStreamI &stream,
+                            const int32 priority) const {
+    //Same header that syslog() sends to the local syslog daemon: <PRI>Mmm dd hh:mm:ss ident[pid]:
+    time_t now = time(NULL_PTR(time_t *));
+    struct tm nowTm;
+    char8 timestamp[32];
+    timestamp[0] = '\0';
+    if (localtime_r(&now, &nowTm) != NULL_PTR(struct tm *)) {
+        (void) strftime(&timestamp[0], sizeof(timestamp), "%h %e %T", &nowTm);
+    }
+    return stream.Printf("<%d>%s %s[%d]: ", (SYSLOGGER_FACILITY | priority), &timestamp[0], ident.Buffer(), pid);
+}
+
+bool SysLogger::Connect() {
+    if (socketFd < 0) {
+        socketFd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (socketFd >= 0) {
+            struct sockaddr_un address;
+            (void) MemoryOperationsHelper::Set(&address, '\0', static_cast<uint32>(sizeof(address)));
+            address.sun_family = AF_UNIX;
+            (void) StringHelper::CopyN(&address.sun_path[0], socketPath.Buffer(), static_cast<uint32>(sizeof(address.sun_path) - 1u));
+            /*lint -e{740} -e{929} -e{9176} sockaddr_un is a sockaddr*/
+            if (connect(socketFd, reinterpret_cast<struct sockaddr *>(&address), static_cast<socklen_t>(sizeof(address))) != 0) {
+                Disconnect();
+            }
         }
-        else if (errorType == ErrorManagement::IllegalOperation) {
-            syslogErrorCode = LOG_ERR;
+    }
+    return (socketFd >= 0);
+}
+
+void SysLogger::Disconnect() {
+    if (socketFd >= 0) {
+        (void) close(socketFd);
+        socketFd = -1;
+    }
+}
+
+void SysLogger::SendRecords() {
+    bool done = (records == NULL_PTR(char8 *));
+    while (!done) {
+        SysLoggerBarrier();
+        uint32 nOfRecords = (producedRecords - consumedRecords);
+        if (nOfRecords > batchSize) {
+            nOfRecords = batchSize;
         }
-        else if (errorType == ErrorManagement::ErrorSharing) {
-            syslogErrorCode = LOG_ERR;
+        done = (nOfRecords == 0u);
+        uint32 nOfConsumed = 0u;
+        if (!done) {
+            if (Connect()) {
+                uint32 i;
+                /*lint -e{613} records, recordSizes, messageHeaders and messageVectors cannot be NULL in Mode == Asynchronous*/
+                for (i = 0u; i < nOfRecords; i++) {
+                    uint32 slot = ((consumedRecords + i) % numberOfRecords);
+                    messageVectors[i].iov_base = &records[slot * recordSize];
+                    messageVectors[i].iov_len = recordSizes[slot];
+                    messageHeaders[i].msg_hdr.msg_iov = &messageVectors[i];
+                    messageHeaders[i].msg_hdr.msg_iovlen = 1u;
+                    messageHeaders[i].msg_len = 0u;
+                }
+                int32 nOfSent = sendmmsg(socketFd, messageHeaders, nOfRecords, 0);
+                if (nOfSent > 0) {
+                    nOfConsumed = static_cast<uint32>(nOfSent);
+                    sentMessages += nOfConsumed;
+                }
+                else if (errno != EINTR) {
+                    //The syslog daemon went away: discard the batch and reconnect in the next batch
+                    Disconnect();
+                    nOfConsumed = nOfRecords;
+                    failedMessages += nOfConsumed;
+                }
+                else {
+                    //Interrupted: try again
+                }
+            }
+            else {
+                //Nobody is listening: discard everything which is queued and try again in the next flush
+                nOfConsumed = (producedRecords - consumedRecords);
+                failedMessages += nOfConsumed;
+                done = true;
+            }
         }
-        else if (errorType == ErrorManagement::Exception) {
-            syslogErrorCode = LOG_CRIT;
+        //The records shall no longer be used before they are released to ConsumeLogMessage
+        SysLoggerBarrier();
+        consumedRecords += nOfConsumed;
+    }
+}
+
+void SysLogger::SendSummaries(const bool force) {
+    uint64 now = HighResolutionTimer::Counter();
+    if ((force) || ((now - lastSummaryTicks) >= rateLimitTicks)) {
+        lastSummaryTicks = now;
+        for (uint32 i = 0u; i < SYSLOGGER_NUMBER_OF_ERROR_TYPES; i++) {
+            uint32 nOfSuppressed = suppressedMessages[i];
+            if (nOfSuppressed != reportedSuppressedMessages[i]) {
+                SendSummary(SYSLOGGER_PRIORITIES[i], (nOfSuppressed - reportedSuppressedMessages[i]), SYSLOGGER_TYPE_NAMES[i], "suppressed");
+                reportedSuppressedMessages[i] = nOfSuppressed;
+            }
         }
-        else if (errorType == ErrorManagement::UnsupportedFeature) {
-            syslogErrorCode = LOG_CRIT;
+        uint32 nOfDropped = droppedMessages;
+        if (nOfDropped != reportedDroppedMessages) {
+            /*lint -e{9130} -e{9117} the LOG_WARNING constant is defined by <syslog.h>*/
+            SendSummary(LOG_WARNING, (nOfDropped - reportedDroppedMessages), "", "dropped (the SysLogger ring was full)");
+            reportedDroppedMessages = nOfDropped;
         }
-        else if (errorType == ErrorManagement::SyntaxError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+}
+
+void SysLogger::SendSummary(const int32 priority,
+                            const uint32 nOfMessages,
+                            const char8 * const typeName,
+                            const char8 * const reason) {
+    if ((summaryRecord != NULL_PTR(char8 *)) && (Connect())) {
+        StreamMemoryReference summaryStream(summaryRecord, recordSize);
+        bool ok = PrintHeader(summaryStream, priority);
+        if (ok) {
+            if (StringHelper::Length(typeName) > 0u) {
+                ok = summaryStream.Printf("%u %s messages %s", nOfMessages, typeName, reason);
+            }
+            else {
+                ok = summaryStream.Printf("%u messages %s", nOfMessages, reason);
+            }
         }
-        else {
-            syslogErrorCode = LOG_CRIT;
+        if (ok) {
+            if (send(socketFd, summaryRecord, static_cast<size_t>(summaryStream.Size()), 0) < 0) {
+                Disconnect();
+            }
         }
-        syslog(syslogErrorCode, "%s", err.Buffer());
     }
 }
 
+ErrorManagement::ErrorType SysLogger::Execute(ExecutionInfo & info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Either BatchSize records were queued or the FlushPeriod elapsed
+        (void) flushSem.ResetWait(flushTimeout);
+        SendRecords();
+        SendSummaries(false);
+    }
+    return ErrorManagement::NoError;
+}
+
 bool SysLogger::Initialise(StructuredDataI &data) {
     bool ok = Object::Initialise(data);
     if (ok) {
@@ -136,9 +438,136 @@ bool SysLogger::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The Ident shall be specified");
         }
     }
+    if (ok) {
+        StreamString modeStr;
+        if (data.Read("Mode", modeStr)) {
+            if (modeStr == "Asynchronous") {
+                mode = SysLoggerModeAsynchronous;
+            }
+            else {
+                ok = (modeStr == "Synchronous");
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported Mode %s. Mode shall be Synchronous or Asynchronous", modeStr.Buffer());
+                }
+            }
+        }
+    }
+    if ((ok) && (mode == SysLoggerModeAsynchronous)) {
+        if (data.Read("Socket", socketPath)) {
+            struct sockaddr_un address;
+            ok = ((socketPath.Size() > 0u) && (socketPath.Size() < sizeof(address.sun_path)));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid Socket %s", socketPath.Buffer());
+            }
+        }
+        if (ok) {
+            (void) data.Read("NumberOfRecords", numberOfRecords);
+            (void) data.Read("RecordSize", recordSize);
+            (void) data.Read("BatchSize", batchSize);
+            ok = (numberOfRecords > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfRecords shall be > 0");
+            }
+        }
+        if (ok) {
+            ok = (recordSize >= 64u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "RecordSize shall be >= 64");
+            }
+        }
+        if (ok) {
+            ok = ((batchSize > 0u) && (batchSize <= numberOfRecords));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize shall be > 0 and <= NumberOfRecords");
+            }
+        }
+        uint32 flushPeriod = 10u;
+        uint32 rateLimitPeriod = 1000u;
+        if (ok) {
+            (void) data.Read("FlushPeriod", flushPeriod);
+            (void) data.Read("RateLimitPeriod", rateLimitPeriod);
+            (void) data.Read("RateLimitBurst", rateLimitBurst);
+            ok = ((flushPeriod > 0u) && (rateLimitPeriod > 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "FlushPeriod and RateLimitPeriod shall be > 0");
+            }
+        }
+        if (ok) {
+            flushTimeout = flushPeriod;
+            float64 rateLimitTicksF = (static_cast<float64>(rateLimitPeriod) * 1e-3) * static_cast<float64>(HighResolutionTimer::Frequency());
+            rateLimitTicks = static_cast<uint64>(rateLimitTicksF);
+            if (!data.Read("CPUMask", cpuMask)) {
+                REPORT_ERROR(ErrorManagement::Information, "No CPUMask defined. Using default = 0x%x", cpuMask);
+            }
+            if (!data.Read("StackSize", stackSize)) {
+                REPORT_ERROR(ErrorManagement::Information, "No StackSize defined. Using default = %d", stackSize);
+            }
+            pid = static_cast<int32>(getpid());
+            records = new char8[numberOfRecords * recordSize];
+            recordSizes = new uint32[numberOfRecords];
+            messageHeaders = new struct mmsghdr[batchSize];
+            messageVectors = new struct iovec[batchSize];
+            summaryRecord = new char8[recordSize];
+            ok = MemoryOperationsHelper::Set(messageHeaders, '\0', static_cast<uint32>(sizeof(struct mmsghdr)) * batchSize);
+        }
+        if (ok) {
+            //One connection for the lifetime of the SysLogger (reconnected by the thread only if the syslog daemon goes away)
+            if (!Connect()) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not connect to %s. Will try again before sending the messages.", socketPath.Buffer());
+            }
+            executor.SetName(GetName());
+            executor.SetCPUMask(cpuMask);
+            executor.SetStackSize(stackSize);
+            lastSummaryTicks = HighResolutionTimer::Counter();
+            ok = (executor.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the SysLogger thread");
+            }
+        }
+    }
     return ok;
 }
 
+SysLoggerMode SysLogger::GetMode() const {
+    return mode;
+}
+
+uint32 SysLogger::GetNumberOfRecords() const {
+    return numberOfRecords;
+}
+
+uint32 SysLogger::GetRecordSize() const {
+    return recordSize;
+}
+
+uint32 SysLogger::GetBatchSize() const {
+    return batchSize;
+}
+
+uint32 SysLogger::GetRateLimitBurst() const {
+    return rateLimitBurst;
+}
+
+uint32 SysLogger::GetNumberOfSentMessages() const {
+    return sentMessages;
+}
+
+uint32 SysLogger::GetNumberOfSuppressedMessages() const {
+    uint32 nOfSuppressed = 0u;
+    for (uint32 i = 0u; i < SYSLOGGER_NUMBER_OF_ERROR_TYPES; i++) {
+        nOfSuppressed += suppressedMessages[i];
+    }
+    return nOfSuppressed;
+}
+
+uint32 SysLogger::GetNumberOfDroppedMessages() const {
+    return droppedMessages;
+}
+
+uint32 SysLogger::GetNumberOfFailedMessages() const {
+    return failedMessages;
+}
+
 CLASS_REGISTER(SysLogger, "1.0")
 
 }
@@ -27,12 +27,17 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <sys/socket.h>
+#include <sys/uio.h>
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "LoggerConsumerI.h"
 #include "Object.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -40,6 +45,17 @@
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe {
+
+typedef enum {
+    SysLoggerModeSynchronous,
+    SysLoggerModeAsynchronous
+} SysLoggerMode;
+
+/**
+ * Number of message types (one per ErrorManagement::ErrorType handled by the SysLogger plus one for any other type).
+ */
+static const uint32 SYSLOGGER_NUMBER_OF_ERROR_TYPES = 21u;
+
 /**
  * @brief A LoggerConsumerI which outputs the log messages to a syslog.
  * @details The configuration syntax is (names are only given as an example):
@@ -50,10 +66,30 @@ namespace MARTe {
  *     Format = ItOoFm //Compulsory. As described in LoggerConsumerI::LoadPrintPreferences
  *     PrintKeys = 1 //Optional. As described in LoggerConsumerI::LoadPrintPreferences
  *     Ident = myapp //Compulsory. Name of the syslog ident.
+ *     Mode = Synchronous //Optional (default Synchronous)
+ *       If Mode == Synchronous each message is sent with a blocking syslog() call in the context of the LoggerService thread.
+ *       If Mode == Asynchronous the messages are formatted into a pre-allocated ring and sent in batches by a dedicated thread (see below).
+ *     Socket = /dev/log //Optional (default /dev/log). Only for Mode == Asynchronous. Path of the local datagram socket of the syslog daemon.
+ *     NumberOfRecords = 256 //Optional (default 256). Only for Mode == Asynchronous. Number of messages that can be queued in the ring.
+ *     RecordSize = 1024 //Optional (default 1024). Only for Mode == Asynchronous. Maximum size of a message (longer messages are truncated).
+ *     BatchSize = 32 //Optional (default 32). Only for Mode == Asynchronous. Maximum number of messages sent with each sendmmsg call.
+ *     FlushPeriod = 10 //Optional (default 10 ms). Only for Mode == Asynchronous. Maximum time that a message waits in the ring.
+ *     RateLimitPeriod = 1000 //Optional (default 1000 ms). Only for Mode == Asynchronous. Period of the rate limiter.
+ *     RateLimitBurst = 0 //Optional (default 0, i.e. no limit). Only for Mode == Asynchronous. Maximum number of messages of each type per RateLimitPeriod.
+ *     CPUMask = 0xFF //Optional. Only for Mode == Asynchronous. CPU affinity of the thread which sends the messages.
+ *     StackSize = 1048576 //Optional. Only for Mode == Asynchronous. Stack size of the thread which sends the messages.
  * }
  * </pre>
+ *
+ * In Mode == Asynchronous ConsumeLogMessage never blocks nor allocates memory: the message is formatted (with the syslog header) directly into
+ * the next free record of the ring, which is shared without locks with the thread that sends the records. The thread keeps one connection to the
+ * Socket and wakes up every FlushPeriod (or as soon as BatchSize records are queued) to send all the queued records with sendmmsg.
+ * If the ring is full the message is dropped. If RateLimitBurst > 0, at most RateLimitBurst messages of each type (ErrorManagement::ErrorType) are
+ * accepted every RateLimitPeriod and the others are suppressed before being formatted.
+ * The number of suppressed (per type) and dropped messages is sent, at most once every RateLimitPeriod, as a "N messages suppressed"
+ * (or "N messages dropped") summary message.
  */
-class SysLogger: public Object, public LoggerConsumerI {
+class SysLogger: public Object, public LoggerConsumerI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -63,27 +99,295 @@ public:
     SysLogger();
 
     /**
-     * @brief Destructor. Closes the console.NOOP.
+     * @brief Destructor. In Mode == Asynchronous stops the thread and sends the records which are still in the ring.
      */
     virtual ~SysLogger();
 
     /**
      * @brief Prints the logPage in the console output.
+     * @details In Mode == Asynchronous the logPage is formatted into the ring (if accepted by the rate limiter and if the ring is not full)
+     * and sent later by the SysLogger thread.
      * @param logPage the log message to be printed.
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
     /**
-     * @brief Calls Object::Initialise and reads the Format, Ident and PrintKeys parameters (see class description) .
+     * @brief Calls Object::Initialise and reads the parameters (see class description).
+     * @details In Mode == Asynchronous allocates the ring, connects to the Socket and starts the thread which sends the records.
      * @param[in] data see Object::Initialise.
      * @return true if Object::Initialise returns true and if the compulsory are correctly set..
      */
     virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Sends the records queued in the ring (Mode == Asynchronous).
+     * @details Waits until BatchSize records are queued or FlushPeriod elapses and sends all the queued records and,
+     * if RateLimitPeriod elapsed since the last time, the summary of the suppressed and dropped messages.
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
+    /**
+     * @brief Gets the configured Mode.
+     * @return the configured Mode.
+     */
+    SysLoggerMode GetMode() const;
+
+    /**
+     * @brief Gets the number of records of the ring.
+     * @return the number of records of the ring.
+     */
+    uint32 GetNumberOfRecords() const;
+
+    /**
+     * @brief Gets the maximum size of a record.
+     * @return the maximum size of a record.
+     */
+    uint32 GetRecordSize() const;
+
+    /**
+     * @brief Gets the maximum number of records sent with each sendmmsg call.
+     * @return the maximum number of records sent with each sendmmsg call.
+     */
+    uint32 GetBatchSize() const;
+
+    /**
+     * @brief Gets the maximum number of messages of each type accepted every RateLimitPeriod.
+     * @return the maximum number of messages of each type accepted every RateLimitPeriod (0 if there is no limit).
+     */
+    uint32 GetRateLimitBurst() const;
+
+    /**
+     * @brief Gets the number of records (not including the summaries) sent to the Socket.
+     * @return the number of records sent to the Socket.
+     */
+    uint32 GetNumberOfSentMessages() const;
+
+    /**
+     * @brief Gets the number of messages suppressed by the rate limiter.
+     * @return the number of messages suppressed by the rate limiter.
+     */
+    uint32 GetNumberOfSuppressedMessages() const;
+
+    /**
+     * @brief Gets the number of messages dropped because the ring was full.
+     * @return the number of messages dropped because the ring was full.
+     */
+    uint32 GetNumberOfDroppedMessages() const;
+
+    /**
+     * @brief Gets the number of records that could not be sent to the Socket.
+     * @return the number of records that could not be sent to the Socket.
+     */
+    uint32 GetNumberOfFailedMessages() const;
+
 private:
+
+    /**
+     * @brief Applies the rate limiter to a message of type \a typeIdx.
+     * @return true if the message is to be sent.
+     */
+    bool AcceptMessage(const uint32 typeIdx);
+
+    /**
+     * @brief Formats the logPage into the next free record of the ring.
+     * @return false if the ring is full.
+     */
+    bool QueueMessage(LoggerPage * const logPage,
+                      const int32 priority);
+
+    /**
+     * @brief Writes the syslog header (priority, timestamp, ident and pid) into \a stream.
+     * @return true if the header was written.
+     */
+    bool PrintHeader(BufferedStreamI &stream,
+                     const int32 priority) const;
+
+    /**
+     * @brief Connects to the Socket, if not already connected.
+     * @return true if the SysLogger is connected to the Socket.
+     */
+    bool Connect();
+
+    /**
+     * @brief Closes the connection to the Socket.
+     */
+    void Disconnect();
+
+    /**
+     * @brief Sends all the records which are queued in the ring, BatchSize records per sendmmsg call.
+     */
+    void SendRecords();
+
+    /**
+     * @brief Sends the summary of the messages suppressed and dropped since the last summary.
+     * @param[in] force if false the summary is only sent if RateLimitPeriod elapsed since the last summary.
+     */
+    void SendSummaries(const bool force);
+
+    /**
+     * @brief Sends one summary message.
+     */
+    void SendSummary(const int32 priority,
+                     const uint32 nOfMessages,
+                     const char8 * const typeName,
+                     const char8 * const reason);
+
     /**
      * The syslog ident
      */
     StreamString ident;
+
+    /**
+     * The configured Mode.
+     */
+    SysLoggerMode mode;
+
+    /**
+     * Path of the syslog daemon socket.
+     */
+    StreamString socketPath;
+
+    /**
+     * The socket connected to socketPath (-1 if not connected).
+     */
+    int32 socketFd;
+
+    /**
+     * The pid written in the syslog header.
+     */
+    int32 pid;
+
+    /**
+     * Number of records of the ring.
+     */
+    uint32 numberOfRecords;
+
+    /**
+     * Maximum size of each record.
+     */
+    uint32 recordSize;
+
+    /**
+     * Maximum number of records sent with each sendmmsg call.
+     */
+    uint32 batchSize;
+
+    /**
+     * The records (numberOfRecords x recordSize).
+     */
+    char8 *records;
+
+    /**
+     * The number of bytes used by each record.
+     */
+    uint32 *recordSizes;
+
+    /**
+     * Number of records queued since the beginning. Only written by ConsumeLogMessage.
+     */
+    volatile uint32 producedRecords;
+
+    /**
+     * Number of records sent (or discarded) since the beginning. Only written by the SysLogger thread.
+     */
+    volatile uint32 consumedRecords;
+
+    /**
+     * The headers of the sendmmsg call (batchSize).
+     */
+    struct mmsghdr *messageHeaders;
+
+    /**
+     * The io vectors of the sendmmsg call (batchSize).
+     */
+    struct iovec *messageVectors;
+
+    /**
+     * Memory where the summaries are formatted (recordSize).
+     */
+    char8 *summaryRecord;
+
+    /**
+     * Time that the SysLogger thread waits for BatchSize records to be queued.
+     */
+    TimeoutType flushTimeout;
+
+    /**
+     * Posted by ConsumeLogMessage when BatchSize records are queued.
+     */
+    EventSem flushSem;
+
+    /**
+     * Period of the rate limiter in HighResolutionTimer ticks.
+     */
+    uint64 rateLimitTicks;
+
+    /**
+     * Maximum number of messages of each type per rateLimitTicks (0 if there is no limit).
+     */
+    uint32 rateLimitBurst;
+
+    /**
+     * Start of the current rate limiter window of each type. Only used by ConsumeLogMessage.
+     */
+    uint64 rateLimitWindowStart[SYSLOGGER_NUMBER_OF_ERROR_TYPES];
+
+    /**
+     * Number of messages accepted in the current window of each type. Only used by ConsumeLogMessage.
+     */
+    uint32 rateLimitWindowCount[SYSLOGGER_NUMBER_OF_ERROR_TYPES];
+
+    /**
+     * Number of messages suppressed of each type. Only written by ConsumeLogMessage.
+     */
+    volatile uint32 suppressedMessages[SYSLOGGER_NUMBER_OF_ERROR_TYPES];
+
+    /**
+     * Number of messages of each type already reported in a summary. Only used by the SysLogger thread.
+     */
+    uint32 reportedSuppressedMessages[SYSLOGGER_NUMBER_OF_ERROR_TYPES];
+
+    /**
+     * Number of messages dropped because the ring was full. Only written by ConsumeLogMessage.
+     */
+    volatile uint32 droppedMessages;
+
+    /**
+     * Number of dropped messages already reported in a summary. Only used by the SysLogger thread.
+     */
+    uint32 reportedDroppedMessages;
+
+    /**
+     * Time of the last summary. Only used by the SysLogger thread.
+     */
+    uint64 lastSummaryTicks;
+
+    /**
+     * Number of records sent. Only written by the SysLogger thread.
+     */
+    volatile uint32 sentMessages;
+
+    /**
+     * Number of records that could not be sent. Only written by the SysLogger thread.
+     */
+    volatile uint32 failedMessages;
+
+    /**
+     * The thread which sends the records.
+     */
+    SingleThreadService executor;
+
+    /**
+     * CPU affinity of the executor.
+     */
+    uint32 cpuMask;
+
+    /**
+     * Stack size of the executor.
+     */
+    uint32 stackSize;
 };
 }
 
@@ -139,4 +139,29 @@ TEST(EPICSCAInputGTest,TestExecute_Arrays) {
     EPICSCAInputTest test;
     ASSERT_TRUE(test.TestExecute_Arrays());
 }
+
+TEST(EPICSCAInputGTest,TestExecute_TimestampUpdated) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestExecute_TimestampUpdated());
+}
+
+TEST(EPICSCAInputGTest,TestExecute_TimestampUpdated_TwoGAMs) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestExecute_TimestampUpdated_TwoGAMs());
+}
+
+TEST(EPICSCAInputGTest,TestSetConfiguredDatabase_False_FieldType) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_FieldType());
+}
+
+TEST(EPICSCAInputGTest,TestSetConfiguredDatabase_False_FieldNoValue) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_FieldNoValue());
+}
+
+TEST(EPICSCAInputGTest,TestSetConfiguredDatabase_False_UnsupportedField) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_UnsupportedField());
+}
 	
@@ -131,6 +131,37 @@ public:
 };
 CLASS_REGISTER(EPICSCAInputGAMTestHelper, "1.0")
 
+/**
+ * @brief GAM which reads the value, the timestamp and the updated signals of a PV from a given EPICSCAInput
+ */
+class EPICSCAInputFieldGAMTestHelper: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()EPICSCAInputFieldGAMTestHelper() {
+        valueSignal = NULL;
+        timestampSignal = NULL;
+        updatedSignal = NULL;
+    }
+
+    virtual ~EPICSCAInputFieldGAMTestHelper() {
+    }
+
+    virtual bool Setup() {
+        using namespace MARTe;
+        valueSignal = reinterpret_cast<float64 *>(GetInputSignalMemory(0u));
+        timestampSignal = reinterpret_cast<uint64 *>(GetInputSignalMemory(1u));
+        updatedSignal = reinterpret_cast<uint32 *>(GetInputSignalMemory(2u));
+        return true;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+    MARTe::float64 *valueSignal;
+    MARTe::uint64 *timestampSignal;
+    MARTe::uint32 *updatedSignal;
+};
+CLASS_REGISTER(EPICSCAInputFieldGAMTestHelper, "1.0")
+
 /**
  * @brief Manual scheduler to test the correct interface between the EPICSCAInput and the GAMs
  */
@@ -909,6 +940,363 @@ static const MARTe::char8 * const config7 = ""
         "    }"
         "}";
 
+//Configuration with the Timestamp and Updated fields of a PV
+static const MARTe::char8 * const config8 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputFieldGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Timestamp"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Updated"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with a Timestamp field with the wrong type
+static const MARTe::char8 * const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputFieldGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Timestamp"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Updated"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an Updated field of a PV without value signal
+static const MARTe::char8 * const config10 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputFieldGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Timestamp"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float32\""
+        "                    Field = Updated"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an unsupported field
+static const MARTe::char8 * const config11 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputFieldGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Timestamp"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Severity"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with two GAMs reading the Timestamp and Updated fields of a PV
+static const MARTe::char8 * const config12 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputFieldGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM2 = {"
+        "            Class = EPICSCAInputFieldGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "                SignalFloat64Timestamp = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Timestamp"
+        "                }"
+        "                SignalFloat64Updated = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                    Field = Updated"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1 GAM2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -963,7 +1351,7 @@ bool EPICSCAInputTest::TestGetBrokerName() {
     using namespace MARTe;
     EPICSCAInput test;
     ConfigurationDatabase cdb;
-    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapInputBroker") == 0);
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "EPICSCAInputBroker") == 0);
 
     return ok;
 }
@@ -1337,3 +1725,214 @@ bool EPICSCAInputTest::TestExecute_Arrays() {
     return ok;
 }
 
+bool EPICSCAInputTest::TestExecute_TimestampUpdated() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config8, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAInputFieldGAMTestHelper> gam1;
+    ReferenceT<EPICSCAInputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+
+    if (ok) {
+        ok = (ca_context_create(ca_enable_preemptive_callback));
+    }
+    chid pvChid = NULL_PTR(chid);
+    if (ok) {
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        ok = (ca_create_channel("MARTe2::EPICSCAInput::Test::Float64", NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvChid) == ECA_NORMAL);
+    }
+    float64 float64Value = 31.5;
+    //Any EPICS timestamp after 2020 (in ns since the UNIX epoch)
+    const uint64 minTimestamp = 1577836800000000000ULL;
+    uint64 timestamp = 0u;
+    if (ok) {
+        bool done = false;
+        uint32 totalUpdates = 0u;
+        uint32 timeOutCounts = 50;
+        while ((!done) && (timeOutCounts > 0u)) {
+            ca_put(DBR_DOUBLE, pvChid, &float64Value);
+            ca_pend_io(1.0);
+            scheduler->ExecuteThreadCycle(0);
+            totalUpdates += *gam1->updatedSignal;
+            done = (*gam1->valueSignal == float64Value);
+            done &= (totalUpdates > 0u);
+            done &= (*gam1->timestampSignal > minTimestamp);
+            if (!done) {
+                timeOutCounts--;
+                Sleep::Sec(0.1);
+            }
+        }
+        ok = done;
+        timestamp = *gam1->timestampSignal;
+    }
+    if (ok) {
+        //No new values: the updated signal shall be reset and the timestamp kept
+        Sleep::Sec(0.2);
+        scheduler->ExecuteThreadCycle(0);
+        ok = (*gam1->updatedSignal == 0u);
+        if (ok) {
+            ok = (*gam1->timestampSignal == timestamp);
+        }
+        if (ok) {
+            ok = (*gam1->valueSignal == float64Value);
+        }
+    }
+    if (ok) {
+        float64Value *= 2;
+        bool done = false;
+        uint32 timeOutCounts = 50;
+        while ((!done) && (timeOutCounts > 0u)) {
+            ca_put(DBR_DOUBLE, pvChid, &float64Value);
+            ca_pend_io(1.0);
+            scheduler->ExecuteThreadCycle(0);
+            done = (*gam1->valueSignal == float64Value);
+            if (!done) {
+                timeOutCounts--;
+                Sleep::Sec(0.1);
+            }
+        }
+        ok = done;
+        if (ok) {
+            ok = (*gam1->updatedSignal > 0u);
+        }
+        if (ok) {
+            ok = (*gam1->timestampSignal >= timestamp);
+        }
+    }
+
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    if (pvChid != NULL_PTR(chid)) {
+        ca_clear_channel(pvChid);
+    }
+    ca_detach_context();
+    ca_context_destroy();
+    godb->Purge();
+    return ok;
+}
+
+bool EPICSCAInputTest::TestExecute_TimestampUpdated_TwoGAMs() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config12, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAInputFieldGAMTestHelper> gam1;
+    ReferenceT<EPICSCAInputFieldGAMTestHelper> gam2;
+    ReferenceT<EPICSCAInputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        gam2 = godb->Find("Test.Functions.GAM2");
+        ok = gam2.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+
+    if (ok) {
+        ok = (ca_context_create(ca_enable_preemptive_callback));
+    }
+    chid pvChid = NULL_PTR(chid);
+    if (ok) {
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        ok = (ca_create_channel("MARTe2::EPICSCAInput::Test::Float64", NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvChid) == ECA_NORMAL);
+    }
+    float64 float64Value = 17.25;
+    if (ok) {
+        //Both GAMs shall see the same snapshot, including the number of updates, in the same cycle
+        bool done = false;
+        uint32 timeOutCounts = 50;
+        while ((!done) && (timeOutCounts > 0u) && (ok)) {
+            ca_put(DBR_DOUBLE, pvChid, &float64Value);
+            ca_pend_io(1.0);
+            scheduler->ExecuteThreadCycle(0);
+            ok = (*gam1->updatedSignal == *gam2->updatedSignal);
+            if (ok) {
+                ok = (*gam1->valueSignal == *gam2->valueSignal);
+            }
+            if (ok) {
+                ok = (*gam1->timestampSignal == *gam2->timestampSignal);
+            }
+            done = (*gam2->valueSignal == float64Value);
+            done &= (*gam2->updatedSignal > 0u);
+            if (!done) {
+                timeOutCounts--;
+                Sleep::Sec(0.1);
+            }
+        }
+        if (ok) {
+            ok = done;
+        }
+    }
+    if (ok) {
+        //No new values: the updated signal shall be reset for both GAMs
+        Sleep::Sec(0.2);
+        scheduler->ExecuteThreadCycle(0);
+        ok = (*gam1->updatedSignal == 0u);
+        if (ok) {
+            ok = (*gam2->updatedSignal == 0u);
+        }
+        if (ok) {
+            ok = (*gam2->valueSignal == float64Value);
+        }
+    }
+
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    if (pvChid != NULL_PTR(chid)) {
+        ca_clear_channel(pvChid);
+    }
+    ca_detach_context();
+    ca_context_destroy();
+    godb->Purge();
+    return ok;
+}
+
+bool EPICSCAInputTest::TestSetConfiguredDatabase_False_FieldType() {
+    return !TestIntegratedInApplication(config9, true);
+}
+
+bool EPICSCAInputTest::TestSetConfiguredDatabase_False_FieldNoValue() {
+    return !TestIntegratedInApplication(config10, true);
+}
+
+bool EPICSCAInputTest::TestSetConfiguredDatabase_False_UnsupportedField() {
+    return !TestIntegratedInApplication(config11, true);
+}
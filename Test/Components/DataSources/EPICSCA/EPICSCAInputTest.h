@@ -145,6 +145,31 @@ public:
      */
     bool TestExecute_Arrays();
 
+    /**
+     * @brief Tests that the EPICS timestamp and the number of updates since the previous cycle are captured in the Timestamp and Updated signals.
+     */
+    bool TestExecute_TimestampUpdated();
+
+    /**
+     * @brief Tests that two GAMs reading the DataSource in the same cycle get the same snapshot and number of updates.
+     */
+    bool TestExecute_TimestampUpdated_TwoGAMs();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a Timestamp signal is not uint64.
+     */
+    bool TestSetConfiguredDatabase_False_FieldType();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if an Updated signal has no value signal with the same PVName.
+     */
+    bool TestSetConfiguredDatabase_False_FieldNoValue();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the Field is not supported.
+     */
+    bool TestSetConfiguredDatabase_False_UnsupportedField();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -100,6 +100,16 @@ TEST(EPICSCAOutputGTest,TestInitialise_False_NumberOfBuffers) {
     ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers());
 }
 
+TEST(EPICSCAOutputGTest,TestInitialise_BatchPuts) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_BatchPuts());
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_False_BatchPuts) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BatchPuts());
+}
+
 // TEST(EPICSCAOutputGTest,TestAsyncCaPut) {
 //     EPICSCAOutputTest test;
 //     ASSERT_TRUE(test.TestAsyncCaPut());
@@ -165,6 +175,11 @@ TEST(EPICSCAOutputGTest,TestExecute_Arrays) {
     ASSERT_TRUE(test.TestExecute_Arrays());
 }
 
+TEST(EPICSCAOutputGTest,TestExecute_BatchPuts_Deadband) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_BatchPuts_Deadband());
+}
+
 TEST(EPICSCAOutputGTest,TestIsIgnoringBufferOverrun) {
     EPICSCAOutputTest test;
     ASSERT_TRUE(test.TestIsIgnoringBufferOverrun());
@@ -1036,6 +1036,67 @@ static const MARTe::char8 * const config8 = ""
         "    }"
         "}";
 
+static const MARTe::char8 * const configBatch = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAOutputTest = {"
+        "            Class = EPICSCAOutput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            NumberOfBuffers = 8"
+        "            BatchPuts = \"yes\""
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::UInt32\""
+        "                    Deadband = 5"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1164,6 +1225,35 @@ bool EPICSCAOutputTest::TestInitialise_False_NumberOfBuffers() {
     return !test.Initialise(cdb);
 }
 
+bool EPICSCAOutputTest::TestInitialise_BatchPuts() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("BatchPuts", "yes");
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = !test.IsBatchingPuts();
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        ok = test.IsBatchingPuts();
+    }
+    return ok;
+}
+
+bool EPICSCAOutputTest::TestInitialise_False_BatchPuts() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("BatchPuts", "true");
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool EPICSCAOutputTest::TestSetConfiguredDatabase() {
     return TestIntegratedInApplication(config1, true);
 }
@@ -1679,3 +1769,99 @@ bool EPICSCAOutputTest::TestExecute_Arrays() {
     return ok;
 }
 
+bool EPICSCAOutputTest::TestExecute_BatchPuts_Deadband() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(configBatch, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAOutputGAMTestHelper> gam1;
+    ReferenceT<EPICSCAOutputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<EPICSCAOutput> ds;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ds = godb->Find("Test.Data.EPICSCAOutputTest");
+        ok = ds.IsValid();
+    }
+    if (ok) {
+        ok = ds->IsBatchingPuts();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+
+    if (ok) {
+        ok = (ca_context_create(ca_enable_preemptive_callback) == ECA_NORMAL);
+    }
+    chid uint32Chid = NULL_PTR(chid);
+    chid float64Chid = NULL_PTR(chid);
+    if (ok) {
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        ok = (ca_create_channel("MARTe2::EPICSCAInput::Test::UInt32", NULL_PTR(caCh *), NULL_PTR(void *), 20u, &uint32Chid) == ECA_NORMAL);
+    }
+    if (ok) {
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        ok = (ca_create_channel("MARTe2::EPICSCAInput::Test::Float64", NULL_PTR(caCh *), NULL_PTR(void *), 20u, &float64Chid) == ECA_NORMAL);
+    }
+    //Step 0: both values are written. Step 1: the uint32 change is inside the Deadband. Step 2: the uint32 change exceeds the Deadband.
+    const uint32 expectedUInt32[] = { 10u, 10u, 20u };
+    const uint32 writtenUInt32[] = { 10u, 12u, 20u };
+    const float64 writtenFloat64[] = { 1.0, 2.0, 3.0 };
+    uint32 step;
+    for (step = 0u; (step < 3u) && (ok); step++) {
+        *gam1->uint32Signal = writtenUInt32[step];
+        *gam1->float64Signal = writtenFloat64[step];
+        uint32 timeOutCounts = 50u;
+        bool done = false;
+        while ((!done) && (ok)) {
+            scheduler->ExecuteThreadCycle(0);
+            uint32 uint32Value = 0u;
+            float64 float64Value = 0.0;
+            (void) ca_get(DBR_LONG, uint32Chid, &uint32Value);
+            (void) ca_get(DBR_DOUBLE, float64Chid, &float64Value);
+            (void) ca_pend_io(1.0);
+            //The float64 value is put in the same batch as the uint32 value.
+            done = (float64Value == writtenFloat64[step]);
+            if (done) {
+                ok = (uint32Value == expectedUInt32[step]);
+            }
+            else {
+                timeOutCounts--;
+                ok = (timeOutCounts > 0u);
+                Sleep::Sec(0.1);
+            }
+        }
+    }
+    if (ok) {
+        ok = (ds->GetNumberOfFilteredPuts() > 0u);
+    }
+
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    if (uint32Chid != NULL_PTR(chid)) {
+        (void) ca_clear_channel(uint32Chid);
+    }
+    if (float64Chid != NULL_PTR(chid)) {
+        (void) ca_clear_channel(float64Chid);
+    }
+    ca_detach_context();
+    ca_context_destroy();
+    godb->Purge();
+    return ok;
+}
@@ -101,6 +101,16 @@ public:
      */
     bool TestInitialise_False_NumberOfBuffers();
 
+    /**
+     * @brief Tests the Initialise method with BatchPuts = "yes".
+     */
+    bool TestInitialise_BatchPuts();
+
+    /**
+     * @brief Tests the Initialise method with an invalid BatchPuts.
+     */
+    bool TestInitialise_False_BatchPuts();
+
     /**
      * @brief Tests the SetConfiguredDatabase method.
      */
@@ -146,6 +156,12 @@ public:
      */
     bool TestExecute_Arrays();
 
+    /**
+     * @brief Tests that the PV values are correctly written with BatchPuts = "yes" and that
+     * the values which do not exceed the Deadband are not written.
+     */
+    bool TestExecute_BatchPuts_Deadband();
+
     /**
      * @brief Tests the GetCPUMask method.
      */
@@ -159,3 +159,13 @@ TEST(EPICSPVAOutputGTest,TestSynchronise_False_BadSignal) {
     ASSERT_TRUE(test.TestSynchronise_False_BadSignal());
 }
 
+TEST(EPICSPVAOutputGTest,TestSynchronise_AsyncPut) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_AsyncPut());
+}
+
+TEST(EPICSPVAOutputGTest,TestGetChannel) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestGetChannel());
+}
+
@@ -2651,3 +2651,218 @@ bool EPICSPVAOutputTest::TestSynchronise_False_BadSignal() {
 
     return ok;
 }
+
+bool EPICSPVAOutputTest::TestSynchronise_AsyncPut() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+EPICSPVADatabase1 = {\n"
+            "    Class = EPICSPVADatabase\n"
+            "    +RecordOut1 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Structure = {\n"
+            "             SignalUInt = {\n"
+            "                  Type = uint32\n"
+            "             }\n"
+            "        }\n"
+            "    }\n"
+            "}\n"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAM1 = {\n"
+            "            Class = EPICSPVAOutputGAMTestHelper\n"
+            "            OutputSignals = {\n"
+            "                RecordOut1 = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +EPICSPVAOutputTest = {\n"
+            "            Class = EPICSPVAOutput\n"
+            "            CPUMask = 15\n"
+            "            StackSize = 10000000\n"
+            "            NumberOfBuffers = 2\n"
+            "            Signals = {\n"
+            "                RecordOut1 = {\n"
+            "                    Field = SignalUInt\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAM1}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = EPICSPVAOutputSchedulerTestHelper\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSPVAOutput> ds1;
+    if (ok) {
+        ds1 = godb->Find("Test.Data.EPICSPVAOutputTest");
+        ok = ds1.IsValid();
+    }
+    void *signalMemory = NULL_PTR(void *);
+    if (ok) {
+        ok = ds1->GetSignalMemoryBuffer(0u, 0u, signalMemory);
+    }
+    const uint32 numberOfWrites = 10u;
+    uint32 n;
+    for (n = 0u; (n < numberOfWrites) && (ok); n++) {
+        *static_cast<uint32 *>(signalMemory) = (n + 1u);
+        ok = ds1->Synchronise();
+    }
+    const EPICSPVAChannelWrapper *channel = NULL_PTR(const EPICSPVAChannelWrapper *);
+    if (ok) {
+        channel = ds1->GetChannel(0u);
+        ok = (channel != NULL_PTR(const EPICSPVAChannelWrapper *));
+    }
+    //Every staged value is either sent or overwritten by a newer value.
+    uint32 timeOutCounts = 50u;
+    bool done = false;
+    while ((ok) && (!done)) {
+        done = ((channel->GetNumberOfPuts() + channel->GetNumberOfDroppedValues()) == numberOfWrites);
+        if (!done) {
+            Sleep::Sec(0.1);
+            timeOutCounts--;
+            ok = (timeOutCounts > 0u);
+        }
+    }
+    if (ok) {
+        ok = (channel->GetNumberOfPuts() > 0u);
+    }
+    if (ok) {
+        ok = (channel->GetNumberOfFailedPuts() == 0u);
+    }
+    if (ok) {
+        ok = (channel->GetMaxPutLatency() >= channel->GetLastPutLatency());
+    }
+    if (ok) {
+        pvac::ClientProvider provider("pva");
+        pvac::ClientChannel record1(provider.connect("RecordOut1"));
+        epics::pvData::PVStructure::const_shared_pointer getStruct = record1.get();
+        std::shared_ptr<const epics::pvData::PVUInt> uint32Value = getStruct->getSubField<epics::pvData::PVUInt>("SignalUInt");
+        ok = (uint32Value ? true : false);
+        if (ok) {
+            ok = (uint32Value->get() == numberOfWrites);
+        }
+    }
+    godb->Purge();
+
+    return ok;
+}
+
+bool EPICSPVAOutputTest::TestGetChannel() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+EPICSPVADatabase1 = {\n"
+            "    Class = EPICSPVADatabase\n"
+            "    +RecordOut1 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Structure = {\n"
+            "             SignalUInt = {\n"
+            "                  Type = uint32\n"
+            "             }\n"
+            "        }\n"
+            "    }\n"
+            "}\n"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAM1 = {\n"
+            "            Class = EPICSPVAOutputGAMTestHelper\n"
+            "            OutputSignals = {\n"
+            "                RecordOut1 = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +EPICSPVAOutputTest = {\n"
+            "            Class = EPICSPVAOutput\n"
+            "            CPUMask = 15\n"
+            "            StackSize = 10000000\n"
+            "            NumberOfBuffers = 2\n"
+            "            Signals = {\n"
+            "                RecordOut1 = {\n"
+            "                    Field = SignalUInt\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAM1}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = EPICSPVAOutputSchedulerTestHelper\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSPVAOutput> ds1;
+    if (ok) {
+        ds1 = godb->Find("Test.Data.EPICSPVAOutputTest");
+        ok = ds1.IsValid();
+    }
+    if (ok) {
+        ok = (ds1->GetNumberOfChannels() == 1u);
+    }
+    if (ok) {
+        ok = (ds1->GetChannel(0u) != NULL_PTR(const EPICSPVAChannelWrapper *));
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(ds1->GetChannel(0u)->GetChannelName(), "RecordOut1") == 0);
+    }
+    if (ok) {
+        ok = (ds1->GetChannel(1u) == NULL_PTR(const EPICSPVAChannelWrapper *));
+    }
+    godb->Purge();
+
+    return ok;
+}
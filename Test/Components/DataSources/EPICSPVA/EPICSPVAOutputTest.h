@@ -167,6 +167,17 @@ public:
      */
     bool TestSynchronise_False_BadSignal();
 
+    /**
+     * @brief Tests that the Synchronise method does not wait for the puts, that only the newest value is sent
+     * and that the put statistics are updated (see GetChannel).
+     */
+    bool TestSynchronise_AsyncPut();
+
+    /**
+     * @brief Tests the GetChannel and GetNumberOfChannels methods.
+     */
+    bool TestGetChannel();
+
 };
 
 /*---------------------------------------------------------------------------*/
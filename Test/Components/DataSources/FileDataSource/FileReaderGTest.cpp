@@ -265,6 +265,26 @@ TEST(FileReaderGTest,TestSynchronise_CSV_Interpolation_Preload) {
     ASSERT_TRUE(test.TestSynchronise_CSV_Interpolation_Preload());
 }
 
+TEST(FileReaderGTest,TestSynchronise_CSV_MemoryMapped) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_CSV_MemoryMapped());
+}
+
+TEST(FileReaderGTest,TestSynchronise_CSV_Interpolation_MemoryMapped) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_CSV_Interpolation_MemoryMapped());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_MemoryMapped) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_MemoryMapped());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_Interpolation_MemoryMapped) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_Interpolation_MemoryMapped());
+}
+
 TEST(FileReaderGTest,TestSynchronise_Frequency) {
     FileReaderTest test;
     ASSERT_TRUE(test.TestSynchronise_Frequency());
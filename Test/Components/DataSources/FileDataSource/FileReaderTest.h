@@ -126,6 +126,26 @@ public:
      */
     bool TestSynchronise_Binary_Interpolation_Preload();
 
+    /**
+     * @brief Tests the Synchronise method with a memory mapped csv index (Preload = mmap).
+     */
+    bool TestSynchronise_CSV_MemoryMapped();
+
+    /**
+     * @brief Tests the Synchronise method with a memory mapped csv index (Preload = mmap) and interpolation.
+     */
+    bool TestSynchronise_CSV_Interpolation_MemoryMapped();
+
+    /**
+     * @brief Tests the Synchronise method with a memory mapped binary file (Preload = mmap).
+     */
+    bool TestSynchronise_Binary_MemoryMapped();
+
+    /**
+     * @brief Tests the Synchronise method with a memory mapped binary file (Preload = mmap) and interpolation.
+     */
+    bool TestSynchronise_Binary_Interpolation_MemoryMapped();
+
     /**
      * @brief Tests the Synchronise method using the Frequency parameter.
      */
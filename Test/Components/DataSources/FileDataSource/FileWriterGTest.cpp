@@ -123,6 +123,11 @@ TEST(FileWriterGTest,TestInitialise_False_CSVSeparator) {
     ASSERT_TRUE(test.TestInitialise_False_CSVSeparator());
 }
 
+TEST(FileWriterGTest,TestInitialise_False_CSVBlockSize) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_CSVBlockSize());
+}
+
 TEST(FileWriterGTest,TestInitialise_False_StoreOnTrigger) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestInitialise_False_StoreOnTrigger());
@@ -213,6 +218,11 @@ TEST(FileWriterGTest,TestSynchronise) {
     ASSERT_TRUE(test.TestSynchronise());
 }
 
+TEST(FileWriterGTest,TestSynchronise_CSVBlockSize) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_CSVBlockSize());
+}
+
 TEST(FileWriterGTest,TestPrepareNextState) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestPrepareNextState());
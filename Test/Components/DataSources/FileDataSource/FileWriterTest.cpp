@@ -340,7 +340,8 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
                                     MARTe::uint32 numberOfPreTriggers, MARTe::uint32 numberOfPostTriggers, MARTe::float32 period,
                                     const MARTe::char8 * const filename, const MARTe::char8 * const expectedFileContent, bool csv,
                                     const MARTe::uint32 sleepMSec = 100, 
-                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL) {
+                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL,
+                                    const MARTe::uint32 csvBlockSize = 0u) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -390,6 +391,10 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
         cdb.Write("FileFormat", "csv");
         cdb.Delete("CSVSeparator");
         cdb.Write("CSVSeparator", ";");
+        cdb.Delete("CSVBlockSize");
+        if (csvBlockSize > 0u) {
+            cdb.Write("CSVBlockSize", csvBlockSize);
+        }
     }
     else {
         cdb.Write("FileFormat", "binary");
@@ -3036,6 +3041,20 @@ bool FileWriterTest::TestSynchronise() {
     return ok;
 }
 
+bool FileWriterTest::TestSynchronise_CSVBlockSize() {
+    //The block is smaller than a line, so that it has to be drained in the middle of the lines
+    const MARTe::uint32 csvBlockSize = 64u;
+    bool ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_Block_CSV", true, 0u, NULL, csvBlockSize);
+    if (ok) {
+        ok = TestIntegratedInApplication_NoTrigger_Array("FileWriterTest_TestSynchronise_Block_Arr_CSV", true, csvBlockSize);
+    }
+    if (ok) {
+        MARTe::uint32 runCSV = 0;
+        ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestRefresh_Block_CSV", true, 1u, &runCSV, csvBlockSize);
+    }
+    return ok;
+}
+
 bool FileWriterTest::TestPrepareNextState() {
     using namespace MARTe;
     FileWriter test;
@@ -3303,6 +3322,26 @@ bool FileWriterTest::TestInitialise_False_CSVSeparator() {
     return !test.Initialise(cdb);
 }
 
+bool FileWriterTest::TestInitialise_False_CSVBlockSize() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("CSVBlockSize", 8);
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 1);
+    cdb.Write("NumberOfPreTriggers", 2);
+    cdb.Write("NumberOfPostTriggers", 3);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool FileWriterTest::TestInitialise_False_StoreOnTrigger() {
     using namespace MARTe;
     FileWriter test;
@@ -3404,7 +3443,7 @@ bool FileWriterTest::TestIntegratedInApplication_RefreshContent(const MARTe::cha
     return TestIntegratedInApplication_NoTrigger( filename, csv, 1u, detectedFileSize);
 }
 
-bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize) {
+bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize, MARTe::uint32 csvBlockSize) {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5 };
     uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
@@ -3522,7 +3561,7 @@ bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *
         }
     }
 
-    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, 100, refreshContent, detectedFileSize);
+    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, 100, refreshContent, detectedFileSize, csvBlockSize);
     if (!csv) {
         if (expectedFileContent != NULL) {
             char8 *mem = const_cast<char8 *>(&expectedFileContent[0]);
@@ -3532,7 +3571,7 @@ bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *
     return ok;
 }
 
-bool FileWriterTest::TestIntegratedInApplication_NoTrigger_Array(const MARTe::char8 *filename, bool csv) {
+bool FileWriterTest::TestIntegratedInApplication_NoTrigger_Array(const MARTe::char8 *filename, bool csv, MARTe::uint32 csvBlockSize) {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5 };
     uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
@@ -3631,7 +3670,7 @@ bool FileWriterTest::TestIntegratedInApplication_NoTrigger_Array(const MARTe::ch
     }
 
     bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, ARRAY_SIZE, numberOfBuffers, 0, 0, period, filename,
-                                      expectedFileContent, csv);
+                                      expectedFileContent, csv, 100, 0u, NULL, csvBlockSize);
     if (!csv) {
         if (expectedFileContent != NULL) {
             char8 *mem = const_cast<char8 *>(&expectedFileContent[0]);
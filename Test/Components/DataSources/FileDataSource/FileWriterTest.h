@@ -91,6 +91,11 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests the Synchronise method with a CSVBlockSize smaller than a csv line.
+     */
+    bool TestSynchronise_CSVBlockSize();
+
     /**
      * @brief Tests the PrepareNextState method.
      */
@@ -161,6 +166,11 @@ public:
      */
     bool TestInitialise_False_CSVSeparator();
 
+    /**
+     * @brief Tests the Initialise method with a CSVBlockSize which is too small.
+     */
+    bool TestInitialise_False_CSVBlockSize();
+
     /**
      * @brief Tests the Initialise method without specifying the StoreOnTrigger.
      */
@@ -239,7 +249,7 @@ public:
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
      */
-    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0);
+    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0, MARTe::uint32 csvBlockSize = 0u);
 
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
@@ -249,7 +259,7 @@ public:
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
      */
-    bool TestIntegratedInApplication_NoTrigger_Array(const MARTe::char8 *filename, bool csv = true);
+    bool TestIntegratedInApplication_NoTrigger_Array(const MARTe::char8 *filename, bool csv = true, MARTe::uint32 csvBlockSize = 0u);
 
     /**
      * @brief Tests the FileWriter integrated in an application which asynchronously stores data based on a trigger event.
@@ -85,8 +85,32 @@ TEST(LinkDataSourceGTest,TestSynchronise) {
     ASSERT_TRUE(test.TestSynchronise());
 }
 
+TEST(LinkDataSourceGTest,TestSynchronise_SharedMemoryGate) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_SharedMemoryGate());
+}
+
 TEST(LinkDataSourceGTest,TestGetBrokerName) {
     LinkDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
 }
 
+TEST(LinkDataSourceGTest,TestInitialise_False_ZeroCopyWriter) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ZeroCopyWriter());
+}
+
+TEST(LinkDataSourceGTest,TestAllocateMemory_False_ZeroCopySharedMemoryGate) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory_False_ZeroCopySharedMemoryGate());
+}
+
+TEST(LinkDataSourceGTest,TestSynchronise_ZeroCopy) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_ZeroCopy());
+}
+
+TEST(LinkDataSourceGTest,TestExecute_ZeroCopyBroker) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestExecute_ZeroCopyBroker());
+}
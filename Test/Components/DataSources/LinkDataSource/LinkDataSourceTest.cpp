@@ -37,6 +37,7 @@
 #include "LinkDataSourceTest.h"
 #include "MemoryDataSourceI.h"
 #include "MemoryMapInputBroker.h"
+#include "MemoryMapMultiBufferInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "MemoryMapSynchronisedInputBroker.h"
@@ -1289,3 +1290,880 @@ bool LinkDataSourceTest::TestSynchronise() {
     return ret;
 }
 
+bool LinkDataSourceTest::TestSynchronise_SharedMemoryGate() {
+    //Application2 is linked to different objects which share the same memory (as if it was running in another process)
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = SharedMemoryGate"
+            "    SharedMemoryName = \"/MARTeLinkDataSourceTest1\""
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = SharedMemoryGate"
+            "    SharedMemoryName = \"/MARTeLinkDataSourceTest2\""
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent3 = {"
+            "    Class = SharedMemoryGate"
+            "    SharedMemoryName = \"/MARTeLinkDataSourceTest1\""
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent4 = {"
+            "    Class = SharedMemoryGate"
+            "    SharedMemoryName = \"/MARTeLinkDataSourceTest2\""
+            "    NumberOfBuffers = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent3"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent4"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<LinkDataSourceTestDS> ds1;
+    ReferenceT<LinkDataSourceTestDS> ds2;
+
+    ReferenceT<LinkDataSourceTestDS> ds3;
+    ReferenceT<LinkDataSourceTestDS> ds4;
+
+    if (ret) {
+        ds1 = god->Find("Application1.Data.InputGAM1");
+        ret = ds1.IsValid();
+    }
+
+    if (ret) {
+        ds2 = god->Find("Application1.Data.OutputGAM1");
+        ret = ds2.IsValid();
+    }
+
+    if (ret) {
+        ds3 = god->Find("Application2.Data.InputGAM1");
+        ret = ds3.IsValid();
+    }
+
+    if (ret) {
+        ds4 = god->Find("Application2.Data.OutputGAM1");
+        ret = ds4.IsValid();
+    }
+
+    uint32 *data1 = NULL;
+    if (ret) {
+        ret = ds1->GetSignalMemoryBuffer(0, 0, (void*&) data1);
+    }
+
+    uint32 *data2 = NULL;
+    if (ret) {
+        ret = ds2->GetSignalMemoryBuffer(0, 0, (void*&) data2);
+    }
+
+    uint32 *data3 = NULL;
+    if (ret) {
+        ret = ds3->GetSignalMemoryBuffer(0, 0, (void*&) data3);
+    }
+
+    uint32 *data4 = NULL;
+    if (ret) {
+        ret = ds4->GetSignalMemoryBuffer(0, 0, (void*&) data4);
+    }
+
+    if (ret) {
+        *data2 = 1;
+        *data4 = 2;
+
+        ret &= ds2->Synchronise();
+        ret &= ds4->Synchronise();
+
+    }
+
+    if(ret){
+        ret &= ds1->Synchronise();
+        ret &= ds3->Synchronise();
+
+        ret&=(*data1==2);
+        ret&=(*data3==1);
+
+    }
+
+    god->Purge();
+    return ret;
+}
+
+bool LinkDataSourceTest::TestInitialise_False_ZeroCopyWriter() {
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "            ZeroCopy = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LinkDataSourceTest::TestAllocateMemory_False_ZeroCopySharedMemoryGate() {
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = SharedMemoryGate"
+            "    SharedMemoryName = \"/MARTeLinkDataSourceTest3\""
+            "    NumberOfBuffers = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "            ZeroCopy = 1"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LinkDataSourceTest::TestSynchronise_ZeroCopy() {
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "            ZeroCopy = 1"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<LinkDataSourceTestDS> ds1;
+    ReferenceT<LinkDataSourceTestDS> ds4;
+
+    if (ret) {
+        ds1 = god->Find("Application1.Data.InputGAM1");
+        ret = ds1.IsValid();
+    }
+
+    if (ret) {
+        ds4 = god->Find("Application2.Data.OutputGAM1");
+        ret = ds4.IsValid();
+    }
+
+    if (ret) {
+        ConfigurationDatabase cdb;
+        StreamString brokerName = ds1->GetBrokerName(cdb, InputSignals);
+        ret = (brokerName == "MemoryMapMultiBufferInputBroker");
+    }
+
+    //the broker address is inside the MemoryGate buffers
+    uint8 *data1 = NULL;
+    if (ret) {
+        ret = ds1->GetSignalMemoryBuffer(0, 0, (void*&) data1);
+    }
+    if (ret) {
+        ret = (data1 == ds1->GetLink()->GetBuffersMemory());
+    }
+
+    uint32 *data4 = NULL;
+    if (ret) {
+        ret = ds4->GetSignalMemoryBuffer(0, 0, (void*&) data4);
+    }
+
+    uint32 offset = 0u;
+    if (ret) {
+        *data4 = 2;
+        ret = ds4->Synchronise();
+    }
+    if (ret) {
+        //no buffer borrowed yet
+        ret = !ds1->Synchronise();
+    }
+    if (ret) {
+        ds1->PrepareInputOffsets();
+        ret = ds1->GetInputOffset(0, 1, offset);
+    }
+    if (ret) {
+        //nothing to copy
+        ret = ds1->Synchronise();
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&data1[offset]) == 2u);
+    }
+    //the borrowed buffer is not overwritten until the next cycle
+    if (ret) {
+        *data4 = 3;
+        ret = ds4->Synchronise();
+    }
+    if (ret) {
+        *data4 = 4;
+        ret = ds4->Synchronise();
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&data1[offset]) == 2u);
+    }
+    if (ret) {
+        ds1->PrepareInputOffsets();
+        ret = ds1->GetInputOffset(0, 1, offset);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&data1[offset]) == 4u);
+    }
+
+    god->Purge();
+    return ret;
+}
+
+bool LinkDataSourceTest::TestExecute_ZeroCopyBroker() {
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "            ZeroCopy = 1"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<LinkDataSourceTestDS> ds1;
+    ReferenceT<LinkDataSourceTestDS> ds4;
+
+    if (ret) {
+        ds1 = god->Find("Application1.Data.InputGAM1");
+        ret = ds1.IsValid();
+    }
+    if (ret) {
+        ds4 = god->Find("Application2.Data.OutputGAM1");
+        ret = ds4.IsValid();
+    }
+    //the DataSource declares the buffers of the MemoryGate
+    if (ret) {
+        ret = (ds1->GetNumberOfMemoryBuffers() == 2u);
+    }
+    uint8 *data1 = NULL;
+    if (ret) {
+        ret = ds1->GetSignalMemoryBuffer(0, 1, (void*&) data1);
+    }
+    if (ret) {
+        ret = (data1 == &(ds1->GetLink()->GetBuffersMemory()[ds1->GetTotalMemorySize()]));
+    }
+    if (ret) {
+        ret = !ds1->GetSignalMemoryBuffer(0, 2, (void*&) data1);
+    }
+    uint32 gamMemory = 0u;
+    ReferenceT<MemoryMapMultiBufferInputBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ret) {
+        ret = broker->Init(InputSignals, *ds1.operator->(), "GAM1", &gamMemory);
+    }
+    uint32 *data4 = NULL;
+    if (ret) {
+        ret = ds4->GetSignalMemoryBuffer(0, 0, (void*&) data4);
+    }
+    //write until the newest buffer is not the first one
+    uint32 offset = 0u;
+    uint32 value;
+    for (value = 10u; (value < 14u) && (ret) && (offset == 0u); value++) {
+        *data4 = value;
+        ret = ds4->Synchronise();
+        if (ret) {
+            ds1->PrepareInputOffsets();
+            ret = ds1->GetInputOffset(0, 1, offset);
+        }
+    }
+    if (ret) {
+        ret = (offset == ds1->GetTotalMemorySize());
+    }
+    //the broker copies from the buffer 1 of the MemoryGate
+    if (ret) {
+        ret = broker->Execute();
+    }
+    if (ret) {
+        ret = (gamMemory == (value - 1u));
+    }
+    god->Purge();
+    return ret;
+}
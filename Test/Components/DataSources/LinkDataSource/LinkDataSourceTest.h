@@ -103,11 +103,37 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests the LinkDataSource::Synchronise method with SharedMemoryGate links
+     */
+    bool TestSynchronise_SharedMemoryGate();
+
     /**
      * @brief Tests the LinkDataSource::GetBrokerName() method
      */
     bool TestGetBrokerName();
 
+    /**
+     * @brief Tests that the LinkDataSource::Initialise() method fails if ZeroCopy is set for a writer
+     */
+    bool TestInitialise_False_ZeroCopyWriter();
+
+    /**
+     * @brief Tests that the LinkDataSource::AllocateMemory() method fails if ZeroCopy is set and the
+     * link does not allow borrowing its buffers
+     */
+    bool TestAllocateMemory_False_ZeroCopySharedMemoryGate();
+
+    /**
+     * @brief Tests the LinkDataSource reading directly from the borrowed MemoryGate buffer
+     */
+    bool TestSynchronise_ZeroCopy();
+
+    /**
+     * @brief Tests that the MemoryMapMultiBufferInputBroker of a ZeroCopy LinkDataSource reads a MemoryGate buffer other than the first
+     */
+    bool TestExecute_ZeroCopyBroker();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,102 @@
+/**
+ * @file LatencyHistogramGTest.cpp
+ * @brief Source file for class LatencyHistogramGTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LinuxTimerGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LatencyHistogramTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(LatencyHistogramGTest,TestConstructor) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(LatencyHistogramGTest,TestCreate) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestCreate());
+}
+
+TEST(LatencyHistogramGTest,TestCreate_False_ZeroBins) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestCreate_False_ZeroBins());
+}
+
+TEST(LatencyHistogramGTest,TestCreate_False_ZeroBinWidth) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestCreate_False_ZeroBinWidth());
+}
+
+TEST(LatencyHistogramGTest,TestCreate_False_Twice) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestCreate_False_Twice());
+}
+
+TEST(LatencyHistogramGTest,TestAdd) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestAdd());
+}
+
+TEST(LatencyHistogramGTest,TestAdd_Overflow) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestAdd_Overflow());
+}
+
+TEST(LatencyHistogramGTest,TestGetPercentile99) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestGetPercentile99());
+}
+
+TEST(LatencyHistogramGTest,TestGetPercentile999) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestGetPercentile999());
+}
+
+TEST(LatencyHistogramGTest,TestGetPercentile_Descending) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestGetPercentile_Descending());
+}
+
+TEST(LatencyHistogramGTest,TestGetPercentile_SparseBins) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestGetPercentile_SparseBins());
+}
+
+TEST(LatencyHistogramGTest,TestReset) {
+    LatencyHistogramTest test;
+    ASSERT_TRUE(test.TestReset());
+}
@@ -0,0 +1,247 @@
+/**
+ * @file LatencyHistogramTest.cpp
+ * @brief Source file for class LatencyHistogramTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LatencyHistogramTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LatencyHistogramTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+bool LatencyHistogramTest::TestConstructor() {
+    LatencyHistogram histogram;
+    bool ok = (histogram.GetNumberOfBins() == 0u);
+    if (ok) {
+        ok = (histogram.GetNumberOfSamples() == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetMin() == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetMax() == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetBinCount(0u) == 0u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestCreate() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(10u, 100u);
+    if (ok) {
+        ok = (histogram.GetNumberOfBins() == 10u);
+    }
+    if (ok) {
+        ok = (histogram.GetBinWidth() == 100u);
+    }
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        ok = (histogram.GetBinCount(i) == 0u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestCreate_False_ZeroBins() {
+    LatencyHistogram histogram;
+    return !histogram.Create(0u, 100u);
+}
+
+bool LatencyHistogramTest::TestCreate_False_ZeroBinWidth() {
+    LatencyHistogram histogram;
+    return !histogram.Create(10u, 0u);
+}
+
+bool LatencyHistogramTest::TestCreate_False_Twice() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(10u, 100u);
+    if (ok) {
+        ok = !histogram.Create(10u, 100u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestAdd() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(10u, 100u);
+    if (ok) {
+        histogram.Add(150u, 0u);
+        histogram.Add(50u, 2u);
+        histogram.Add(950u, 1u);
+        histogram.Add(160u, 0u);
+        ok = (histogram.GetNumberOfSamples() == 4u);
+    }
+    if (ok) {
+        ok = (histogram.GetMin() == 50u);
+    }
+    if (ok) {
+        ok = (histogram.GetMax() == 950u);
+    }
+    if (ok) {
+        ok = (histogram.GetLostCycles() == 3u);
+    }
+    if (ok) {
+        ok = (histogram.GetBinCount(0u) == 1u);
+    }
+    if (ok) {
+        ok = (histogram.GetBinCount(1u) == 2u);
+    }
+    if (ok) {
+        ok = (histogram.GetBinCount(9u) == 1u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestAdd_Overflow() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(10u, 100u);
+    if (ok) {
+        histogram.Add(100000u, 0u);
+        histogram.Add(0xFFFFFFFFu, 0u);
+        ok = (histogram.GetBinCount(9u) == 2u);
+    }
+    if (ok) {
+        ok = (histogram.GetMax() == 0xFFFFFFFFu);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile99() == 0xFFFFFFFFu);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestGetPercentile99() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(2000u, 1u);
+    for (uint32 i = 0u; (i < 1000u) && (ok); i++) {
+        histogram.Add(i, 0u);
+        //The percentile is the upper edge of the bin of the sample with rank ceil(0.99 * n)
+        uint32 n = (i + 1u);
+        uint32 rank = ((n * 99u) + 99u) / 100u;
+        ok = (histogram.GetPercentile99() == ((rank < n) ? (rank) : (i)));
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile99() == 990u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestGetPercentile999() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(2000u, 1u);
+    for (uint32 i = 0u; (i < 1000u) && (ok); i++) {
+        histogram.Add(i, 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile999() == 999u);
+    }
+    for (uint32 i = 1000u; (i < 2000u) && (ok); i++) {
+        histogram.Add(i, 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile999() == 1998u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestGetPercentile_Descending() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(1000u, 10u);
+    for (uint32 i = 1000u; (i > 0u) && (ok); i--) {
+        histogram.Add((i - 1u) * 10u, 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile99() == 9900u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile999() == 9990u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestGetPercentile_SparseBins() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(100000u, 1u);
+    for (uint32 i = 0u; (i < 985u) && (ok); i++) {
+        histogram.Add(0u, 0u);
+    }
+    //Skip forward over (almost) all the empty bins
+    for (uint32 i = 0u; (i < 15u) && (ok); i++) {
+        histogram.Add(90000u, 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile99() == 90000u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile999() == 90000u);
+    }
+    //Skip backward
+    for (uint32 i = 0u; (i < 1000u) && (ok); i++) {
+        histogram.Add(10u, 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile99() == 11u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile999() == 90000u);
+    }
+    return ok;
+}
+
+bool LatencyHistogramTest::TestReset() {
+    LatencyHistogram histogram;
+    bool ok = histogram.Create(10u, 100u);
+    if (ok) {
+        histogram.Add(550u, 3u);
+        histogram.Reset();
+        ok = (histogram.GetNumberOfSamples() == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetBinCount(5u) == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetLostCycles() == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetMax() == 0u);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile99() == 0u);
+    }
+    if (ok) {
+        histogram.Add(50u, 0u);
+        ok = (histogram.GetPercentile99() == 50u);
+    }
+    return ok;
+}
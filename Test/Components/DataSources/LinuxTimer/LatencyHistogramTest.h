@@ -0,0 +1,110 @@
+/**
+ * @file LatencyHistogramTest.h
+ * @brief Header file for class LatencyHistogramTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LatencyHistogramTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINUXTIMERTEST_LATENCYHISTOGRAMTEST_H_
+#define LINUXTIMERTEST_LATENCYHISTOGRAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "LatencyHistogram.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the LatencyHistogram public methods.
+ */
+class LatencyHistogramTest {
+public:
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Create method.
+     */
+    bool TestCreate();
+
+    /**
+     * @brief Tests that the Create method fails with zero bins.
+     */
+    bool TestCreate_False_ZeroBins();
+
+    /**
+     * @brief Tests that the Create method fails with a zero bin width.
+     */
+    bool TestCreate_False_ZeroBinWidth();
+
+    /**
+     * @brief Tests that the Create method fails if the histogram was already created.
+     */
+    bool TestCreate_False_Twice();
+
+    /**
+     * @brief Tests the Add method and the min, max and lost cycles statistics.
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests that the values which do not fit in the bins are counted in the last bin.
+     */
+    bool TestAdd_Overflow();
+
+    /**
+     * @brief Tests the GetPercentile99 method with a uniform distribution.
+     */
+    bool TestGetPercentile99();
+
+    /**
+     * @brief Tests the GetPercentile999 method with a uniform distribution.
+     */
+    bool TestGetPercentile999();
+
+    /**
+     * @brief Tests the percentiles when the samples are added in descending order.
+     */
+    bool TestGetPercentile_Descending();
+
+    /**
+     * @brief Tests the percentiles when they have to skip many empty bins (in both directions).
+     */
+    bool TestGetPercentile_SparseBins();
+
+    /**
+     * @brief Tests the Reset method.
+     */
+    bool TestReset();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LINUXTIMERTEST_LATENCYHISTOGRAMTEST_H_ */
@@ -111,6 +111,16 @@ TEST(LinuxTimerGTest, TestExecute_RTThread_WithFive) {
     ASSERT_TRUE(test.TestExecute_RTThread_WithFive());
 }
 
+TEST(LinuxTimerGTest, TestExecute_RTThread_WithSeven) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_RTThread_WithSeven());
+}
+
+TEST(LinuxTimerGTest, TestExecute_LatenessAndOverruns) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_LatenessAndOverruns());
+}
+
 TEST(LinuxTimerGTest, TestExecute_RTThread_WithPhase) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestExecute_RTThread_WithPhase());
@@ -215,6 +225,21 @@ TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_MoreThan5Signals) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_MoreThan5Signals());
 }
 
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_MoreThan12Signals) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_MoreThan12Signals());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidSignal6) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidSignal6());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidSignal7) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidSignal7());
+}
+
 TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_No32BitsSignal1) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_No32BitsSignal1());
@@ -265,6 +290,26 @@ TEST(LinuxTimerGTest, TestGetSleepPercentage) {
     ASSERT_TRUE(test.TestGetSleepPercentage());
 }
 
+TEST(LinuxTimerGTest, TestInitialise_False_LatencyHistogramBins) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_LatencyHistogramBins());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidLatencyStatistics) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidLatencyStatistics());
+}
+
+TEST(LinuxTimerGTest, TestDumpLatencyHistogram) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestDumpLatencyHistogram());
+}
+
+TEST(LinuxTimerGTest, TestDumpLatencyHistogram_Timeout) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestDumpLatencyHistogram_Timeout());
+}
+
 TEST(LinuxTimerGTest, TestSetConfiguredDatabase_UseBusySleepAndPercentage) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_UseBusySleepAndPercentage());
@@ -1556,6 +1556,514 @@ const MARTe::char8 *const config34 = ""
         "    }"
         "}";
 
+//Configuration with all the seven signals and the MonotonicTimeProvider
+const MARTe::char8 *const config35 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = RealTimeThread"
+        "            +TimeProvider = {"
+        "                Class = MonotonicTimeProvider"
+        "                SleepMode = TimerFd"
+        "                SpinTime = 20"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with more than twelve signals
+const MARTe::char8 *const config36 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessMin = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessMax = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessP99 = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessP999 = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LostCycles = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                WrongSignal = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = RealTimeThread"
+        "            +TimeProvider = {"
+        "                Class = MonotonicTimeProvider"
+        "                SleepMode = TimerFd"
+        "                SpinTime = 20"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an invalid Lateness signal
+const MARTe::char8 *const config37 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = RealTimeThread"
+        "            +TimeProvider = {"
+        "                Class = MonotonicTimeProvider"
+        "                SleepMode = TimerFd"
+        "                SpinTime = 20"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an invalid Overruns signal
+const MARTe::char8 *const config38 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = int32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = RealTimeThread"
+        "            +TimeProvider = {"
+        "                Class = MonotonicTimeProvider"
+        "                SleepMode = TimerFd"
+        "                SpinTime = 20"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with all the twelve signals and a custom lateness histogram
+const MARTe::char8 *const config39 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessMin = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessMax = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessP99 = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessP999 = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LostCycles = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            LatencyHistogramBins = 100"
+        "            LatencyHistogramBinWidth = 10000"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an invalid latency statistics signal
+const MARTe::char8 *const config40 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessMin = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessMax = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LatenessP99 = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                LatenessP999 = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                LostCycles = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            LatencyHistogramBins = 100"
+        "            LatencyHistogramBinWidth = 10000"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1599,7 +2107,7 @@ bool LinuxTimerTest::TestGetSignalMemoryBuffer_False() {
     using namespace MARTe;
     LinuxTimer test;
     uint32 *ptr;
-    return !test.GetSignalMemoryBuffer(5, 0, (void*&) ptr);
+    return !test.GetSignalMemoryBuffer(12, 0, (void*&) ptr);
 }
 
 bool LinuxTimerTest::TestGetBrokerName() {
@@ -1656,6 +2164,84 @@ bool LinuxTimerTest::TestExecute_RTThread_WithFive() {
     return TestIntegratedInApplication(config12);
 }
 
+bool LinuxTimerTest::TestExecute_RTThread_WithSeven() {
+    return TestIntegratedInApplication(config35);
+}
+
+bool LinuxTimerTest::TestExecute_LatenessAndOverruns() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config35;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ReferenceT<LinuxTimer> test = god->Find("Test.Data.Timer");
+        ok = test.IsValid();
+        uint32 *lateness = NULL_PTR(uint32 *);
+        uint32 *overruns = NULL_PTR(uint32 *);
+        if (ok) {
+            ok = test->GetSignalMemoryBuffer(5, 0, (void*&) lateness);
+        }
+        if (ok) {
+            ok = test->GetSignalMemoryBuffer(6, 0, (void*&) overruns);
+        }
+        ExecutionInfo info;
+        for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+            ok = (test->Execute(info) == ErrorManagement::NoError);
+        }
+        if (ok) {
+            //1 kHz timer: a wake-up later than 10 periods would be a wrong deadline computation
+            ok = (*lateness < 10000000u);
+        }
+        if (ok) {
+            ok = (*overruns == 0u);
+        }
+        if (ok) {
+            //Miss at least four periods
+            Sleep::MSec(5);
+            ok = (test->Execute(info) == ErrorManagement::NoError);
+        }
+        if (ok) {
+            ok = (*overruns >= 4u);
+        }
+        if (ok) {
+            ok = (test->Execute(info) == ErrorManagement::NoError);
+        }
+        if (ok) {
+            ok = (*overruns == 0u);
+        }
+        //need to do this to stop the threads otw they are stuck on the sem
+        if (ok) {
+            application->StartNextStateExecution();
+        }
+        if (ok) {
+            application->StopCurrentStateExecution();
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
 bool LinuxTimerTest::TestExecute_RTThread_WithPhase() {
     return TestIntegratedInApplication(config15);
 }
@@ -2390,6 +2976,10 @@ bool LinuxTimerTest::TestSetConfiguredDatabase_False_MoreThan5Signals() {
     return !TestIntegratedInApplication(config4);
 }
 
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_MoreThan12Signals() {
+    return !TestIntegratedInApplication(config36);
+}
+
 bool LinuxTimerTest::TestSetConfiguredDatabase_False_No32BitsSignal1() {
     return !TestIntegratedInApplication(config5);
 }
@@ -2410,6 +3000,14 @@ bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidSignal5() {
     return !TestIntegratedInApplication(config19);
 }
 
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidSignal6() {
+    return !TestIntegratedInApplication(config37);
+}
+
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidSignal7() {
+    return !TestIntegratedInApplication(config38);
+}
+
 bool LinuxTimerTest::TestSetConfiguredDatabase_False_NoFrequencySet() {
     return !TestIntegratedInApplication(config7);
 }
@@ -2442,6 +3040,145 @@ bool LinuxTimerTest::TestSetConfiguredDatabase_WithBackwardCompatOnHRT() {
     return TestIntegratedInApplication(config34);
 }
 
+bool LinuxTimerTest::TestInitialise_False_LatencyHistogramBins() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("LatencyHistogramBins", 0);
+    return !test.Initialise(cdb);
+}
+
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidLatencyStatistics() {
+    return !TestIntegratedInApplication(config40);
+}
+
+bool LinuxTimerTest::TestDumpLatencyHistogram() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config39;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        application->StartNextStateExecution();
+    }
+    ReferenceT<LinuxTimer> linuxTimer;
+    if (ok) {
+        linuxTimer = application->Find("Data.Timer");
+        ok = linuxTimer.IsValid();
+    }
+    uint32 *counter = NULL_PTR(uint32 *);
+    uint32 *statistics[5];
+    for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+        ok = linuxTimer->GetSignalMemoryBuffer(7u + i, 0, (void*&) statistics[i]);
+    }
+    if (ok) {
+        ok = linuxTimer->GetSignalMemoryBuffer(0, 0, (void*&) counter);
+    }
+    if (ok) {
+        uint32 c = 0u;
+        while ((c < 500u) && (*counter < 100u)) {
+            Sleep::MSec(10);
+            c++;
+        }
+        ok = (*counter >= 100u);
+    }
+    if (ok) {
+        uint32 latenessMin = *statistics[0];
+        uint32 latenessMax = *statistics[1];
+        uint32 latenessP99 = *statistics[2];
+        uint32 latenessP999 = *statistics[3];
+        ok = (latenessMin <= latenessP99);
+        if (ok) {
+            ok = (latenessP99 <= latenessP999);
+        }
+        if (ok) {
+            ok = (latenessP999 <= latenessMax);
+        }
+    }
+    if (ok) {
+        ok = (linuxTimer->DumpLatencyHistogram() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        //A second dump must not reuse the bank retired by the first one
+        ok = (linuxTimer->DumpLatencyHistogram() == ErrorManagement::NoError);
+    }
+    if (application.IsValid()) {
+        application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    return ok;
+}
+
+bool LinuxTimerTest::TestDumpLatencyHistogram_Timeout() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config12;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ReferenceT<LinuxTimer> test = god->Find("Test.Data.Timer");
+        ok = test.IsValid();
+        //Nobody is calling Execute
+        if (ok) {
+            ok = (test->DumpLatencyHistogram() == ErrorManagement::Timeout);
+        }
+        //need to do this to stop the threads otw they are stuck on the sem
+        if (ok) {
+            application->StartNextStateExecution();
+        }
+        //The pending switch is performed by the timer thread and reported by the next call
+        if (ok) {
+            Sleep::MSec(100);
+            ok = (test->DumpLatencyHistogram() == ErrorManagement::NoError);
+        }
+        if (ok) {
+            application->StopCurrentStateExecution();
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
 bool LinuxTimerTest::TestGetSleepPercentage() {
     return TestInitialise_Busy_SleepPercentage();
 }
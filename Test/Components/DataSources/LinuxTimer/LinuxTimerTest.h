@@ -111,6 +111,16 @@ public:
      */
     bool TestExecute_RTThread_WithFive();
 
+    /**
+     * @brief Tests the Execute method in the context of the real-time thread by using all the seven signals and the MonotonicTimeProvider
+     */
+    bool TestExecute_RTThread_WithSeven();
+
+    /**
+     * @brief Tests that the Execute method updates the Lateness and Overruns signals.
+     */
+    bool TestExecute_LatenessAndOverruns();
+
     /**
      * @brief Tests the Execute method exercising the phase section
      */
@@ -221,6 +231,11 @@ public:
      */
     bool TestSetConfiguredDatabase_False_MoreThan5Signals();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method specifying more than twelve signals.
+     */
+    bool TestSetConfiguredDatabase_False_MoreThan12Signals();
+
     /**
      * @brief Tests the SetConfiguredDatabase method specifying with a first signal that has more than 32 bits.
      */
@@ -241,6 +256,16 @@ public:
      */
     bool TestSetConfiguredDatabase_False_InvalidSignal5();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method specifying a wrong attributes sixth (Lateness) signal
+     */
+    bool TestSetConfiguredDatabase_False_InvalidSignal6();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method specifying a wrong attributes seventh (Overruns) signal
+     */
+    bool TestSetConfiguredDatabase_False_InvalidSignal7();
+
     /**
      * @brief Tests the SetConfiguredDatabase method specifying with a first signal that is not (Un)SignedInteged.
      */
@@ -296,6 +321,26 @@ public:
      */
     bool TestSetConfiguredDatabase_WithBackwardCompatOnHRT();
 
+    /**
+     * @brief Tests that the Initialise method fails with LatencyHistogramBins = 0
+     */
+    bool TestInitialise_False_LatencyHistogramBins();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method specifying a wrong type for a latency statistics signal
+     */
+    bool TestSetConfiguredDatabase_False_InvalidLatencyStatistics();
+
+    /**
+     * @brief Tests the DumpLatencyHistogram method and the latency statistics signals
+     */
+    bool TestDumpLatencyHistogram();
+
+    /**
+     * @brief Tests that the DumpLatencyHistogram method returns Timeout if Execute is not being called and that the next call reports the late switch
+     */
+    bool TestDumpLatencyHistogram_Timeout();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,107 @@
+/**
+ * @file MonotonicTimeProviderGTest.cpp
+ * @brief Source file for class MonotonicTimeProviderGTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LinuxTimerGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MonotonicTimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(MonotonicTimeProviderGTest,TestConstructor) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+
+TEST(MonotonicTimeProviderGTest,TestCounter) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestCounter());
+}
+
+TEST(MonotonicTimeProviderGTest,TestPeriod) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestPeriod());
+}
+
+TEST(MonotonicTimeProviderGTest,TestFrequency) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestFrequency());
+}
+
+TEST(MonotonicTimeProviderGTest,TestSleep) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestSleep());
+}
+
+TEST(MonotonicTimeProviderGTest,TestInitialise) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(MonotonicTimeProviderGTest,TestInitialise_TimerFd) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_TimerFd());
+}
+
+TEST(MonotonicTimeProviderGTest,TestInitialise_False_SleepMode) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SleepMode());
+}
+
+TEST(MonotonicTimeProviderGTest,TestSleep_TimerFd) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestSleep_TimerFd());
+}
+
+TEST(MonotonicTimeProviderGTest,TestSleep_Spin) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestSleep_Spin());
+}
+
+TEST(MonotonicTimeProviderGTest,TestSleep_DeadlinePassed) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestSleep_DeadlinePassed());
+}
+
+TEST(MonotonicTimeProviderGTest,TestBackwardCompatibilityInit) {
+    MonotonicTimeProviderTest test;
+    ASSERT_TRUE(test.TestBackwardCompatibilityInit());
+}
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
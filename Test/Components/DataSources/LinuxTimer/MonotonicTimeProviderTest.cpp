@@ -0,0 +1,163 @@
+/**
+ * @file MonotonicTimeProviderTest.cpp
+ * @brief Source file for class MonotonicTimeProviderTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MonotonicTimeProviderTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "MonotonicTimeProvider.h"
+#include "MonotonicTimeProviderTest.h"
+#include "TimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Sleeps 1 ms on a freshly initialised MonotonicTimeProvider and checks that the deadline was met.
+ */
+static bool MonotonicTimeProviderTestSleepDeadline(ConfigurationDatabase &cdb) {
+    MonotonicTimeProvider provider;
+    bool ok = provider.Initialise(cdb);
+    const uint64 deltaTime = 1000000u;
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        uint64 startTime = provider.Counter();
+        ok = provider.Sleep(startTime, deltaTime);
+        uint64 endTime = provider.Counter();
+        if (ok) {
+            ok = ((endTime - startTime) >= deltaTime);
+        }
+        if (ok) {
+            //Generous upper bound, only to detect a wrong deadline computation
+            ok = ((endTime - startTime) < (100u * deltaTime));
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+MonotonicTimeProviderTest::MonotonicTimeProviderTest() : TimeProviderTest(){
+    timeProvider = new MARTe::MonotonicTimeProvider();
+}
+
+MonotonicTimeProviderTest::~MonotonicTimeProviderTest() {
+}
+
+bool MonotonicTimeProviderTest::TestInitialise() {
+    ConfigurationDatabase cdb;
+    MonotonicTimeProvider provider;
+    bool ok = provider.Initialise(cdb);
+    if (ok) {
+        ok = (provider.GetSpinTime() == 0u);
+    }
+    if (ok) {
+        ok = !provider.IsTimerFd();
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestInitialise_TimerFd() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SleepMode", "TimerFd");
+    if (ok) {
+        ok = cdb.Write("SpinTime", 20);
+    }
+    MonotonicTimeProvider provider;
+    if (ok) {
+        ok = provider.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (provider.GetSpinTime() == 20000u);
+    }
+    if (ok) {
+        ok = provider.IsTimerFd();
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestInitialise_False_SleepMode() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SleepMode", "Busy");
+    MonotonicTimeProvider provider;
+    if (ok) {
+        ok = !provider.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestSleep_TimerFd() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SleepMode", "TimerFd");
+    if (ok) {
+        ok = MonotonicTimeProviderTestSleepDeadline(cdb);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestSleep_Spin() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SpinTime", 100);
+    if (ok) {
+        ok = MonotonicTimeProviderTestSleepDeadline(cdb);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestSleep_DeadlinePassed() {
+    MonotonicTimeProvider provider;
+    uint64 startTime = provider.Counter();
+    //Deadline one second in the past
+    bool ok = provider.Sleep(startTime - 2000000000u, 1000000000u);
+    uint64 endTime = provider.Counter();
+    if (ok) {
+        ok = ((endTime - startTime) < 1000000000u);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestBackwardCompatibilityInit() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SleepNature", "Busy");
+    if (ok) {
+        ok = cdb.Write("SleepPercentage", 50);
+    }
+    MonotonicTimeProvider provider;
+    if (ok) {
+        ok = provider.BackwardCompatibilityInit(cdb);
+    }
+    if (ok) {
+        ok = (provider.GetSpinTime() == 0u);
+    }
+    return ok;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file MonotonicTimeProviderTest.h
+ * @brief Header file for class MonotonicTimeProviderTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MonotonicTimeProviderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINUXTIMERTEST_MONOTONICTIMEPROVIDERTEST_H_
+#define LINUXTIMERTEST_MONOTONICTIMEPROVIDERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "TimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the MonotonicTimeProvider public methods.
+ */
+class MonotonicTimeProviderTest : public TimeProviderTest {
+    public:
+        MonotonicTimeProviderTest();
+        ~MonotonicTimeProviderTest();
+
+        /**
+         * @brief Tests the Initialise method with the default parameters.
+         */
+        bool TestInitialise();
+
+        /**
+         * @brief Tests the Initialise method with SleepMode = TimerFd.
+         */
+        bool TestInitialise_TimerFd();
+
+        /**
+         * @brief Tests that the Initialise method fails with an invalid SleepMode.
+         */
+        bool TestInitialise_False_SleepMode();
+
+        /**
+         * @brief Tests that the Sleep method wakes up after the deadline with SleepMode = TimerFd.
+         */
+        bool TestSleep_TimerFd();
+
+        /**
+         * @brief Tests that the Sleep method wakes up after the deadline with a SpinTime.
+         */
+        bool TestSleep_Spin();
+
+        /**
+         * @brief Tests that the Sleep method returns immediately if the deadline has already elapsed.
+         */
+        bool TestSleep_DeadlinePassed();
+
+        /**
+         * @brief Tests that the BackwardCompatibilityInit method ignores the legacy parameters.
+         */
+        bool TestBackwardCompatibilityInit();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LINUXTIMERTEST_MONOTONICTIMEPROVIDERTEST_H_ */
@@ -81,6 +81,21 @@ TEST(MDSReaderGTest, TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(MDSReaderGTest, TestInitialise_PrefetchSegments) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_PrefetchSegments());
+}
+
+TEST(MDSReaderGTest, TestSynchronise_SegmentCache) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_SegmentCache());
+}
+
+TEST(MDSReaderGTest, TestSynchronise_Prefetch) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Prefetch());
+}
+
 TEST(MDSReaderGTest, TestSetConfiguredDatabaseNoSignals) {
     MDSReaderTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabaseNoSignals());
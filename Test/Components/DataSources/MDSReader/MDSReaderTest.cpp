@@ -35,6 +35,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "MDSReaderTest.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -1540,6 +1541,105 @@ bool MDSReaderTest::TestInitialise() {
     return ok;
 }
 
+bool MDSReaderTest::TestInitialise_PrefetchSegments() {
+    bool ok;
+    MDSReader dS;
+    ConfigurationDatabase config;
+    config.Write("TreeName", treeName.Buffer());
+    config.Write("ShotNumber", 1);
+    config.Write("Frequency", 1);
+    config.Write("PrefetchSegments", 3);
+    config.CreateRelative("Signals");
+    config.MoveToRoot();
+    ok = (dS.GetPrefetchSegments() == 0u);
+    if (ok) {
+        ok = dS.Initialise(config);
+    }
+    if (ok) {
+        ok = (dS.GetPrefetchSegments() == 3u);
+    }
+    return ok;
+}
+
+bool MDSReaderTest::TestSynchronise_SegmentCache() {
+    MDSReaderTestHelper dS(treeName);
+    bool ok;
+    ok = dS.CreateConfigurationFile();
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    for (uint32 i = 0u; (i < 20) && ok; i++) {
+        ok = dS.Synchronise();
+        if (ok) {
+            ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4, dS.elementsRead);
+            ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1, dS.elementsRead);
+        }
+    }
+    //20 cycles of 10 samples cross 10 segments of 20 samples in each of the 10 nodes.
+    if (ok) {
+        ok = (dS.GetCacheMisses() >= 10u * numberOfValidNodes);
+    }
+    if (ok) {
+        ok = (dS.GetCacheMisses() < 20u * numberOfValidNodes);
+    }
+    if (ok) {
+        ok = (dS.GetPrefetchedSegments() == 0u);
+    }
+    delete[] ptr;
+    return ok;
+}
+
+bool MDSReaderTest::TestSynchronise_Prefetch() {
+    MDSReaderTestHelper dS(treeName);
+    bool ok;
+    ok = dS.CreateConfigurationFile();
+    if (ok) {
+        ok = dS.config.Write("PrefetchSegments", 2);
+    }
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    for (uint32 i = 0u; (i < 20) && ok; i++) {
+        //Give time to the prefetch thread
+        Sleep::MSec(20);
+        ok = dS.Synchronise();
+        if (ok) {
+            ok &= dS.CompareS_uint8(((uint8 *) ptr[0]), i, 1, dS.elementsRead);
+            ok &= dS.CompareS_int8(((int8 *) ptr[1]), i, 1, dS.elementsRead);
+            ok &= dS.CompareS_uint16(((uint16 *) ptr[2]), i, 2, dS.elementsRead);
+            ok &= dS.CompareS_int16(((int16 *) ptr[3]), i, 2, dS.elementsRead);
+            ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4, dS.elementsRead);
+            ok &= dS.CompareS_int32(((int32 *) ptr[5]), i, 4, dS.elementsRead);
+            ok &= dS.CompareS_uint64(((uint64 *) ptr[6]), i, 8, dS.elementsRead);
+            ok &= dS.CompareS_int64(((int64 *) ptr[7]), i, 8, dS.elementsRead);
+            ok &= dS.CompareS_float32(((float32 *) ptr[8]), i, 0.1, dS.elementsRead);
+            ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1, dS.elementsRead);
+        }
+    }
+    if (ok) {
+        ok = (dS.GetPrefetchedSegments() > 0u);
+    }
+    if (ok) {
+        ok = (dS.GetCacheMisses() < 10u * numberOfValidNodes);
+    }
+    delete[] ptr;
+    return ok;
+}
+
 bool MDSReaderTest::TestSetConfiguredDatabaseNoSignals() {
     bool ok;
     MDSReader dS;
@@ -91,6 +91,22 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests that MDSReader::Initialise() reads the PrefetchSegments parameter.
+     */
+    bool TestInitialise_PrefetchSegments();
+
+    /**
+     * @brief Tests that, without prefetch, each segment is decoded only once (and not once per cycle).
+     */
+    bool TestSynchronise_SegmentCache();
+
+    /**
+     * @brief Tests that with PrefetchSegments > 0 the segments are decoded by the background thread
+     * and the output is the same as in TestSynchronise().
+     */
+    bool TestSynchronise_Prefetch();
+
     /**
      * @brief Test message errors of MDSReader::SetConfiguredDatabase().
      */
@@ -219,6 +219,26 @@ TEST(MDSWriterNodeGTest,TestFlush) {
     ASSERT_TRUE(test.TestFlush());
 }
 
+TEST(MDSWriterNodeGTest,TestInitialise_AutomaticSegmentSize) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_AutomaticSegmentSize());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_False_BadAutomaticSegmentSize) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadAutomaticSegmentSize());
+}
+
+TEST(MDSWriterNodeGTest,TestExecute_AutomaticSegmentation) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_AutomaticSegmentation());
+}
+
+TEST(MDSWriterNodeGTest,TestExecute_AutomaticSegmentationBenchmark) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_AutomaticSegmentationBenchmark());
+}
+
 TEST(MDSWriterNodeGTest,TestSetSignalMemory) {
     MDSWriterNodeTest test;
     ASSERT_TRUE(test.TestSetSignalMemory());
@@ -40,6 +40,37 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/**
+ * Creates a new pulse of the test tree and opens it.
+ */
+static MDSplus::Tree *MDSWriterNodeTestCreatePulse(const MARTe::char8 * const treeName) {
+    using namespace MARTe;
+    MDSplus::Tree *tree = NULL;
+    int32 lastPulseNumber = -1;
+    bool ok = true;
+    try {
+        tree = new MDSplus::Tree(treeName, lastPulseNumber);
+        lastPulseNumber = tree->getCurrent(treeName);
+    }
+    catch (MDSplus::MdsException &exc) {
+        ok = false;
+    }
+    delete tree;
+    tree = NULL_PTR(MDSplus::Tree *);
+    int32 currentPulseNumber = lastPulseNumber + 1;
+    if (ok) {
+        try {
+            tree = new MDSplus::Tree(treeName, -1);
+            tree->setCurrent(treeName, currentPulseNumber);
+            tree->createPulse(currentPulseNumber);
+        }
+        catch (MDSplus::MdsException &exc) {
+            delete tree;
+            tree = NULL_PTR(MDSplus::Tree *);
+        }
+    }
+    return tree;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -1114,6 +1145,231 @@ bool MDSWriterNodeTest::TestFlush() {
 
 }
 
+bool MDSWriterNodeTest::TestInitialise_AutomaticSegmentSize() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 2);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetAutomaticSegmentSize() == 1024u);
+    }
+    if (ok) {
+        MDSWriterNode test16;
+        cdb.Write("AutomaticSegmentSize", 16);
+        ok = test16.Initialise(cdb);
+        if (ok) {
+            ok = (test16.GetAutomaticSegmentSize() == 16u);
+        }
+    }
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestInitialise_False_BadAutomaticSegmentSize() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 2);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("AutomaticSegmentSize", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
+bool MDSWriterNodeTest::TestExecute_AutomaticSegmentation() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 2u;
+    const uint32 numberOfSamples = 3u;
+    const uint32 segmentSize = 4u;
+    const uint32 numberOfExecutes = 3u;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", numberOfElements);
+    cdb.Write("Period", 2);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("AutomaticSegmentSize", segmentSize);
+    cdb.Write("Samples", numberOfSamples);
+    cdb.Write("NumberOfDimensions", 1);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    MDSplus::Tree *tree = NULL_PTR(MDSplus::Tree *);
+    if (ok) {
+        tree = MDSWriterNodeTestCreatePulse("mds_m2test");
+        ok = (tree != NULL_PTR(MDSplus::Tree *));
+    }
+    MDSplus::TreeNode *sigUInt16F = NULL_PTR(MDSplus::TreeNode *);
+    if (ok) {
+        try {
+            sigUInt16F = tree->getNode("SIGUINT16F");
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+    uint16 signal[numberOfElements * numberOfSamples];
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(&signal[0]);
+    }
+    uint32 i;
+    uint32 j;
+    //Each Execute writes 3 rows into segments of 4 rows => 9 rows in 3 segments (4 + 4 + 1)
+    for (i = 0u; (i < numberOfExecutes) && (ok); i++) {
+        for (j = 0u; j < (numberOfElements * numberOfSamples); j++) {
+            signal[j] = static_cast<uint16>((i * numberOfElements * numberOfSamples) + j);
+        }
+        ok = test.Execute();
+    }
+    if (ok) {
+        ok = (sigUInt16F->getNumSegments() == 3);
+    }
+    uint32 row = 0u;
+    int32 s;
+    for (s = 0; (s < 3) && (ok); s++) {
+        MDSplus::Array *segment = sigUInt16F->getSegment(s);
+        MDSplus::Data *segmentTimeD = sigUInt16F->getSegmentDim(s);
+        int32 numberOfElementsData = 0;
+        int32 numberOfElementsTime = 0;
+        uint16 *data = reinterpret_cast<uint16 *>(segment->getShortUnsignedArray(&numberOfElementsData));
+        int64_t *segmentTime = segmentTimeD->getLongArray(&numberOfElementsTime);
+        ok = (numberOfElementsData == (numberOfElementsTime * static_cast<int32>(numberOfElements)));
+        int32 e;
+        for (e = 0; (e < numberOfElementsData) && (ok); e++) {
+            ok = (data[e] == static_cast<uint16>((row * numberOfElements) + static_cast<uint32>(e)));
+        }
+        for (e = 0; (e < numberOfElementsTime) && (ok); e++) {
+            ok = (segmentTime[e] == static_cast<int64_t>(2u * row));
+            row++;
+        }
+        delete[] data;
+        delete[] segmentTime;
+        MDSplus::deleteData(segment);
+        MDSplus::deleteData(segmentTimeD);
+    }
+    if (ok) {
+        ok = (row == (numberOfSamples * numberOfExecutes));
+    }
+    if (sigUInt16F != NULL_PTR(MDSplus::TreeNode *)) {
+        delete sigUInt16F;
+    }
+    if (tree != NULL_PTR(MDSplus::Tree *)) {
+        delete tree;
+    }
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestExecute_AutomaticSegmentationBenchmark() {
+    using namespace MARTe;
+    //1000 element signal at 10 kHz, flushed every millisecond, for one second of data.
+    const uint32 numberOfElements = 1000u;
+    const uint32 numberOfSamples = 10u;
+    const uint32 numberOfExecutes = 1000u;
+    const uint32 numberOfRows = numberOfSamples * numberOfExecutes;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGFLT64F");
+    cdb.Write("Type", "float64");
+    cdb.Write("NumberOfElements", numberOfElements);
+    cdb.Write("Period", 1e-4);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("Samples", numberOfSamples);
+    cdb.Write("NumberOfDimensions", 1);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    MDSplus::Tree *tree = NULL_PTR(MDSplus::Tree *);
+    if (ok) {
+        tree = MDSWriterNodeTestCreatePulse("mds_m2test");
+        ok = (tree != NULL_PTR(MDSplus::Tree *));
+    }
+    float64 *signal = new float64[numberOfElements * numberOfSamples];
+    uint32 j;
+    for (j = 0u; j < (numberOfElements * numberOfSamples); j++) {
+        signal[j] = static_cast<float64>(j);
+    }
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(signal);
+    }
+    uint32 i;
+    uint64 blockStart = HighResolutionTimer::Counter();
+    for (i = 0u; (i < numberOfExecutes) && (ok); i++) {
+        ok = test.Execute();
+    }
+    uint64 blockTicks = (HighResolutionTimer::Counter() - blockStart);
+
+    //Reference: one MDSplus array and one putRow() per sample, as done before the bulk segment writes.
+    MDSplus::TreeNode *reference = NULL_PTR(MDSplus::TreeNode *);
+    if (ok) {
+        try {
+            reference = tree->getNode("SIGFLT64");
+            reference->deleteData();
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+    uint64 rowStart = HighResolutionTimer::Counter();
+    for (i = 0u; (i < numberOfRows) && (ok); i++) {
+        int64_t rowTime = static_cast<int64_t>(i);
+        MDSplus::Array *value = new MDSplus::Float64Array(&signal[(i % numberOfSamples) * numberOfElements], static_cast<int32>(numberOfElements));
+        try {
+            reference->putRow(value, &rowTime);
+        }
+        catch (MDSplus::MdsException &exc) {
+            ok = false;
+        }
+        MDSplus::deleteData(value);
+    }
+    uint64 rowTicks = (HighResolutionTimer::Counter() - rowStart);
+
+    if (ok) {
+        float64 blockTime = static_cast<float64>(blockTicks) * HighResolutionTimer::Period();
+        float64 rowTime = static_cast<float64>(rowTicks) * HighResolutionTimer::Period();
+        float64 megaBytes = static_cast<float64>(numberOfRows * numberOfElements * sizeof(float64)) / 1e6;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Wrote %u rows of %u float64: segment blocks %f s (%f MB/s), putRow %f s (%f MB/s)", numberOfRows,
+                            numberOfElements, blockTime, (megaBytes / blockTime), rowTime, (megaBytes / rowTime));
+    }
+    if (ok) {
+        MDSplus::TreeNode *sigFlt64F = NULL_PTR(MDSplus::TreeNode *);
+        try {
+            sigFlt64F = tree->getNode("SIGFLT64F");
+            int32 numberOfSegments = sigFlt64F->getNumSegments();
+            int32 expectedSegments = static_cast<int32>((numberOfRows + test.GetAutomaticSegmentSize() - 1u) / test.GetAutomaticSegmentSize());
+            ok = (numberOfSegments == expectedSegments);
+        }
+        catch (MDSplus::MdsException &exc) {
+            ok = false;
+        }
+        if (sigFlt64F != NULL_PTR(MDSplus::TreeNode *)) {
+            delete sigFlt64F;
+        }
+    }
+    if (reference != NULL_PTR(MDSplus::TreeNode *)) {
+        delete reference;
+    }
+    delete[] signal;
+    if (tree != NULL_PTR(MDSplus::Tree *)) {
+        delete tree;
+    }
+    return ok;
+}
+
 bool MDSWriterNodeTest::TestSetSignalMemory() {
     return TestExecute();
 }
@@ -241,6 +241,26 @@ public:
      */
     bool TestFlush();
 
+    /**
+     * @brief Tests the Initialise with and without the AutomaticSegmentSize.
+     */
+    bool TestInitialise_AutomaticSegmentSize();
+
+    /**
+     * @brief Tests that the Initialise fails with AutomaticSegmentSize = 0.
+     */
+    bool TestInitialise_False_BadAutomaticSegmentSize();
+
+    /**
+     * @brief Tests the Execute method with automatic segmentation and blocks that span more than one segment.
+     */
+    bool TestExecute_AutomaticSegmentation();
+
+    /**
+     * @brief Benchmarks the automatic segmentation block writes against one putRow() per sample on a local tree.
+     */
+    bool TestExecute_AutomaticSegmentationBenchmark();
+
     /**
      * @brief Test the SetSignalMemory.
      */
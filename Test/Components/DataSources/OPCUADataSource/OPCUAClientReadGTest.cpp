@@ -76,3 +76,18 @@ TEST(OPCUAClientReadGTest,Test_Read_ExtensionObject_Array) {
 }
 
 	
+
+TEST(OPCUAClientReadGTest,Test_Read_ExtensionObject_Benchmark) {
+    OPCUAClientReadTest test;
+    ASSERT_TRUE(test.Test_Read_ExtensionObject_Benchmark());
+}
+
+TEST(OPCUAClientReadGTest,Test_Monitor) {
+    OPCUAClientReadTest test;
+    ASSERT_TRUE(test.Test_Monitor());
+}
+
+TEST(OPCUAClientReadGTest,Test_Monitor_Reconnect) {
+    OPCUAClientReadTest test;
+    ASSERT_TRUE(test.Test_Monitor_Reconnect());
+}
@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
 #include "ObjectRegistryDatabase.h"
 #include "StandardParser.h"
 #include "OPCUAClientRead.h"
@@ -575,6 +576,177 @@ bool OPCUAClientReadTest::Test_Read_ExtensionObject() {
     return ok;
 }
 
+bool OPCUAClientReadTest::Test_Read_ExtensionObject_Benchmark() {
+    using namespace MARTe;
+    OPCUATestServer ots;
+    ots.service.Start();
+    StreamString config = ""
+            "+OPCUATypes = {\n"
+            "     Class = ReferenceContainer\n"
+            "     +Point = {\n"
+            "         Class = IntrospectionStructure\n"
+            "         x = {\n"
+            "             Type = float32\n"
+            "             NumberOfElements = 1\n"
+            "         }\n"
+            "         y = {\n"
+            "             Type = float32\n"
+            "             NumberOfElements = 1\n"
+            "         }\n"
+            "         z = {\n"
+            "             Type = float32\n"
+            "             NumberOfElements = 1\n"
+            "         }\n"
+            "     }\n"
+            "}\n"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAMTimer = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Frequency = 1\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "        +GAMDisplay = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Point = {\n"
+            "                    Type = Point\n"
+            "                    DataSource = OPCUA\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                Point = {\n"
+            "                    Type = Point\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "    +DDB1 = {\n"
+            "      Class = GAMDataSource\n"
+            "    }\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +OPCUA = {\n"
+            "            Class = OPCUADataSource::OPCUADSInput\n"
+            "            Address = \"opc.tcp://localhost.localdomain:4840\""
+            "            Synchronise = \"yes\""
+            "            Signals = {\n"
+            "                Point = {\n"
+            "                    NamespaceIndex = 1\n"
+            "                    Path = Point\n"
+            "                    Type = Point\n"
+            "                    ExtensionObject = \"yes\"\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    +Timer = {\n"
+            "      Class = LinuxTimer\n"
+            "      SleepNature = \"Default\"\n"
+            "      Signals = {\n"
+            "        Counter = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "        Time = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "      }\n"
+            "    }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAMTimer GAMDisplay}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = GAMScheduler\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    Sleep::MSec(200);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ord->Find("Test");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    Sleep::MSec(1000);
+    ReferenceT<OPCUADSInput> odi;
+    if (ok) {
+        odi = ord->Find("Test.Data.OPCUA");
+        ok = odi.IsValid();
+    }
+    /* The application is not started, so that the client is only used by this thread */
+    if (ok) {
+        OPCUAClientRead *ocr = odi->GetOPCUAClient();
+        void *dataPtr = ocr->GetDataPtr();
+        const uint32 nOfReads = 1000u;
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; (i < nOfReads) && (ok); i++) {
+            ok = ocr->Read(NULL_PTR(TypeDescriptor*), NULL_PTR(uint32*));
+        }
+        uint64 elapsed = (HighResolutionTimer::Counter() - start);
+        if (ok) {
+            float64 meanReadTime = (static_cast<float64>(elapsed) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(nOfReads);
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "ExtensionObject Read: %d reads, mean = %f us", nOfReads, meanReadTime);
+            /* The bodies are copied without moving the dataPtr */
+            ok = (ocr->GetDataPtr() == dataPtr);
+        }
+        if (ok) {
+            float32 *ptr = reinterpret_cast<float32*>(ocr->GetDataPtr());
+            ok = (ptr[0] == 1.0);
+        }
+    }
+    ots.SetRunning(false);
+    ots.service.Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool OPCUAClientReadTest::Test_Read_ExtensionObject_Complex() {
     using namespace MARTe;
     StreamString config = ""
@@ -897,3 +1069,160 @@ bool OPCUAClientReadTest::Test_Read_ExtensionObject_Array() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ok;
 }
+
+bool OPCUAClientReadTest::Test_Monitor() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     AddressSpace = {"
+            "         MyNode = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    StreamString *path = new StreamString("MyNode");
+    uint16 ns = 1;
+    uint16 *nsp = &ns;
+    const uint32 nOfNodes = 1u;
+    TypeDescriptor types[] = { UnsignedInteger32Bit };
+    uint32 nElements[] = { 1u };
+    OPCUAClientRead ocr;
+    ocr.SetServerAddress("opc.tcp://localhost:4840");
+    if (ok) {
+        ok = ocr.Connect();
+    }
+    Sleep::MSec(200);
+    if (ok) {
+        ok = ocr.SetServiceRequest(nsp, path, nOfNodes);
+    }
+    void *mem = NULL_PTR(void*);
+    if (ok) {
+        ocr.SetValueMemories(nOfNodes);
+        ok = ocr.GetSignalMemory(mem, 0u, types[0u], nElements[0u]);
+    }
+    if (ok) {
+        *reinterpret_cast<uint32*>(mem) = 0xFFFFFFFFu;
+        ok = ocr.SetMonitoredItems(&types[0u], &nElements[0u], 10.0, 1u);
+    }
+    if (ok) {
+        /* The first notification carries the initial value of the node */
+        uint32 timeOutCounts = 50u;
+        bool done = false;
+        while ((!done) && (timeOutCounts > 0u) && (ok)) {
+            ok = ocr.Monitor(100u);
+            if (ok) {
+                ok = ocr.GetMonitoredSnapshot();
+            }
+            done = (ocr.GetNumberOfNotifications() > 0u);
+            timeOutCounts--;
+        }
+        if (ok) {
+            ok = done;
+        }
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<uint32*>(mem) != 0xFFFFFFFFu);
+    }
+    delete path;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool OPCUAClientReadTest::Test_Monitor_Reconnect() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     AddressSpace = {"
+            "         MyNode = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    StreamString *path = new StreamString("MyNode");
+    uint16 ns = 1;
+    uint16 *nsp = &ns;
+    const uint32 nOfNodes = 1u;
+    TypeDescriptor types[] = { UnsignedInteger32Bit };
+    uint32 nElements[] = { 1u };
+    OPCUAClientRead ocr;
+    ocr.SetServerAddress("opc.tcp://localhost:4840");
+    if (ok) {
+        ok = ocr.Connect();
+    }
+    Sleep::MSec(200);
+    if (ok) {
+        ok = ocr.SetServiceRequest(nsp, path, nOfNodes);
+    }
+    void *mem = NULL_PTR(void*);
+    if (ok) {
+        ocr.SetValueMemories(nOfNodes);
+        ok = ocr.GetSignalMemory(mem, 0u, types[0u], nElements[0u]);
+    }
+    if (ok) {
+        ok = ocr.SetMonitoredItems(&types[0u], &nElements[0u], 10.0, 1u);
+    }
+    uint32 timeOutCounts = 50u;
+    bool done = false;
+    while ((!done) && (timeOutCounts > 0u) && (ok)) {
+        ok = ocr.Monitor(100u);
+        done = (ocr.GetNumberOfNotifications() > 0u);
+        timeOutCounts--;
+    }
+    if (ok) {
+        ok = done;
+    }
+    /* Stop the server: the subscription is lost */
+    if (ok) {
+        ord->Purge();
+        timeOutCounts = 50u;
+        done = false;
+        while ((!done) && (timeOutCounts > 0u)) {
+            done = !ocr.Monitor(100u);
+            timeOutCounts--;
+        }
+        ok = (done) && (!ocr.IsSubscribed());
+    }
+    /* The last values shall still be available */
+    if (ok) {
+        ok = ocr.GetMonitoredSnapshot();
+    }
+    /* Restart the server: the subscription shall be re-created and send the initial value again */
+    uint32 notifications = ocr.GetNumberOfNotifications();
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        timeOutCounts = 100u;
+        done = false;
+        while ((!done) && (timeOutCounts > 0u)) {
+            (void) ocr.Monitor(100u);
+            done = (ocr.IsSubscribed()) && (ocr.GetNumberOfNotifications() > notifications);
+            timeOutCounts--;
+        }
+        ok = done;
+    }
+    delete path;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
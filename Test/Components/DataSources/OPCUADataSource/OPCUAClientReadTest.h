@@ -67,6 +67,21 @@ public:
      */
     bool Test_Read_ExtensionObject_Array();
 
+    /**
+     * @brief Measures the time of the Read of an ExtensionObject and checks that the bodies are decoded in place.
+     */
+    bool Test_Read_ExtensionObject_Benchmark();
+
+    /**
+     * @brief Tests that the monitored items deliver the node values through the snapshot.
+     */
+    bool Test_Monitor();
+
+    /**
+     * @brief Tests that the subscription is re-created after the server is restarted.
+     */
+    bool Test_Monitor_Reconnect();
+
 private:
     class OPCUATestServer: public MARTe::EmbeddedServiceMethodBinderI {
     public:
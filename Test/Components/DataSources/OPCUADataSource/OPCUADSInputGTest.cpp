@@ -71,6 +71,11 @@ TEST(OPCUADSInputGTest,TestSynchronise_Monitor) {
     ASSERT_TRUE(test.TestSynchronise_Monitor());
 }
 
+TEST(OPCUADSInputGTest,TestSynchronise_Monitor_Values) {
+    OPCUADSInputTest test;
+    ASSERT_TRUE(test.TestSynchronise_Monitor_Values());
+}
+
 TEST(OPCUADSInputGTest,TestSynchronise_WrongMode) {
     OPCUADSInputTest test;
     ASSERT_TRUE(test.TestSynchronise_WrongMode());
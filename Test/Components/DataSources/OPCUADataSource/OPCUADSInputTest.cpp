@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ObjectRegistryDatabase.h"
+#include "OPCUAClientWrite.h"
 #include "OPCUADSInputTest.h"
 #include "OPCUADSInput.h"
 #include "OPCUAServer.h"
@@ -742,6 +743,186 @@ bool OPCUADSInputTest::TestSynchronise_Monitor() {
     return ok;
 }
 
+bool OPCUADSInputTest::TestSynchronise_Monitor_Values() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     Port = 4840"
+            "     AddressSpace = {"
+            "         MyNode = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAMTimer = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Frequency = 1\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "        +GAMDisplay = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                MyNode = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = OPCUA\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                MyNode = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "    +DDB1 = {\n"
+            "      Class = GAMDataSource\n"
+            "    }\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +OPCUA = {\n"
+            "            Class = OPCUADataSource::OPCUADSInput\n"
+            "            Address = \"opc.tcp://localhost.localdomain:4840\"\n"
+            "            Synchronise = \"yes\"\n"
+            "            ReadMode = \"Monitor\"\n"
+            "            Signals = {\n"
+            "                MyNode = {\n"
+            "                    NamespaceIndex = 1\n"
+            "                    Path = MyNode\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    +Timer = {\n"
+            "      Class = LinuxTimer\n"
+            "      SleepNature = \"Default\"\n"
+            "      Signals = {\n"
+            "        Counter = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "        Time = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "      }\n"
+            "    }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAMTimer GAMDisplay}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = GAMScheduler\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    Sleep::MSec(200);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ord->Find("Test");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<OPCUADSInput> ds;
+    if (ok) {
+        ds = ord->Find("Test.Data.OPCUA");
+        ok = ds.IsValid();
+    }
+    void *mem = NULL_PTR(void*);
+    if (ok) {
+        ok = ds->GetSignalMemoryBuffer(0u, 0u, mem);
+    }
+    /* Change the value of the node on the server */
+    StreamString *path = new StreamString("MyNode");
+    uint16 ns = 1u;
+    TypeDescriptor type = UnsignedInteger32Bit;
+    uint32 nElements = 1u;
+    OPCUAClientWrite ocw;
+    ocw.SetServerAddress("opc.tcp://localhost:4840");
+    if (ok) {
+        ok = ocw.Connect();
+    }
+    if (ok) {
+        ok = ocw.SetServiceRequest(&ns, path, 1u);
+    }
+    void *writeMem = NULL_PTR(void*);
+    if (ok) {
+        ocw.SetValueMemories(1u);
+        ok = ocw.GetSignalMemory(writeMem, 0u, type, nElements);
+    }
+    if (ok) {
+        ocw.SetWriteRequest(0u, 0u, nElements, type);
+        *reinterpret_cast<uint32*>(writeMem) = 0x12345678u;
+        ok = ocw.Write();
+    }
+    /* The Monitor thread of the DataSource shall receive the new value */
+    if (ok) {
+        uint32 timeOutCounts = 50u;
+        bool done = false;
+        while ((!done) && (timeOutCounts > 0u) && (ok)) {
+            ok = ds->Synchronise();
+            done = (*reinterpret_cast<uint32*>(mem) == 0x12345678u);
+            if (!done) {
+                Sleep::MSec(100);
+            }
+            timeOutCounts--;
+        }
+        if (ok) {
+            ok = done;
+        }
+    }
+    delete path;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool OPCUADSInputTest::TestSynchronise_WrongMode() {
     using namespace MARTe;
     StreamString config = ""
@@ -71,6 +71,11 @@ public:
      */
     bool TestSynchronise_Monitor();
 
+    /**
+     * @brief Tests that Synchronise copies the values received by the MonitoredItem service.
+     */
+    bool TestSynchronise_Monitor_Values();
+
     /**
      * @brief Tests the Synchronise method with Sync option enabled and specifying a not supported read service.
      */
@@ -149,4 +149,19 @@ TEST(RealTimeThreadSynchronisationGTest,TestGetNumberOfStatefulMemoryBuffers) {
     ASSERT_TRUE(test.TestGetNumberOfStatefulMemoryBuffers());
 }
 
+TEST(RealTimeThreadSynchronisationGTest,TestInitialise_NumberOfBuffers) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfBuffers());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestInitialise_False_NumberOfBuffers) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_NumberOfBuffers) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_NumberOfBuffers());
+}
+
 
@@ -380,6 +380,163 @@ static const MARTe::char8 * const config1 = ""
         "    }"
         "}";
 
+//As config1 with NumberOfBuffers = 4
+static const MARTe::char8 * const config1c = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "            NumberOfBuffers = 4"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 //As config1 with WaitForNext
 static const MARTe::char8 * const config1b = ""
         "$Test = {"
@@ -1602,6 +1759,33 @@ bool RealTimeThreadSynchronisationTest::TestInitialise_Timeout() {
     return ok;
 }
 
+bool RealTimeThreadSynchronisationTest::TestInitialise_NumberOfBuffers() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
+    ConfigurationDatabase cdb;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetNumberOfBuffers() == 2u);
+    }
+    if (ok) {
+        RealTimeThreadSynchronisation test4;
+        cdb.Write("NumberOfBuffers", 4);
+        ok = test4.Initialise(cdb);
+        if (ok) {
+            ok = (test4.GetNumberOfBuffers() == 4u);
+        }
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchronisationTest::TestInitialise_False_NumberOfBuffers() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 1);
+    return !test.Initialise(cdb);
+}
+
 bool RealTimeThreadSynchronisationTest::TestGetSynchroniseTimeout() {
     return TestInitialise_Timeout();
 }
@@ -1773,6 +1957,92 @@ bool RealTimeThreadSynchronisationTest::TestSynchronise() {
     return ok;
 }
 
+bool RealTimeThreadSynchronisationTest::TestSynchronise_NumberOfBuffers() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config1c, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread1;
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread2;
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread3;
+    ReferenceT<RealTimeThreadSynchronisationSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeThreadSynchronisation> dataSource;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1Thread1 = godb->Find("Test.Functions.GAM1Thread1");
+        ok = gam1Thread1.IsValid();
+    }
+    if (ok) {
+        gam1Thread2 = godb->Find("Test.Functions.GAM1Thread2");
+        ok = gam1Thread2.IsValid();
+    }
+    if (ok) {
+        gam1Thread3 = godb->Find("Test.Functions.GAM1Thread3");
+        ok = gam1Thread3.IsValid();
+    }
+    if (ok) {
+        dataSource = godb->Find("Test.Data.RealTimeThreadSynchronisationTest");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+
+    //Produce 6 samples without consuming them
+    const uint32 numberOfExecutions = 6u;
+    uint32 j;
+    for (j = 0u; (j < numberOfExecutions) && (ok); j++) {
+        *gam1Thread1->uint32Signal = j;
+        scheduler->ExecuteThreadCycle(0);
+    }
+    uint32 overruns = 0u;
+    uint32 missedBuffers = 0u;
+    //Thread 3 (2 samples) has 3 completed buffers queued out of 4 and shall read them in order
+    if (ok) {
+        ok = dataSource->GetBufferCounters("GAM1Thread3", overruns, missedBuffers);
+    }
+    if (ok) {
+        ok = ((overruns == 0u) && (missedBuffers == 0u));
+    }
+    uint32 b;
+    for (b = 0u; (b < 3u) && (ok); b++) {
+        scheduler->ExecuteThreadCycle(2);
+        ok = (gam1Thread3->uint32Signal[0] == (2u * b));
+        if (ok) {
+            ok = (gam1Thread3->uint32Signal[1] == ((2u * b) + 1u));
+        }
+    }
+    //Thread 2 (1 sample) could only keep the last 3 buffers
+    if (ok) {
+        ok = dataSource->GetBufferCounters("GAM1Thread2", overruns, missedBuffers);
+    }
+    if (ok) {
+        ok = ((overruns == 3u) && (missedBuffers == 3u));
+    }
+    for (b = 3u; (b < numberOfExecutions) && (ok); b++) {
+        scheduler->ExecuteThreadCycle(1);
+        ok = (*gam1Thread2->uint32Signal == b);
+    }
+    if (ok) {
+        ok = !dataSource->GetBufferCounters("GAM1Thread1", overruns, missedBuffers);
+    }
+
+    godb->Purge();
+    return ok;
+}
+
 bool RealTimeThreadSynchronisationTest::TestGetNumberOfStatefulMemoryBuffers() {
     using namespace MARTe;
     RealTimeThreadSynchronisation rtt;
@@ -150,6 +150,21 @@ public:
      */
     bool TestGetNumberOfStatefulMemoryBuffers();
 
+    /**
+     * @brief Tests the Initialise method with the NumberOfBuffers parameter
+     */
+    bool TestInitialise_NumberOfBuffers();
+
+    /**
+     * @brief Tests that the Initialise method fails with NumberOfBuffers < 2
+     */
+    bool TestInitialise_False_NumberOfBuffers();
+
+    /**
+     * @brief Tests that the completed buffers are read in order and that the overruns and missed buffers are counted
+     */
+    bool TestSynchronise_NumberOfBuffers();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -54,6 +54,26 @@ TEST(UARTDataSourceTestGTest,TestCRIOThreadCallback_FailedRead) {
     ASSERT_TRUE(test.TestCRIOThreadCallback_FailedRead());
 }
 
+TEST(UARTDataSourceTestGTest,TestCRIOThreadCallback_FixedLength_Burst) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestCRIOThreadCallback_FixedLength_Burst());
+}
+
+TEST(UARTDataSourceTestGTest,TestCRIOThreadCallback_SyncWord) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestCRIOThreadCallback_SyncWord());
+}
+
+TEST(UARTDataSourceTestGTest,TestCRIOThreadCallback_LengthPrefixed) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestCRIOThreadCallback_LengthPrefixed());
+}
+
+TEST(UARTDataSourceTestGTest,TestCRIOThreadCallback_Timestamps) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestCRIOThreadCallback_Timestamps());
+}
+
 TEST(UARTDataSourceTestGTest,TestGetBrokerName) {
     UARTDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
@@ -119,6 +139,36 @@ TEST(UARTDataSourceTestGTest,TestPrepareNextState) {
     ASSERT_TRUE(test.TestPrepareNextState());
 }
 
+TEST(UARTDataSourceTestGTest,TestInitialise_Framing) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_Framing());
+}
+
+TEST(UARTDataSourceTestGTest,TestInitialise_False_Framing) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Framing());
+}
+
+TEST(UARTDataSourceTestGTest,TestInitialise_False_SyncWord) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SyncWord());
+}
+
+TEST(UARTDataSourceTestGTest,TestInitialise_False_SyncWordSize) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SyncWordSize());
+}
+
+TEST(UARTDataSourceTestGTest,TestInitialise_False_LengthSize) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_LengthSize());
+}
+
+TEST(UARTDataSourceTestGTest,TestInitialise_False_RingSize) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_RingSize());
+}
+
 TEST(UARTDataSourceTestGTest,TestSetConfiguredDatabase) {
     UARTDataSourceTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase());
@@ -158,3 +208,8 @@ TEST(UARTDataSourceTestGTest,TestStopAcquisition) {
     UARTDataSourceTest test;
     ASSERT_TRUE(test.TestStopAcquisition());
 }
+
+TEST(UARTDataSourceTestGTest,TestSetConfiguredDatabase_False_RingSize) {
+    UARTDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_RingSize());
+}
@@ -24,6 +24,10 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -32,6 +36,7 @@
 #include "UARTDataSource.h"
 #include "BasicUART.h"
 #include "GAM.h"
+#include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
@@ -560,6 +565,370 @@ const MARTe::char8 *const config4 = ""
         "}";
 
 
+/**
+ * Maximum number of frames and of bytes per frame stored by the UARTDataSourceTestFrameGAM.
+ */
+static const MARTe::uint32 UART_DATA_SOURCE_TEST_MAX_FRAMES = 16u;
+static const MARTe::uint32 UART_DATA_SOURCE_TEST_MAX_FRAME_SIZE = 16u;
+
+/**
+ * Stores all the valid frames (and their time) that are read from the UARTDataSource.
+ */
+class UARTDataSourceTestFrameGAM: public MARTe::GAM {
+public:CLASS_REGISTER_DECLARATION()
+
+    UARTDataSourceTestFrameGAM () {
+        packetSize = 0u;
+        numberOfFrames = 0u;
+        executedAtLeastOnce = false;
+    }
+
+    virtual ~UARTDataSourceTestFrameGAM() {
+    }
+
+    bool Execute() {
+        MARTe::uint8 *validSignal = reinterpret_cast<MARTe::uint8*>(GetInputSignalMemory(0));
+        MARTe::uint64 *timeSignal = reinterpret_cast<MARTe::uint64*>(GetInputSignalMemory(1));
+        MARTe::uint8 *dataSignal = reinterpret_cast<MARTe::uint8*>(GetInputSignalMemory(2));
+        if (*validSignal) {
+            if (numberOfFrames < UART_DATA_SOURCE_TEST_MAX_FRAMES) {
+                MARTe::MemoryOperationsHelper::Copy(&frames[numberOfFrames][0], dataSignal, packetSize);
+                timestamps[numberOfFrames] = *timeSignal;
+                numberOfFrames++;
+            }
+        }
+        executedAtLeastOnce = true;
+        return true;
+    }
+
+    bool Setup() {
+        bool ok = (GetNumberOfInputSignals() == 3);
+        if (ok) {
+            ok = GetSignalByteSize(MARTe::InputSignals, 2u, packetSize);
+        }
+        if (ok) {
+            ok = (packetSize <= UART_DATA_SOURCE_TEST_MAX_FRAME_SIZE);
+        }
+        return ok;
+    }
+
+    MARTe::uint8 frames[UART_DATA_SOURCE_TEST_MAX_FRAMES][UART_DATA_SOURCE_TEST_MAX_FRAME_SIZE];
+    MARTe::uint64 timestamps[UART_DATA_SOURCE_TEST_MAX_FRAMES];
+    MARTe::uint32 packetSize;
+    volatile MARTe::uint32 numberOfFrames;
+    volatile bool executedAtLeastOnce;
+};
+CLASS_REGISTER(UARTDataSourceTestFrameGAM, "1.0")
+
+/**
+ * Time provider in micro-seconds, to check that the time-stamps are interpolated in the units of the provider.
+ */
+class UARTDataSourceTestMicrosecondProvider: public MARTe::TimestampProvider {
+public:CLASS_REGISTER_DECLARATION()
+
+    UARTDataSourceTestMicrosecondProvider() :
+            MARTe::TimestampProvider() {
+    }
+
+    virtual ~UARTDataSourceTestMicrosecondProvider() {
+    }
+
+    virtual MARTe::uint64 Timestamp() {
+        return static_cast<MARTe::uint64>(static_cast<MARTe::float64>(MARTe::HighResolutionTimer::Counter()) * MARTe::HighResolutionTimer::Period() * 1e6);
+    }
+
+    virtual MARTe::uint64 Frequency() {
+        return 1000000u;
+    }
+};
+CLASS_REGISTER(UARTDataSourceTestMicrosecondProvider, "1.0")
+
+/**
+ * Opens a pseudo-terminal pair. The slave is set in raw mode and kept open by the test, so that the settings are not lost when the UARTDataSource opens it.
+ */
+static bool UARTDataSourceTestOpenPty(int &masterFd, int &slaveFd, MARTe::StreamString &slaveName) {
+    masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+    slaveFd = -1;
+    bool ok = (masterFd >= 0);
+    if (ok) {
+        ok = (grantpt(masterFd) == 0);
+    }
+    if (ok) {
+        ok = (unlockpt(masterFd) == 0);
+    }
+    const char *name = NULL_PTR(const char *);
+    if (ok) {
+        name = ptsname(masterFd);
+        ok = (name != NULL_PTR(const char *));
+    }
+    if (ok) {
+        slaveName = name;
+        slaveFd = open(name, O_RDWR | O_NOCTTY);
+        ok = (slaveFd >= 0);
+    }
+    struct termios tio;
+    if (ok) {
+        ok = (tcgetattr(slaveFd, &tio) == 0);
+    }
+    if (ok) {
+        cfmakeraw(&tio);
+        ok = (tcsetattr(slaveFd, TCSANOW, &tio) == 0);
+    }
+    return ok;
+}
+
+/**
+ * Closes the pseudo-terminal pair opened with UARTDataSourceTestOpenPty.
+ */
+static void UARTDataSourceTestClosePty(const int masterFd, const int slaveFd) {
+    if (slaveFd >= 0) {
+        close(slaveFd);
+    }
+    if (masterFd >= 0) {
+        close(masterFd);
+    }
+}
+
+/**
+ * Updates a CRC-16/CCITT-FALSE with one more byte.
+ */
+static MARTe::uint16 UARTDataSourceTestCRC(MARTe::uint16 crc, const MARTe::uint8 value) {
+    crc ^= static_cast<MARTe::uint16>(value << 8u);
+    for (MARTe::uint32 b = 0u; b < 8u; b++) {
+        crc = static_cast<MARTe::uint16>((crc & 0x8000u) ? ((crc << 1u) ^ 0x1021u) : (crc << 1u));
+    }
+    return crc;
+}
+
+/**
+ * Appends a LengthPrefixed frame with a one byte SyncWord (0x55) and a one byte Length to a stream.
+ */
+static MARTe::uint32 UARTDataSourceTestAddLengthPrefixedFrame(MARTe::uint8 * const stream, const MARTe::uint8 * const payload, const MARTe::uint8 payloadSize,
+                                                             const bool corruptCRC) {
+    MARTe::uint32 n = 0u;
+    stream[n++] = 0x55u;
+    stream[n++] = payloadSize;
+    MARTe::uint16 crc = UARTDataSourceTestCRC(0xFFFFu, payloadSize);
+    for (MARTe::uint32 i = 0u; i < payloadSize; i++) {
+        stream[n++] = payload[i];
+        crc = UARTDataSourceTestCRC(crc, payload[i]);
+    }
+    if (corruptCRC) {
+        crc ^= 0x1u;
+    }
+    stream[n++] = static_cast<MARTe::uint8>(crc >> 8u);
+    stream[n++] = static_cast<MARTe::uint8>(crc & 0xFFu);
+    return n;
+}
+
+/**
+ * Creates the configuration of an application where the UARTDataSourceTestFrameGAM reads from a UARTDataSource.
+ */
+static void UARTDataSourceTestFramingConfig(MARTe::StreamString &config, const MARTe::char8 * const portName, const MARTe::char8 * const framingConfig,
+                                            const MARTe::uint32 packetSize) {
+    config = "";
+    config.Printf(""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = UARTDataSourceTestFrameGAM"
+            "            InputSignals = {"
+            "               DataOK = {"
+            "                   DataSource = CRIOUART"
+            "                   Type = uint8"
+            "                   NumberOfElements = 1"
+            "               }"
+            "               TimeStamp = {"
+            "                   DataSource = CRIOUART"
+            "                   Type = uint64"
+            "                   NumberOfElements = 1"
+            "               }"
+            "               Packet = {"
+            "                   DataSource = CRIOUART"
+            "                   Type = uint8"
+            "                   NumberOfElements = %u"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +CRIOUART = {"
+            "            Class = UARTDataSource"
+            "            NumberOfBuffers = 8"
+            "            PortName = \"%s\""
+            "            BaudRate = 115200"
+            "            Timeout = 200000"
+            "            SerialTimeout = 100000"
+            "            CPUMask = 8"
+            "            %s"
+            "            Signals = {"
+            "                DataOK = {"
+            "                    Type = uint8"
+            "                    NumberOfElements = 1"
+            "                }"
+            "                TimeStamp = {"
+            "                    Type = uint64"
+            "                    NumberOfElements = 1"
+            "                }"
+            "                Packet = {"
+            "                    Type = uint8"
+            "                    NumberOfElements = %u"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}", packetSize, portName, framingConfig, packetSize);
+    config.Seek(0LLU);
+}
+
+/**
+ * Starts a MARTe application which reads from a pseudo-terminal, writes the stream in one go and checks that the expected frames are read, in order and
+ * with increasing time-stamps. If timestamps is set, the time-stamps of the frames are copied to it.
+ */
+static bool TestFramingInApplication(const MARTe::char8 * const framingConfig, const MARTe::uint32 packetSize, const MARTe::uint8 * const stream,
+                                     const MARTe::uint32 streamSize, const MARTe::uint8 * const expectedFrames, const MARTe::uint32 numberOfExpectedFrames,
+                                     MARTe::uint32 &discardedBytes, MARTe::uint32 &crcErrors, MARTe::uint64 * const timestamps = NULL_PTR(MARTe::uint64 *),
+                                     MARTe::uint32 * const numberOfReads = NULL_PTR(MARTe::uint32 *)) {
+    using namespace MARTe;
+    int masterFd;
+    int slaveFd;
+    StreamString slaveName;
+    bool ok = UARTDataSourceTestOpenPty(masterFd, slaveFd, slaveName);
+
+    ConfigurationDatabase cdb;
+    StreamString configStream;
+    if (ok) {
+        UARTDataSourceTestFramingConfig(configStream, slaveName.Buffer(), framingConfig, packetSize);
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        application->StartNextStateExecution();
+    }
+    ReferenceT<UARTDataSourceTestFrameGAM> gam;
+    ReferenceT<UARTDataSource> ds;
+    if (ok) {
+        gam = application->Find("Functions.GAM1");
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ds = application->Find("Data.CRIOUART");
+        ok = ds.IsValid();
+    }
+    if (ok) {
+        while (!gam->executedAtLeastOnce) {
+            Sleep::Sec(0.1);
+        }
+        //All the frames are written at once, so that many frames arrive in the same read.
+        ok = (write(masterFd, stream, streamSize) == static_cast<ssize_t>(streamSize));
+    }
+    if (ok) {
+        TimeoutType maxTimeout(2000);
+        uint64 maxTimeoutTicks = (HighResolutionTimer::Counter() + maxTimeout.HighResolutionTimerTicks());
+        while ((gam->numberOfFrames < numberOfExpectedFrames) && (HighResolutionTimer::Counter() < maxTimeoutTicks)) {
+            Sleep::Sec(0.01);
+        }
+        ok = (gam->numberOfFrames == numberOfExpectedFrames);
+    }
+    for (uint32 f = 0u; (f < numberOfExpectedFrames) && (ok); f++) {
+        for (uint32 i = 0u; (i < packetSize) && (ok); i++) {
+            ok = (gam->frames[f][i] == expectedFrames[(f * packetSize) + i]);
+        }
+        if (ok) {
+            ok = (gam->timestamps[f] > 0u);
+        }
+        if ((ok) && (f > 0u)) {
+            ok = (gam->timestamps[f] >= gam->timestamps[f - 1u]);
+        }
+    }
+    if (ok) {
+        discardedBytes = ds->GetNumberOfDiscardedBytes();
+        crcErrors = ds->GetNumberOfCRCErrors();
+        if (timestamps != NULL_PTR(MARTe::uint64 *)) {
+            for (uint32 f = 0u; f < numberOfExpectedFrames; f++) {
+                timestamps[f] = gam->timestamps[f];
+            }
+        }
+        if (numberOfReads != NULL_PTR(MARTe::uint32 *)) {
+            *numberOfReads = ds->GetNumberOfReads();
+        }
+        ok = (ds->GetNumberOfOverruns() == 0u);
+    }
+    if (application.IsValid()) {
+        application->StopCurrentStateExecution();
+    }
+
+    god->Purge();
+    UARTDataSourceTestClosePty(masterFd, slaveFd);
+    return ok;
+}
+
+/**
+ * Initialises a UARTDataSource, which reads from a pseudo-terminal, with the given framing parameters.
+ */
+static bool TestInitialiseFraming(MARTe::ConfigurationDatabase &cdb, MARTe::UARTDataSource &ds) {
+    using namespace MARTe;
+    int masterFd;
+    int slaveFd;
+    StreamString slaveName;
+    bool ok = UARTDataSourceTestOpenPty(masterFd, slaveFd, slaveName);
+    if (ok) {
+        cdb.MoveToRoot();
+        cdb.Write("PortName", slaveName.Buffer());
+        cdb.Write("BaudRate", 115200);
+        cdb.Write("Timeout", 5000);
+        cdb.Write("SerialTimeout", 100000);
+        cdb.CreateAbsolute("Signals");
+        cdb.MoveToRoot();
+        ok = ds.Initialise(cdb);
+    }
+    UARTDataSourceTestClosePty(masterFd, slaveFd);
+    return ok;
+}
+
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1119,3 +1488,221 @@ bool UARTDataSourceTest::TestStopAcquisition() {
 
     return ok;
 }
+
+bool UARTDataSourceTest::TestInitialise_Framing() {
+    using namespace MARTe;
+    UARTDataSource ds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Framing", "LengthPrefixed");
+    uint8 syncWord[2] = { 0xEBu, 0x90u };
+    Vector<uint8> syncWordVector(&syncWord[0], 2u);
+    cdb.Write("SyncWord", syncWordVector);
+    cdb.Write("LengthSize", 2);
+    cdb.Write("RingSize", 1024);
+    bool ok = TestInitialiseFraming(cdb, ds);
+    if (ok) {
+        ok = (ds.GetFraming() == UARTDataSourceFramingLengthPrefixed);
+    }
+    return ok;
+}
+
+bool UARTDataSourceTest::TestInitialise_False_Framing() {
+    using namespace MARTe;
+    UARTDataSource ds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Framing", "Unknown");
+    return !TestInitialiseFraming(cdb, ds);
+}
+
+bool UARTDataSourceTest::TestInitialise_False_SyncWord() {
+    using namespace MARTe;
+    UARTDataSource ds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Framing", "SyncWord");
+    return !TestInitialiseFraming(cdb, ds);
+}
+
+bool UARTDataSourceTest::TestInitialise_False_SyncWordSize() {
+    using namespace MARTe;
+    UARTDataSource ds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Framing", "SyncWord");
+    uint8 syncWord[UART_DATA_SOURCE_MAX_SYNC_WORD_SIZE + 1u];
+    MemoryOperationsHelper::Set(&syncWord[0], '\0', sizeof(syncWord));
+    Vector<uint8> syncWordVector(&syncWord[0], UART_DATA_SOURCE_MAX_SYNC_WORD_SIZE + 1u);
+    cdb.Write("SyncWord", syncWordVector);
+    return !TestInitialiseFraming(cdb, ds);
+}
+
+bool UARTDataSourceTest::TestInitialise_False_LengthSize() {
+    using namespace MARTe;
+    UARTDataSource ds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Framing", "LengthPrefixed");
+    cdb.Write("LengthSize", 3);
+    return !TestInitialiseFraming(cdb, ds);
+}
+
+bool UARTDataSourceTest::TestInitialise_False_RingSize() {
+    using namespace MARTe;
+    UARTDataSource ds;
+    ConfigurationDatabase cdb;
+    cdb.Write("RingSize", 1000);
+    return !TestInitialiseFraming(cdb, ds);
+}
+
+bool UARTDataSourceTest::TestSetConfiguredDatabase_False_RingSize() {
+    using namespace MARTe;
+    int masterFd;
+    int slaveFd;
+    StreamString slaveName;
+    bool ok = UARTDataSourceTestOpenPty(masterFd, slaveFd, slaveName);
+    ConfigurationDatabase cdb;
+    StreamString configStream;
+    if (ok) {
+        //The ring shall hold at least two frames of 15 bytes
+        UARTDataSourceTestFramingConfig(configStream, slaveName.Buffer(), "RingSize = 16", 15u);
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+    god->Purge();
+    UARTDataSourceTestClosePty(masterFd, slaveFd);
+    return ok;
+}
+
+bool UARTDataSourceTest::TestCRIOThreadCallback_FixedLength_Burst() {
+    using namespace MARTe;
+    const uint32 packetSize = 15u;
+    const uint32 numberOfFrames = 4u;
+    uint8 stream[packetSize * numberOfFrames];
+    for (uint32 i = 0u; i < (packetSize * numberOfFrames); i++) {
+        stream[i] = static_cast<uint8>(i + 1u);
+    }
+    uint32 discardedBytes = 0u;
+    uint32 crcErrors = 0u;
+    bool ok = TestFramingInApplication("", packetSize, &stream[0], sizeof(stream), &stream[0], numberOfFrames, discardedBytes, crcErrors);
+    if (ok) {
+        ok = (discardedBytes == 0u);
+    }
+    return ok;
+}
+
+bool UARTDataSourceTest::TestCRIOThreadCallback_SyncWord() {
+    using namespace MARTe;
+    const uint32 packetSize = 8u;
+    const uint8 frame1[packetSize] = { 0xEBu, 0x90u, 1u, 2u, 3u, 4u, 5u, 6u };
+    const uint8 frame2[packetSize] = { 0xEBu, 0x90u, 7u, 8u, 9u, 10u, 11u, 12u };
+    const uint8 frame3[packetSize] = { 0xEBu, 0x90u, 13u, 14u, 15u, 16u, 17u, 18u };
+    //Garbage before the first frame and between the first and the second frame (including partial SyncWords)
+    const uint8 garbage1[3] = { 0x01u, 0xEBu, 0x02u };
+    const uint8 garbage2[2] = { 0x90u, 0xEBu };
+    uint8 stream[64];
+    uint32 n = 0u;
+    MemoryOperationsHelper::Copy(&stream[n], &garbage1[0], sizeof(garbage1));
+    n += sizeof(garbage1);
+    MemoryOperationsHelper::Copy(&stream[n], &frame1[0], packetSize);
+    n += packetSize;
+    MemoryOperationsHelper::Copy(&stream[n], &garbage2[0], sizeof(garbage2));
+    n += sizeof(garbage2);
+    MemoryOperationsHelper::Copy(&stream[n], &frame2[0], packetSize);
+    n += packetSize;
+    MemoryOperationsHelper::Copy(&stream[n], &frame3[0], packetSize);
+    n += packetSize;
+    uint8 expectedFrames[3u * packetSize];
+    MemoryOperationsHelper::Copy(&expectedFrames[0], &frame1[0], packetSize);
+    MemoryOperationsHelper::Copy(&expectedFrames[packetSize], &frame2[0], packetSize);
+    MemoryOperationsHelper::Copy(&expectedFrames[2u * packetSize], &frame3[0], packetSize);
+
+    uint32 discardedBytes = 0u;
+    uint32 crcErrors = 0u;
+    bool ok = TestFramingInApplication("Framing = SyncWord SyncWord = {0xEB 0x90}", packetSize, &stream[0], n, &expectedFrames[0], 3u, discardedBytes,
+                                       crcErrors);
+    if (ok) {
+        ok = (discardedBytes == (sizeof(garbage1) + sizeof(garbage2)));
+    }
+    return ok;
+}
+
+bool UARTDataSourceTest::TestCRIOThreadCallback_LengthPrefixed() {
+    using namespace MARTe;
+    const uint32 packetSize = 8u;
+    const uint8 payload1[3] = { 1u, 2u, 3u };
+    const uint8 payload2[4] = { 4u, 5u, 6u, 7u };
+    const uint8 payload3[8] = { 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u };
+    uint8 stream[64];
+    uint32 n = 0u;
+    n += UARTDataSourceTestAddLengthPrefixedFrame(&stream[n], &payload1[0], sizeof(payload1), false);
+    uint32 corruptedFrameSize = UARTDataSourceTestAddLengthPrefixedFrame(&stream[n], &payload2[0], sizeof(payload2), true);
+    n += corruptedFrameSize;
+    n += UARTDataSourceTestAddLengthPrefixedFrame(&stream[n], &payload3[0], sizeof(payload3), false);
+    //The payloads are padded with zeros
+    uint8 expectedFrames[2u * packetSize];
+    MemoryOperationsHelper::Set(&expectedFrames[0], '\0', sizeof(expectedFrames));
+    MemoryOperationsHelper::Copy(&expectedFrames[0], &payload1[0], sizeof(payload1));
+    MemoryOperationsHelper::Copy(&expectedFrames[packetSize], &payload3[0], sizeof(payload3));
+
+    uint32 discardedBytes = 0u;
+    uint32 crcErrors = 0u;
+    bool ok = TestFramingInApplication("Framing = LengthPrefixed SyncWord = {0x55}", packetSize, &stream[0], n, &expectedFrames[0], 2u, discardedBytes,
+                                       crcErrors);
+    if (ok) {
+        ok = (crcErrors > 0u);
+    }
+    //Only the corrupted frame is lost
+    if (ok) {
+        ok = (discardedBytes == corruptedFrameSize);
+    }
+    return ok;
+}
+
+bool UARTDataSourceTest::TestCRIOThreadCallback_Timestamps() {
+    using namespace MARTe;
+    const uint32 packetSize = 15u;
+    const uint32 numberOfFrames = 4u;
+    uint8 stream[packetSize * numberOfFrames];
+    for (uint32 i = 0u; i < (packetSize * numberOfFrames); i++) {
+        stream[i] = static_cast<uint8>(i + 1u);
+    }
+    uint32 discardedBytes = 0u;
+    uint32 crcErrors = 0u;
+    uint64 timestamps[numberOfFrames];
+    uint32 numberOfReads = 0u;
+    bool ok = TestFramingInApplication("+TimeProvider = { Class = UARTDataSourceTestMicrosecondProvider }", packetSize, &stream[0], sizeof(stream),
+                                       &stream[0], numberOfFrames, discardedBytes, crcErrors, &timestamps[0], &numberOfReads);
+    if (ok) {
+        ok = (numberOfReads > 0u);
+    }
+    //The frames which arrive in the same read shall be spaced by the time that a frame takes at 115200 baud (1302.08 us),
+    //allowing 1 us for the truncation of each time-stamp. The pseudo-terminal may split the burst, and the frames at the boundary
+    //of two reads are spaced by the time between the reads, so that at most (numberOfReads - 1) spacings may differ.
+    const uint64 frameDurationTimesBaudRate = static_cast<uint64>(packetSize) * 10u * 1000000u;
+    const uint64 toleranceTimesBaudRate = 115200u;
+    uint32 nOfSpacingsBetweenReads = 0u;
+    for (uint32 f = 1u; (f < numberOfFrames) && (ok); f++) {
+        uint64 spacingTimesBaudRate = (timestamps[f] - timestamps[f - 1u]) * 115200u;
+        bool sameRead = ((spacingTimesBaudRate + toleranceTimesBaudRate) >= frameDurationTimesBaudRate);
+        if (sameRead) {
+            sameRead = (spacingTimesBaudRate <= (frameDurationTimesBaudRate + toleranceTimesBaudRate));
+        }
+        if (!sameRead) {
+            nOfSpacingsBetweenReads++;
+        }
+    }
+    if (ok) {
+        ok = (nOfSpacingsBetweenReads < numberOfReads);
+    }
+    return ok;
+}
@@ -90,6 +90,36 @@ public:
      */
     bool TestInitialise_TooManyTimestampProviders();
 
+    /**
+     * @brief Tests the Initialise method with the Framing, SyncWord, LengthSize and RingSize parameters.
+     */
+    bool TestInitialise_Framing();
+
+    /**
+     * @brief Tests that the Initialise method fails if the Framing is not supported.
+     */
+    bool TestInitialise_False_Framing();
+
+    /**
+     * @brief Tests that the Initialise method fails if Framing = SyncWord and no SyncWord is specified.
+     */
+    bool TestInitialise_False_SyncWord();
+
+    /**
+     * @brief Tests that the Initialise method fails if the SyncWord is too large.
+     */
+    bool TestInitialise_False_SyncWordSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if the LengthSize is not 1 or 2.
+     */
+    bool TestInitialise_False_LengthSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if the RingSize is not a power of 2.
+     */
+    bool TestInitialise_False_RingSize();
+
     /**
      * @brief Tests the SetConfiguredDatabase method.
      */
@@ -115,6 +145,11 @@ public:
      */
     bool TestSetConfiguredDatabase_False_Signal2_Not_UInt64();
 
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the RingSize cannot hold two frames.
+     */
+    bool TestSetConfiguredDatabase_False_RingSize();
+
     /**
      * @brief Tests the GetInputOffset method.
      */
@@ -140,6 +175,26 @@ public:
      */
     bool TestCRIOThreadCallback_FailedRead();
 
+    /**
+     * @brief Tests that the CRIOThreadCallback extracts all the frames which arrive in the same read (using a pseudo-terminal).
+     */
+    bool TestCRIOThreadCallback_FixedLength_Burst();
+
+    /**
+     * @brief Tests that the CRIOThreadCallback resynchronises on the SyncWord without losing any valid frame (using a pseudo-terminal).
+     */
+    bool TestCRIOThreadCallback_SyncWord();
+
+    /**
+     * @brief Tests that the CRIOThreadCallback only discards the LengthPrefixed frames with a wrong CRC (using a pseudo-terminal).
+     */
+    bool TestCRIOThreadCallback_LengthPrefixed();
+
+    /**
+     * @brief Tests that the CRIOThreadCallback interpolates the time-stamps of the frames of a burst in the units of the time provider.
+     */
+    bool TestCRIOThreadCallback_Timestamps();
+
     /**
      * @brief Tests the GetBrokerName method.
      */
@@ -119,3 +119,53 @@ TEST(UDPReceiverGTest,TestExecute_Timeout) {
     UDPReceiverTest test;
     ASSERT_TRUE(test.TestExecute_Timeout());
 }
+
+TEST(UDPReceiverGTest,TestInitialise_Batch) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Batch());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_ReceiveMode) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_ReceiveMode());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_BatchSize) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_BatchSize());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_Batch) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_Batch());
+}
+
+TEST(UDPReceiverGTest,TestExecute_TripleBuffer) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestExecute_TripleBuffer());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_AgeSignal) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_AgeSignal());
+}
+
+TEST(UDPReceiverGTest,TestSetConfiguredDatabase_False_AgeSignal) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_AgeSignal());
+}
+
+TEST(UDPReceiverGTest,TestExecuteJitterBenchmark_RealTimeThread) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestExecuteJitterBenchmark("RealTimeThread"));
+}
+
+TEST(UDPReceiverGTest,TestExecuteJitterBenchmark_IndependentThread) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestExecuteJitterBenchmark("IndependentThread"));
+}
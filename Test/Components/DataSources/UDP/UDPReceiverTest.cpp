@@ -33,6 +33,7 @@
 
 #include "AdvancedErrorManagement.h"
 #include "GAMScheduler.h"
+#include "HighResolutionTimer.h"
 #include "ObjectRegistryDatabase.h"
 #include "StandardParser.h"
 #include "StreamString.h"
@@ -122,6 +123,70 @@ private:
 
 };
 
+//Helper Client which sends an increasing counter with a given period
+class PeriodicSenderHelper: public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    PeriodicSenderHelper(const MARTe::uint16 portIn,
+                         const MARTe::uint32 periodUSecIn) :
+            EmbeddedServiceMethodBinderI(),
+            executor(*this) {
+        port = portIn;
+        periodUSec = periodUSecIn;
+        counter = 0u;
+    }
+
+    ~PeriodicSenderHelper() {
+        if (!executor.Stop()) {
+            if (!executor.Stop()) {
+
+            }
+        }
+        if (!socket.Close()) {
+
+        }
+    }
+
+    bool Start() {
+        using namespace MARTe;
+        bool ok = socket.Open();
+        if (ok) {
+            ok = socket.Connect("127.0.0.1", port);
+        }
+        if (ok) {
+            ok = (executor.Start() == ErrorManagement::NoError);
+        }
+        return ok;
+    }
+
+    bool Stop() {
+        using namespace MARTe;
+        executor.Stop();
+        return (executor.Stop() == ErrorManagement::NoError);
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info) {
+        using namespace MARTe;
+        counter++;
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        bool ok = socket.Write(reinterpret_cast<const char8 *>(&counter), size);
+        Sleep::USec(periodUSec);
+        return ok;
+    }
+
+private:
+
+    MARTe::SingleThreadService executor;
+
+    MARTe::UDPSocket socket;
+
+    MARTe::uint16 port;
+
+    MARTe::uint32 periodUSec;
+
+    MARTe::uint32 counter;
+
+};
+
 /**
  * @brief Manual scheduler to test the correct interface between the UDPSender and the GAMs
  */
@@ -205,6 +270,88 @@ private:
 
 CLASS_REGISTER(TestHelperGAM, "1.0")
 
+/**
+ * @brief Copies the two batch counters followed by the NumberOfPackets = 4 payload samples.
+ */
+class TestHelperBatchGAM: public MARTe::GAM {
+public:CLASS_REGISTER_DECLARATION()
+    TestHelperBatchGAM() :
+            MARTe::GAM() {
+        MARTe::uint32 i;
+        for (i = 0u; i < 6u; i++) {
+            mem[i] = 0u;
+        }
+    }
+
+    ~TestHelperBatchGAM() {
+    }
+
+    bool Setup() {
+        return true;
+    }
+
+    bool Execute() {
+        using namespace MARTe;
+        bool ok = MemoryOperationsHelper::Copy(&mem[0], GetInputSignalsMemory(), static_cast<uint32>(sizeof(mem)));
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), static_cast<uint32>(sizeof(mem)));
+        }
+        return ok;
+    }
+
+    const MARTe::uint32 * GetMemory() const {
+        return &mem[0];
+    }
+
+private:
+    MARTe::uint32 mem[6];
+
+};
+
+CLASS_REGISTER(TestHelperBatchGAM, "1.0")
+
+/**
+ * @brief Copies the payload and the age signal.
+ */
+class TestHelperAgeGAM: public MARTe::GAM {
+public:CLASS_REGISTER_DECLARATION()
+    TestHelperAgeGAM() :
+            MARTe::GAM() {
+        mem[0] = 0u;
+        mem[1] = 0u;
+    }
+
+    ~TestHelperAgeGAM() {
+    }
+
+    bool Setup() {
+        return true;
+    }
+
+    bool Execute() {
+        using namespace MARTe;
+        bool ok = MemoryOperationsHelper::Copy(&mem[0], GetInputSignalsMemory(), static_cast<uint32>(sizeof(mem)));
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), static_cast<uint32>(sizeof(mem)));
+        }
+        return ok;
+    }
+
+    MARTe::uint32 GetPayload() const {
+        return mem[0];
+    }
+
+    MARTe::uint32 GetAge() const {
+        return mem[1];
+    }
+
+private:
+    MARTe::uint32 mem[2];
+
+};
+
+CLASS_REGISTER(TestHelperAgeGAM, "1.0")
+
 static bool TestIntegratedExecution(const MARTe::char8 *const config,
                                     MARTe::uint32 sleepMSec = 10) {
     using namespace MARTe;
@@ -585,38 +732,335 @@ static const MARTe::char8 *const config4 = ""
         "    }"
         "}";
 
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
-bool UDPReceiverTest::TestConstructor() {
-    using namespace MARTe;
-    UDPReceiver test;
-    bool ok = (test.GetCPUMask() == 0u);
-    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
-    ok &= (test.GetPort() == 0u);
-    ok &= (test.GetAddress() == "");
-    ok &= (test.GetExecutionMode() == UDPReceiverExecutionModeRealTime);
-    return ok;
-}
+//Correct configuration in batch mode
+static const MARTe::char8 *const config5 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperBatchGAM"
+        "            InputSignals = {"
+        "                Dropped = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Overrun = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Out = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 6"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            ReceiveMode = Batch"
+        "            BatchSize = 3"
+        "            NumberOfPackets = 4"
+        "            Port = 45679"
+        "            Timeout = 1"
+        "            Signals = {"
+        "                Dropped = {"
+        "                    Type = uint32"
+        "                }"
+        "                Overrun = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 
-bool UDPReceiverTest::TestInitialise_No_Address() {
-    using namespace MARTe;
-    UDPReceiver test;
-    ConfigurationDatabase cdb;
-    cdb.Write("Port", 45678);
-    cdb.Write("Timeout", 10);
-    cdb.Write("ExecutionMode", "RealTimeThread");
-    cdb.CreateRelative("Signals");
-    cdb.MoveToRoot();
-    bool ok = test.Initialise(cdb);
-    ok &= (test.GetAddress() == "");
-    return ok;
-}
+//Correct configuration with decoupled thread and age signal
+static const MARTe::char8 *const config6 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperAgeGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Age = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Out = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 2"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = IndependentThread"
+        "            Port = 45680"
+        "            Timeout = 1"
+        "            AgeSignal = Age"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "                Age = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 
-bool UDPReceiverTest::TestInitialise_No_Port() {
-    using namespace MARTe;
-    UDPReceiver test;
+//Correct configuration with age signal
+static const MARTe::char8 *const config7 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperAgeGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Age = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Out = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 2"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            Port = 45681"
+        "            Timeout = 1"
+        "            AgeSignal = Age"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "                Age = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Wrong configuration with the age signal not being the last signal
+static const MARTe::char8 *const config8 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperAgeGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Age = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Out = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 2"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            Port = 45681"
+        "            Timeout = 1"
+        "            AgeSignal = Age"
+        "            Signals = {"
+        "                Age = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool UDPReceiverTest::TestConstructor() {
+    using namespace MARTe;
+    UDPReceiver test;
+    bool ok = (test.GetCPUMask() == 0u);
+    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
+    ok &= (test.GetPort() == 0u);
+    ok &= (test.GetAddress() == "");
+    ok &= (test.GetExecutionMode() == UDPReceiverExecutionModeRealTime);
+    ok &= (test.GetReceiveMode() == UDPReceiverReceiveModeSingle);
+    ok &= (test.GetBatchSize() == 32u);
+    ok &= (test.GetNumberOfPackets() == 1u);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_No_Address() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("Timeout", 10);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetAddress() == "");
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_No_Port() {
+    using namespace MARTe;
+    UDPReceiver test;
     ConfigurationDatabase cdb;
     cdb.Write("Timeout", 10);
     cdb.Write("ExecutionMode", "RealTimeThread");
@@ -715,6 +1159,61 @@ bool UDPReceiverTest::TestInitialise_Wrong_ExecutionMode() {
     return !ok;
 }
 
+bool UDPReceiverTest::TestInitialise_Batch() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 500);
+    cdb.Write("ReceiveMode", "Batch");
+    cdb.Write("BatchSize", 8);
+    cdb.Write("NumberOfPackets", 4);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetReceiveMode() == UDPReceiverReceiveModeBatch);
+    ok &= (test.GetBatchSize() == 8u);
+    ok &= (test.GetNumberOfPackets() == 4u);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_ReceiveMode() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 500);
+    cdb.Write("ReceiveMode", "Bulk");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_BatchSize() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 500);
+    cdb.Write("ReceiveMode", "Batch");
+    cdb.Write("BatchSize", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_NumberOfPackets() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 500);
+    cdb.Write("ReceiveMode", "Batch");
+    cdb.Write("NumberOfPackets", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
 bool UDPReceiverTest::TestSetConfiguredDatabase_ValidAddress() {
     return TestIntegratedExecution(config1);
 }
@@ -821,3 +1320,348 @@ bool UDPReceiverTest::TestExecute_Timeout() {
 
     return ok;
 }
+
+bool UDPReceiverTest::TestSynchronise_Batch() {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config5;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<UDPReceiverSchedulerTestHelper> scheduler;
+    ReferenceT<TestHelperBatchGAM> hGam;
+    UDPSocket sender;
+
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        hGam = application->Find("Functions.GAMReceiver");
+        ok = hGam.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = sender.Open();
+    }
+    if (ok) {
+        ok = sender.Connect("127.0.0.1", 45679u);
+    }
+    //10 datagrams for a ring of 4: the 4 newest are published and 6 are overrun
+    uint32 value;
+    for (value = 1u; (value <= 10u) && (ok); value++) {
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        ok = sender.Write(reinterpret_cast<const char8 *>(&value), size);
+    }
+    if (ok) {
+        Sleep::MSec(10u);
+        scheduler->ExecuteThreadCycle(0);
+        const uint32 *const received = hGam->GetMemory();
+        ok = (received[0] == 0u);
+        ok &= (received[1] == 6u);
+        ok &= (received[2] == 7u);
+        ok &= (received[3] == 8u);
+        ok &= (received[4] == 9u);
+        ok &= (received[5] == 10u);
+    }
+    //A datagram with the wrong size is counted as dropped and not stored
+    if (ok) {
+        uint16 wrongSize = 5u;
+        uint32 size = static_cast<uint32>(sizeof(uint16));
+        ok = sender.Write(reinterpret_cast<const char8 *>(&wrongSize), size);
+    }
+    if (ok) {
+        value = 11u;
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        ok = sender.Write(reinterpret_cast<const char8 *>(&value), size);
+    }
+    if (ok) {
+        Sleep::MSec(10u);
+        scheduler->ExecuteThreadCycle(0);
+        const uint32 *const received = hGam->GetMemory();
+        ok = (received[0] == 1u);
+        ok &= (received[1] == 6u);
+        ok &= (received[2] == 8u);
+        ok &= (received[3] == 9u);
+        ok &= (received[4] == 10u);
+        ok &= (received[5] == 11u);
+    }
+    (void) sender.Close();
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    return ok;
+}
+
+bool UDPReceiverTest::TestExecute_TripleBuffer() {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config6;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<UDPReceiverSchedulerTestHelper> scheduler;
+    ReferenceT<TestHelperAgeGAM> hGam;
+    UDPSocket sender;
+
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        hGam = application->Find("Functions.GAMReceiver");
+        ok = hGam.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    //Nothing received yet
+    if (ok) {
+        scheduler->ExecuteThreadCycle(0);
+        ok = (hGam->GetPayload() == 0u);
+        ok &= (hGam->GetAge() == 0xFFFFFFFFu);
+    }
+    if (ok) {
+        ok = sender.Open();
+    }
+    if (ok) {
+        ok = sender.Connect("127.0.0.1", 45680u);
+    }
+    //Only the newest packet shall be read, without blocking
+    uint32 value;
+    for (value = 1u; (value <= 5u) && (ok); value++) {
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        ok = sender.Write(reinterpret_cast<const char8 *>(&value), size);
+        Sleep::MSec(5u);
+    }
+    if (ok) {
+        Sleep::MSec(10u);
+        scheduler->ExecuteThreadCycle(0);
+        ok = (hGam->GetPayload() == 5u);
+        ok &= (hGam->GetAge() < 1000000u);
+    }
+    //No new packet: the same data is read again and the age increases
+    uint32 lastAge = 0u;
+    if (ok) {
+        lastAge = hGam->GetAge();
+        Sleep::MSec(20u);
+        scheduler->ExecuteThreadCycle(0);
+        ok = (hGam->GetPayload() == 5u);
+        ok &= (hGam->GetAge() >= (lastAge + 20000u));
+    }
+    (void) sender.Close();
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    return ok;
+}
+
+bool UDPReceiverTest::TestSynchronise_AgeSignal() {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config7;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<UDPReceiverSchedulerTestHelper> scheduler;
+    ReferenceT<TestHelperAgeGAM> hGam;
+    UDPSocket sender;
+
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        hGam = application->Find("Functions.GAMReceiver");
+        ok = hGam.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = sender.Open();
+    }
+    if (ok) {
+        ok = sender.Connect("127.0.0.1", 45681u);
+    }
+    //The datagram does not include the age signal
+    if (ok) {
+        uint32 value = 7u;
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        ok = sender.Write(reinterpret_cast<const char8 *>(&value), size);
+    }
+    if (ok) {
+        scheduler->ExecuteThreadCycle(0);
+        ok = (hGam->GetPayload() == 7u);
+        ok &= (hGam->GetAge() < 1000000u);
+    }
+    (void) sender.Close();
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    return ok;
+}
+
+bool UDPReceiverTest::TestSetConfiguredDatabase_False_AgeSignal() {
+    return !TestIntegratedExecution(config8);
+}
+
+bool UDPReceiverTest::TestExecuteJitterBenchmark(const MARTe::char8 *const executionMode) {
+    using namespace MARTe;
+    const uint32 numberOfCycles = 500u;
+    const uint32 cyclePeriodUSec = 1000u;
+    bool independentThread = (StringHelper::Compare(executionMode, "IndependentThread") == 0);
+    const uint16 benchmarkPort = (independentThread) ? (45680u) : (45681u);
+
+    StreamString configStream = (independentThread) ? (config6) : (config7);
+    bool ok = configStream.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configStream, cdb);
+    if (ok) {
+        ok = parser.Parse();
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<UDPReceiverSchedulerTestHelper> scheduler;
+    ReferenceT<TestHelperAgeGAM> hGam;
+    PeriodicSenderHelper sender(benchmarkPort, cyclePeriodUSec);
+
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        hGam = application->Find("Functions.GAMReceiver");
+        ok = hGam.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = sender.Start();
+    }
+    uint64 totalTicks = 0u;
+    uint64 maxTicks = 0u;
+    uint64 totalAge = 0u;
+    uint32 maxAge = 0u;
+    uint32 nOfAges = 0u;
+    uint32 c;
+    for (c = 0u; (c < numberOfCycles) && (ok); c++) {
+        uint64 start = HighResolutionTimer::Counter();
+        scheduler->ExecuteThreadCycle(0);
+        uint64 elapsed = HighResolutionTimer::Counter() - start;
+        totalTicks += elapsed;
+        if (elapsed > maxTicks) {
+            maxTicks = elapsed;
+        }
+        uint32 age = hGam->GetAge();
+        if (age != 0xFFFFFFFFu) {
+            totalAge += age;
+            nOfAges++;
+            if (age > maxAge) {
+                maxAge = age;
+            }
+        }
+        Sleep::USec(cyclePeriodUSec);
+    }
+    if (ok) {
+        ok = sender.Stop();
+    }
+    if (ok) {
+        ok = (nOfAges > 0u);
+    }
+    if (ok) {
+        float64 averageUs = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(numberOfCycles);
+        float64 maxUs = static_cast<float64>(maxTicks) * HighResolutionTimer::Period() * 1e6;
+        float64 averageAgeUs = static_cast<float64>(totalAge) / static_cast<float64>(nOfAges);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%s: %u cycles. Cycle time average = %f us, max = %f us. Age average = %f us, max = %u us", executionMode,
+                            numberOfCycles, averageUs, maxUs, averageAgeUs, maxAge);
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    return ok;
+}
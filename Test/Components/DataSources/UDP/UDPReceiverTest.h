@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
 
 
 /*---------------------------------------------------------------------------*/
@@ -89,6 +90,26 @@ public:
      */
     bool TestInitialise_Wrong_ExecutionMode();
 
+    /**
+     * @brief Tests the Initialise method with ReceiveMode = Batch, BatchSize and NumberOfPackets
+     */
+    bool TestInitialise_Batch();
+
+    /**
+     * @brief Tests the Initialise method with a wrong ReceiveMode
+     */
+    bool TestInitialise_Wrong_ReceiveMode();
+
+    /**
+     * @brief Tests the Initialise method with BatchSize = 0
+     */
+    bool TestInitialise_Wrong_BatchSize();
+
+    /**
+     * @brief Tests the Initialise method with NumberOfPackets = 0
+     */
+    bool TestInitialise_Wrong_NumberOfPackets();
+
     /**
      * @brief Tests the SetConfiguredDatabase method with Address for multicast.
      */
@@ -119,6 +140,32 @@ public:
      */
     bool TestExecute_Timeout();
 
+    /**
+     * @brief Tests the Synchronise method with ReceiveMode = Batch, including the overrun and dropped counters
+     */
+    bool TestSynchronise_Batch();
+
+    /**
+     * @brief Tests that in IndependentThread mode the newest packet is read without blocking and that the age signal increases when no packet is received.
+     */
+    bool TestExecute_TripleBuffer();
+
+    /**
+     * @brief Tests the Synchronise method with an AgeSignal in RealTimeThread mode.
+     */
+    bool TestSynchronise_AgeSignal();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase fails if the AgeSignal is not the last signal.
+     */
+    bool TestSetConfiguredDatabase_False_AgeSignal();
+
+    /**
+     * @brief Benchmarks the real-time cycle time and the age of the data received from a sender running over the loopback with a 1 ms period.
+     * @param[in] executionMode the UDPReceiver ExecutionMode.
+     */
+    bool TestExecuteJitterBenchmark(const MARTe::char8 *const executionMode);
+
 };
 
 
@@ -229,6 +229,21 @@ TEST(ConversionGAMGTest,TestSetup_False_InvalidOutputSamplesMismatch) {
     ASSERT_TRUE(test.TestSetup_False_InvalidOutputSamplesMismatch());
 }
 
+TEST(ConversionGAMGTest,TestSetup_False_SaturateFloat) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_SaturateFloat());
+}
+
+TEST(ConversionGAMGTest,TestExecute_OffsetSaturateRound) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_OffsetSaturateRound());
+}
+
+TEST(ConversionGAMGTest,TestGetNumberOfFusedConversions) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestGetNumberOfFusedConversions());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
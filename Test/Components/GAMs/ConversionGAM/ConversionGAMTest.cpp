@@ -402,4 +402,99 @@ bool ConversionGAMTest::TestSetup_False_InvalidOutputSamplesMismatch() {
     return ok;
 }
 
+bool ConversionGAMTest::TestExecute_OffsetSaturateRound() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(configOffsetSaturateRound, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<ConversionGAMTestHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        //Signal1 and Signal2 are contiguous and fused. Signal4 has no Gain nor Offset and is not fused with Signal3.
+        ok = (gam->GetNumberOfFusedConversions() == 3u);
+    }
+    if (ok) {
+        const int16 values[4] = { -1000, -3, 3, 1000 };
+        int16 *inputSignals = static_cast<int16 *>(gam->GetInputSignalsMemory());
+        uint32 i;
+        for (i = 0u; i < 16u; i++) {
+            inputSignals[i] = values[i % 4u];
+        }
+        ok = gam->Execute();
+    }
+    if (ok) {
+        //0.5 * x + 0.25 rounded and saturated
+        const int8 expected[4] = { -128, -1, 2, 127 };
+        uint32 s;
+        for (s = 0u; (s < 2u) && (ok); s++) {
+            int8 *output = static_cast<int8 *>(gam->GetOutputSignalMemory(s));
+            uint32 i;
+            for (i = 0u; (i < 4u) && (ok); i++) {
+                ok = (output[i] == expected[i]);
+            }
+        }
+    }
+    if (ok) {
+        const float32 expected3[4] = { -2001.0F, -7.0F, 5.0F, 1999.0F };
+        const float32 expected4[4] = { -1000.0F, -3.0F, 3.0F, 1000.0F };
+        float32 *output3 = static_cast<float32 *>(gam->GetOutputSignalMemory(2u));
+        float32 *output4 = static_cast<float32 *>(gam->GetOutputSignalMemory(3u));
+        uint32 i;
+        for (i = 0u; (i < 4u) && (ok); i++) {
+            ok = (output3[i] == expected3[i]) && (output4[i] == expected4[i]);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool ConversionGAMTest::TestGetNumberOfFusedConversions() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(configFromBasicTypeTemplate, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<ConversionGAMTestHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        //30 uint8 signals converted to 10 different types
+        ok = (gam->GetNumberOfFusedConversions() == 10u);
+    }
+    god->Purge();
+    return ok;
+}
 
+bool ConversionGAMTest::TestSetup_False_SaturateFloat() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configOffsetSaturateRound;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal3");
+    }
+    if (ok) {
+        ok = cdb.Write("Saturate", 1);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+
+    god->Purge();
+    return ok;
+}
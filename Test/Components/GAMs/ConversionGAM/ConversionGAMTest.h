@@ -101,6 +101,21 @@ public:
     template<typename baseType>
     bool TestExecute(baseType typeValue, bool setGain = false, MARTe::float32 gainValue = 1.0);
 
+    /**
+     * @brief Tests the Execute method with an Offset and with the Saturate and Round integer modes.
+     */
+    bool TestExecute_OffsetSaturateRound();
+
+    /**
+     * @brief Tests the GetNumberOfFusedConversions method.
+     */
+    bool TestGetNumberOfFusedConversions();
+
+    /**
+     * @brief Tests that the Setup method fails if Saturate or Round are set for a float OutputSignal.
+     */
+    bool TestSetup_False_SaturateFloat();
+
 private:
     /**
      * Starts a MARTe application that uses this GAM instance.
@@ -478,6 +493,102 @@ static const MARTe::char8 * const configFromBasicTypeTemplate = ""
         "    }"
         "}";
 
+//Offset, Saturate and Round
+static const MARTe::char8 * const configOffsetSaturateRound = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = ConversionGAMTestHelper"
+        "            InputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int16"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int16"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int16"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               Signal4 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int16"
+        "                   NumberOfElements = 4"
+        "               }"
+        "            }"
+        "            OutputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = int8"
+        "                   NumberOfElements = 4"
+        "                   Gain = 0.5"
+        "                   Offset = 0.25"
+        "                   Saturate = 1"
+        "                   Round = 1"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = int8"
+        "                   NumberOfElements = 4"
+        "                   Gain = 0.5"
+        "                   Offset = 0.25"
+        "                   Saturate = 1"
+        "                   Round = 1"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "                   Gain = 2"
+        "                   Offset = -1"
+        "               }"
+        "               Signal4 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   NumberOfElements = 4"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = ConversionGAMDataSourceHelper"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 template<typename baseType>
 bool ConversionGAMTest::TestSetup_False_InvalidOutputSignalType() {
     using namespace MARTe;
@@ -85,6 +85,41 @@ TEST(ConversionHelperTGTest,TestSetNumberOfSamples) {
     ASSERT_TRUE(test.TestSetNumberOfSamples());
 }
 
+TEST(ConversionHelperTGTest,TestLoadOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadOffset());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_GainOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_GainOffset());
+}
+
+TEST(ConversionHelperTGTest,TestSetIntegerMode) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSetIntegerMode());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_NegativeGainUnsigned) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_NegativeGainUnsigned());
+}
+
+TEST(ConversionHelperTGTest,TestFuse) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestFuse());
+}
+
+TEST(ConversionHelperTGTest,TestFuse_False_DifferentKernel) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestFuse_False_DifferentKernel());
+}
+
+TEST(ConversionHelperTGTest,TestGetNumberOfSegments) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestGetNumberOfSegments());
+}
+
 
 
 
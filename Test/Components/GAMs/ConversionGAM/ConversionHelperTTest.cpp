@@ -124,3 +124,207 @@ bool ConversionHelperTTest::TestGetOutputMemory() {
     }
     return ok;
 }
+
+bool ConversionHelperTTest::TestLoadOffset() {
+    using namespace MARTe;
+    ConversionHelperT<uint32, float32> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    bool ok = !test.LoadOffset(cdb);
+    cdb.Write("Offset", -10);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_GainOffset() {
+    using namespace MARTe;
+    int16 input[4] = { -2, 0, 1, 100 };
+    float32 output[4];
+    ConversionHelperT<int16, float32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(2u);
+    test.SetNumberOfSamples(2u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Offset", 0.5);
+    bool ok = !test.LoadGain(cdb);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == -1.5F) && (output[1] == 0.5F) && (output[2] == 1.5F) && (output[3] == 100.5F);
+    }
+    cdb.Write("Gain", 2);
+    if (ok) {
+        ok = test.LoadGain(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == -3.5F) && (output[1] == 0.5F) && (output[2] == 2.5F) && (output[3] == 200.5F);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSetIntegerMode() {
+    using namespace MARTe;
+    float64 input[6] = { -1000.0, -2.5, -0.4, 1.5, 126.6, 1000.0 };
+    int8 output[6];
+    ConversionHelperT<float64, int8> test(&input[0], &output[0]);
+    test.SetNumberOfElements(6u);
+    test.SetNumberOfSamples(1u);
+    test.SetIntegerMode(true, true);
+    test.Convert();
+    bool ok = (output[0] == -128) && (output[1] == -3) && (output[2] == 0) && (output[3] == 2) && (output[4] == 127) && (output[5] == 127);
+    if (ok) {
+        test.SetIntegerMode(false, true);
+        input[0] = -100.0;
+        input[5] = 100.0;
+        test.Convert();
+        ok = (output[0] == -100) && (output[1] == -3) && (output[2] == 0) && (output[3] == 2) && (output[4] == 127) && (output[5] == 100);
+    }
+    if (ok) {
+        test.SetIntegerMode(true, false);
+        input[0] = -1000.0;
+        input[5] = 1000.0;
+        test.Convert();
+        ok = (output[0] == -128) && (output[1] == -2) && (output[2] == 0) && (output[3] == 1) && (output[4] == 126) && (output[5] == 127);
+    }
+    uint16 output16[2];
+    ConversionHelperT<float64, uint16> test16(&input[4], &output16[0]);
+    test16.SetNumberOfElements(2u);
+    test16.SetNumberOfSamples(1u);
+    if (ok) {
+        ConfigurationDatabase cdb;
+        cdb.Write("Gain", 100);
+        cdb.Write("Offset", -20000);
+        ok = test16.LoadGain(cdb);
+        if (ok) {
+            ok = test16.LoadOffset(cdb);
+        }
+        test16.SetIntegerMode(true, true);
+        test16.Convert();
+        ok = (output16[0] == 0u) && (output16[1] == 65535u);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_NegativeGainUnsigned() {
+    using namespace MARTe;
+    int16 input[4] = { 0, 1, 200, -200 };
+    uint8 output[4];
+    ConversionHelperT<int16, uint8> test(&input[0], &output[0]);
+    test.SetNumberOfElements(4u);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", -2);
+    cdb.Write("Offset", 100);
+    //The Gain cannot be represented in uint8, so that the result is computed in float64 (without Saturate) and shall still be clipped
+    bool ok = test.LoadGain(cdb);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == 100u) && (output[1] == 98u) && (output[2] == 0u) && (output[3] == 255u);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestFuse() {
+    using namespace MARTe;
+    uint16 input[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    float32 output[10];
+    ConversionHelperT<uint16, float32> test1(&input[0], &output[0]);
+    ConversionHelperT<uint16, float32> test2(&input[4], &output[4]);
+    ConversionHelperT<uint16, float32> test3(&input[6], &output[6]);
+    test1.SetNumberOfElements(4u);
+    test1.SetNumberOfSamples(1u);
+    test2.SetNumberOfElements(1u);
+    test2.SetNumberOfSamples(2u);
+    test3.SetNumberOfElements(2u);
+    test3.SetNumberOfSamples(2u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 2);
+    bool ok = test1.LoadGain(cdb);
+    if (ok) {
+        ok = test2.LoadGain(cdb);
+    }
+    cdb.Delete("Gain");
+    cdb.Write("Gain", 3);
+    if (ok) {
+        ok = test3.LoadGain(cdb);
+    }
+    if (ok) {
+        ok = test1.Fuse(test2);
+    }
+    //Contiguous with the same gain
+    if (ok) {
+        ok = (test1.GetNumberOfSegments() == 1u);
+    }
+    if (ok) {
+        ok = test1.Fuse(test3);
+    }
+    //Contiguous with a different gain
+    if (ok) {
+        ok = (test1.GetNumberOfSegments() == 2u);
+    }
+    //Already fused
+    if (ok) {
+        ok = !test3.Fuse(test1);
+    }
+    if (ok) {
+        test1.Convert();
+        uint32 i;
+        for (i = 0u; (i < 10u) && (ok); i++) {
+            float32 expected = static_cast<float32>(input[i]) * ((i < 6u) ? (2.0F) : (3.0F));
+            ok = (output[i] == expected);
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestFuse_False_DifferentKernel() {
+    using namespace MARTe;
+    uint16 input[2] = { 0, 1 };
+    float32 output[2];
+    ConversionHelperT<uint16, float32> test1(&input[0], &output[0]);
+    ConversionHelperT<uint16, float32> test2(&input[1], &output[1]);
+    test1.SetNumberOfElements(1u);
+    test1.SetNumberOfSamples(1u);
+    test2.SetNumberOfElements(1u);
+    test2.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Offset", 2);
+    bool ok = test2.LoadOffset(cdb);
+    if (ok) {
+        ok = !test1.Fuse(test2);
+    }
+    if (ok) {
+        ConversionHelperT<uint16, float32> test3(NULL, NULL);
+        ok = !test1.Fuse(test3);
+    }
+    if (ok) {
+        ok = (test1.GetNumberOfSegments() == 1u);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestGetNumberOfSegments() {
+    using namespace MARTe;
+    uint8 input[3];
+    uint8 output[3];
+    ConversionHelperT<uint8, uint8> test1(&input[0], &output[0]);
+    ConversionHelperT<uint8, uint8> test2(&input[2], &output[2]);
+    test1.SetNumberOfElements(1u);
+    test1.SetNumberOfSamples(1u);
+    test2.SetNumberOfElements(1u);
+    test2.SetNumberOfSamples(1u);
+    bool ok = (test1.GetNumberOfSegments() == 1u);
+    if (ok) {
+        ok = test1.Fuse(test2);
+    }
+    if (ok) {
+        ok = (test1.GetNumberOfSegments() == 2u);
+    }
+    return ok;
+}
@@ -86,6 +86,41 @@ public:
      */
     bool TestGetOutputMemory();
 
+    /**
+     * @brief Tests the LoadOffset method.
+     */
+    bool TestLoadOffset();
+
+    /**
+     * @brief Tests the Convert method with a Gain and an Offset.
+     */
+    bool TestConvert_GainOffset();
+
+    /**
+     * @brief Tests the SetIntegerMode method.
+     */
+    bool TestSetIntegerMode();
+
+    /**
+     * @brief Tests the Convert method with a negative Gain and an unsigned output type, without the integer modes.
+     */
+    bool TestConvert_NegativeGainUnsigned();
+
+    /**
+     * @brief Tests the Fuse method.
+     */
+    bool TestFuse();
+
+    /**
+     * @brief Tests that the Fuse method fails if the helpers use different kernels.
+     */
+    bool TestFuse_False_DifferentKernel();
+
+    /**
+     * @brief Tests the GetNumberOfSegments method.
+     */
+    bool TestGetNumberOfSegments();
+
 };
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
@@ -289,3 +289,82 @@ TEST(FilterGAMGTest,TestResetOnlyWhenRequiredMemoryNotInit) {
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 
+TEST(FilterGAMGTest,TestInitialiseSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOS());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSWithNum) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSWithNum());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSWrongNumberOfColumns) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSWrongNumberOfColumns());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSNotNormalised) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSNotNormalised());
+}
+
+TEST(FilterGAMGTest,TestInitialiseWrongExecutionMode) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongExecutionMode());
+}
+
+TEST(FilterGAMGTest,TestExecuteInterleavedBitExact) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteInterleavedBitExact());
+}
+
+TEST(FilterGAMGTest,TestExecuteFIRRampInputFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteFIRRampInputFloat64());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSIntegrator) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSIntegrator());
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Scalar_64Signals_4Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(64, 4, "Scalar"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Interleaved_64Signals_4Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(64, 4, "Interleaved"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Scalar_64Signals_16Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(64, 16, "Scalar"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Interleaved_64Signals_16Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(64, 16, "Interleaved"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Scalar_256Signals_4Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(256, 4, "Scalar"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Interleaved_256Signals_4Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(256, 4, "Interleaved"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Scalar_256Signals_16Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(256, 16, "Scalar"));
+}
+
+TEST(FilterGAMGTest,TestExecuteBenchmark_Interleaved_256Signals_16Taps) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBenchmark(256, 16, "Interleaved"));
+}
@@ -34,6 +34,9 @@
 #include "ConfigurationDatabase.h"
 #include "FilterGAM.h"
 #include "FilterGAMTest.h"
+#include "HighResolutionTimer.h"
+#include "Matrix.h"
+#include "MemoryOperationsHelper.h"
 #include "Vector.h"
 #include "stdio.h"
 
@@ -399,6 +402,69 @@ FilterGAMTestHelper    (MARTe::uint32 elements=10, MARTe::uint32 samples=1) {
         return ok;
     }
 
+    bool InitialiseFilterSOS(const MARTe::float64 * const sos, const MARTe::uint32 numberOfSections) {
+        bool ret = !isInitialised;
+        if (ret) {
+            MARTe::float64 *sosH = const_cast<MARTe::float64 *>(sos);
+            MARTe::Matrix<MARTe::float64> sosMat(sosH, numberOfSections, 6u);
+            ret &= config.Write("SOS", sosMat);
+            ret &= config.Write("ResetInEachState", 1);
+            isInitialised = ret;
+        }
+        return ret;
+    }
+
+    /**
+     * Configures numberOfSignals input and output arrays (numberOfElements, one sample) of the given type.
+     */
+    bool InitialiseConfigDataBaseSignalN(const MARTe::uint32 numberOfSignals, const MARTe::char8 * const typeName, const MARTe::uint32 typeSize) {
+        using namespace MARTe;
+        bool ok = true;
+        uint32 signalByteSize = numberOfElements * typeSize;
+        uint32 totalByteSize = signalByteSize * numberOfSignals;
+        const char8 * const directions[] = { "InputSignals", "OutputSignals" };
+        for (uint32 d = 0u; d < 2u; d++) {
+            StreamString path;
+            path.Printf("Signals.%s", directions[d]);
+            for (uint32 i = 0u; i < numberOfSignals; i++) {
+                StreamString signalName;
+                signalName.Printf("%u", i);
+                StreamString qualifiedName;
+                qualifiedName.Printf("%sSignal%u", directions[d], i);
+                if (i == 0u) {
+                    ok &= configSignals.CreateAbsolute(path.Buffer());
+                }
+                else {
+                    ok &= configSignals.MoveAbsolute(path.Buffer());
+                }
+                ok &= configSignals.CreateRelative(signalName.Buffer());
+                ok &= configSignals.Write("QualifiedName", qualifiedName.Buffer());
+                ok &= configSignals.Write("DataSource", "TestDataSource");
+                ok &= configSignals.Write("Type", typeName);
+                ok &= configSignals.Write("NumberOfDimensions", 1);
+                ok &= configSignals.Write("NumberOfElements", numberOfElements);
+                ok &= configSignals.Write("ByteSize", signalByteSize);
+            }
+            ok &= configSignals.MoveAbsolute(path.Buffer());
+            ok &= configSignals.Write("ByteSize", totalByteSize);
+            StreamString memoryPath;
+            memoryPath.Printf("Memory.%s", directions[d]);
+            ok &= configSignals.CreateAbsolute(memoryPath.Buffer());
+            ok &= configSignals.CreateRelative("0");
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.CreateRelative("Signals");
+            for (uint32 i = 0u; i < numberOfSignals; i++) {
+                StreamString signalName;
+                signalName.Printf("%u", i);
+                ok &= configSignals.CreateRelative(signalName.Buffer());
+                ok &= configSignals.Write("Samples", 1);
+                ok &= configSignals.MoveToAncestor(1u);
+            }
+        }
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
     MARTe::uint32 numberOfElements;
     MARTe::uint32 numberOfSamples;
     MARTe::uint32 byteSize;
@@ -2828,3 +2894,258 @@ bool FilterGAMTest::TestResetOnlyWhenRequiredMemoryNotInit() {
     return ok;
 }
 
+bool FilterGAMTest::TestInitialiseSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sos[12] = { 0.5, 0.5, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, -0.5, 0.0 };
+    bool ok = gam.InitialiseFilterSOS(&sos[0], 2u);
+    ok &= gam.Initialise(gam.config);
+    ok &= (gam.GetNumberOfSections() == 2u);
+    ok &= (gam.GetNumberOfNumCoeff() == 0u);
+    bool isInfinite = true;
+    ok &= (gam.GetStaticGain(isInfinite) == 2.0F);
+    ok &= !isInfinite;
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSWithNum() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sos[6] = { 0.5, 0.5, 0.0, 1.0, 0.0, 0.0 };
+    bool ok = gam.InitialiseFilterSOS(&sos[0], 1u);
+    float32 numH[2] = { 0.5F, 0.5F };
+    Vector<float32> numVec(&numH[0], 2u);
+    ok &= gam.config.Write("Num", numVec);
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSWrongNumberOfColumns() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sosH[10] = { 0.5, 0.5, 0.0, 1.0, 0.0, 0.5, 0.5, 0.0, 1.0, 0.0 };
+    Matrix<float64> sosMat(&sosH[0], 2u, 5u);
+    bool ok = gam.config.Write("SOS", sosMat);
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSNotNormalised() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sos[6] = { 0.5, 0.5, 0.0, 2.0, 0.0, 0.0 };
+    bool ok = gam.InitialiseFilterSOS(&sos[0], 1u);
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseWrongExecutionMode() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("ExecutionMode", "Vectorised");
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteInterleavedBitExact() {
+    using namespace MARTe;
+    const uint32 numberOfSignals = 8u;
+    const uint32 numberOfElements = 10u;
+    FilterGAMTestHelper gamScalar(numberOfElements);
+    FilterGAMTestHelper gamInterleaved(numberOfElements);
+    gamScalar.SetName("Scalar");
+    gamInterleaved.SetName("Interleaved");
+    float32 numH[4] = { 0.1F, 0.2F, 0.3F, 0.15F };
+    float32 denH[3] = { 1.0F, -0.5F, 0.2F };
+    Vector<float32> numVec(&numH[0], 4u);
+    Vector<float32> denVec(&denH[0], 3u);
+    bool ok = true;
+    ok &= gamScalar.config.Write("Num", numVec);
+    ok &= gamScalar.config.Write("Den", denVec);
+    ok &= gamScalar.config.Write("ResetInEachState", 0);
+    ok &= gamInterleaved.config.Write("Num", numVec);
+    ok &= gamInterleaved.config.Write("Den", denVec);
+    ok &= gamInterleaved.config.Write("ResetInEachState", 0);
+    ok &= gamInterleaved.config.Write("ExecutionMode", "Interleaved");
+    ok &= gamScalar.Initialise(gamScalar.config);
+    ok &= gamInterleaved.Initialise(gamInterleaved.config);
+    ok &= gamScalar.InitialiseConfigDataBaseSignalN(numberOfSignals, "float32", sizeof(float32));
+    ok &= gamInterleaved.InitialiseConfigDataBaseSignalN(numberOfSignals, "float32", sizeof(float32));
+    ok &= gamScalar.SetConfiguredDatabase(gamScalar.configSignals);
+    ok &= gamInterleaved.SetConfiguredDatabase(gamInterleaved.configSignals);
+    ok &= gamScalar.AllocateInputSignalsMemory();
+    ok &= gamScalar.AllocateOutputSignalsMemory();
+    ok &= gamInterleaved.AllocateInputSignalsMemory();
+    ok &= gamInterleaved.AllocateOutputSignalsMemory();
+    ok &= gamScalar.Setup();
+    ok &= gamInterleaved.Setup();
+    uint32 seed = 7u;
+    for (uint32 cycle = 0u; (cycle < 20u) && (ok); cycle++) {
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            float32 *inScalar = static_cast<float32 *>(gamScalar.GetInputSignalsMemory(s));
+            float32 *inInterleaved = static_cast<float32 *>(gamInterleaved.GetInputSignalsMemory(s));
+            for (uint32 i = 0u; i < numberOfElements; i++) {
+                seed = (seed * 1103515245u) + 12345u;
+                inScalar[i] = static_cast<float32>((seed >> 16u) % 1000u) / 7.0F;
+                inInterleaved[i] = inScalar[i];
+            }
+        }
+        ok &= gamScalar.Execute();
+        ok &= gamInterleaved.Execute();
+        for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+            ok = (MemoryOperationsHelper::Compare(gamScalar.GetOutputSignalsMemory(s), gamInterleaved.GetOutputSignalsMemory(s),
+                                                  static_cast<uint32>(numberOfElements * sizeof(float32))) == 0);
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteFIRRampInputFloat64() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalN(2u, "float64", sizeof(float64));
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+
+    float64 *gamMemoryIn0 = static_cast<float64 *>(gam.GetInputSignalsMemory(0));
+    float64 *gamMemoryOut0 = static_cast<float64 *>(gam.GetOutputSignalsMemory(0));
+    float64 *gamMemoryIn1 = static_cast<float64 *>(gam.GetInputSignalsMemory(1));
+    float64 *gamMemoryOut1 = static_cast<float64 *>(gam.GetOutputSignalsMemory(1));
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn0[i] = i;
+        gamMemoryIn1[i] = 1;
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    ok &= (gamMemoryOut0[0] == 0);
+    ok &= (gamMemoryOut1[0] == 0.5);
+    for (uint32 i = 1u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut0[i] == i - 0.5);
+        ok &= (gamMemoryOut1[i] == 1);
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn0[i] = i + 10;
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut0[i] == 10 + i - 0.5);
+        ok &= (gamMemoryOut1[i] == 1);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOSIntegrator() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    //Integrator (1 / (1 - z^-1)) in cascade with a unitary gain section
+    float64 sos[12] = { 1.0, 0.0, 0.0, 1.0, -1.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+    bool ok = gam.InitialiseFilterSOS(&sos[0], 2u);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalN(2u, "float32", sizeof(float32));
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+
+    float32 *gamMemoryIn0 = static_cast<float32 *>(gam.GetInputSignalsMemory(0));
+    float32 *gamMemoryOut0 = static_cast<float32 *>(gam.GetOutputSignalsMemory(0));
+    float32 *gamMemoryIn1 = static_cast<float32 *>(gam.GetInputSignalsMemory(1));
+    float32 *gamMemoryOut1 = static_cast<float32 *>(gam.GetOutputSignalsMemory(1));
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn0[i] = 1.0F;
+        gamMemoryIn1[i] = 2.0F;
+    }
+    if (ok) {
+        ok = gam.PrepareNextState("", "A");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut0[i] == i + 1.0F);
+        ok &= (gamMemoryOut1[i] == 2.0F * (i + 1.0F));
+    }
+    //ResetInEachState = 1 => the integrators restart from 0
+    if (ok) {
+        ok = gam.PrepareNextState("A", "B");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut0[i] == i + 1.0F);
+        ok &= (gamMemoryOut1[i] == 2.0F * (i + 1.0F));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteBenchmark(const MARTe::uint32 numberOfSignals,
+                                         const MARTe::uint32 numberOfCoeff,
+                                         const MARTe::char8 * const executionMode) {
+    using namespace MARTe;
+    const uint32 numberOfElements = 16u;
+    const uint32 numberOfCycles = 1000u;
+    FilterGAMTestHelper gam(numberOfElements);
+    gam.SetName("Test");
+    float32 *numH = new float32[numberOfCoeff];
+    float32 *denH = new float32[numberOfCoeff];
+    for (uint32 k = 0u; k < numberOfCoeff; k++) {
+        numH[k] = 1.0F / static_cast<float32>(numberOfCoeff);
+        denH[k] = (k == 0u) ? (1.0F) : (0.01F / static_cast<float32>(k));
+    }
+    Vector<float32> numVec(numH, numberOfCoeff);
+    Vector<float32> denVec(denH, numberOfCoeff);
+    bool ok = gam.config.Write("Num", numVec);
+    ok &= gam.config.Write("Den", denVec);
+    ok &= gam.config.Write("ResetInEachState", 0);
+    ok &= gam.config.Write("ExecutionMode", executionMode);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalN(numberOfSignals, "float32", sizeof(float32));
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+        float32 *in = static_cast<float32 *>(gam.GetInputSignalsMemory(s));
+        for (uint32 i = 0u; i < numberOfElements; i++) {
+            in[i] = static_cast<float32>(i + s);
+        }
+    }
+    uint64 totalTicks = 0u;
+    uint64 maxTicks = 0u;
+    for (uint32 c = 0u; (c < numberOfCycles) && (ok); c++) {
+        uint64 start = HighResolutionTimer::Counter();
+        ok = gam.Execute();
+        uint64 elapsed = HighResolutionTimer::Counter() - start;
+        totalTicks += elapsed;
+        if (elapsed > maxTicks) {
+            maxTicks = elapsed;
+        }
+    }
+    if (ok) {
+        float64 averageUs = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(numberOfCycles);
+        float64 maxUs = static_cast<float64>(maxTicks) * HighResolutionTimer::Period() * 1e6;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%s: %u signals x %u elements, %u taps. Cycle time average = %f us, max = %f us", executionMode,
+                            numberOfSignals, numberOfElements, numberOfCoeff, averageUs, maxUs);
+    }
+    delete[] numH;
+    delete[] denH;
+    return ok;
+}
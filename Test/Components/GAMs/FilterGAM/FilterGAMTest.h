@@ -393,6 +393,67 @@ public:
      * @return true if PrepareNextState() fails.
      */
     bool TestResetOnlyWhenRequiredMemoryNotInit();
+
+    /**
+     * @brief Tests the initialisation of a filter defined with second-order sections.
+     * @return true if the number of sections and the static gain are as expected.
+     */
+    bool TestInitialiseSOS();
+
+    /**
+     * @brief Tests that SOS and Num cannot be defined together.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSWithNum();
+
+    /**
+     * @brief Tests that the SOS matrix must have six columns.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSWrongNumberOfColumns();
+
+    /**
+     * @brief Tests that the second-order sections must be normalised (a0 = 1).
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSNotNormalised();
+
+    /**
+     * @brief Tests an invalid ExecutionMode.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongExecutionMode();
+
+    /**
+     * @brief Tests that the Interleaved mode output is bit-for-bit identical to the Scalar mode output.
+     * @details Filters 8 signals with an IIR filter during several cycles.
+     * @return true if the outputs of both modes are identical.
+     */
+    bool TestExecuteInterleavedBitExact();
+
+    /**
+     * @brief Tests a FIR filter with a ramp and a constant float64 input signals.
+     * @return true if the output values are as expected.
+     */
+    bool TestExecuteFIRRampInputFloat64();
+
+    /**
+     * @brief Tests a cascade of an integrator section and a unitary section, including the reset of the state.
+     * @return true if the output values are as expected.
+     */
+    bool TestExecuteSOSIntegrator();
+
+    /**
+     * @brief Benchmarks the Execute() cycle time.
+     * @details Reports the average and maximum cycle time over 1000 cycles.
+     * @param[in] numberOfSignals the number of signals (channels).
+     * @param[in] numberOfCoeff the number of numerator and denominator coefficients.
+     * @param[in] executionMode Scalar or Interleaved.
+     * @return true if the filter could be executed.
+     */
+    bool TestExecuteBenchmark(const MARTe::uint32 numberOfSignals,
+                              const MARTe::uint32 numberOfCoeff,
+                              const MARTe::char8 * const executionMode);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -192,3 +192,28 @@ TEST(HistogramComparatorTGTest,TestGetNumberOfBins) {
     HistogramComparatorTTest<uint8> test;
     ASSERT_TRUE(test.TestGetNumberOfBins());
 }
+
+TEST(HistogramComparatorTGTest,TestGetBins_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestGetBins(64, 191, 13, 1));
+}
+
+TEST(HistogramComparatorTGTest,TestGetBins_I16) {
+    HistogramComparatorTTest<int16> test;
+    ASSERT_TRUE(test.TestGetBins(-49, 0, 9, 1));
+}
+
+TEST(HistogramComparatorTGTest,TestGetBins_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestGetBins(-1000, 1000, 13, 16));
+}
+
+TEST(HistogramComparatorTGTest,TestGetBins_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestGetBins(10.5, 20.5, 7, 0.125));
+}
+
+TEST(HistogramComparatorTGTest,TestGetBins_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestGetBins(0.0, 1.0, 12, 0.01));
+}
@@ -85,6 +85,15 @@ public:
                      T value,
                      uint32 expected);
 
+    /**
+     * @brief Tests the HistogramComparatorT::GetBins method against the HistogramComparatorT::InRange method
+     * for all the values between \a min - 2 * (\a max - \a min) and \a max + 2 * (\a max - \a min).
+     */
+    bool TestGetBins(T min,
+                     T max,
+                     uint32 nBins,
+                     T step);
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -140,5 +149,49 @@ bool HistogramComparatorTTest<T>::TestInRange(T min,
 
 }
 
+template<typename T>
+bool HistogramComparatorTTest<T>::TestGetBins(T min,
+                                              T max,
+                                              uint32 nBins,
+                                              T step) {
+    HistogramComparatorT<T> test;
+
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    test.SetNumberOfBins(nBins);
+
+    const uint32 numberOfValues = 256u;
+    T values[numberOfValues];
+    uint32 bins[numberOfValues];
+    //Values around the range, so that all the bins and the edges are tested
+    T value = static_cast<T>(min - static_cast<T>(static_cast<T>(numberOfValues / 4u) * step));
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        values[i] = value;
+        value += step;
+    }
+    test.GetBins((void*) &values[0], numberOfValues, &bins[0]);
+
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfValues) && (ok); i++) {
+        uint32 expected = 0u;
+        if (values[i] >= max) {
+            expected = (nBins - 1u);
+        }
+        else if (values[i] >= min) {
+            //Smallest k such that value < min + k * width
+            const float64 width = (static_cast<float64>(max) - static_cast<float64>(min)) / static_cast<float64>(nBins - 2u);
+            expected = 1u;
+            while ((expected < (nBins - 2u)) && ((static_cast<float64>(values[i]) - static_cast<float64>(min)) >= (expected * width))) {
+                expected++;
+            }
+        }
+        ok = (bins[i] == expected);
+        if (ok) {
+            ok = (test.InRange((void*) &values[i]) == expected);
+        }
+    }
+    return ok;
+}
+
 #endif /* HISTOGRAM_COMPARATORTTEST_H_ */
 
@@ -64,14 +64,14 @@ TEST(HistogramGAMGTest,TestSetup_DifferentInputOutputNSignals) {
     ASSERT_TRUE(test.TestSetup_DifferentInputOutputNSignals());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseInputNotScalar) {
+TEST(HistogramGAMGTest,TestSetup_InputNotScalar) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseInputNotScalar());
+    ASSERT_TRUE(test.TestSetup_InputNotScalar());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseSamplesNotOne) {
+TEST(HistogramGAMGTest,TestSetup_SamplesNotOne) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseSamplesNotOne());
+    ASSERT_TRUE(test.TestSetup_SamplesNotOne());
 }
 
 TEST(HistogramGAMGTest,TestSetup_UndefinedMaxLim) {
@@ -119,4 +119,29 @@ TEST(HistogramGAMGTest,TestPrepareNextState_Reset_State) {
     ASSERT_TRUE(test.TestPrepareNextState_Reset_State());
 }
 
+TEST(HistogramGAMGTest,TestInitialise_False_WindowCyclesAndDecayShift) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WindowCyclesAndDecayShift());
+}
+
+TEST(HistogramGAMGTest,TestInitialise_False_DecayShift) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_DecayShift());
+}
+
+TEST(HistogramGAMGTest,TestExecute_ElementsAndSamples) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ElementsAndSamples());
+}
+
+TEST(HistogramGAMGTest,TestExecute_WindowCycles) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_WindowCycles());
+}
+
+TEST(HistogramGAMGTest,TestExecute_DecayShift) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_DecayShift());
+}
+
 
@@ -235,6 +235,110 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Helper function to setup a MARTe execution environment with a single float32 input signal
+ * with 4 elements and 2 samples, MinLim = 0, MaxLim = 4 and 6 bins.
+ */
+static bool InitialiseElementsAndSamplesEnviroment(const char8 * const gamParameters) {
+    StreamString config;
+    (void) config.Printf("%s", ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM");
+    (void) config.Printf("%s", gamParameters);
+    (void) config.Printf("%s", ""
+            "             InputSignals = {"
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 4"
+            "                     MinLim = 0"
+            "                     Type = float32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 4"
+            "                     Samples = 2"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 6"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}");
+    return InitialiseMemoryMapInputBrokerEnviroment(config.Buffer());
+}
+
+/**
+ * Executes the GAM configured with InitialiseElementsAndSamplesEnviroment once for each line of \a values
+ * and compares the histogram with \a expected.
+ */
+static bool ExecuteElementsAndSamples(const char8 * const gamParameters,
+                                      const float32 values[][8],
+                                      const uint32 numberOfCycles,
+                                      const uint32 expected[6]) {
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseElementsAndSamplesEnviroment(gamParameters);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float32 *input = static_cast<float32 *>(gam->GetInputSignalsMemory());
+        for (uint32 c = 0u; (c < numberOfCycles) && (ret); c++) {
+            for (uint32 i = 0u; i < 8u; i++) {
+                input[i] = values[c][i];
+            }
+            ret = gam->Execute();
+        }
+    }
+    if (ret) {
+        uint32 *output = static_cast<uint32 *>(gam->GetOutputSignalsMemory());
+        for (uint32 i = 0u; (i < 6u) && (ret); i++) {
+            ret = (output[i] == expected[i]);
+        }
+    }
+    god->Purge();
+    return ret;
+}
+
 HistogramGAMTest::HistogramGAMTest() {
 
 }
@@ -635,7 +739,7 @@ bool HistogramGAMTest::TestSetup_DifferentInputOutputNSignals() {
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
+bool HistogramGAMTest::TestSetup_InputNotScalar() {
 
     const char8 *config = ""
             "$Application = {"
@@ -811,12 +915,12 @@ bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
             "}";
 
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
     god->Purge();
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseSamplesNotOne() {
+bool HistogramGAMTest::TestSetup_SamplesNotOne() {
 
     const char8 *config = ""
             "$Application = {"
@@ -990,7 +1094,7 @@ bool HistogramGAMTest::TestSetup_FalseSamplesNotOne() {
             "     }"
             "}";
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
     god->Purge();
     return ret;
 }
@@ -3686,3 +3790,44 @@ bool HistogramGAMTest::TestPrepareNextState_Reset_State() {
     god->Purge();
     return ret;
 }
+
+bool HistogramGAMTest::TestInitialise_False_WindowCyclesAndDecayShift() {
+    ConfigurationDatabase cdb;
+    cdb.Write("WindowCycles", 10u);
+    cdb.Write("DecayShift", 2u);
+
+    HistogramGAMTestGAM test;
+
+    return !test.Initialise(cdb);
+}
+
+bool HistogramGAMTest::TestInitialise_False_DecayShift() {
+    ConfigurationDatabase cdb;
+    cdb.Write("DecayShift", 32u);
+
+    HistogramGAMTestGAM test;
+
+    return !test.Initialise(cdb);
+}
+
+bool HistogramGAMTest::TestExecute_ElementsAndSamples() {
+    const float32 values[1][8] = { { -1.F, 0.F, 0.5F, 1.F, 2.5F, 3.99F, 4.F, 10.F } };
+    const uint32 expected[6] = { 1u, 2u, 1u, 1u, 1u, 2u };
+    return ExecuteElementsAndSamples("", values, 1u, expected);
+}
+
+bool HistogramGAMTest::TestExecute_WindowCycles() {
+    //Only the last two cycles shall be counted
+    const float32 values[3][8] = { { 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F }, { 1.5F, 1.5F, 1.5F, 1.5F, 1.5F, 1.5F, 1.5F, 1.5F }, { 2.5F, 2.5F,
+            2.5F, 2.5F, 2.5F, 2.5F, 2.5F, -1.F } };
+    const uint32 expected[6] = { 1u, 0u, 8u, 7u, 0u, 0u };
+    return ExecuteElementsAndSamples(" WindowCycles = 2 ", values, 3u, expected);
+}
+
+bool HistogramGAMTest::TestExecute_DecayShift() {
+    //bin = bin - (bin >> 1) + 8 => 8, 12, 14
+    const float32 values[3][8] = { { 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F }, { 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F }, { 0.5F, 0.5F,
+            0.5F, 0.5F, 0.5F, 0.5F, 0.5F, 0.5F } };
+    const uint32 expected[6] = { 0u, 14u, 0u, 0u, 0u, 0u };
+    return ExecuteElementsAndSamples(" DecayShift = 1 ", values, 3u, expected);
+}
@@ -76,16 +76,16 @@ public:
     bool TestSetup_DifferentInputOutputNSignals();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfElements>1
+     * @brief Tests the HistogramGAM::Setup method with
+     * input signals that have NumberOfElements>1
      */
-    bool TestSetup_FalseInputNotScalar();
+    bool TestSetup_InputNotScalar();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfSamples > 1
+     * @brief Tests the HistogramGAM::Setup method with
+     * input signals that have NumberOfSamples > 1
      */
-    bool TestSetup_FalseSamplesNotOne();
+    bool TestSetup_SamplesNotOne();
 
     /**
      * @brief Tests the HistogramGAM::Setup method that fails if MaxLim is not
@@ -136,6 +136,31 @@ public:
      */
     bool TestPrepareNextState_Reset_State();
 
+    /**
+     * @brief Tests that the Initialise method fails if both WindowCycles and DecayShift are set.
+     */
+    bool TestInitialise_False_WindowCyclesAndDecayShift();
+
+    /**
+     * @brief Tests that the Initialise method fails if DecayShift >= 32.
+     */
+    bool TestInitialise_False_DecayShift();
+
+    /**
+     * @brief Tests the HistogramGAM::Execute method with an input signal with many elements and samples.
+     */
+    bool TestExecute_ElementsAndSamples();
+
+    /**
+     * @brief Tests the HistogramGAM::Execute method with WindowCycles set.
+     */
+    bool TestExecute_WindowCycles();
+
+    /**
+     * @brief Tests the HistogramGAM::Execute method with DecayShift set.
+     */
+    bool TestExecute_DecayShift();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -761,3 +761,42 @@ TEST(StatisticsHelperTGTest,TestGetStd_float64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMin_MovingWindow_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMin_MovingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMaxMin_MovingWindow_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMin_MovingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMaxMin_MovingWindow_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMin_MovingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMaxMin_MovingWindow_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMin_MovingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSample_WorstCase_float64_1k) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSample_WorstCase(1024));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSample_WorstCase_float64_16k) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSample_WorstCase(16384));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSample_WorstCase_float64_128k) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSample_WorstCase(131072));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSample_WorstCase_float64_1M) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSample_WorstCase(1048576));
+}
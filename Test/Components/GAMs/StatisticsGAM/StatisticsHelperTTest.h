@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
 #include "StatisticsHelperT.h"
 
 /*---------------------------------------------------------------------------*/
@@ -107,6 +108,20 @@ public:
      */
     bool TestGetSum(const uint32 windowSize);
 
+    /**
+     * @brief Tests that GetMax and GetMin follow the moving window, by comparison with a
+     * full parse of the window, for a sequence which mixes ramps and steps.
+     */
+    bool TestGetMaxMin_MovingWindow(const uint32 windowSize);
+
+    /**
+     * @brief Benchmarks the worst-case PushSample time against the time required to fully
+     * parse the window (i.e. the cost of the former FindMax/FindMin implementation).
+     * @details The sequence is a decreasing ramp, so that the maximum leaves the window
+     * on every push, followed by a spike dominating the whole window.
+     */
+    bool TestPushSample_WorstCase(const uint32 windowSize);
+
 };
 }
 /*---------------------------------------------------------------------------*/
@@ -273,6 +288,82 @@ bool StatisticsHelperTTest<Type>::TestGetSum(const uint32 windowSize) {
     return (myStatisticsHelper.GetSum() == sum);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMaxMin_MovingWindow(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    uint32 size = myStatisticsHelper.GetSize();
+    uint32 nOfPushes = 8u * size;
+    Type *history = new Type[nOfPushes];
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfPushes) && (ok); i++) {
+        history[i] = static_cast<Type>((i * 37u) % 101u);
+        if ((i % (2u * size)) < size) {
+            history[i] = static_cast<Type>(120u - (i % size));
+        }
+        ok = myStatisticsHelper.PushSample(history[i]);
+        uint32 first = (i < size) ? (0u) : (i - size + 1u);
+        Type max = history[i];
+        Type min = history[i];
+        for (uint32 j = first; j < i; j++) {
+            if (history[j] > max) {
+                max = history[j];
+            }
+            if (history[j] < min) {
+                min = history[j];
+            }
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetMax() == max);
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetMin() == min);
+        }
+    }
+    delete[] history;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestPushSample_WorstCase(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    uint32 size = myStatisticsHelper.GetSize();
+    bool ok = true;
+    uint64 worstPush = 0u;
+    uint32 i;
+    for (i = 0u; (i < (2u * size)) && (ok); i++) {
+        Type mySample = static_cast<Type>(size - (i % size));
+        if (i == ((2u * size) - 1u)) {
+            mySample = static_cast<Type>(size + 1u);
+        }
+        uint64 start = HighResolutionTimer::Counter();
+        ok = myStatisticsHelper.PushSample(mySample);
+        uint64 elapsed = HighResolutionTimer::Counter() - start;
+        if ((i >= size) && (elapsed > worstPush)) {
+            worstPush = elapsed;
+        }
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetMax() == static_cast<Type>(size + 1u));
+    }
+    /* Reference: one full parse of the window, as performed by the former implementation */
+    uint64 start = HighResolutionTimer::Counter();
+    Type max = myStatisticsHelper.GetSample(0u);
+    for (i = 1u; i < size; i++) {
+        Type sample = myStatisticsHelper.GetSample(i);
+        if (sample > max) {
+            max = sample;
+        }
+    }
+    uint64 fullParse = HighResolutionTimer::Counter() - start;
+    if (ok) {
+        ok = (max == myStatisticsHelper.GetMax());
+    }
+    float64 worstPushUs = static_cast<float64>(worstPush) * HighResolutionTimer::Period() * 1e6;
+    float64 fullParseUs = static_cast<float64>(fullParse) * HighResolutionTimer::Period() * 1e6;
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Window %u: worst PushSample %f us, full window parse %f us", size, worstPushUs, fullParseUs);
+    return ok;
+}
+
 } /*namespace MARTe*/
 #endif /* STATISTICSHELPERTTEST_H_ */
 
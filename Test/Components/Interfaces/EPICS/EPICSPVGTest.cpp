@@ -429,3 +429,43 @@ TEST(EPICSPVGTest,TestGetAnyType) {
     EPICSPVTest test;
     ASSERT_TRUE(test.TestGetAnyType());
 }
+
+TEST(EPICSPVGTest,TestInitialise_Event_CoalescingWindow) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestInitialise_Event_CoalescingWindow());
+}
+
+TEST(EPICSPVGTest,TestInitialise_Event_False_CoalescingWindow) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestInitialise_Event_False_CoalescingWindow());
+}
+
+TEST(EPICSPVGTest,TestInitialise_Event_False_MessagePoolSize) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestInitialise_Event_False_MessagePoolSize());
+}
+
+TEST(EPICSPVGTest,TestGetCoalescingWindow) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestGetCoalescingWindow());
+}
+
+TEST(EPICSPVGTest,TestGetMessagePoolSize) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestGetMessagePoolSize());
+}
+
+TEST(EPICSPVGTest,TestHandlePVEvent_MessagePool) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestHandlePVEvent_MessagePool());
+}
+
+TEST(EPICSPVGTest,TestHandlePVEvent_CoalescingWindow) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestHandlePVEvent_CoalescingWindow());
+}
+
+TEST(EPICSPVGTest,TestFlushEventMessage) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestFlushEventMessage());
+}
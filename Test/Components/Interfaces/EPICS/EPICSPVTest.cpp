@@ -1643,3 +1643,259 @@ bool EPICSPVTest::TestGetAnyType() {
 bool EPICSPVTest::TestCAGet() {
     return TestCAPut_String();
 }
+
+bool EPICSPVTest::TestInitialise_Event_CoalescingWindow() {
+    using namespace MARTe;
+    EPICSPV pv;
+    ConfigurationDatabase cdb;
+    cdb.Write("PVName", "PVONES");
+    cdb.Write("PVType", "int32");
+    cdb.CreateRelative("Event");
+    cdb.Write("Destination", "AnObject");
+    cdb.Write("Function", "AFunction");
+    cdb.Write("PVValue", "Parameter");
+    cdb.Write("CoalescingWindow", 0.5);
+    cdb.Write("MessagePoolSize", 2);
+    cdb.MoveToRoot();
+
+    bool ok = (pv.Initialise(cdb));
+    ok &= (pv.GetCoalescingWindow() == 0.5);
+    ok &= (pv.GetMessagePoolSize() == 2u);
+    ok &= (pv.GetMode().parameter);
+    return ok;
+}
+
+bool EPICSPVTest::TestInitialise_Event_False_CoalescingWindow() {
+    using namespace MARTe;
+    EPICSPV pv;
+    ConfigurationDatabase cdb;
+    cdb.Write("PVName", "PVONES");
+    cdb.Write("PVType", "int32");
+    cdb.CreateRelative("Event");
+    cdb.Write("Destination", "AnObject");
+    cdb.Write("Function", "AFunction");
+    cdb.Write("PVValue", "Parameter");
+    cdb.Write("CoalescingWindow", -0.5);
+    cdb.MoveToRoot();
+
+    return !(pv.Initialise(cdb));
+}
+
+bool EPICSPVTest::TestInitialise_Event_False_MessagePoolSize() {
+    using namespace MARTe;
+    EPICSPV pv;
+    ConfigurationDatabase cdb;
+    cdb.Write("PVName", "PVONES");
+    cdb.Write("PVType", "int32");
+    cdb.CreateRelative("Event");
+    cdb.Write("Destination", "AnObject");
+    cdb.Write("Function", "AFunction");
+    cdb.Write("PVValue", "Parameter");
+    cdb.Write("MessagePoolSize", 0);
+    cdb.MoveToRoot();
+
+    return !(pv.Initialise(cdb));
+}
+
+bool EPICSPVTest::TestGetCoalescingWindow() {
+    return TestInitialise_Event_CoalescingWindow();
+}
+
+bool EPICSPVTest::TestGetMessagePoolSize() {
+    using namespace MARTe;
+    EPICSPV pv;
+    ConfigurationDatabase cdb;
+    cdb.Write("PVName", "PVONES");
+    cdb.Write("PVType", "int32");
+    cdb.CreateRelative("Event");
+    cdb.Write("Destination", "AnObject");
+    cdb.Write("Function", "AFunction");
+    cdb.Write("PVValue", "Ignore");
+    cdb.MoveToRoot();
+
+    bool ok = (pv.Initialise(cdb));
+    ok &= (pv.GetMessagePoolSize() == 4u);
+    ok &= (pv.GetCoalescingWindow() == 0.0);
+    return ok;
+}
+
+bool EPICSPVTest::TestHandlePVEvent_MessagePool() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+PV_1 = {"
+            "    Class = EPICSPV"
+            "    PVName = PVS::PV1"
+            "    PVType = int32"
+            "    Event = {"
+            "        PVValue = Parameter"
+            "        Destination = AnObject"
+            "        Function = Handle_int32"
+            "        MessagePoolSize = 1"
+            "    }"
+            "}"
+            "+AnObject = {"
+            "    Class = EPICSPVTestHelper"
+            "}";
+
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPVTestHelper> anObject;
+    ReferenceT<EPICSPV> aPV;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        aPV = ord->Find("PV_1");
+        ok = aPV.IsValid();
+    }
+    if (ok) {
+        anObject = ord->Find("AnObject");
+        ok = anObject.IsValid();
+    }
+    const int32 numberOfUpdates = 10;
+    int32 value;
+    for (value = 1; (value <= numberOfUpdates) && (ok); value++) {
+        struct event_handler_args args;
+        args.dbr = reinterpret_cast<const void *>(&value);
+        args.count = 1;
+        aPV->HandlePVEvent(args);
+        //The first event does not trigger a message
+        if (value > 1) {
+            ok = (anObject->int32Value == value);
+        }
+    }
+    if (ok) {
+        ok = (anObject->int32Calls == static_cast<uint32>(numberOfUpdates - 1));
+    }
+    ord->Purge();
+    return ok;
+}
+
+bool EPICSPVTest::TestHandlePVEvent_CoalescingWindow() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+PV_1 = {"
+            "    Class = EPICSPV"
+            "    PVName = PVS::PV1"
+            "    PVType = int32"
+            "    Event = {"
+            "        PVValue = Parameter"
+            "        Destination = AnObject"
+            "        Function = Handle_int32"
+            "        CoalescingWindow = 10.0"
+            "    }"
+            "}"
+            "+AnObject = {"
+            "    Class = EPICSPVTestHelper"
+            "}";
+
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPVTestHelper> anObject;
+    ReferenceT<EPICSPV> aPV;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        aPV = ord->Find("PV_1");
+        ok = aPV.IsValid();
+    }
+    if (ok) {
+        anObject = ord->Find("AnObject");
+        ok = anObject.IsValid();
+    }
+    int32 value;
+    for (value = 1; (value <= 10) && (ok); value++) {
+        struct event_handler_args args;
+        args.dbr = reinterpret_cast<const void *>(&value);
+        args.count = 1;
+        aPV->HandlePVEvent(args);
+    }
+    //The first event does not trigger a message, the second opens the window and the others are coalesced
+    if (ok) {
+        ok = (anObject->int32Calls == 1u);
+    }
+    if (ok) {
+        ok = (anObject->int32Value == 2);
+    }
+    if (ok) {
+        aPV->FlushEventMessage();
+        ok = (anObject->int32Calls == 1u);
+    }
+    ord->Purge();
+    return ok;
+}
+
+bool EPICSPVTest::TestFlushEventMessage() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+PV_1 = {"
+            "    Class = EPICSPV"
+            "    PVName = PVS::PV1"
+            "    PVType = int32"
+            "    Event = {"
+            "        PVValue = Parameter"
+            "        Destination = AnObject"
+            "        Function = Handle_int32"
+            "        CoalescingWindow = 0.2"
+            "    }"
+            "}"
+            "+AnObject = {"
+            "    Class = EPICSPVTestHelper"
+            "}";
+
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPVTestHelper> anObject;
+    ReferenceT<EPICSPV> aPV;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        aPV = ord->Find("PV_1");
+        ok = aPV.IsValid();
+    }
+    if (ok) {
+        anObject = ord->Find("AnObject");
+        ok = anObject.IsValid();
+    }
+    int32 value;
+    for (value = 1; (value <= 10) && (ok); value++) {
+        struct event_handler_args args;
+        args.dbr = reinterpret_cast<const void *>(&value);
+        args.count = 1;
+        aPV->HandlePVEvent(args);
+    }
+    if (ok) {
+        ok = (anObject->int32Calls == 1u);
+    }
+    if (ok) {
+        Sleep::Sec(0.3F);
+        aPV->FlushEventMessage();
+        ok = (anObject->int32Calls == 2u);
+    }
+    //Latest value wins
+    if (ok) {
+        ok = (anObject->int32Value == 10);
+    }
+    //Nothing pending
+    if (ok) {
+        Sleep::Sec(0.3F);
+        aPV->FlushEventMessage();
+        ok = (anObject->int32Calls == 2u);
+    }
+    ord->Purge();
+    return ok;
+}
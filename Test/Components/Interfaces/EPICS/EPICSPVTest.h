@@ -438,6 +438,46 @@ public:
      */
     bool TestGetAnyType();
 
+    /**
+     * @brief Tests the Initialise method with the CoalescingWindow and MessagePoolSize parameters.
+     */
+    bool TestInitialise_Event_CoalescingWindow();
+
+    /**
+     * @brief Tests that the Initialise method fails with a negative CoalescingWindow.
+     */
+    bool TestInitialise_Event_False_CoalescingWindow();
+
+    /**
+     * @brief Tests that the Initialise method fails with a zero MessagePoolSize.
+     */
+    bool TestInitialise_Event_False_MessagePoolSize();
+
+    /**
+     * @brief Tests the GetCoalescingWindow method.
+     */
+    bool TestGetCoalescingWindow();
+
+    /**
+     * @brief Tests the GetMessagePoolSize method.
+     */
+    bool TestGetMessagePoolSize();
+
+    /**
+     * @brief Tests that the pooled messages are reused with the latest PV value.
+     */
+    bool TestHandlePVEvent_MessagePool();
+
+    /**
+     * @brief Tests that a burst of PV updates inside the CoalescingWindow is sent as a single message.
+     */
+    bool TestHandlePVEvent_CoalescingWindow();
+
+    /**
+     * @brief Tests the FlushEventMessage method.
+     */
+    bool TestFlushEventMessage();
+
 private:
     template<typename T>
     bool TestHandlePVEvent_Function_Parameter(T testValue);
@@ -766,6 +806,7 @@ public:
         float64Value = 0;
         stringValue = "";
         noParameterFunctionCalled = false;
+        int32Calls = 0u;
         ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
         filter->SetDestination(this);
         ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -812,6 +853,7 @@ public:
 
     MARTe::ErrorManagement::ErrorType Handle_int32(const MARTe::int32 newValue) {
         int32Value = newValue;
+        int32Calls++;
         return MARTe::ErrorManagement::NoError;
     }
 
@@ -889,6 +931,7 @@ public:
     MARTe::StreamString parameterName;
     bool noParameterFunctionCalled;
     bool messageReceived;
+    MARTe::uint32 int32Calls;
 };
 
 template<typename T>
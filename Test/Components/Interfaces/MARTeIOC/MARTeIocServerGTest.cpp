@@ -98,6 +98,41 @@ TEST(MARTeIocServerGTest,TestGetNumberOfPVs) {
     ASSERT_TRUE(test.TestGetNumberOfPVs());
 }
 
+TEST(MARTeIocServerGTest,TestFindPv) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestFindPv());
+}
+
+TEST(MARTeIocServerGTest,TestPvExistTest_Field) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestPvExistTest_Field());
+}
+
+TEST(MARTeIocServerGTest,TestIocAddPv_False_SameName) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestIocAddPv_False_SameName());
+}
+
+TEST(MARTeIocServerGTest,TestIocAddRemovePv_Index) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestIocAddRemovePv_Index());
+}
+
+TEST(MARTeIocServerGTest,TestPvExistTest_Benchmark_100) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestPvExistTest_Benchmark(100u));
+}
+
+TEST(MARTeIocServerGTest,TestPvExistTest_Benchmark_1000) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestPvExistTest_Benchmark(1000u));
+}
+
+TEST(MARTeIocServerGTest,TestPvExistTest_Benchmark_20000) {
+    MARTeIocServerTest test;
+    ASSERT_TRUE(test.TestPvExistTest_Benchmark(20000u));
+}
+
 #else
 
 TEST(MARTeIocServerGTest,TestInteractive) {
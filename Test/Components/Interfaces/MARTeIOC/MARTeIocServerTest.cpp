@@ -36,9 +36,12 @@
 /*---------------------------------------------------------------------------*/
 
 #include "MARTeIocServerTest.h"
+#include "AdvancedErrorManagement.h"
 #include "MARTeCommonPv.h"
+#include "MARTePvField.h"
 #include "GAM.h"
 #include "GAMScheduler.h"
+#include "HighResolutionTimer.h"
 #include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
@@ -590,6 +593,342 @@ bool MARTeIocServerTest::TestGetNumberOfPVs() {
     return ok;
 }
 
+bool MARTeIocServerTest::TestFindPv() {
+    const char8 *config = ""
+            "    Class = MARTeIocServer"
+            "        +jane = {"
+            "            Class = MARTeCommonPv"
+            "            NAME = \"jane\""
+            "            TYPE = aitEnumFloat64"
+            "            NELM = 1"
+            "            PREC = 4"
+            "            SYNC = excasIoSync"
+            "            EGU = \"volt\""
+            "            HOPR = 10.0"
+            "            LOPR = 1.0"
+            "            HIHI = 9.0"
+            "            HIGH = 8.0"
+            "            LOW = 0.5"
+            "            LOLO = 0.1"
+            "            HHSV =  \"MAJOR\""
+            "            HSV = \"MINOR\""
+            "            LSV = \"MINOR\""
+            "            LLSV = \"MAJOR\""
+            "            HYST = 0.0001"
+            "            ADEL = 0.0001"
+            "            MDEL = 0.01"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    MARTeIocServer ioc;
+    if (ok) {
+        ok = ioc.Initialise(cdb);
+    }
+    ReferenceT<MARTePv> jane;
+    if (ok) {
+        jane = ioc.Find("jane");
+        ok = jane.IsValid();
+    }
+    if (ok) {
+        ReferenceT<MARTePv> pv = ioc.FindPv("jane");
+        ok = (pv == jane);
+    }
+    if (ok) {
+        ReferenceT<MARTePv> pv = ioc.FindPv("jane.VAL");
+        ok = (pv == jane);
+    }
+    if (ok) {
+        ReferenceT<MARTePv> pv = ioc.FindPv("jane.HOPR");
+        ok = (pv == jane->Find("HOPR"));
+        if (ok) {
+            ok = pv.IsValid();
+        }
+    }
+    if (ok) {
+        ok = !ioc.FindPv("jane.NOTAFIELD").IsValid();
+    }
+    if (ok) {
+        ok = !ioc.FindPv("jan").IsValid();
+    }
+    if (ok) {
+        ok = !ioc.FindPv("janet").IsValid();
+    }
+    if (ok) {
+        ok = !ioc.FindPv("").IsValid();
+    }
+    if (ok) {
+        ok = !ioc.FindPv(NULL_PTR(const char8 *)).IsValid();
+    }
+    return ok;
+}
+
+bool MARTeIocServerTest::TestPvExistTest_Field() {
+    const char8 *config = ""
+            "    Class = MARTeIocServer"
+            "        +jane = {"
+            "            Class = MARTeCommonPv"
+            "            NAME = \"jane\""
+            "            TYPE = aitEnumFloat64"
+            "            NELM = 1"
+            "            PREC = 4"
+            "            SYNC = excasIoSync"
+            "            EGU = \"volt\""
+            "            HOPR = 10.0"
+            "            LOPR = 1.0"
+            "            HIHI = 9.0"
+            "            HIGH = 8.0"
+            "            LOW = 0.5"
+            "            LOLO = 0.1"
+            "            HHSV =  \"MAJOR\""
+            "            HSV = \"MINOR\""
+            "            LSV = \"MINOR\""
+            "            LLSV = \"MAJOR\""
+            "            HYST = 0.0001"
+            "            ADEL = 0.0001"
+            "            MDEL = 0.01"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    MARTeIocServer ioc;
+    if (ok) {
+        ok = ioc.Initialise(cdb);
+    }
+    if (ok) {
+        casCtx *ctxIn = new casCtx;
+        caNetAddr *client = new caNetAddr;
+        pvExistReturn ret = ioc.pvExistTest(*ctxIn, *client, "jane.VAL");
+        ok = (ret.getStatus() == pverExistsHere);
+        if (ok) {
+            ret = ioc.pvExistTest(*ctxIn, *client, "jane.EGU");
+            ok = (ret.getStatus() == pverExistsHere);
+        }
+        if (ok) {
+            ret = ioc.pvExistTest(*ctxIn, *client, "jane.XYZ");
+            ok = (ret.getStatus() == pverDoesNotExistHere);
+        }
+        if (ok) {
+            ret = ioc.pvExistTest(*ctxIn, *client, "VAL");
+            ok = (ret.getStatus() == pverDoesNotExistHere);
+        }
+        delete ctxIn;
+        delete client;
+    }
+    return ok;
+}
+
+bool MARTeIocServerTest::TestIocAddPv_False_SameName() {
+    const char8 *config = ""
+            "    Class = MARTeIocServer"
+            "        +jane = {"
+            "            Class = MARTeCommonPv"
+            "            NAME = \"jane\""
+            "            TYPE = aitEnumFloat64"
+            "            NELM = 1"
+            "            PREC = 4"
+            "            SYNC = excasIoSync"
+            "            EGU = \"volt\""
+            "            HOPR = 10.0"
+            "            LOPR = 1.0"
+            "            HIHI = 9.0"
+            "            HIGH = 8.0"
+            "            LOW = 0.5"
+            "            LOLO = 0.1"
+            "            HHSV =  \"MAJOR\""
+            "            HSV = \"MINOR\""
+            "            LSV = \"MINOR\""
+            "            LLSV = \"MAJOR\""
+            "            HYST = 0.0001"
+            "            ADEL = 0.0001"
+            "            MDEL = 0.01"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    MARTeIocServer ioc;
+    if (ok) {
+        ok = ioc.Initialise(cdb);
+    }
+    if (ok) {
+        ReferenceT<MARTePvField> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ref->SetName("jane");
+        ok = !ioc.IocAddPv(ref);
+    }
+    if (ok) {
+        ok = (ioc.GetNumberOfPVs() == 1u);
+    }
+    if (ok) {
+        ok = (ioc.Size() == 1u);
+    }
+    return ok;
+}
+
+bool MARTeIocServerTest::TestIocAddRemovePv_Index() {
+    const char8 *config = ""
+            "    Class = MARTeIocServer"
+            "        +jane = {"
+            "            Class = MARTeCommonPv"
+            "            NAME = \"jane\""
+            "            TYPE = aitEnumFloat64"
+            "            NELM = 1"
+            "            PREC = 4"
+            "            SYNC = excasIoSync"
+            "            EGU = \"volt\""
+            "            HOPR = 10.0"
+            "            LOPR = 1.0"
+            "            HIHI = 9.0"
+            "            HIGH = 8.0"
+            "            LOW = 0.5"
+            "            LOLO = 0.1"
+            "            HHSV =  \"MAJOR\""
+            "            HSV = \"MINOR\""
+            "            LSV = \"MINOR\""
+            "            LLSV = \"MAJOR\""
+            "            HYST = 0.0001"
+            "            ADEL = 0.0001"
+            "            MDEL = 0.01"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    MARTeIocServer ioc;
+    if (ok) {
+        ok = ioc.Initialise(cdb);
+    }
+    const uint32 numberOfPVs = 200u;
+    uint32 i;
+    for (i = 0u; (i < numberOfPVs) && (ok); i++) {
+        ReferenceT<MARTePvField> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString name;
+        (void) name.Printf("IDX:%u", i);
+        ref->SetName(name.Buffer());
+        ok = ioc.IocAddPv(ref);
+    }
+    /* Remove every third PV */
+    for (i = 0u; (i < numberOfPVs) && (ok); i += 3u) {
+        StreamString name;
+        (void) name.Printf("IDX:%u", i);
+        ok = ioc.IocRemovePv(name.Buffer());
+    }
+    for (i = 0u; (i < numberOfPVs) && (ok); i++) {
+        StreamString name;
+        (void) name.Printf("IDX:%u", i);
+        ReferenceT<MARTePv> pv = ioc.FindPv(name.Buffer());
+        if ((i % 3u) == 0u) {
+            ok = !pv.IsValid();
+        }
+        else {
+            ok = pv.IsValid();
+            if (ok) {
+                ok = (pv == ioc.Find(name.Buffer()));
+            }
+        }
+    }
+    if (ok) {
+        ok = ioc.FindPv("jane").IsValid();
+    }
+    if (ok) {
+        ok = (ioc.GetNumberOfPVs() == (1u + numberOfPVs - ((numberOfPVs + 2u) / 3u)));
+    }
+    /* The removed names can be added again */
+    if (ok) {
+        ReferenceT<MARTePvField> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ref->SetName("IDX:0");
+        ok = ioc.IocAddPv(ref);
+    }
+    if (ok) {
+        ok = ioc.FindPv("IDX:0").IsValid();
+    }
+    return ok;
+}
+
+bool MARTeIocServerTest::TestPvExistTest_Benchmark(const uint32 numberOfPVs) {
+    const char8 *config = ""
+            "    Class = MARTeIocServer";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    MARTeIocServer ioc;
+    if (ok) {
+        ok = ioc.Initialise(cdb);
+    }
+    StreamString *names = new StreamString[numberOfPVs];
+    uint32 i;
+    for (i = 0u; (i < numberOfPVs) && (ok); i++) {
+        ReferenceT<MARTePvField> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        (void) names[i].Printf("BENCH:SECTOR%u:PV%u", (i % 16u), i);
+        ref->SetName(names[i].Buffer());
+        ok = ioc.IocAddPv(ref);
+    }
+    casCtx *ctxIn = new casCtx;
+    caNetAddr *client = new caNetAddr;
+    const uint32 numberOfSearches = 100000u;
+    uint32 found = 0u;
+    uint64 start = HighResolutionTimer::Counter();
+    for (i = 0u; (i < numberOfSearches) && (ok); i++) {
+        pvExistReturn ret = ioc.pvExistTest(*ctxIn, *client, names[(i * 7919u) % numberOfPVs].Buffer());
+        if (ret.getStatus() == pverExistsHere) {
+            found++;
+        }
+    }
+    uint64 indexTicks = HighResolutionTimer::Counter() - start;
+    if (ok) {
+        ok = (found == numberOfSearches);
+    }
+    /* Reference: the former linear ReferenceContainer::Find lookup on a subset of the searches */
+    const uint32 numberOfFinds = 1000u;
+    found = 0u;
+    start = HighResolutionTimer::Counter();
+    for (i = 0u; (i < numberOfFinds) && (ok); i++) {
+        ReferenceT<MARTePv> pv = ioc.Find(names[(i * 7919u) % numberOfPVs].Buffer());
+        if (pv.IsValid()) {
+            found++;
+        }
+    }
+    uint64 findTicks = HighResolutionTimer::Counter() - start;
+    if (ok) {
+        ok = (found == numberOfFinds);
+    }
+    delete ctxIn;
+    delete client;
+    delete[] names;
+    float64 indexPeriod = static_cast<float64>(indexTicks) * HighResolutionTimer::Period();
+    float64 findPeriod = static_cast<float64>(findTicks) * HighResolutionTimer::Period();
+    if ((indexPeriod > 0.) && (findPeriod > 0.)) {
+        float64 indexThroughput = static_cast<float64>(numberOfSearches) / indexPeriod;
+        float64 findThroughput = static_cast<float64>(numberOfFinds) / findPeriod;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%u PVs: pvExistTest %f searches/s, ReferenceContainer::Find %f searches/s", numberOfPVs,
+                            indexThroughput, findThroughput);
+    }
+    return ok;
+}
+
 bool MARTeIocServerTest::TestInteractive() {
 
     const char8 *config = ""
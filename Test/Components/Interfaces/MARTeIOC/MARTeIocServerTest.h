@@ -125,6 +125,32 @@ public:
      */
     bool TestGetNumberOfPVs();
 
+    /**
+     * @brief Tests the FindPv method with and without field suffixes.
+     */
+    bool TestFindPv();
+
+    /**
+     * @brief Tests the pvExistTest method with a field suffix.
+     */
+    bool TestPvExistTest_Field();
+
+    /**
+     * @brief Tests that the IocAddPv method fails if a PV with the same name already exists.
+     */
+    bool TestIocAddPv_False_SameName();
+
+    /**
+     * @brief Tests that the PVs remain reachable after adding and removing PVs at runtime.
+     */
+    bool TestIocAddRemovePv_Index();
+
+    /**
+     * @brief Benchmarks the pvExistTest search throughput against the former linear
+     * ReferenceContainer::Find lookup, for an IOC with \a numberOfPVs PVs.
+     */
+    bool TestPvExistTest_Benchmark(const uint32 numberOfPVs);
+
     /**
      * @brief Interactive test
      */
@@ -94,3 +94,37 @@ TEST(MemoryGateGTest,TestMemoryWrite_Overflow) {
     ASSERT_TRUE(test.TestMemoryWrite_Overflow());
 }
 
+TEST(MemoryGateGTest,TestMemoryRead_Newest) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryRead_Newest());
+}
+
+TEST(MemoryGateGTest,TestMemoryRead_WriterBusy) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryRead_WriterBusy());
+}
+
+TEST(MemoryGateGTest,TestMemoryBorrow) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryBorrow());
+}
+
+TEST(MemoryGateGTest,TestMemoryBorrow_FalseNoMemory) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryBorrow_FalseNoMemory());
+}
+
+TEST(MemoryGateGTest,TestMemoryRelease_False) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryRelease_False());
+}
+
+TEST(MemoryGateGTest,TestMemoryWrite_Borrowed) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryWrite_Borrowed());
+}
+
+TEST(MemoryGateGTest,TestGetBuffersMemory) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestGetBuffersMemory());
+}
@@ -91,6 +91,8 @@ public:
 
     uint32 *GetCounters();
 
+    int32 GetNewestBuffer();
+
 private:
     EventSem readEventSem;
     EventSem writeEventSem;
@@ -312,12 +314,17 @@ void MemoryGateTestInterface::SetCounters(uint32 globCounter) {
         initCounter++;
     }
     whatIsNewestGlobCounter = globCounter;
+    newestBuffer = static_cast<int32>(numberOfBuffers - 1u);
 }
 
 uint32 *MemoryGateTestInterface::GetCounters() {
     return whatIsNewestCounter;
 }
 
+int32 MemoryGateTestInterface::GetNewestBuffer() {
+    return newestBuffer;
+}
+
 CLASS_REGISTER(MemoryGateTestInterface, "1.0")
 
 /*---------------------------------------------------------------------------*/
@@ -977,3 +984,222 @@ bool MemoryGateTest::TestMemoryWrite_Overflow() {
     return ok;
 }
 
+
+static bool MemoryGateTestInitialise(MemoryGateTestInterface &test,
+                                     const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryRead_Newest() {
+    const char8* config = ""
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 4";
+
+    MemoryGateTestInterface test;
+    bool ok = MemoryGateTestInitialise(test, config);
+
+    //the writes go round-robin after the newest and the read always gets the last written
+    for (uint32 i = 1u; (i <= 6u) && (ok); i++) {
+        uint32 value = i;
+        ok = test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+        if (ok) {
+            ok = (test.GetNewestBuffer() == static_cast<int32>(i % 4u));
+        }
+        uint32 readValue = 0u;
+        if (ok) {
+            ok = test.MemoryGate::MemoryRead(reinterpret_cast<uint8 *>(&readValue));
+        }
+        if (ok) {
+            ok = (readValue == i);
+        }
+    }
+    if (ok) {
+        uint32 *counters = test.GetCounters();
+        ok = (counters[1] == 5u) && (counters[2] == 6u) && (counters[3] == 3u) && (counters[0] == 4u);
+    }
+    if (ok) {
+        ok = (test.GetSpinlocksRead()[2] == 0);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryRead_WriterBusy() {
+    const char8* config = ""
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 4";
+
+    MemoryGateTestInterface test;
+    bool ok = MemoryGateTestInitialise(test, config);
+
+    for (uint32 i = 1u; (i <= 3u) && (ok); i++) {
+        uint32 value = i;
+        ok = test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    //a writer is on the newest (3): the one written before is read
+    FastPollingMutexSem *spinlocksWrite = test.GetSpinlocksWrite();
+    if (ok) {
+        ok = spinlocksWrite[3].FastTryLock();
+    }
+    uint32 readValue = 0u;
+    if (ok) {
+        ok = test.MemoryGate::MemoryRead(reinterpret_cast<uint8 *>(&readValue));
+    }
+    if (ok) {
+        ok = (readValue == 2u);
+    }
+    //all busy
+    if (ok) {
+        ok = spinlocksWrite[0].FastTryLock();
+        ok &= spinlocksWrite[1].FastTryLock();
+        ok &= spinlocksWrite[2].FastTryLock();
+    }
+    if (ok) {
+        ok = !test.MemoryGate::MemoryRead(reinterpret_cast<uint8 *>(&readValue));
+    }
+    for (uint32 i = 0u; i < 4u; i++) {
+        spinlocksWrite[i].FastUnLock();
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryBorrow() {
+    const char8* config = ""
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 4";
+
+    MemoryGateTestInterface test;
+    bool ok = MemoryGateTestInitialise(test, config);
+
+    uint32 value = 7u;
+    if (ok) {
+        ok = test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    const uint8 *buffer = NULL_PTR(const uint8 *);
+    uint32 bufferIdx = 0u;
+    if (ok) {
+        ok = test.MemoryBorrow(buffer, bufferIdx);
+    }
+    if (ok) {
+        ok = (bufferIdx == 1u);
+        ok &= (buffer == &test.GetMem()[4]);
+        ok &= (*reinterpret_cast<const uint32 *>(buffer) == 7u);
+        ok &= (test.GetSpinlocksRead()[1] == 1);
+    }
+    //the borrowed buffer is not overwritten
+    for (uint32 i = 8u; (i < 11u) && (ok); i++) {
+        value = i;
+        ok = test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+        if (ok) {
+            ok = (*reinterpret_cast<const uint32 *>(buffer) == 7u);
+        }
+        if (ok) {
+            ok = (test.GetNewestBuffer() == 0);
+        }
+    }
+    uint32 readValue = 0u;
+    if (ok) {
+        ok = test.MemoryGate::MemoryRead(reinterpret_cast<uint8 *>(&readValue));
+    }
+    if (ok) {
+        ok = (readValue == 10u);
+    }
+    if (ok) {
+        ok = test.MemoryRelease(bufferIdx);
+    }
+    if (ok) {
+        ok = (test.GetSpinlocksRead()[1] == 0);
+    }
+    if (ok) {
+        value = 11u;
+        ok = test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<const uint32 *>(buffer) == 11u);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryBorrow_FalseNoMemory() {
+    const char8* config = ""
+            "NumberOfBuffers = 2";
+
+    MemoryGateTestInterface test;
+    bool ok = MemoryGateTestInitialise(test, config);
+
+    const uint8 *buffer = NULL_PTR(const uint8 *);
+    uint32 bufferIdx = 0u;
+    if (ok) {
+        ok = !test.MemoryBorrow(buffer, bufferIdx);
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = !test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryRelease_False() {
+    const char8* config = ""
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 4";
+
+    MemoryGateTestInterface test;
+    bool ok = MemoryGateTestInitialise(test, config);
+    if (ok) {
+        ok = !test.MemoryRelease(2u);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryWrite_Borrowed() {
+    const char8* config = ""
+            "NumberOfBuffers = 1\n"
+            "MemorySize = 4";
+
+    MemoryGateTestInterface test;
+    bool ok = MemoryGateTestInitialise(test, config);
+
+    const uint8 *buffer = NULL_PTR(const uint8 *);
+    uint32 bufferIdx = 0u;
+    if (ok) {
+        ok = test.MemoryBorrow(buffer, bufferIdx);
+    }
+    uint32 value = 1u;
+    if (ok) {
+        ok = !test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = test.MemoryRelease(bufferIdx);
+    }
+    if (ok) {
+        ok = test.MemoryGate::MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<const uint32 *>(buffer) == 1u);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestGetBuffersMemory() {
+    MemoryGateTestInterface test;
+    bool ok = (test.GetBuffersMemory() == NULL_PTR(const uint8 *));
+    if (ok) {
+        ok = MemoryGateTestInitialise(test, "NumberOfBuffers = 2");
+    }
+    if (ok) {
+        ok = test.SetMemorySize(8u);
+    }
+    if (ok) {
+        ok = (test.GetBuffersMemory() == test.GetMem());
+    }
+    return ok;
+}
@@ -114,6 +114,43 @@ public:
      */
     bool TestMemoryWrite_Overflow();
 
+    /**
+     * @brief Tests that the MemoryGate::MemoryRead method reads the last written buffer and that
+     * MemoryGate::MemoryWrite writes the buffers in round-robin order.
+     */
+    bool TestMemoryRead_Newest();
+
+    /**
+     * @brief Tests that the MemoryGate::MemoryRead method reads the previously written buffer when
+     * the newest is busy and fails if all the buffers are busy.
+     */
+    bool TestMemoryRead_WriterBusy();
+
+    /**
+     * @brief Tests the MemoryGate::MemoryBorrow method.
+     */
+    bool TestMemoryBorrow();
+
+    /**
+     * @brief Tests that the MemoryGate::MemoryBorrow method fails if the memory is not allocated.
+     */
+    bool TestMemoryBorrow_FalseNoMemory();
+
+    /**
+     * @brief Tests that the MemoryGate::MemoryRelease method fails with an invalid buffer index.
+     */
+    bool TestMemoryRelease_False();
+
+    /**
+     * @brief Tests that the MemoryGate::MemoryWrite method does not write a borrowed buffer.
+     */
+    bool TestMemoryWrite_Borrowed();
+
+    /**
+     * @brief Tests the MemoryGate::GetBuffersMemory method.
+     */
+    bool TestGetBuffersMemory();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,120 @@
+/**
+ * @file SharedMemoryGateGTest.cpp
+ * @brief Source file for class SharedMemoryGateGTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGateGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryGateTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(SharedMemoryGateGTest,TestConstructor) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(SharedMemoryGateGTest,TestInitialise) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(SharedMemoryGateGTest,TestInitialise_NoMemSize) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise_NoMemSize());
+}
+
+TEST(SharedMemoryGateGTest,TestInitialise_False_NoSharedMemoryName) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NoSharedMemoryName());
+}
+
+TEST(SharedMemoryGateGTest,TestInitialise_False_BadSharedMemoryName) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadSharedMemoryName());
+}
+
+TEST(SharedMemoryGateGTest,TestInitialise_False_NumberOfBuffers) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers());
+}
+
+TEST(SharedMemoryGateGTest,TestSetMemorySize_Join) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_Join());
+}
+
+TEST(SharedMemoryGateGTest,TestSetMemorySize_False_DifferentSize) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_False_DifferentSize());
+}
+
+TEST(SharedMemoryGateGTest,TestSetMemorySize_False_DifferentNumberOfBuffers) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_False_DifferentNumberOfBuffers());
+}
+
+TEST(SharedMemoryGateGTest,TestSetMemorySize_StaleOwner) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_StaleOwner());
+}
+
+TEST(SharedMemoryGateGTest,TestSetMemorySize_StaleOwner_ConcurrentRecovery) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_StaleOwner_ConcurrentRecovery());
+}
+
+TEST(SharedMemoryGateGTest,TestSetMemorySize_False_Overflow) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_False_Overflow());
+}
+
+TEST(SharedMemoryGateGTest,TestMemoryRead) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryRead());
+}
+
+TEST(SharedMemoryGateGTest,TestMemoryWrite) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryWrite());
+}
+
+TEST(SharedMemoryGateGTest,TestMemoryRead_CrossProcessConsistency) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryRead_CrossProcessConsistency());
+}
+
+TEST(SharedMemoryGateGTest,TestCrossProcessLatencyBenchmark) {
+    SharedMemoryGateTest test;
+    ASSERT_TRUE(test.TestCrossProcessLatencyBenchmark());
+}
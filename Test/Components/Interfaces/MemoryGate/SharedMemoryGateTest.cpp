@@ -0,0 +1,631 @@
+/**
+ * @file SharedMemoryGateTest.cpp
+ * @brief Source file for class SharedMemoryGateTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGateTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
+#include "SharedMemoryGateTest.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static bool InitialiseSharedMemoryGate(SharedMemoryGate &gate,
+                                       const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = gate.Initialise(cdb);
+    }
+    return ok;
+}
+
+/**
+ * Names of the shared memories used by the tests.
+ */
+static const char8 * const sharedMemoryGateTestNames[] = { "/MARTeSharedMemoryGateTest1", "/MARTeSharedMemoryGateTest2", NULL_PTR(const char8 *) };
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+SharedMemoryGateTest::SharedMemoryGateTest() {
+    //Remove any leftover of a previous (crashed) execution.
+    uint32 n;
+    for (n = 0u; sharedMemoryGateTestNames[n] != NULL_PTR(const char8 *); n++) {
+        (void) shm_unlink(sharedMemoryGateTestNames[n]);
+    }
+}
+
+SharedMemoryGateTest::~SharedMemoryGateTest() {
+}
+
+bool SharedMemoryGateTest::TestConstructor() {
+    SharedMemoryGate test;
+    bool ok = (!test.IsOwner());
+    ok &= (test.GetGeneration() == 0u);
+    ok &= (test.GetSharedMemoryName() == "");
+    uint8 buffer = 0u;
+    ok &= (!test.MemoryRead(&buffer));
+    ok &= (!test.MemoryWrite(&buffer));
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestInitialise() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 10\n"
+            "MemorySize = 10";
+
+    SharedMemoryGate test;
+    bool ok = InitialiseSharedMemoryGate(test, config);
+    if (ok) {
+        ok &= test.IsOwner();
+        ok &= (test.GetSharedMemoryName() == "/MARTeSharedMemoryGateTest1");
+        ok &= (test.GetGeneration() == 0u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestInitialise_NoMemSize() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n";
+
+    SharedMemoryGate test;
+    bool ok = InitialiseSharedMemoryGate(test, config);
+    if (ok) {
+        //Not created until the size is known
+        ok = (!test.IsOwner());
+    }
+    uint8 buffer[4];
+    if (ok) {
+        ok = (!test.MemoryRead(&buffer[0]));
+    }
+    if (ok) {
+        ok = test.SetMemorySize(4u);
+    }
+    if (ok) {
+        ok = test.IsOwner();
+    }
+    if (ok) {
+        ok = test.MemoryRead(&buffer[0]);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestInitialise_False_NoSharedMemoryName() {
+    const char8* config = ""
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 10";
+
+    SharedMemoryGate test;
+    return !InitialiseSharedMemoryGate(test, config);
+}
+
+bool SharedMemoryGateTest::TestInitialise_False_BadSharedMemoryName() {
+    const char8* config = ""
+            "SharedMemoryName = \"MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 10";
+
+    SharedMemoryGate test;
+    return !InitialiseSharedMemoryGate(test, config);
+}
+
+bool SharedMemoryGateTest::TestInitialise_False_NumberOfBuffers() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 1\n"
+            "MemorySize = 10";
+    const char8* config65 = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 65\n"
+            "MemorySize = 10";
+
+    SharedMemoryGate test1;
+    bool ok = !InitialiseSharedMemoryGate(test1, config1);
+    if (ok) {
+        SharedMemoryGate test65;
+        ok = !InitialiseSharedMemoryGate(test65, config65);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_Join() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 4\n";
+
+    SharedMemoryGate owner;
+    SharedMemoryGate joiner;
+    bool ok = InitialiseSharedMemoryGate(owner, config);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(joiner, config);
+    }
+    if (ok) {
+        ok = owner.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = joiner.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = (owner.IsOwner() && (!joiner.IsOwner()));
+    }
+    if (ok) {
+        ok = joiner.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = !joiner.SetMemorySize(sizeof(uint64));
+    }
+    uint32 value = 7u;
+    if (ok) {
+        ok = joiner.MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    value = 0u;
+    if (ok) {
+        ok = owner.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 7u);
+    }
+    if (ok) {
+        ok = ((owner.GetGeneration() == 1u) && (joiner.GetGeneration() == 1u));
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_False_DifferentSize() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 4\n"
+            "JoinTimeout = 10\n";
+
+    SharedMemoryGate owner;
+    SharedMemoryGate joiner;
+    bool ok = InitialiseSharedMemoryGate(owner, config);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(joiner, config);
+    }
+    if (ok) {
+        ok = owner.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = !joiner.SetMemorySize(sizeof(uint64));
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_False_DifferentNumberOfBuffers() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 64\n"
+            "JoinTimeout = 10\n";
+    //Same total size (4 * 64 = 8 * 32)
+    const char8* config2 = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 8\n"
+            "MemorySize = 32\n"
+            "JoinTimeout = 10\n";
+
+    SharedMemoryGate owner;
+    SharedMemoryGate joiner;
+    bool ok = InitialiseSharedMemoryGate(owner, config1);
+    if (ok) {
+        ok = !InitialiseSharedMemoryGate(joiner, config2);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryRead() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 3\n"
+            "MemorySize = 4";
+
+    SharedMemoryGate test;
+    bool ok = InitialiseSharedMemoryGate(test, config);
+    uint32 value = 0xFFFFFFFFu;
+    //Nothing written yet. The memory is initialised to zero.
+    if (ok) {
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 0u);
+    }
+    uint32 i;
+    for (i = 1u; (i < 10u) && (ok); i++) {
+        ok = test.MemoryWrite(reinterpret_cast<uint8 *>(&i));
+        if (ok) {
+            ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+        }
+        if (ok) {
+            ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+        }
+        if (ok) {
+            ok = (value == i);
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryWrite() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 4";
+
+    SharedMemoryGate test;
+    bool ok = InitialiseSharedMemoryGate(test, config);
+    uint32 i;
+    for (i = 1u; (i <= 100u) && (ok); i++) {
+        ok = test.MemoryWrite(reinterpret_cast<uint8 *>(&i));
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 100u);
+    }
+    if (ok) {
+        ok = (test.GetGeneration() == 100u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_StaleOwner() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 4\n";
+    const char8* newConfig = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 2\n";
+
+    pid_t cpid = fork();
+    bool ok = (cpid != -1);
+    if (cpid == 0) {
+        //Owner process which dies without destroying the SharedMemoryGate (i.e. without unlinking the shared memory)
+        SharedMemoryGate *crashedOwner = new SharedMemoryGate();
+        bool okChild = InitialiseSharedMemoryGate(*crashedOwner, config);
+        if (okChild) {
+            okChild = crashedOwner->SetMemorySize(sizeof(uint32));
+        }
+        if (okChild) {
+            okChild = crashedOwner->IsOwner();
+        }
+        _exit(okChild ? 0 : 1);
+    }
+    if (cpid > 0) {
+        int32 status = 0;
+        if (waitpid(cpid, &status, 0) == cpid) {
+            ok = (WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+        }
+        else {
+            ok = false;
+        }
+    }
+    //The stale shared memory (with 4 buffers) shall be replaced by a new one.
+    SharedMemoryGate owner;
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(owner, newConfig);
+    }
+    if (ok) {
+        ok = owner.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = owner.IsOwner();
+    }
+    if (ok) {
+        ok = (owner.GetGeneration() == 0u);
+    }
+    uint32 value = 3u;
+    if (ok) {
+        ok = owner.MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    value = 0u;
+    if (ok) {
+        ok = owner.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 3u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_StaleOwner_ConcurrentRecovery() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 2\n";
+    const uint32 numberOfProcesses = 4u;
+    const uint32 ownerMarker = 0xCAFEu;
+    //Exit codes of the recovering processes
+    const int32 exitJoined = 0;
+    const int32 exitFailed = 1;
+    const int32 exitOwner = 2;
+
+    //Leave a stale shared memory behind
+    pid_t cpid = fork();
+    bool ok = (cpid != -1);
+    if (cpid == 0) {
+        SharedMemoryGate *crashedOwner = new SharedMemoryGate();
+        bool okChild = InitialiseSharedMemoryGate(*crashedOwner, config);
+        if (okChild) {
+            okChild = crashedOwner->SetMemorySize(sizeof(uint32));
+        }
+        _exit(okChild ? 0 : 1);
+    }
+    if (cpid > 0) {
+        int32 status = 0;
+        ok = (waitpid(cpid, &status, 0) == cpid);
+        if (ok) {
+            ok = (WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+        }
+    }
+    //All the processes recover at the same time. Exactly one shall own the new shared memory and all the others shall join it.
+    pid_t cpids[numberOfProcesses];
+    uint32 n;
+    for (n = 0u; (n < numberOfProcesses) && (ok); n++) {
+        cpids[n] = fork();
+        ok = (cpids[n] != -1);
+        if (cpids[n] == 0) {
+            SharedMemoryGate *gate = new SharedMemoryGate();
+            bool okChild = InitialiseSharedMemoryGate(*gate, config);
+            if (okChild) {
+                okChild = gate->SetMemorySize(sizeof(uint32));
+            }
+            bool isOwner = false;
+            if (okChild) {
+                isOwner = gate->IsOwner();
+            }
+            //Let all the processes create or join the shared memory
+            Sleep::MSec(200u);
+            uint32 value = ownerMarker;
+            if ((okChild) && (isOwner)) {
+                okChild = gate->MemoryWrite(reinterpret_cast<uint8 *>(&value));
+                //Keep the shared memory alive while the others read it
+                Sleep::MSec(600u);
+            }
+            else if (okChild) {
+                Sleep::MSec(200u);
+                value = 0u;
+                okChild = gate->MemoryRead(reinterpret_cast<uint8 *>(&value));
+                if (okChild) {
+                    okChild = (value == ownerMarker);
+                }
+            }
+            else {
+                //The process failed
+            }
+            delete gate;
+            _exit(okChild ? (isOwner ? exitOwner : exitJoined) : exitFailed);
+        }
+    }
+    uint32 numberOfOwners = 0u;
+    for (n = 0u; (n < numberOfProcesses) && (ok); n++) {
+        int32 status = 0;
+        ok = (waitpid(cpids[n], &status, 0) == cpids[n]);
+        if (ok) {
+            ok = WIFEXITED(status);
+        }
+        if (ok) {
+            ok = (WEXITSTATUS(status) != exitFailed);
+        }
+        if (ok) {
+            if (WEXITSTATUS(status) == exitOwner) {
+                numberOfOwners++;
+            }
+        }
+    }
+    if (ok) {
+        ok = (numberOfOwners == 1u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_False_Overflow() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 4\n";
+    SharedMemoryGate test;
+    bool ok = InitialiseSharedMemoryGate(test, config);
+    if (ok) {
+        ok = !test.SetMemorySize(0x40000000u);
+    }
+    if (ok) {
+        ok = (shm_open("/MARTeSharedMemoryGateTest1", O_RDONLY, 0) == -1);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryRead_CrossProcessConsistency() {
+    const char8* config = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 3\n"
+            "MemorySize = 1024";
+    const uint32 numberOfElements = 256u;
+    const uint32 numberOfWrites = 100000u;
+
+    SharedMemoryGate reader;
+    bool ok = InitialiseSharedMemoryGate(reader, config);
+    pid_t cpid = -1;
+    if (ok) {
+        cpid = fork();
+        ok = (cpid != -1);
+    }
+    if (cpid == 0) {
+        //Writer process
+        SharedMemoryGate writer;
+        bool okChild = InitialiseSharedMemoryGate(writer, config);
+        uint32 buffer[numberOfElements];
+        uint32 i;
+        for (i = 1u; (i <= numberOfWrites) && (okChild); i++) {
+            uint32 e;
+            for (e = 0u; e < numberOfElements; e++) {
+                buffer[e] = i;
+            }
+            okChild = writer.MemoryWrite(reinterpret_cast<uint8 *>(&buffer[0]));
+        }
+        _exit(okChild ? 0 : 1);
+    }
+    uint32 buffer[numberOfElements];
+    uint32 last = 0u;
+    uint32 numberOfReads = 0u;
+    uint32 numberOfFailedReads = 0u;
+    const uint64 maxTimeoutSeconds = 10u;
+    uint64 maxTimeout = HighResolutionTimer::Counter() + maxTimeoutSeconds * HighResolutionTimer::Frequency();
+    while ((last < numberOfWrites) && (ok)) {
+        if (reader.MemoryRead(reinterpret_cast<uint8 *>(&buffer[0]))) {
+            numberOfReads++;
+            uint32 e;
+            for (e = 1u; (e < numberOfElements) && (ok); e++) {
+                ok = (buffer[e] == buffer[0]);
+            }
+            if (ok) {
+                ok = (buffer[0] >= last);
+            }
+            last = buffer[0];
+        }
+        else {
+            numberOfFailedReads++;
+        }
+        if (ok) {
+            ok = (HighResolutionTimer::Counter() < maxTimeout);
+        }
+    }
+    if (cpid > 0) {
+        int32 status = 0;
+        if (waitpid(cpid, &status, 0) == cpid) {
+            ok &= (WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+        }
+        else {
+            ok = false;
+        }
+    }
+    if (ok) {
+        ok = (reader.GetGeneration() == numberOfWrites);
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Consistent reads = %u. Retried reads = %u", numberOfReads, numberOfFailedReads);
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestCrossProcessLatencyBenchmark() {
+    const char8* configPing = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest1\"\n"
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 4";
+    const char8* configPong = ""
+            "SharedMemoryName = \"/MARTeSharedMemoryGateTest2\"\n"
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 4";
+    const uint32 numberOfIterations = 10000u;
+
+    SharedMemoryGate ping;
+    SharedMemoryGate pong;
+    bool ok = InitialiseSharedMemoryGate(ping, configPing);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(pong, configPong);
+    }
+    pid_t cpid = -1;
+    if (ok) {
+        cpid = fork();
+        ok = (cpid != -1);
+    }
+    if (cpid == 0) {
+        //Echo process: copies every new ping value to the pong gate.
+        SharedMemoryGate pingChild;
+        SharedMemoryGate pongChild;
+        bool okChild = InitialiseSharedMemoryGate(pingChild, configPing);
+        if (okChild) {
+            okChild = InitialiseSharedMemoryGate(pongChild, configPong);
+        }
+        uint32 last = 0u;
+        const uint64 maxTimeoutSeconds = 10u;
+        uint64 maxTimeout = HighResolutionTimer::Counter() + maxTimeoutSeconds * HighResolutionTimer::Frequency();
+        while ((last < numberOfIterations) && (okChild)) {
+            uint32 value = 0u;
+            if (pingChild.MemoryRead(reinterpret_cast<uint8 *>(&value))) {
+                if (value != last) {
+                    okChild = pongChild.MemoryWrite(reinterpret_cast<uint8 *>(&value));
+                    last = value;
+                }
+            }
+            if (okChild) {
+                okChild = (HighResolutionTimer::Counter() < maxTimeout);
+            }
+        }
+        _exit(okChild ? 0 : 1);
+    }
+    uint64 totalTicks = 0u;
+    uint64 maxTicks = 0u;
+    uint32 i;
+    for (i = 1u; (i <= numberOfIterations) && (ok); i++) {
+        uint64 startTicks = HighResolutionTimer::Counter();
+        ok = ping.MemoryWrite(reinterpret_cast<uint8 *>(&i));
+        uint32 value = 0u;
+        const uint64 maxTimeout = startTicks + HighResolutionTimer::Frequency();
+        while ((value != i) && (ok)) {
+            if (!pong.MemoryRead(reinterpret_cast<uint8 *>(&value))) {
+                value = 0u;
+            }
+            ok = (HighResolutionTimer::Counter() < maxTimeout);
+        }
+        uint64 ticks = (HighResolutionTimer::Counter() - startTicks);
+        totalTicks += ticks;
+        if (ticks > maxTicks) {
+            maxTicks = ticks;
+        }
+    }
+    if (cpid > 0) {
+        int32 status = 0;
+        if (waitpid(cpid, &status, 0) == cpid) {
+            ok &= (WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+        }
+        else {
+            ok = false;
+        }
+    }
+    if (ok) {
+        float64 meanUs = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(numberOfIterations);
+        float64 maxUs = static_cast<float64>(maxTicks) * HighResolutionTimer::Period() * 1e6;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Cross-process round trip over %u iterations: mean = %f us, max = %f us", numberOfIterations, meanUs, maxUs);
+    }
+    return ok;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file SharedMemoryGateTest.h
+ * @brief Header file for class SharedMemoryGateTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryGateTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYGATE_SHAREDMEMORYGATETEST_H_
+#define MEMORYGATE_SHAREDMEMORYGATETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryGate.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Test all the SharedMemoryGate methods
+ */
+class SharedMemoryGateTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    SharedMemoryGateTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~SharedMemoryGateTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the SharedMemoryGate::Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the SharedMemoryGate::Initialise method without a MemorySize
+     */
+    bool TestInitialise_NoMemSize();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::Initialise method fails without a SharedMemoryName
+     */
+    bool TestInitialise_False_NoSharedMemoryName();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::Initialise method fails if the SharedMemoryName does not start with /
+     */
+    bool TestInitialise_False_BadSharedMemoryName();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::Initialise method fails with less than 2 or more than 64 buffers
+     */
+    bool TestInitialise_False_NumberOfBuffers();
+
+    /**
+     * @brief Tests that a second SharedMemoryGate with the same name joins the shared memory
+     */
+    bool TestSetMemorySize_Join();
+
+    /**
+     * @brief Tests that joining a shared memory with a different memory size fails
+     */
+    bool TestSetMemorySize_False_DifferentSize();
+
+    /**
+     * @brief Tests that joining a shared memory with a different number of buffers fails
+     */
+    bool TestSetMemorySize_False_DifferentNumberOfBuffers();
+
+    /**
+     * @brief Tests that the shared memory left behind by an owner which died is recreated by the next SharedMemoryGate
+     */
+    bool TestSetMemorySize_StaleOwner();
+
+    /**
+     * @brief Tests that processes which recover the same stale shared memory at the same time end up on the same new shared memory
+     */
+    bool TestSetMemorySize_StaleOwner_ConcurrentRecovery();
+
+    /**
+     * @brief Tests that the SetMemorySize method fails if the shared memory would be larger than 4 GB
+     */
+    bool TestSetMemorySize_False_Overflow();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::MemoryRead method returns the newest written buffer
+     */
+    bool TestMemoryRead();
+
+    /**
+     * @brief Tests the SharedMemoryGate::MemoryWrite method and the generation counter
+     */
+    bool TestMemoryWrite();
+
+    /**
+     * @brief Tests that the reads of a process never see a partially written buffer from another process
+     */
+    bool TestMemoryRead_CrossProcessConsistency();
+
+    /**
+     * @brief Benchmarks the round trip latency between two processes exchanging a counter through two SharedMemoryGate.
+     */
+    bool TestCrossProcessLatencyBenchmark();
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYGATE_SHAREDMEMORYGATETEST_H_ */
@@ -74,6 +74,16 @@ TEST(OPCUAServerGTest,TestExecute_WrongNDimensions) {
     ASSERT_TRUE(test.TestExecute_WrongNDimensions());
 }
 
+TEST(OPCUAServerGTest,TestRegisterObject) {
+    OPCUAServerTest test;
+    ASSERT_TRUE(test.TestRegisterObject());
+}
+
+TEST(OPCUAServerGTest,TestRegisterObject_False_Invalid) {
+    OPCUAServerTest test;
+    ASSERT_TRUE(test.TestRegisterObject_False_Invalid());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
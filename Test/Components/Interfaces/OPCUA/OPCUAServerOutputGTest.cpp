@@ -0,0 +1,138 @@
+/**
+ * @file OPCUAServerOutputGTest.cpp
+ * @brief Source file for class OPCUAServerOutputGTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUAServerOutputGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "OPCUAServerOutputTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(OPCUAServerOutputGTest,TestConstructor) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(OPCUAServerOutputGTest,TestInitialise) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(OPCUAServerOutputGTest,TestInitialise_DefaultObjectName) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_DefaultObjectName());
+}
+
+TEST(OPCUAServerOutputGTest,TestInitialise_False_NoServer) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NoServer());
+}
+
+TEST(OPCUAServerOutputGTest,TestSetConfiguredDatabase) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase());
+}
+
+TEST(OPCUAServerOutputGTest,TestSetConfiguredDatabase_False_ServerNotFound) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_ServerNotFound());
+}
+
+TEST(OPCUAServerOutputGTest,TestSetConfiguredDatabase_False_UnsupportedType) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_UnsupportedType());
+}
+
+TEST(OPCUAServerOutputGTest,TestSetConfiguredDatabase_False_Samples) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Samples());
+}
+
+TEST(OPCUAServerOutputGTest,TestSetConfiguredDatabase_False_Samples_SecondFunction) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Samples_SecondFunction());
+}
+
+TEST(OPCUAServerOutputGTest,TestSetConfiguredDatabase_False_NumberOfDimensions) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NumberOfDimensions());
+}
+
+TEST(OPCUAServerOutputGTest,TestGetSignalMemoryBuffer) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestGetSignalMemoryBuffer());
+}
+
+TEST(OPCUAServerOutputGTest,TestGetBrokerName) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(OPCUAServerOutputGTest,TestPrepareNextState) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(OPCUAServerOutputGTest,TestSynchronise) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(OPCUAServerOutputGTest,TestGetServerName) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestGetServerName());
+}
+
+TEST(OPCUAServerOutputGTest,TestGetObjectName) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestGetObjectName());
+}
+
+TEST(OPCUAServerOutputGTest,TestGetSignalNode) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestGetSignalNode());
+}
+
+TEST(OPCUAServerOutputGTest,TestSynchronise_Subscriptions_1) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_Subscriptions(1u));
+}
+
+TEST(OPCUAServerOutputGTest,TestSynchronise_Subscriptions_4) {
+    OPCUAServerOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_Subscriptions(4u));
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
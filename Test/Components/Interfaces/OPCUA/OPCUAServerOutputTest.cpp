@@ -0,0 +1,1101 @@
+/**
+ * @file OPCUAServerOutputTest.cpp
+ * @brief Source file for class OPCUAServerOutputTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUAServerOutputTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "ObjectRegistryDatabase.h"
+#include "OPCUAServer.h"
+#include "OPCUAServerOutput.h"
+#include "OPCUAServerOutputTest.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which gives access to the memory of its output signals.
+ */
+class OPCUAServerOutputGAMTestHelper: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    OPCUAServerOutputGAMTestHelper() {
+        numberOfSignals = 0u;
+        for (MARTe::uint32 n = 0u; n < 8u; n++) {
+            signalMemory[n] = NULL;
+        }
+    }
+
+    virtual ~OPCUAServerOutputGAMTestHelper() {
+    }
+
+    virtual bool Setup() {
+        using namespace MARTe;
+        numberOfSignals = GetNumberOfOutputSignals();
+        bool ok = (numberOfSignals <= 8u);
+        for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+            signalMemory[n] = GetOutputSignalMemory(n);
+        }
+        return ok;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+
+    MARTe::uint32 numberOfSignals;
+    void *signalMemory[8];
+};
+CLASS_REGISTER(OPCUAServerOutputGAMTestHelper, "1.0")
+
+/**
+ * @brief Manual scheduler which allows to execute single cycles of the real-time thread.
+ */
+class OPCUAServerOutputSchedulerTestHelper: public MARTe::GAMSchedulerI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    OPCUAServerOutputSchedulerTestHelper() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    void ExecuteThreadCycle(MARTe::uint32 threadId) {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
+        ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].executables,
+                           scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeApp) {
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeApp);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+
+    MARTe::ScheduledState * const * scheduledStates;
+};
+CLASS_REGISTER(OPCUAServerOutputSchedulerTestHelper, "1.0")
+
+/**
+ * Number of elements of the Values signal.
+ */
+static const MARTe::uint32 OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS = 16u;
+
+/**
+ * Number of notifications that each subscribed client shall receive.
+ */
+static const MARTe::uint32 OPCUA_SERVER_OUTPUT_TEST_N_NOTIFICATIONS = 5u;
+
+/**
+ * @brief Parses the configuration, initialises the ObjectRegistryDatabase and configures the Test application.
+ */
+static bool OPCUAServerOutputTestConfigure(const MARTe::char8 * const config) {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StreamString err;
+    StandardParser parser(configStream, cdb, &err);
+
+    bool ok = parser.Parse();
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s", err.Buffer());
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Configures the Test application and purges the ObjectRegistryDatabase.
+ */
+static bool OPCUAServerOutputTestIntegratedInApplication(const MARTe::char8 * const config) {
+    bool ok = OPCUAServerOutputTestConfigure(config);
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+/**
+ * @brief Waits for the server to add the registered objects to the Address Space.
+ */
+static bool OPCUAServerOutputTestWaitRegistration() {
+    using namespace MARTe;
+    ReferenceT<OPCUAServer> server = ObjectRegistryDatabase::Instance()->Find("ServerTest");
+    bool ok = server.IsValid();
+    bool done = false;
+    for (uint32 n = 0u; (n < 500u) && (ok) && (!done); n++) {
+        done = (server->GetNumberOfPendingObjects() == 0u);
+        if (!done) {
+            Sleep::MSec(10);
+        }
+    }
+    return (ok && done);
+}
+
+/**
+ * @brief Gets the NodeId assigned by the server to the signal with name \a signalName.
+ */
+static bool OPCUAServerOutputTestGetNodeId(MARTe::ReferenceT<MARTe::OPCUAServerOutput> dataSource,
+                                           const MARTe::char8 * const signalName,
+                                           MARTe::uint32 &nodeId) {
+    using namespace MARTe;
+    uint32 signalIdx = 0u;
+    bool ok = dataSource->GetSignalIndex(signalIdx, signalName);
+    ReferenceT<OPCUASignalNode> node;
+    if (ok) {
+        node = dataSource->GetSignalNode(signalIdx);
+        ok = node.IsValid();
+    }
+    if (ok) {
+        nodeId = node->GetNodeId();
+    }
+    return ok;
+}
+
+/**
+ * @brief Counters updated by the subscription callbacks of one client.
+ */
+struct OPCUAServerOutputTestClient {
+    UA_Client *client;
+    MARTe::uint32 notifications;
+    MARTe::uint32 inconsistentNotifications;
+    MARTe::uint32 lastValue;
+};
+
+/**
+ * @brief Checks that all the elements of the notified array are equal (i.e. they were published together).
+ */
+static void OPCUAServerOutputTestDataChange(UA_Client *client,
+                                            UA_UInt32 subId,
+                                            void *subContext,
+                                            UA_UInt32 monId,
+                                            void *monContext,
+                                            UA_DataValue *value) {
+    using namespace MARTe;
+    OPCUAServerOutputTestClient *testClient = static_cast<OPCUAServerOutputTestClient *>(monContext);
+    if ((testClient != NULL) && (value != NULL)) {
+        bool ok = (value->hasValue);
+        if (ok) {
+            ok = ((value->value.type == &UA_TYPES[UA_TYPES_UINT32]) && (value->value.arrayLength == OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS));
+        }
+        if (ok) {
+            const uint32 * const values = static_cast<const uint32 *>(value->value.data);
+            for (uint32 j = 1u; (j < OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS) && (ok); j++) {
+                ok = (values[j] == values[0u]);
+            }
+            if (ok) {
+                ok = (values[0u] >= testClient->lastValue);
+                testClient->lastValue = values[0u];
+            }
+        }
+        if (!ok) {
+            testClient->inconsistentNotifications++;
+        }
+        testClient->notifications++;
+    }
+}
+
+/**
+ * @brief Parameters and results of OPCUAServerOutputTestRealTimeThread.
+ */
+struct OPCUAServerOutputTestRealTimeParams {
+    OPCUAServerOutputSchedulerTestHelper *scheduler;
+    MARTe::uint32 *values;
+    volatile MARTe::int32 stop;
+    volatile MARTe::int32 done;
+    MARTe::uint32 cycles;
+};
+
+/**
+ * @brief Executes the real-time thread as fast as possible, writing arrays where all the elements are equal to the cycle number.
+ */
+static void OPCUAServerOutputTestRealTimeThread(const void * const params) {
+    using namespace MARTe;
+    OPCUAServerOutputTestRealTimeParams *rtParams = static_cast<OPCUAServerOutputTestRealTimeParams *>(const_cast<void *>(params));
+    while (rtParams->stop == 0) {
+        rtParams->cycles++;
+        for (uint32 j = 0u; j < OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS; j++) {
+            rtParams->values[j] = rtParams->cycles;
+        }
+        rtParams->scheduler->ExecuteThreadCycle(0u);
+    }
+    rtParams->done = 1;
+}
+
+//Standard configuration
+static const MARTe::char8 * const config1 = ""
+        "+ServerTest = {"
+        "    Class = OPCUA::OPCUAServer"
+        "    AddressSpace = {"
+        "        MyNode = {"
+        "            Type = uint8"
+        "        }"
+        "    }"
+        "}"
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "                Value = {"
+        "                    Type = float64"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "                Values = {"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 16"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "            Server = ServerTest"
+        "            ObjectName = RTSignals"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//No Server
+static const MARTe::char8 * const config2 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Server which does not exist
+static const MARTe::char8 * const config3 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "            Server = ServerTest"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Unsupported type
+static const MARTe::char8 * const config4 = ""
+        "+ServerTest = {"
+        "    Class = OPCUA::OPCUAServer"
+        "    AddressSpace = {"
+        "        MyNode = {"
+        "            Type = uint8"
+        "        }"
+        "    }"
+        "}"
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Name = {"
+        "                    Type = char8"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 8"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "            Server = ServerTest"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//More than one sample
+static const MARTe::char8 * const config5 = ""
+        "+ServerTest = {"
+        "    Class = OPCUA::OPCUAServer"
+        "    AddressSpace = {"
+        "        MyNode = {"
+        "            Type = uint8"
+        "        }"
+        "    }"
+        "}"
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    Samples = 2"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "            Server = ServerTest"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//More than one dimension
+static const MARTe::char8 * const config6 = ""
+        "+ServerTest = {"
+        "    Class = OPCUA::OPCUAServer"
+        "    AddressSpace = {"
+        "        MyNode = {"
+        "            Type = uint8"
+        "        }"
+        "    }"
+        "}"
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Matrix = {"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 2"
+        "                    NumberOfElements = 4"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "            Server = ServerTest"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//More than one sample in the second function
+static const MARTe::char8 * const config7 = ""
+        "+ServerTest = {"
+        "    Class = OPCUA::OPCUAServer"
+        "    AddressSpace = {"
+        "        MyNode = {"
+        "            Type = uint8"
+        "        }"
+        "    }"
+        "}"
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM2 = {"
+        "            Class = OPCUAServerOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                Value = {"
+        "                    Type = uint32"
+        "                    Samples = 2"
+        "                    DataSource = OPCUAOut"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +OPCUAOut = {"
+        "            Class = OPCUA::OPCUAServerOutput"
+        "            Server = ServerTest"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1 GAM2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = OPCUAServerOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool OPCUAServerOutputTest::TestConstructor() {
+    using namespace MARTe;
+    OPCUAServerOutput dataSource;
+    StreamString serverName = dataSource.GetServerName();
+    StreamString objectName = dataSource.GetObjectName();
+    bool ok = (serverName == "");
+    if (ok) {
+        ok = (objectName == "");
+    }
+    if (ok) {
+        ok = !dataSource.GetSignalNode(0u).IsValid();
+    }
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestInitialise() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("Server", "ServerTest");
+    cdb.Write("ObjectName", "RTSignals");
+    OPCUAServerOutput dataSource;
+    dataSource.SetName("OPCUAOut");
+    bool ok = dataSource.Initialise(cdb);
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetServerName(), "ServerTest") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetObjectName(), "RTSignals") == 0);
+    }
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestInitialise_DefaultObjectName() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("Server", "ServerTest");
+    OPCUAServerOutput dataSource;
+    dataSource.SetName("OPCUAOut");
+    bool ok = dataSource.Initialise(cdb);
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetObjectName(), "OPCUAOut") == 0);
+    }
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestInitialise_False_NoServer() {
+    return !OPCUAServerOutputTestIntegratedInApplication(config2);
+}
+
+bool OPCUAServerOutputTest::TestSetConfiguredDatabase() {
+    using namespace MARTe;
+    bool ok = OPCUAServerOutputTestConfigure(config1);
+    if (ok) {
+        ok = OPCUAServerOutputTestWaitRegistration();
+    }
+    UA_Client *client = UA_Client_new();
+    UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    if (ok) {
+        UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+        ok = (retval == UA_STATUSCODE_GOOD);
+    }
+    ReferenceT<OPCUAServerOutput> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Test.Data.OPCUAOut");
+        ok = dataSource.IsValid();
+    }
+    const char8 * const signalNames[] = { "Counter", "Value", "Values" };
+    for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+        uint32 nodeId = 0u;
+        ok = OPCUAServerOutputTestGetNodeId(dataSource, signalNames[i], nodeId);
+        UA_QualifiedName browseName;
+        UA_QualifiedName_init(&browseName);
+        if (ok) {
+            UA_StatusCode retval = UA_Client_readBrowseNameAttribute(client, UA_NODEID_NUMERIC(1u, nodeId), &browseName);
+            ok = (retval == UA_STATUSCODE_GOOD);
+        }
+        if (ok) {
+            StreamString name;
+            ok = name.Write(reinterpret_cast<const char8 *>(browseName.name.data), browseName.name.length);
+            if (ok) {
+                ok = (name == signalNames[i]);
+            }
+        }
+        UA_QualifiedName_deleteMembers(&browseName);
+    }
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestSetConfiguredDatabase_False_ServerNotFound() {
+    return !OPCUAServerOutputTestIntegratedInApplication(config3);
+}
+
+bool OPCUAServerOutputTest::TestSetConfiguredDatabase_False_UnsupportedType() {
+    return !OPCUAServerOutputTestIntegratedInApplication(config4);
+}
+
+bool OPCUAServerOutputTest::TestSetConfiguredDatabase_False_Samples() {
+    return !OPCUAServerOutputTestIntegratedInApplication(config5);
+}
+
+bool OPCUAServerOutputTest::TestSetConfiguredDatabase_False_Samples_SecondFunction() {
+    return !OPCUAServerOutputTestIntegratedInApplication(config7);
+}
+
+bool OPCUAServerOutputTest::TestSetConfiguredDatabase_False_NumberOfDimensions() {
+    return !OPCUAServerOutputTestIntegratedInApplication(config6);
+}
+
+bool OPCUAServerOutputTest::TestGetSignalMemoryBuffer() {
+    using namespace MARTe;
+    bool ok = OPCUAServerOutputTestConfigure(config1);
+    ReferenceT<OPCUAServerOutput> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Test.Data.OPCUAOut");
+        ok = dataSource.IsValid();
+    }
+    void *counterAddress = NULL;
+    void *valueAddress = NULL;
+    void *valuesAddress = NULL;
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(0u, 0u, counterAddress);
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(1u, 0u, valueAddress);
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(2u, 0u, valuesAddress);
+    }
+    if (ok) {
+        ok = ((counterAddress != NULL) && (valueAddress != NULL) && (valuesAddress != NULL));
+    }
+    if (ok) {
+        ok = ((counterAddress != valueAddress) && (valueAddress != valuesAddress));
+    }
+    if (ok) {
+        void *invalidAddress = NULL;
+        ok = !dataSource->GetSignalMemoryBuffer(3u, 0u, invalidAddress);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestGetBrokerName() {
+    using namespace MARTe;
+    OPCUAServerOutput dataSource;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(dataSource.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetBrokerName(cdb, InputSignals), "") == 0);
+    }
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestPrepareNextState() {
+    using namespace MARTe;
+    OPCUAServerOutput dataSource;
+    return dataSource.PrepareNextState("State1", "State2");
+}
+
+bool OPCUAServerOutputTest::TestSynchronise() {
+    using namespace MARTe;
+    bool ok = OPCUAServerOutputTestConfigure(config1);
+    if (ok) {
+        ok = OPCUAServerOutputTestWaitRegistration();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeApplication> application = god->Find("Test");
+    ReferenceT<OPCUAServerOutputSchedulerTestHelper> scheduler = god->Find("Test.Scheduler");
+    ReferenceT<OPCUAServerOutputGAMTestHelper> gam = god->Find("Test.Functions.GAM1");
+    ReferenceT<OPCUAServerOutput> dataSource = god->Find("Test.Data.OPCUAOut");
+    if (ok) {
+        ok = (application.IsValid() && scheduler.IsValid() && gam.IsValid() && dataSource.IsValid());
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        *static_cast<uint32 *>(gam->signalMemory[0u]) = 7u;
+        *static_cast<float64 *>(gam->signalMemory[1u]) = 2.5;
+        uint32 *values = static_cast<uint32 *>(gam->signalMemory[2u]);
+        for (uint32 j = 0u; j < OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS; j++) {
+            values[j] = j;
+        }
+        scheduler->ExecuteThreadCycle(0u);
+    }
+    UA_Client *client = UA_Client_new();
+    UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    if (ok) {
+        UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+        ok = (retval == UA_STATUSCODE_GOOD);
+    }
+    uint32 nodeId = 0u;
+    UA_Variant value;
+    UA_Variant_init(&value);
+    if (ok) {
+        ok = OPCUAServerOutputTestGetNodeId(dataSource, "Counter", nodeId);
+    }
+    if (ok) {
+        ok = (UA_Client_readValueAttribute(client, UA_NODEID_NUMERIC(1u, nodeId), &value) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (UA_Variant_hasScalarType(&value, &UA_TYPES[UA_TYPES_UINT32]));
+    }
+    if (ok) {
+        ok = (*static_cast<UA_UInt32 *>(value.data) == 7u);
+    }
+    UA_Variant_deleteMembers(&value);
+    if (ok) {
+        ok = OPCUAServerOutputTestGetNodeId(dataSource, "Value", nodeId);
+    }
+    if (ok) {
+        ok = (UA_Client_readValueAttribute(client, UA_NODEID_NUMERIC(1u, nodeId), &value) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (UA_Variant_hasScalarType(&value, &UA_TYPES[UA_TYPES_DOUBLE]));
+    }
+    if (ok) {
+        ok = (*static_cast<UA_Double *>(value.data) == 2.5);
+    }
+    UA_Variant_deleteMembers(&value);
+    if (ok) {
+        ok = OPCUAServerOutputTestGetNodeId(dataSource, "Values", nodeId);
+    }
+    if (ok) {
+        ok = (UA_Client_readValueAttribute(client, UA_NODEID_NUMERIC(1u, nodeId), &value) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (UA_Variant_hasArrayType(&value, &UA_TYPES[UA_TYPES_UINT32]));
+    }
+    if (ok) {
+        ok = (value.arrayLength == OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS);
+    }
+    for (uint32 j = 0u; (j < OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS) && (ok); j++) {
+        ok = (static_cast<UA_UInt32 *>(value.data)[j] == j);
+    }
+    UA_Variant_deleteMembers(&value);
+    //The clients cannot write the published values
+    if (ok) {
+        UA_Variant newValue;
+        UA_UInt32 newCounter = 3u;
+        UA_Variant_setScalar(&newValue, &newCounter, &UA_TYPES[UA_TYPES_UINT32]);
+        ok = OPCUAServerOutputTestGetNodeId(dataSource, "Counter", nodeId);
+        if (ok) {
+            ok = (UA_Client_writeValueAttribute(client, UA_NODEID_NUMERIC(1u, nodeId), &newValue) != UA_STATUSCODE_GOOD);
+        }
+    }
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+    if (application.IsValid()) {
+        (void) application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestGetServerName() {
+    return TestInitialise();
+}
+
+bool OPCUAServerOutputTest::TestGetObjectName() {
+    return TestInitialise();
+}
+
+bool OPCUAServerOutputTest::TestGetSignalNode() {
+    using namespace MARTe;
+    bool ok = OPCUAServerOutputTestConfigure(config1);
+    ReferenceT<OPCUAServerOutput> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Test.Data.OPCUAOut");
+        ok = dataSource.IsValid();
+    }
+    ReferenceT<OPCUASignalNode> node;
+    if (ok) {
+        node = dataSource->GetSignalNode(2u);
+        ok = node.IsValid();
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(node->GetName(), "Values") == 0);
+    }
+    if (ok) {
+        ok = (node->GetValueNumberOfElements() == OPCUA_SERVER_OUTPUT_TEST_N_ELEMENTS);
+    }
+    if (ok) {
+        ok = (node->GetUADataType() == &UA_TYPES[UA_TYPES_UINT32]);
+    }
+    if (ok) {
+        ok = !dataSource->GetSignalNode(3u).IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool OPCUAServerOutputTest::TestSynchronise_Subscriptions(const MARTe::uint32 numberOfClients) {
+    using namespace MARTe;
+    bool ok = OPCUAServerOutputTestConfigure(config1);
+    if (ok) {
+        ok = OPCUAServerOutputTestWaitRegistration();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeApplication> application = god->Find("Test");
+    ReferenceT<OPCUAServerOutputSchedulerTestHelper> scheduler = god->Find("Test.Scheduler");
+    ReferenceT<OPCUAServerOutputGAMTestHelper> gam = god->Find("Test.Functions.GAM1");
+    ReferenceT<OPCUAServerOutput> dataSource = god->Find("Test.Data.OPCUAOut");
+    if (ok) {
+        ok = (application.IsValid() && scheduler.IsValid() && gam.IsValid() && dataSource.IsValid());
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    uint32 nodeId = 0u;
+    if (ok) {
+        ok = OPCUAServerOutputTestGetNodeId(dataSource, "Values", nodeId);
+    }
+    OPCUAServerOutputTestClient *clients = new OPCUAServerOutputTestClient[numberOfClients];
+    for (uint32 i = 0u; i < numberOfClients; i++) {
+        clients[i].client = UA_Client_new();
+        clients[i].notifications = 0u;
+        clients[i].inconsistentNotifications = 0u;
+        clients[i].lastValue = 0u;
+        UA_ClientConfig_setDefault(UA_Client_getConfig(clients[i].client));
+    }
+    for (uint32 i = 0u; (i < numberOfClients) && (ok); i++) {
+        ok = (UA_Client_connect(clients[i].client, "opc.tcp://localhost:4840") == UA_STATUSCODE_GOOD);
+        UA_UInt32 subscriptionId = 0u;
+        if (ok) {
+            UA_CreateSubscriptionRequest sReq = UA_CreateSubscriptionRequest_default();
+            sReq.requestedPublishingInterval = 10.0;
+            UA_CreateSubscriptionResponse sResp = UA_Client_Subscriptions_create(clients[i].client, sReq, NULL, NULL, NULL);
+            ok = (sResp.responseHeader.serviceResult == UA_STATUSCODE_GOOD);
+            subscriptionId = sResp.subscriptionId;
+        }
+        if (ok) {
+            UA_MonitoredItemCreateRequest mReq = UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1u, nodeId));
+            mReq.requestedParameters.samplingInterval = 10.0;
+            mReq.requestedParameters.queueSize = 1u;
+            UA_MonitoredItemCreateResult mResult = UA_Client_MonitoredItems_createDataChange(clients[i].client, subscriptionId,
+                                                                                             UA_TIMESTAMPSTORETURN_SOURCE, mReq, &clients[i],
+                                                                                             &OPCUAServerOutputTestDataChange, NULL);
+            ok = (mResult.statusCode == UA_STATUSCODE_GOOD);
+        }
+    }
+    OPCUAServerOutputTestRealTimeParams rtParams;
+    rtParams.scheduler = scheduler.operator->();
+    rtParams.values = NULL;
+    rtParams.stop = 0;
+    rtParams.done = 0;
+    rtParams.cycles = 0u;
+    if (ok) {
+        rtParams.values = static_cast<uint32 *>(gam->signalMemory[2u]);
+        ok = (Threads::BeginThread(&OPCUAServerOutputTestRealTimeThread, &rtParams) != InvalidThreadIdentifier);
+    }
+    //Serve the subscriptions until all the clients were notified while the real-time thread publishes as fast as it can.
+    if (ok) {
+        bool allNotified = false;
+        for (uint32 n = 0u; (n < 1000u) && (!allNotified); n++) {
+            allNotified = true;
+            for (uint32 i = 0u; i < numberOfClients; i++) {
+                (void) UA_Client_run_iterate(clients[i].client, 10u);
+                if (clients[i].notifications < OPCUA_SERVER_OUTPUT_TEST_N_NOTIFICATIONS) {
+                    allNotified = false;
+                }
+            }
+        }
+        rtParams.stop = 1;
+        for (uint32 n = 0u; (n < 500u) && (rtParams.done == 0); n++) {
+            Sleep::MSec(10);
+        }
+        ok = (rtParams.done == 1);
+    }
+    for (uint32 i = 0u; (i < numberOfClients) && (ok); i++) {
+        ok = (clients[i].notifications >= OPCUA_SERVER_OUTPUT_TEST_N_NOTIFICATIONS);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The client %u only received %u notifications", i, clients[i].notifications);
+        }
+        if (ok) {
+            ok = (clients[i].inconsistentNotifications == 0u);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The client %u received %u inconsistent arrays", i, clients[i].inconsistentNotifications);
+            }
+        }
+    }
+    for (uint32 i = 0u; i < numberOfClients; i++) {
+        UA_Client_disconnect(clients[i].client);
+        UA_Client_delete(clients[i].client);
+    }
+    delete[] clients;
+    if (application.IsValid()) {
+        (void) application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    return ok;
+}
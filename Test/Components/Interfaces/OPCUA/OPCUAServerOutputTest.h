@@ -0,0 +1,141 @@
+/**
+ * @file OPCUAServerOutputTest.h
+ * @brief Header file for class OPCUAServerOutputTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class OPCUAServerOutputTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_INTERFACES_OPCUA_OPCUASERVEROUTPUTTEST_H_
+#define TEST_COMPONENTS_INTERFACES_OPCUA_OPCUASERVEROUTPUTTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the OPCUAServerOutput public methods.
+ */
+class OPCUAServerOutputTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method without ObjectName.
+     */
+    bool TestInitialise_DefaultObjectName();
+
+    /**
+     * @brief Tests that the Initialise method fails without Server.
+     */
+    bool TestInitialise_False_NoServer();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method registers the signals in the server.
+     */
+    bool TestSetConfiguredDatabase();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the server does not exist.
+     */
+    bool TestSetConfiguredDatabase_False_ServerNotFound();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with an unsupported type.
+     */
+    bool TestSetConfiguredDatabase_False_UnsupportedType();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with more than one sample.
+     */
+    bool TestSetConfiguredDatabase_False_Samples();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with more than one sample in a function other than the first.
+     */
+    bool TestSetConfiguredDatabase_False_Samples_SecondFunction();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with more than one dimension.
+     */
+    bool TestSetConfiguredDatabase_False_NumberOfDimensions();
+
+    /**
+     * @brief Tests the GetSignalMemoryBuffer method.
+     */
+    bool TestGetSignalMemoryBuffer();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests the PrepareNextState method.
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests that the values written by a GAM can be read by an OPCUA client.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests the GetServerName method.
+     */
+    bool TestGetServerName();
+
+    /**
+     * @brief Tests the GetObjectName method.
+     */
+    bool TestGetObjectName();
+
+    /**
+     * @brief Tests the GetSignalNode method.
+     */
+    bool TestGetSignalNode();
+
+    /**
+     * @brief Tests that \a numberOfClients OPCUA clients subscribed to an array signal are notified, and only with consistent arrays,
+     * while the real-time thread (GAM + broker + Synchronise) publishes the signal as fast as it can.
+     * @param[in] numberOfClients the number of clients subscribed to the signal.
+     */
+    bool TestSynchronise_Subscriptions(const MARTe::uint32 numberOfClients);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_INTERFACES_OPCUA_OPCUASERVEROUTPUTTEST_H_ */
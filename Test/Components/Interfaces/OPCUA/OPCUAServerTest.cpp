@@ -341,6 +341,91 @@ bool OPCUAServerTest::TestExecute_WrongNDimensions() {
 	return !ok;
 }
 
+bool OPCUAServerTest::TestRegisterObject() {
+	using namespace MARTe;
+	StreamString config = ""
+			"+ServerTest = {"
+			"     Class = OPCUA::OPCUAServer"
+			"     AddressSpace = {"
+			"         MyNode = {"
+			"             Type = uint8"
+			"         }"
+			"     }"
+			"}";
+	config.Seek(0LLU);
+	ConfigurationDatabase cdb;
+	StandardParser parser(config, cdb, NULL);
+	bool ok = parser.Parse();
+	cdb.MoveToRoot();
+	ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+	if (ok) {
+		ok = ord->Initialise(cdb);
+	}
+	ReferenceT<OPCUAServer> server;
+	if (ok) {
+		server = ord->Find("ServerTest");
+		ok = server.IsValid();
+	}
+	ReferenceT<OPCUAObject> object("OPCUAObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+	ReferenceT<OPCUASignalNode> node("OPCUASignalNode", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+	object->SetName("Registered");
+	node->SetName("Signal");
+	node->SetNodeType(Float64Bit);
+	if (ok) {
+		ok = node->AllocateValue();
+	}
+	if (ok) {
+		ok = object->Insert(node);
+	}
+	if (ok) {
+		float64 value = 1.5;
+		node->Publish(&value);
+		ok = server->RegisterObject(object);
+	}
+	for (uint32 n = 0u; (n < 200u) && (ok) && (server->GetNumberOfPendingObjects() > 0u); n++) {
+		Sleep::MSec(10);
+	}
+	if (ok) {
+		ok = (server->GetNumberOfPendingObjects() == 0u);
+	}
+	UA_Client *client = UA_Client_new();
+	UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+	if (ok) {
+		UA_StatusCode retval = UA_Client_connect(client,
+				"opc.tcp://localhost:4840");
+		ok = (retval == UA_STATUSCODE_GOOD);
+	}
+	UA_Variant value;
+	UA_Variant_init(&value);
+	if (ok) {
+		UA_StatusCode retval = UA_Client_readValueAttribute(client,
+				UA_NODEID_NUMERIC(1u, node->GetNodeId()), &value);
+		ok = (retval == UA_STATUSCODE_GOOD);
+	}
+	if (ok) {
+		ok = (UA_Variant_hasScalarType(&value, &UA_TYPES[UA_TYPES_DOUBLE]));
+	}
+	if (ok) {
+		ok = (*static_cast<UA_Double *>(value.data) == 1.5);
+	}
+	UA_Variant_deleteMembers(&value);
+	UA_Client_disconnect(client);
+	UA_Client_delete(client);
+	ord->Purge();
+	return ok;
+}
+
+bool OPCUAServerTest::TestRegisterObject_False_Invalid() {
+	using namespace MARTe;
+	OPCUAServer server;
+	ReferenceT<OPCUAObject> object;
+	bool ok = !server.RegisterObject(object);
+	if (ok) {
+		ok = (server.GetNumberOfPendingObjects() == 0u);
+	}
+	return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
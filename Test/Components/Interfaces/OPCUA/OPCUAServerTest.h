@@ -76,6 +76,16 @@ public:
      */
     bool TestExecute_WrongNDimensions();
 
+    /**
+     * @brief Tests that the RegisterObject method adds the object to the Address Space of a running server.
+     */
+    bool TestRegisterObject();
+
+    /**
+     * @brief Tests that the RegisterObject method fails with an invalid object.
+     */
+    bool TestRegisterObject_False_Invalid();
+
 };
 
 
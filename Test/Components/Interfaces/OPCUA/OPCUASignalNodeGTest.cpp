@@ -0,0 +1,93 @@
+/**
+ * @file OPCUASignalNodeGTest.cpp
+ * @brief Source file for class OPCUASignalNodeGTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUASignalNodeGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "OPCUASignalNodeTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(OPCUASignalNodeGTest,TestConstructor) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(OPCUASignalNodeGTest,TestAllocateValue) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestAllocateValue());
+}
+
+TEST(OPCUASignalNodeGTest,TestAllocateValue_Array) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestAllocateValue_Array());
+}
+
+TEST(OPCUASignalNodeGTest,TestAllocateValue_False_Type) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestAllocateValue_False_Type());
+}
+
+TEST(OPCUASignalNodeGTest,TestAllocateValue_False_Twice) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestAllocateValue_False_Twice());
+}
+
+TEST(OPCUASignalNodeGTest,TestPublish) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestPublish());
+}
+
+TEST(OPCUASignalNodeGTest,TestReadValue_NoPublication) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestReadValue_NoPublication());
+}
+
+TEST(OPCUASignalNodeGTest,TestReadValue_ConcurrentPublish) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestReadValue_ConcurrentPublish());
+}
+
+TEST(OPCUASignalNodeGTest,TestGetDataSource) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestGetDataSource());
+}
+
+TEST(OPCUASignalNodeGTest,TestGetUADataType) {
+    OPCUASignalNodeTest test;
+    ASSERT_TRUE(test.TestGetUADataType());
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
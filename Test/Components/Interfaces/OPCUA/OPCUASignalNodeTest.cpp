@@ -0,0 +1,313 @@
+/**
+ * @file OPCUASignalNodeTest.cpp
+ * @brief Source file for class OPCUASignalNodeTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUASignalNodeTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "OPCUASignalNode.h"
+#include "OPCUASignalNodeTest.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Number of elements of the arrays used in the concurrent tests.
+ */
+const MARTe::uint32 OPCUA_SIGNAL_NODE_TEST_N_ELEMENTS = 64u;
+
+/**
+ * Number of values published by OPCUASignalNodeTestPublisher.
+ */
+const MARTe::uint32 OPCUA_SIGNAL_NODE_TEST_N_PUBLICATIONS = 200000u;
+
+/**
+ * Parameters of OPCUASignalNodeTestPublisher.
+ */
+struct OPCUASignalNodeTestPublisherParams {
+    MARTe::OPCUASignalNode *node;
+    volatile MARTe::int32 done;
+};
+
+/**
+ * Publishes arrays where all the elements are equal to the publication number.
+ */
+void OPCUASignalNodeTestPublisher(const void * const params) {
+    using namespace MARTe;
+    OPCUASignalNodeTestPublisherParams *publisherParams = static_cast<OPCUASignalNodeTestPublisherParams *>(const_cast<void *>(params));
+    uint32 value[OPCUA_SIGNAL_NODE_TEST_N_ELEMENTS];
+    for (uint32 i = 1u; i <= OPCUA_SIGNAL_NODE_TEST_N_PUBLICATIONS; i++) {
+        for (uint32 j = 0u; j < OPCUA_SIGNAL_NODE_TEST_N_ELEMENTS; j++) {
+            value[j] = i;
+        }
+        publisherParams->node->Publish(&value[0]);
+    }
+    publisherParams->done = 1;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool OPCUASignalNodeTest::TestConstructor() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    bool ok = (node.GetValueSize() == 0u);
+    if (ok) {
+        ok = (node.GetValueNumberOfElements() == 0u);
+    }
+    if (ok) {
+        ok = (node.GetNumberOfPublications() == 0u);
+    }
+    if (ok) {
+        ok = (node.GetUADataType() == NULL);
+    }
+    if (ok) {
+        ok = node.IsNode();
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestAllocateValue() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(Float64Bit);
+    bool ok = node.AllocateValue();
+    if (ok) {
+        ok = (node.GetValueSize() == 8u);
+    }
+    if (ok) {
+        ok = (node.GetValueNumberOfElements() == 1u);
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestAllocateValue_Array() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(UnsignedInteger16Bit);
+    node.SetNumberOfDimensions(1u);
+    node.SetNumberOfElements(0u, 10u);
+    bool ok = node.AllocateValue();
+    if (ok) {
+        ok = (node.GetValueSize() == 20u);
+    }
+    if (ok) {
+        ok = (node.GetValueNumberOfElements() == 10u);
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestAllocateValue_False_Type() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(CharString);
+    return !node.AllocateValue();
+}
+
+bool OPCUASignalNodeTest::TestAllocateValue_False_Twice() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(UnsignedInteger32Bit);
+    bool ok = node.AllocateValue();
+    if (ok) {
+        ok = !node.AllocateValue();
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestPublish() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(SignedInteger32Bit);
+    node.SetNumberOfDimensions(1u);
+    node.SetNumberOfElements(0u, 3u);
+    bool ok = node.AllocateValue();
+    int32 value[3] = { -1, 2, -3 };
+    int32 readValue[3] = { 0, 0, 0 };
+    int64 timestamp = 0;
+    if (ok) {
+        node.Publish(&value[0]);
+        ok = node.ReadValue(&readValue[0], timestamp);
+    }
+    if (ok) {
+        ok = ((readValue[0] == -1) && (readValue[1] == 2) && (readValue[2] == -3));
+    }
+    if (ok) {
+        ok = (timestamp != 0);
+    }
+    if (ok) {
+        value[1] = 5;
+        node.Publish(&value[0]);
+        ok = node.ReadValue(&readValue[0], timestamp);
+    }
+    if (ok) {
+        ok = ((readValue[0] == -1) && (readValue[1] == 5) && (readValue[2] == -3));
+    }
+    if (ok) {
+        ok = (node.GetNumberOfPublications() == 2u);
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestReadValue_NoPublication() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(Float32Bit);
+    bool ok = node.AllocateValue();
+    float32 readValue = 1.0F;
+    int64 timestamp = 1;
+    if (ok) {
+        ok = node.ReadValue(&readValue, timestamp);
+    }
+    if (ok) {
+        ok = (readValue == 0.0F);
+    }
+    if (ok) {
+        ok = (timestamp == 0);
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestReadValue_ConcurrentPublish() {
+    using namespace MARTe;
+    ReferenceT<OPCUASignalNode> node("OPCUASignalNode", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    node->SetName("Node");
+    node->SetNodeType(UnsignedInteger32Bit);
+    node->SetNumberOfDimensions(1u);
+    node->SetNumberOfElements(0u, OPCUA_SIGNAL_NODE_TEST_N_ELEMENTS);
+    bool ok = node->AllocateValue();
+    OPCUASignalNodeTestPublisherParams params;
+    params.node = node.operator->();
+    params.done = 0;
+    if (ok) {
+        ok = (Threads::BeginThread(&OPCUASignalNodeTestPublisher, &params) != InvalidThreadIdentifier);
+    }
+    uint32 readValue[OPCUA_SIGNAL_NODE_TEST_N_ELEMENTS];
+    uint32 lastValue = 0u;
+    uint32 nOfReads = 0u;
+    while ((ok) && (params.done == 0)) {
+        int64 timestamp;
+        ok = node->ReadValue(&readValue[0], timestamp);
+        //The copy shall never mix two publications and shall never go back in time.
+        for (uint32 j = 1u; (j < OPCUA_SIGNAL_NODE_TEST_N_ELEMENTS) && (ok); j++) {
+            ok = (readValue[j] == readValue[0u]);
+        }
+        if (ok) {
+            ok = (readValue[0u] >= lastValue);
+            lastValue = readValue[0u];
+        }
+        nOfReads++;
+    }
+    if (ok) {
+        int64 timestamp;
+        ok = node->ReadValue(&readValue[0], timestamp);
+    }
+    if (ok) {
+        ok = (readValue[0u] == OPCUA_SIGNAL_NODE_TEST_N_PUBLICATIONS);
+    }
+    if (ok) {
+        ok = (node->GetNumberOfPublications() == OPCUA_SIGNAL_NODE_TEST_N_PUBLICATIONS);
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "%u consistent reads during %u publications", nOfReads, OPCUA_SIGNAL_NODE_TEST_N_PUBLICATIONS);
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestGetDataSource() {
+    using namespace MARTe;
+    OPCUASignalNode node;
+    node.SetName("Node");
+    node.SetNodeType(Float64Bit);
+    bool ok = node.AllocateValue();
+    UA_DataSource dataSource = node.GetDataSource();
+    if (ok) {
+        ok = (dataSource.read != NULL);
+    }
+    if (ok) {
+        ok = (dataSource.write == NULL);
+    }
+    float64 value = 3.5;
+    node.Publish(&value);
+    UA_DataValue dataValue;
+    UA_DataValue_init(&dataValue);
+    if (ok) {
+        UA_StatusCode code = dataSource.read(NULL, NULL, NULL, NULL, &node, true, NULL, &dataValue);
+        ok = (code == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (dataValue.hasValue);
+    }
+    if (ok) {
+        ok = (UA_Variant_hasScalarType(&dataValue.value, &UA_TYPES[UA_TYPES_DOUBLE]));
+    }
+    if (ok) {
+        ok = (*static_cast<UA_Double *>(dataValue.value.data) == 3.5);
+    }
+    if (ok) {
+        ok = (dataValue.hasSourceTimestamp);
+    }
+    UA_DataValue_deleteMembers(&dataValue);
+    if (ok) {
+        UA_NumericRange range;
+        UA_DataValue_init(&dataValue);
+        UA_StatusCode code = dataSource.read(NULL, NULL, NULL, NULL, &node, false, &range, &dataValue);
+        ok = (code == UA_STATUSCODE_BADINDEXRANGEINVALID);
+    }
+    return ok;
+}
+
+bool OPCUASignalNodeTest::TestGetUADataType() {
+    using namespace MARTe;
+    const TypeDescriptor types[] = { UnsignedInteger8Bit, UnsignedInteger16Bit, UnsignedInteger32Bit, UnsignedInteger64Bit, SignedInteger8Bit,
+            SignedInteger16Bit, SignedInteger32Bit, SignedInteger64Bit, Float32Bit, Float64Bit };
+    const UA_DataType *uaTypes[] = { &UA_TYPES[UA_TYPES_BYTE], &UA_TYPES[UA_TYPES_UINT16], &UA_TYPES[UA_TYPES_UINT32], &UA_TYPES[UA_TYPES_UINT64],
+            &UA_TYPES[UA_TYPES_SBYTE], &UA_TYPES[UA_TYPES_INT16], &UA_TYPES[UA_TYPES_INT32], &UA_TYPES[UA_TYPES_INT64], &UA_TYPES[UA_TYPES_FLOAT],
+            &UA_TYPES[UA_TYPES_DOUBLE] };
+    bool ok = true;
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        OPCUASignalNode node;
+        node.SetName("Node");
+        node.SetNodeType(types[i]);
+        ok = node.AllocateValue();
+        if (ok) {
+            ok = (node.GetUADataType() == uaTypes[i]);
+        }
+    }
+    return ok;
+}
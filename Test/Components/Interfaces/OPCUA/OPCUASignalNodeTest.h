@@ -0,0 +1,100 @@
+/**
+ * @file OPCUASignalNodeTest.h
+ * @brief Header file for class OPCUASignalNodeTest
+ * @date 18/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class OPCUASignalNodeTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_INTERFACES_OPCUA_OPCUASIGNALNODETEST_H_
+#define TEST_COMPONENTS_INTERFACES_OPCUA_OPCUASIGNALNODETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the OPCUASignalNode public methods.
+ */
+class OPCUASignalNodeTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the AllocateValue method with a scalar.
+     */
+    bool TestAllocateValue();
+
+    /**
+     * @brief Tests the AllocateValue method with an array.
+     */
+    bool TestAllocateValue_Array();
+
+    /**
+     * @brief Tests that the AllocateValue method fails with a type which is not supported.
+     */
+    bool TestAllocateValue_False_Type();
+
+    /**
+     * @brief Tests that the AllocateValue method fails if called twice.
+     */
+    bool TestAllocateValue_False_Twice();
+
+    /**
+     * @brief Tests the Publish method.
+     */
+    bool TestPublish();
+
+    /**
+     * @brief Tests the ReadValue method before any value is published.
+     */
+    bool TestReadValue_NoPublication();
+
+    /**
+     * @brief Tests that the ReadValue method always returns consistent arrays while another thread publishes.
+     */
+    bool TestReadValue_ConcurrentPublish();
+
+    /**
+     * @brief Tests the GetDataSource method, calling the read callback.
+     */
+    bool TestGetDataSource();
+
+    /**
+     * @brief Tests the GetUADataType method.
+     */
+    bool TestGetUADataType();
+};
+
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_INTERFACES_OPCUA_OPCUASIGNALNODETEST_H_ */
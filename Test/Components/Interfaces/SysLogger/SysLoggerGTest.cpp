@@ -64,4 +64,39 @@ TEST(SysLoggerGTest,TestConsumeLogMessage) {
     ASSERT_TRUE(test.TestConsumeLogMessage());
 }
 
+TEST(SysLoggerGTest,TestInitialise_Asynchronous) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_Asynchronous());
+}
+
+TEST(SysLoggerGTest,TestInitialise_False_Mode) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Mode());
+}
+
+TEST(SysLoggerGTest,TestInitialise_False_BatchSize) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BatchSize());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_Asynchronous) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Asynchronous());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_RateLimit) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_RateLimit());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_RingFull) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_RingFull());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_NoSocket) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_NoSocket());
+}
+
 	
@@ -24,20 +24,146 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
 #include "LoggerService.h"
+#include "MemoryOperationsHelper.h"
 #include "ReferenceT.h"
+#include "Sleep.h"
+#include "StringHelper.h"
 #include "SysLogger.h"
 #include "SysLoggerTest.h"
+#include "TypeConversion.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * Path of the socket where SysLoggerTestSink receives the messages.
+ */
+static const MARTe::char8 * const SYSLOGGER_TEST_SOCKET = "/tmp/MARTe2SysLoggerTest.sock";
+
+/**
+ * @brief Local datagram socket which replaces the syslog daemon.
+ */
+class SysLoggerTestSink {
+public:
+    SysLoggerTestSink() {
+        fd = -1;
+    }
+
+    ~SysLoggerTestSink() {
+        if (fd >= 0) {
+            close(fd);
+            unlink(SYSLOGGER_TEST_SOCKET);
+        }
+    }
+
+    bool Open() {
+        using namespace MARTe;
+        unlink(SYSLOGGER_TEST_SOCKET);
+        fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+        bool ok = (fd >= 0);
+        if (ok) {
+            struct sockaddr_un address;
+            MemoryOperationsHelper::Set(&address, '\0', sizeof(address));
+            address.sun_family = AF_UNIX;
+            StringHelper::CopyN(&address.sun_path[0], SYSLOGGER_TEST_SOCKET, sizeof(address.sun_path) - 1u);
+            ok = (bind(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) == 0);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Receives one message, waiting at most timeoutMSec.
+     */
+    bool Receive(MARTe::StreamString &message,
+                 const MARTe::int32 timeoutMSec) {
+        using namespace MARTe;
+        struct pollfd pollDescriptor;
+        pollDescriptor.fd = fd;
+        pollDescriptor.events = POLLIN;
+        pollDescriptor.revents = 0;
+        bool ok = (poll(&pollDescriptor, 1u, timeoutMSec) > 0);
+        if (ok) {
+            char8 buffer[2048];
+            ssize_t size = recv(fd, &buffer[0], sizeof(buffer), 0);
+            ok = (size > 0);
+            if (ok) {
+                message = "";
+                uint32 messageSize = static_cast<uint32>(size);
+                ok = message.Write(&buffer[0], messageSize);
+            }
+        }
+        return ok;
+    }
+
+private:
+    MARTe::int32 fd;
+};
+
+/**
+ * @brief Creates an asynchronous SysLogger which sends the messages to SYSLOGGER_TEST_SOCKET.
+ */
+static bool SysLoggerTestInitialiseAsynchronous(MARTe::SysLogger &logger,
+                                                MARTe::ConfigurationDatabase &cdb) {
+    using namespace MARTe;
+    cdb.Write("Format", "m");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("Mode", "Asynchronous");
+    cdb.Write("Socket", SYSLOGGER_TEST_SOCKET);
+    logger.SetName("SysLoggerTest");
+    return logger.Initialise(cdb);
+}
+
+/**
+ * @brief Sends one message directly to the consumer, as the LoggerService would.
+ */
+static void SysLoggerTestConsume(MARTe::SysLogger &logger,
+                                 const MARTe::ErrorManagement::ErrorType errorType,
+                                 const MARTe::char8 * const message) {
+    using namespace MARTe;
+    LoggerPage page;
+    MemoryOperationsHelper::Set(&page, '\0', sizeof(LoggerPage));
+    page.errorInfo.header.errorType = errorType;
+    StringHelper::CopyN(&page.errorStrBuffer[0], message, MAX_ERROR_MESSAGE_SIZE - 1u);
+    logger.ConsumeLogMessage(&page);
+}
+
+/**
+ * @brief Waits for the SysLogger thread to account for \a nOfMessages sent messages (which might already be in the sink).
+ */
+static bool SysLoggerTestWaitSent(MARTe::SysLogger &logger,
+                                  const MARTe::uint32 nOfMessages) {
+    using namespace MARTe;
+    for (uint32 n = 0u; (n < 100u) && (logger.GetNumberOfSentMessages() < nOfMessages); n++) {
+        Sleep::MSec(10);
+    }
+    return (logger.GetNumberOfSentMessages() == nOfMessages);
+}
+
+/**
+ * @brief Checks if the message ends with \a text.
+ */
+static bool SysLoggerTestEndsWith(MARTe::StreamString &message,
+                                  const MARTe::char8 * const text) {
+    using namespace MARTe;
+    uint32 textSize = StringHelper::Length(text);
+    bool ok = (message.Size() >= textSize);
+    if (ok) {
+        ok = (StringHelper::Compare(&message.Buffer()[message.Size() - textSize], text) == 0);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -109,3 +235,213 @@ bool SysLoggerTest::TestConsumeLogMessage() {
 
     return ok;
 }
+
+bool SysLoggerTest::TestInitialise_Asynchronous() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfRecords", 16);
+    cdb.Write("RecordSize", 512);
+    cdb.Write("BatchSize", 8);
+    cdb.Write("RateLimitBurst", 4);
+    bool ok = SysLoggerTestInitialiseAsynchronous(test, cdb);
+    if (ok) {
+        ok = (test.GetMode() == SysLoggerModeAsynchronous);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfRecords() == 16u);
+    }
+    if (ok) {
+        ok = (test.GetRecordSize() == 512u);
+    }
+    if (ok) {
+        ok = (test.GetBatchSize() == 8u);
+    }
+    if (ok) {
+        ok = (test.GetRateLimitBurst() == 4u);
+    }
+    return ok;
+}
+
+bool SysLoggerTest::TestInitialise_False_Mode() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("Mode", "Batch");
+    return !test.Initialise(cdb);
+}
+
+bool SysLoggerTest::TestInitialise_False_BatchSize() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfRecords", 4);
+    cdb.Write("BatchSize", 8);
+    return !SysLoggerTestInitialiseAsynchronous(test, cdb);
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_Asynchronous() {
+    using namespace MARTe;
+    SysLoggerTestSink sink;
+    bool ok = sink.Open();
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = SysLoggerTestInitialiseAsynchronous(test, cdb);
+    }
+    const uint32 nOfMessages = 10u;
+    if (ok) {
+        for (uint32 i = 0u; i < nOfMessages; i++) {
+            SysLoggerTestConsume(test, ErrorManagement::Warning, "TestConsumeLogMessage_Asynchronous");
+        }
+        SysLoggerTestConsume(test, ErrorManagement::FatalError, "TestConsumeLogMessage_Asynchronous");
+    }
+    //<PRI>Mmm dd hh:mm:ss ident[pid]: message, PRI = LOG_USER | LOG_WARNING = 12 and LOG_USER | LOG_CRIT = 10
+    for (uint32 i = 0u; (i < (nOfMessages + 1u)) && (ok); i++) {
+        StreamString message;
+        ok = sink.Receive(message, 1000);
+        if (ok) {
+            const char8 * const expectedPriority = (i < nOfMessages) ? "<12>" : "<10>";
+            ok = (StringHelper::CompareN(message.Buffer(), expectedPriority, 4u) == 0);
+        }
+        if (ok) {
+            ok = (StringHelper::SearchString(message.Buffer(), " MARTe2SysLoggerTest[") != NULL);
+        }
+        if (ok) {
+            ok = SysLoggerTestEndsWith(message, "]: TestConsumeLogMessage_Asynchronous");
+        }
+    }
+    if (ok) {
+        ok = SysLoggerTestWaitSent(test, nOfMessages + 1u);
+    }
+    if (ok) {
+        ok = ((test.GetNumberOfDroppedMessages() == 0u) && (test.GetNumberOfSuppressedMessages() == 0u) && (test.GetNumberOfFailedMessages() == 0u));
+    }
+    return ok;
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_RateLimit() {
+    using namespace MARTe;
+    SysLoggerTestSink sink;
+    bool ok = sink.Open();
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("RateLimitBurst", 5);
+    cdb.Write("RateLimitPeriod", 100);
+    if (ok) {
+        ok = SysLoggerTestInitialiseAsynchronous(test, cdb);
+    }
+    if (ok) {
+        for (uint32 i = 0u; i < 20u; i++) {
+            SysLoggerTestConsume(test, ErrorManagement::Warning, "TestConsumeLogMessage_RateLimit");
+        }
+        //The limit is per message type
+        for (uint32 i = 0u; i < 3u; i++) {
+            SysLoggerTestConsume(test, ErrorManagement::Information, "TestConsumeLogMessage_RateLimit");
+        }
+        ok = (test.GetNumberOfSuppressedMessages() == 15u);
+    }
+    uint32 nOfMessages = 0u;
+    bool summaryReceived = false;
+    while ((ok) && (!summaryReceived)) {
+        StreamString message;
+        ok = sink.Receive(message, 1000);
+        if (ok) {
+            summaryReceived = SysLoggerTestEndsWith(message, "]: 15 Warning messages suppressed");
+            if (summaryReceived) {
+                ok = (StringHelper::CompareN(message.Buffer(), "<12>", 4u) == 0);
+            }
+            else {
+                ok = SysLoggerTestEndsWith(message, "]: TestConsumeLogMessage_RateLimit");
+                nOfMessages++;
+            }
+        }
+    }
+    if (ok) {
+        ok = (nOfMessages == 8u);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfSentMessages() == 8u);
+    }
+    return ok;
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_RingFull() {
+    using namespace MARTe;
+    SysLoggerTestSink sink;
+    bool ok = sink.Open();
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfRecords", 4);
+    cdb.Write("BatchSize", 4);
+    cdb.Write("RateLimitPeriod", 100);
+    if (ok) {
+        ok = SysLoggerTestInitialiseAsynchronous(test, cdb);
+    }
+    const uint32 nOfMessages = 1000u;
+    if (ok) {
+        for (uint32 i = 0u; i < nOfMessages; i++) {
+            SysLoggerTestConsume(test, ErrorManagement::Warning, "TestConsumeLogMessage_RingFull");
+        }
+        ok = (test.GetNumberOfDroppedMessages() > 0u);
+    }
+    //Drain the sink until all the messages were either sent or reported as dropped
+    uint32 nOfReceived = 0u;
+    uint32 nOfReportedDropped = 0u;
+    while ((ok) && ((nOfReceived + nOfReportedDropped) < nOfMessages)) {
+        StreamString message;
+        ok = sink.Receive(message, 1000);
+        if (ok) {
+            if (SysLoggerTestEndsWith(message, " messages dropped (the SysLogger ring was full)")) {
+                const char8 *summary = StringHelper::SearchString(message.Buffer(), "]: ");
+                ok = (summary != NULL);
+                if (ok) {
+                    StreamString nOfDroppedStr = &summary[3];
+                    uint32 nOfDropped = 0u;
+                    //The number is followed by " messages..."
+                    nOfDroppedStr.SetSize(static_cast<uint64>(StringHelper::SearchIndex(nOfDroppedStr.Buffer(), " ")));
+                    ok = TypeConvert(nOfDropped, nOfDroppedStr);
+                    nOfReportedDropped += nOfDropped;
+                }
+            }
+            else {
+                nOfReceived++;
+            }
+        }
+    }
+    if (ok) {
+        ok = ((nOfReceived + nOfReportedDropped) == nOfMessages);
+    }
+    if (ok) {
+        ok = (nOfReportedDropped == test.GetNumberOfDroppedMessages());
+    }
+    if (ok) {
+        ok = SysLoggerTestWaitSent(test, nOfReceived);
+    }
+    return ok;
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_NoSocket() {
+    using namespace MARTe;
+    unlink(SYSLOGGER_TEST_SOCKET);
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    bool ok = SysLoggerTestInitialiseAsynchronous(test, cdb);
+    if (ok) {
+        for (uint32 i = 0u; i < 10u; i++) {
+            SysLoggerTestConsume(test, ErrorManagement::Warning, "TestConsumeLogMessage_NoSocket");
+        }
+    }
+    for (uint32 n = 0u; (n < 100u) && (ok) && (test.GetNumberOfFailedMessages() < 10u); n++) {
+        Sleep::MSec(10);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfFailedMessages() == 10u);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfSentMessages() == 0u);
+    }
+    return ok;
+}
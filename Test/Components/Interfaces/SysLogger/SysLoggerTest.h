@@ -65,6 +65,41 @@ public:
      * @brief Tests the ConsumeLogMessage method .
      */
     bool TestConsumeLogMessage();
+
+    /**
+     * @brief Tests the Initialise method with Mode = Asynchronous.
+     */
+    bool TestInitialise_Asynchronous();
+
+    /**
+     * @brief Tests the Initialise method with an invalid Mode.
+     */
+    bool TestInitialise_False_Mode();
+
+    /**
+     * @brief Tests the Initialise method with a BatchSize greater than the NumberOfRecords.
+     */
+    bool TestInitialise_False_BatchSize();
+
+    /**
+     * @brief Tests the ConsumeLogMessage method with Mode = Asynchronous, receiving the messages from a local socket.
+     */
+    bool TestConsumeLogMessage_Asynchronous();
+
+    /**
+     * @brief Tests that the messages above the RateLimitBurst are suppressed and reported in a summary.
+     */
+    bool TestConsumeLogMessage_RateLimit();
+
+    /**
+     * @brief Tests that the messages which do not fit in the ring are dropped and reported in a summary.
+     */
+    bool TestConsumeLogMessage_RingFull();
+
+    /**
+     * @brief Tests that the messages are counted as failed if nobody is listening on the Socket.
+     */
+    bool TestConsumeLogMessage_NoSocket();
 };
 
 /*---------------------------------------------------------------------------*/